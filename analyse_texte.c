@@ -0,0 +1,651 @@
+#include "analyse_texte.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "normalisation.h"
+#include "sortie_texte.h"
+
+#define TAILLE_TAMPON_NORMALISATION 512 // Caractères du tampon de normalisation sur la pile (mots jusqu'à 127)
+
+/**
+ * Retourne le temps écoulé depuis un instant
+ *
+ * @param debut Instant relevé avec clock_gettime(CLOCK_MONOTONIC)
+ * @return Secondes écoulées
+ */
+static double secondesDepuis(const struct timespec* debut) {
+    struct timespec fin;
+    clock_gettime(CLOCK_MONOTONIC, &fin);
+    return (double)(fin.tv_sec - debut->tv_sec) + (fin.tv_nsec - debut->tv_nsec) / 1e9;
+}
+
+/**
+ * Initialise une structure AnalyseTexte avec des valeurs par défaut
+ * Met à zéro tous les compteurs et initialise la table de hachage ; les n-grammes sont comptés
+ *
+ * @param analyse Pointeur vers la structure à initialiser
+ */
+void initialiserAnalyse(AnalyseTexte* analyse) {
+    // Remplit toute la structure AnalyseTexte avec des zéros (initialisation complète)
+    memset(analyse, 0, sizeof(AnalyseTexte));
+    // Table de hachage vide (aucun mot n'est encore stocké)
+    initialiserTableMots(&analyse->vocabulaire);
+    initialiserNgrammes(&analyse->ngrammes);
+    analyse->compter_ngrammes = 1;
+    // Initialisation pour la phrase la plus courte
+    analyse->longueur_plus_courte = LLONG_MAX;
+}
+
+/**
+ * Remet à zéro une analyse pour l'appliquer à un autre fichier
+ * Les tables des mots et des n-grammes (ou les esquisses du mode approché) sont vidées sans libérer leur mémoire :
+ * elle sert à l'analyse suivante. Le mode de l'analyse et l'usage du cache sont conservés
+ *
+ * @param analyse Pointeur vers une analyse déjà initialisée
+ */
+void reinitialiserAnalyse(AnalyseTexte* analyse) {
+    TableMots vocabulaire = analyse->vocabulaire;
+    Ngrammes ngrammes = analyse->ngrammes;
+    int compter_ngrammes = analyse->compter_ngrammes;
+    EsquissesMots* esquisses = analyse->esquisses;
+    int sans_cache = analyse->sans_cache;
+    free(analyse->phrase_plus_longue);
+    free(analyse->phrase_plus_courte);
+    initialiserAnalyse(analyse);
+    viderTableMots(&vocabulaire);
+    viderNgrammes(&ngrammes);
+    if (esquisses) viderEsquissesMots(esquisses);
+    analyse->vocabulaire = vocabulaire;
+    analyse->ngrammes = ngrammes;
+    analyse->compter_ngrammes = compter_ngrammes;
+    analyse->esquisses = esquisses;
+    analyse->sans_cache = sans_cache;
+}
+
+/**
+ * Choisit le mode d'une analyse vide
+ * En mode approché, les mots ne passent que dans des esquisses de taille fixe (HyperLogLog pour les mots, verbes et
+ * noms propres distincts, résumé Space-Saving pour les mots les plus fréquents) : la mémoire ne dépend plus de la
+ * taille du texte, mais les métriques du vocabulaire sont estimées et les listes complètes de mots n'existent pas
+ * Les n-grammes ont besoin des indices du vocabulaire : ils ne sont pas comptés en mode approché
+ *
+ * @param analyse Pointeur vers une analyse initialisée et vide
+ * @param approche 1 pour le mode approché, 0 pour le vocabulaire exact
+ * @return 0 en cas de succès, -1 si la mémoire manque pour les esquisses (errno vaut alors ENOMEM)
+ */
+int choisirModeAnalyse(AnalyseTexte* analyse, int approche) {
+    if (approche && !analyse->esquisses) {
+        analyse->esquisses = creerEsquissesMots();
+        if (!analyse->esquisses) {
+            errno = ENOMEM;
+            return -1;
+        }
+    } else if (!approche && analyse->esquisses) {
+        detruireEsquissesMots(analyse->esquisses);
+        analyse->esquisses = NULL;
+    }
+    analyse->compter_ngrammes = !approche;
+    return 0;
+}
+
+/**
+ * Libère la mémoire allouée pour une analyse de texte
+ * Libère les cases et les mots de la table de hachage, les n-grammes, les esquisses et le texte des phrases extrêmes
+ *
+ * @param analyse Pointeur vers la structure à libérer
+ */
+void libererAnalyse(AnalyseTexte* analyse) {
+    libererTableMots(&analyse->vocabulaire);
+    libererNgrammes(&analyse->ngrammes);
+    detruireEsquissesMots(analyse->esquisses);
+    analyse->esquisses = NULL;
+    free(analyse->phrase_plus_longue);
+    free(analyse->phrase_plus_courte);
+    analyse->phrase_plus_longue = NULL;
+    analyse->phrase_plus_courte = NULL;
+}
+
+/**
+ * Calcule la complexité globale du texte basée sur plusieurs métriques
+ * Combine la longueur des phrases, diversité lexicale, proportion de verbes et autres facteurs
+ *
+ * @param analyse Pointeur vers la structure contenant les données d'analyse
+ * @return Score de complexité (plus le score est élevé, plus le texte est complexe)
+ */
+double calculerComplexiteTexte(const AnalyseTexte* analyse) {
+    return (
+        0.3 * analyse->longueur_phrase_moyenne + // Pondère la longueur moyenne des phrases
+        0.2 * analyse->diversite_lexicale * 100 + // Pondère la diversité lexicale (en pourcentage)
+        0.2 * ((double)analyse->nb_verbes / analyse->nb_mots_total) * 100 + // Pondère le ratio de verbes
+        0.15 * ((double)analyse->nb_mots_uniques / analyse->nb_mots_total) * 100 + // Pondère la diversité des mots uniques
+        0.15 * analyse->longueur_mot_moyenne // Pondère la longueur moyenne des mots
+    );
+}
+
+/**
+ * Ajoute ou met à jour un mot dans la table de hachage
+ * Crée une nouvelle entrée si le mot n'existe pas, sinon incrémente sa fréquence
+ * Le mot prolonge aussi la fenêtre des n-grammes, qui ne retient que son indice dans le vocabulaire
+ * En mode approché, le mot ne fait que passer dans les esquisses
+ *
+ * @param analyse Pointeur vers la structure d'analyse
+ * @param mot Mot à ajouter ou mettre à jour (normalisé)
+ * @param attributs_texte Attributs tirés du texte avant normalisation (ATTRIBUT_NOM_PROPRE si le mot commençait par
+ *                        une majuscule)
+ * @return 0 en cas de succès, -1 si la mémoire manque (errno vaut alors ENOMEM)
+ */
+int ajouterMot(AnalyseTexte* analyse, const wchar_t* mot, uint16_t attributs_texte) {
+    if (analyse->esquisses) {
+        if (compterMotEsquisses(analyse->esquisses, mot, wcslen(mot), attributs_texte) != 0) {
+            errno = ENOMEM;
+            return -1;
+        }
+        return 0;
+    }
+    // Recherche le mot dans la table de hachage, et l'y ajoute s'il n'existe pas encore
+    int nouveau;
+    Mot* entree = insererMot(&analyse->vocabulaire, mot, attributs_texte, &nouveau);
+    if (!entree) { // Vérifie si l'allocation mémoire a échoué
+        errno = ENOMEM;
+        return -1;
+    }
+    entree->frequence++; // Incrémente sa fréquence
+    if (analyse->compter_ngrammes &&
+        compterMotNgrammes(&analyse->ngrammes, (uint32_t)(entree - analyse->vocabulaire.mots)) != 0) {
+        errno = ENOMEM;
+        return -1;
+    }
+    if (!nouveau) {
+        return 0;
+    }
+
+    analyse->nb_mots_uniques++; // Incrémente le compteur de mots uniques
+
+    // Met à jour les statistiques si le mot est un verbe ou un nom propre (attributs calculés par la table)
+    if (aAttribut(entree, ATTRIBUT_VERBE)) analyse->nb_verbes++;
+    if (aAttribut(entree, ATTRIBUT_NOM_PROPRE)) analyse->nb_noms_propres++;
+    return 0;
+}
+
+/**
+ * Fusionne le vocabulaire et les n-grammes d'une analyse dans une autre
+ * Les fréquences des mots déjà connus sont additionnées, les autres mots sont ajoutés dans leur ordre d'origine
+ * (comme si les mots de la source avaient été ajoutés après ceux de la destination) ; les n-grammes de la source
+ * sont traduits avec les indices des mots dans la destination, et ceux qui chevauchent la jonction sont comptés
+ * En mode approché, ce sont les esquisses qui sont fusionnées
+ *
+ * @param destination Analyse qui reçoit les mots
+ * @param source Analyse portant sur la suite du texte (ses tables de hachage sont vidées)
+ * @return 0 en cas de succès, -1 si la mémoire manque (errno vaut alors ENOMEM ; la destination est incomplète)
+ */
+int fusionnerVocabulaire(AnalyseTexte* destination, AnalyseTexte* source) {
+    if (source->esquisses) {
+        if (fusionnerEsquissesMots(destination->esquisses, source->esquisses) != 0) {
+            errno = ENOMEM;
+            return -1;
+        }
+        return 0;
+    }
+    // Indice dans la destination de chaque mot de la source, pour traduire les n-grammes de la source
+    uint32_t* correspondance = NULL;
+    if (source->compter_ngrammes) {
+        correspondance = (uint32_t*)malloc((source->vocabulaire.nb_mots + 1) * sizeof(uint32_t));
+        if (!correspondance) {
+            errno = ENOMEM;
+            return -1;
+        }
+    }
+    for (size_t i = 0; i < source->vocabulaire.nb_mots; i++) {
+        const Mot* mot = &source->vocabulaire.mots[i];
+        int nouveau;
+        Mot* entree = insererMot(&destination->vocabulaire, texteMot(&source->vocabulaire, mot),
+                                 mot->attributs & ATTRIBUTS_TEXTE, &nouveau);
+        if (!entree) {
+            free(correspondance);
+            errno = ENOMEM;
+            return -1;
+        }
+        entree->frequence += mot->frequence;
+        if (correspondance) {
+            correspondance[i] = (uint32_t)(entree - destination->vocabulaire.mots);
+        }
+        if (nouveau) {
+            destination->nb_mots_uniques++;
+            if (aAttribut(entree, ATTRIBUT_VERBE)) destination->nb_verbes++;
+            if (aAttribut(entree, ATTRIBUT_NOM_PROPRE)) destination->nb_noms_propres++;
+        }
+    }
+    if (correspondance) {
+        int resultat = fusionnerNgrammes(&destination->ngrammes, &source->ngrammes, correspondance);
+        free(correspondance);
+        if (resultat != 0) {
+            errno = ENOMEM;
+            return -1;
+        }
+    }
+    libererTableMots(&source->vocabulaire);
+    source->nb_mots_uniques = 0;
+    source->nb_verbes = 0;
+    source->nb_noms_propres = 0;
+    return 0;
+}
+
+/**
+ * Reçoit un mot trouvé par le tokeniseur, le normalise et l'ajoute à la table de hachage
+ * Une insertion sur PERIODE_MESURE_INSERTIONS est chronométrée et compte pour toute la période
+ * Après une erreur, les mots suivants sont ignorés : terminerLecture signale l'erreur
+ *
+ * @param contexte Pointeur vers la structure d'analyse
+ * @param mot_lu Mot trouvé par le tokeniseur
+ */
+static void traiterMot(void* contexte, wchar_t* mot_lu) {
+    AnalyseTexte* analyse = (AnalyseTexte*)contexte;
+    if (analyse->erreur) {
+        return;
+    }
+    // La forme NFC peut être plus longue que le mot lu : tampon sur la pile, sauf pour les mots très longs
+    wchar_t tampon[TAILLE_TAMPON_NORMALISATION];
+    wchar_t* mot = tampon;
+    size_t longueur = wcslen(mot_lu);
+    if (longueur > (TAILLE_TAMPON_NORMALISATION - 1) / EXPANSION_NORMALISATION_MAX &&
+        (mot = malloc((longueur * EXPANSION_NORMALISATION_MAX + 1) * sizeof(wchar_t))) == NULL) {
+        analyse->erreur = ENOMEM;
+        return;
+    }
+    // La majuscule initiale (nom propre) disparaît avec le repli des casses : elle est relevée avant
+    uint16_t attributs_texte = longueur > 0 && estMajuscule(mot_lu[0]) ? 1u << ATTRIBUT_NOM_PROPRE : 0;
+    normaliserMot(mot_lu, longueur, mot);
+    int resultat;
+#if PERIODE_MESURE_INSERTIONS > 0
+    if (++analyse->durees.insertions % PERIODE_MESURE_INSERTIONS == 0) {
+        struct timespec debut;
+        clock_gettime(CLOCK_MONOTONIC, &debut);
+        resultat = ajouterMot(analyse, mot, attributs_texte);
+        analyse->durees.insertion += secondesDepuis(&debut) * PERIODE_MESURE_INSERTIONS;
+    } else {
+        resultat = ajouterMot(analyse, mot, attributs_texte);
+    }
+#else
+    resultat = ajouterMot(analyse, mot, attributs_texte);
+#endif
+    if (resultat != 0) {
+        analyse->erreur = errno;
+    }
+    if (mot != tampon) {
+        free(mot);
+    }
+}
+
+/**
+ * Crée l'analyse qui reçoit les mots d'une tranche du fichier (analyse parallèle)
+ *
+ * @param principal Analyse principale, qui donne le mode de la tranche (exact ou approché) et les options des
+ *                  n-grammes
+ * @return Nouvelle analyse vide, ou NULL si la mémoire manque
+ */
+static void* creerAnalyseTranche(void* principal) {
+    const AnalyseTexte* options = (const AnalyseTexte*)principal;
+    AnalyseTexte* analyse = (AnalyseTexte*)malloc(sizeof(AnalyseTexte));
+    if (!analyse) {
+        return NULL;
+    }
+    initialiserAnalyse(analyse);
+    if (choisirModeAnalyse(analyse, options->esquisses != NULL) != 0) {
+        libererAnalyse(analyse);
+        free(analyse);
+        return NULL;
+    }
+    analyse->compter_ngrammes = options->compter_ngrammes;
+    configurerNgrammes(&analyse->ngrammes, options->ngrammes.tables[0].mode, options->ngrammes.tables[0].budget);
+    return analyse;
+}
+
+/**
+ * Libère l'analyse d'une tranche
+ *
+ * @param tranche Analyse créée par creerAnalyseTranche
+ */
+static void libererAnalyseTranche(void* tranche) {
+    libererAnalyse((AnalyseTexte*)tranche);
+    free(tranche);
+}
+
+/**
+ * Fusionne le vocabulaire d'une tranche dans celui de la tranche précédente, puis libère la tranche
+ * Les durées mesurées dans la tranche s'ajoutent à celles de la tranche précédente, et une erreur de l'une des deux
+ * reste attachée à la tranche précédente (la fusion est alors sautée)
+ *
+ * @param destination Analyse de la tranche précédente
+ * @param tranche Analyse de la tranche suivante
+ */
+static void fusionnerAnalyseTranche(void* destination, void* tranche) {
+    AnalyseTexte* precedente = (AnalyseTexte*)destination;
+    AnalyseTexte* suivante = (AnalyseTexte*)tranche;
+    if (!precedente->erreur) {
+        precedente->erreur = suivante->erreur;
+    }
+    if (!precedente->erreur) {
+        struct timespec debut;
+        clock_gettime(CLOCK_MONOTONIC, &debut);
+        if (fusionnerVocabulaire(precedente, suivante) != 0) {
+            precedente->erreur = errno;
+        }
+        precedente->durees.fusion += secondesDepuis(&debut);
+    }
+    precedente->durees.fusion += suivante->durees.fusion;
+    precedente->durees.insertion += suivante->durees.insertion;
+    precedente->durees.insertions += suivante->durees.insertions;
+    libererAnalyseTranche(tranche);
+}
+
+static const OperationsTranches operations_tranches = {
+    creerAnalyseTranche, fusionnerAnalyseTranche, libererAnalyseTranche
+};
+
+/**
+ * Retourne la variante des instantanés du cache d'une analyse
+ * Les analyses sans n-grammes (analyse par lots) ont leurs propres instantanés
+ *
+ * @param analyse Pointeur vers la structure d'analyse
+ * @return Variante passée au cache
+ */
+static int varianteCache(const AnalyseTexte* analyse) {
+    return analyse->compter_ngrammes ? 1 : 2;
+}
+
+/**
+ * Prépare la lecture d'un fichier
+ * L'état enregistré dans le cache est repris si le fichier est inchangé ou seulement complété, puis le fichier est
+ * ouvert là où la lecture doit continuer. Le cache garde un vocabulaire exact : une analyse approchée relit toujours
+ * le fichier, comme une analyse sans cache (sans_cache), qui n'enregistre pas non plus d'instantané
+ *
+ * @param chemin Chemin du fichier à analyser
+ * @param analyse Analyse vide qui recevra les résultats
+ * @param lecture Lecture à préparer (ni copiée ni déplacée jusqu'à terminerLecture)
+ * @param suivi Progression et annulation de la lecture (NULL si non suivie)
+ * @return 0 en cas de succès (lecture->cache vaut CACHE_A_JOUR si le fichier n'a pas à être lu), -1 si le fichier
+ *         ne peut pas être lu (errno donne la cause)
+ */
+int commencerLecture(const char* chemin, AnalyseTexte* analyse, LectureFichier* lecture, SuiviLecture* suivi) {
+    clock_gettime(CLOCK_MONOTONIC, &lecture->debut);
+    initialiserTokeniseur(&lecture->tokeniseur, traiterMot, analyse);
+    lecture->tokeniseur.suivi = suivi;
+    memset(&lecture->reprise, 0, sizeof(RepriseAnalyse));
+    analyse->erreur = 0;
+    lecture->identifie = !analyse->esquisses && !analyse->sans_cache && identifierFichier(chemin, &lecture->identite) == 0;
+    lecture->cache = CACHE_ABSENT;
+    if (lecture->identifie) {
+        lecture->cache = chargerAnalyseCache(&lecture->identite, varianteCache(analyse), &lecture->reprise,
+                                             &analyse->vocabulaire,
+                                             analyse->compter_ngrammes ? &analyse->ngrammes : NULL,
+                                             &lecture->tokeniseur);
+    }
+    analyse->nb_mots_uniques = lecture->reprise.nb_mots_uniques;
+    analyse->nb_verbes = lecture->reprise.nb_verbes;
+    analyse->nb_noms_propres = lecture->reprise.nb_noms_propres;
+    lecture->taille = lecture->identite.taille;
+    if (lecture->cache == CACHE_A_JOUR) {
+        if (suivi != NULL) {
+            atomic_store(&suivi->octets_total, lecture->taille);
+            atomic_store(&suivi->octets_traites, lecture->taille);
+        }
+        analyse->durees.ouverture = secondesDepuis(&lecture->debut);
+        clock_gettime(CLOCK_MONOTONIC, &lecture->debut);
+        return 0;
+    }
+
+    if (ouvrirSource(&lecture->source, chemin) != 0) {
+        int erreur = errno;
+        libererTokeniseur(&lecture->tokeniseur);
+        errno = erreur;
+        return -1;
+    }
+    if (positionnerSource(&lecture->source, lecture->reprise.octets_lus) != 0) {
+        int erreur = errno;
+        fermerSource(&lecture->source);
+        libererTokeniseur(&lecture->tokeniseur);
+        errno = erreur;
+        return -1;
+    }
+    lecture->taille = tailleSource(&lecture->source);
+    if (suivi != NULL) {
+        atomic_store(&suivi->octets_total, lecture->taille);
+        atomic_store(&suivi->octets_traites, lecture->reprise.octets_lus);
+    }
+    analyse->durees.ouverture = secondesDepuis(&lecture->debut);
+    clock_gettime(CLOCK_MONOTONIC, &lecture->debut);
+    return 0;
+}
+
+/**
+ * Coupe le fichier d'une lecture en tranches que l'appelant répartit lui-même entre ses threads
+ * (voir decouperSource : les tranches sont lues avec tokeniserTranche, puis assemblées avec assemblerTranches)
+ *
+ * @param lecture Lecture préparée par commencerLecture (le fichier doit être lu : cache différent de CACHE_A_JOUR)
+ * @param nb_tranches Nombre de tranches souhaité
+ * @return Découpage à lire puis assembler, ou NULL si le fichier doit être lu en série (avec tokeniserSource)
+ */
+DecoupageSource* decouperLecture(LectureFichier* lecture, int nb_tranches) {
+    return decouperSource(&lecture->tokeniseur, &lecture->source, nb_tranches, &operations_tranches);
+}
+
+/**
+ * Termine la lecture d'un fichier et calcule les métriques
+ * L'état de la lecture est enregistré dans le cache avant d'être terminé, pour pouvoir la reprendre si le fichier
+ * grandit (l'identité relevée avant la lecture doit décrire exactement les octets lus) ; puis le dernier mot et la
+ * dernière phrase sont comptés. Une lecture annulée ou interrompue par une erreur n'est pas enregistrée
+ *
+ * @param analyse Analyse passée à commencerLecture
+ * @param lecture Lecture dont tout le fichier a été découpé (ou à jour dans le cache) ; elle est libérée
+ * @return 0 en cas de succès, -1 en cas d'erreur ou d'annulation (errno vaut alors ENOMEM ou ECANCELED ; l'analyse
+ *         est incomplète et doit être réinitialisée)
+ */
+int terminerLecture(AnalyseTexte* analyse, LectureFichier* lecture) {
+    analyse->durees.lecture = secondesDepuis(&lecture->debut);
+    clock_gettime(CLOCK_MONOTONIC, &lecture->debut);
+    Tokeniseur* tokeniseur = &lecture->tokeniseur;
+    int annule = tokeniseur->suivi != NULL && atomic_load(&tokeniseur->suivi->annulation);
+    if (lecture->cache != CACHE_A_JOUR) {
+        if (!annule && !analyse->erreur && lecture->identifie &&
+            tailleSource(&lecture->source) == lecture->identite.taille) {
+            lecture->reprise.octets_lus = positionSource(&lecture->source);
+            lecture->reprise.nb_mots_uniques = analyse->nb_mots_uniques;
+            lecture->reprise.nb_verbes = analyse->nb_verbes;
+            lecture->reprise.nb_noms_propres = analyse->nb_noms_propres;
+            enregistrerAnalyseCache(&lecture->identite, varianteCache(analyse), &lecture->reprise,
+                                    &analyse->vocabulaire, analyse->compter_ngrammes ? &analyse->ngrammes : NULL,
+                                    tokeniseur);
+        }
+        fermerSource(&lecture->source);
+    }
+    if (annule || analyse->erreur) {
+        libererTokeniseur(tokeniseur);
+        errno = analyse->erreur ? analyse->erreur : ECANCELED;
+        return -1;
+    }
+    terminerTokeniseur(tokeniseur, 1);
+
+    // Report des compteurs du tokeniseur dans l'analyse
+    analyse->nb_espaces = tokeniseur->nb_espaces;
+    analyse->nb_chars_sans_espaces = tokeniseur->nb_chars_sans_espaces;
+    analyse->nb_lignes = tokeniseur->nb_lignes;
+    analyse->nb_caracteres = tokeniseur->nb_caracteres;
+    analyse->nb_mots_total = tokeniseur->nb_mots_total;
+    analyse->nb_phrases = tokeniseur->nb_phrases;
+    analyse->nb_paragraphes = tokeniseur->nb_paragraphes;
+    analyse->longueur_phrase_moyenne = tokeniseur->somme_mots_phrases;
+    analyse->longueur_plus_longue = tokeniseur->phrase_plus_longue.longueur;
+    analyse->longueur_plus_courte = tokeniseur->phrase_plus_courte.longueur;
+    analyse->phrase_plus_longue = detacherPhrase(&tokeniseur->phrase_plus_longue);
+    analyse->phrase_plus_courte = detacherPhrase(&tokeniseur->phrase_plus_courte);
+    libererTokeniseur(tokeniseur);
+    if (analyse->erreur) { // Le dernier mot n'a pas pu être ajouté
+        errno = analyse->erreur;
+        return -1;
+    }
+
+    // Calcul des moyennes et métriques finales
+    if (analyse->nb_phrases > 0) {
+        analyse->longueur_phrase_moyenne /= analyse->nb_phrases;
+    }
+
+    // Mode approché : les mots, verbes et noms propres distincts sont estimés par les HyperLogLog
+    if (analyse->esquisses) {
+        analyse->nb_mots_uniques = llround(estimerDistincts(&analyse->esquisses->mots));
+        analyse->nb_verbes = llround(estimerDistincts(&analyse->esquisses->verbes));
+        analyse->nb_noms_propres = llround(estimerDistincts(&analyse->esquisses->noms_propres));
+    }
+    analyse->diversite_lexicale = (double)analyse->nb_mots_uniques / analyse->nb_mots_total;
+    analyse->complexite_texte = calculerComplexiteTexte(analyse);
+    analyse->durees.finalisation = secondesDepuis(&lecture->debut);
+    return 0;
+}
+
+/**
+ * Analyse un fichier texte et remplit une structure AnalyseTexte avec diverses statistiques
+ * Compte les caractères, mots, phrases, et calcule différentes métriques ; les gros fichiers sont coupés en tranches
+ * lues en parallèle. Peut être appelée depuis n'importe quel thread, pour des analyses différentes en même temps
+ * Un fichier déjà analysé n'est pas relu : le cache rend l'état de la lecture à la fin de l'analyse précédente,
+ * et seuls les octets ajoutés depuis sont lus (un fichier tronqué ou réécrit est relu entièrement)
+ *
+ * @param chemin Chemin du fichier à analyser
+ * @param analyse Pointeur vers la structure qui contiendra les résultats
+ * @param suivi Progression et annulation de la lecture (NULL si non suivie)
+ * @return 0 en cas de succès, -1 en cas d'erreur ou d'annulation (errno donne la cause, ECANCELED pour une
+ *         annulation)
+ */
+int analyserFichier(const char* chemin, AnalyseTexte* analyse, SuiviLecture* suivi) {
+    LectureFichier lecture;
+    if (commencerLecture(chemin, analyse, &lecture, suivi) != 0) {
+        return -1;
+    }
+    // Découpage du texte en mots, phrases et paragraphes (par tranches en parallèle pour les gros fichiers)
+    if (lecture.cache != CACHE_A_JOUR) {
+        tokeniserSourceParallele(&lecture.tokeniseur, &lecture.source, 0, &operations_tranches);
+    }
+    return terminerLecture(analyse, &lecture);
+}
+
+// Rapport en cours de rédaction dans un tampon fourni par l'appelant (tronqué s'il est trop petit)
+typedef struct {
+    char* tampon;
+    size_t taille;
+    size_t longueur;            // Longueur du rapport complet, même au-delà du tampon
+} Redaction;
+
+/**
+ * Ajoute du texte formaté au rapport
+ *
+ * @param redaction Rapport en cours
+ * @param format Format de printf, suivi de ses arguments
+ */
+static void __attribute__((format(printf, 2, 3))) rediger(Redaction* redaction, const char* format, ...) {
+    size_t reste = redaction->longueur < redaction->taille ? redaction->taille - redaction->longueur : 0;
+    va_list arguments;
+    va_start(arguments, format);
+    int n = vsnprintf(reste > 0 ? redaction->tampon + redaction->longueur : NULL, reste, format, arguments);
+    va_end(arguments);
+    if (n > 0) {
+        redaction->longueur += (size_t)n;
+    }
+}
+
+/**
+ * Ajoute un texte en caractères larges au rapport, encodé en UTF-8 quelle que soit la locale
+ *
+ * @param redaction Rapport en cours
+ * @param texte Texte à ajouter (NULL : rien n'est ajouté)
+ */
+static void redigerTexteLarge(Redaction* redaction, const wchar_t* texte) {
+    if (texte == NULL) {
+        return;
+    }
+    size_t reste = redaction->longueur < redaction->taille ? redaction->taille - redaction->longueur : 0;
+    char vide[1];
+    char* destination = reste > 0 ? redaction->tampon + redaction->longueur : vide;
+    redaction->longueur += encoderUtf8(texte, wcslen(texte), destination, reste > 0 ? reste : sizeof(vide));
+}
+
+/**
+ * Rédige le rapport détaillé des statistiques d'analyse : caractères, structure et phrases extrêmes
+ * Comme snprintf, le rapport est tronqué s'il ne tient pas dans le tampon, et sa longueur complète est retournée
+ * (un premier appel avec un tampon NULL de taille 0 donne la taille à allouer, octet nul non compris)
+ *
+ * @param analyse Analyse terminée
+ * @param tampon Destination du rapport en UTF-8, terminé par un octet nul si taille > 0
+ * @param taille Taille du tampon en octets
+ * @return Longueur du rapport complet, sans l'octet nul
+ */
+size_t formaterStatistiquesDetaillees(const AnalyseTexte* analyse, char* tampon, size_t taille) {
+    Redaction redaction = {tampon, taille, 0};
+    rediger(&redaction, "\nStatistiques détaillées du texte:\n"
+                        "-----------------------------------\n"
+                        "Caractères:\n"
+                        "  - Total avec espaces: %lld\n"
+                        "  - Total sans espaces: %lld\n"
+                        "  - Nombre d'espaces: %lld\n"
+                        "\nStructure:\n"
+                        "  - Nombre de mots: %lld\n"
+                        "  - Nombre de phrases: %lld\n"
+                        "  - Nombre de paragraphes: %lld\n"
+                        "\nPhrases extrêmes:\n"
+                        "Plus longue phrase (%lld caractères):\n",
+            analyse->nb_caracteres, analyse->nb_chars_sans_espaces, analyse->nb_espaces, analyse->nb_mots_total,
+            analyse->nb_phrases, analyse->nb_paragraphes, analyse->longueur_plus_longue);
+    redigerTexteLarge(&redaction, analyse->phrase_plus_longue);
+    rediger(&redaction, "\n\nPlus courte phrase (%lld caractères):\n", analyse->longueur_plus_courte);
+    redigerTexteLarge(&redaction, analyse->phrase_plus_courte);
+    rediger(&redaction, "\n");
+    return redaction.longueur;
+}
+
+/**
+ * Rédige le rapport des performances de l'analyse : durées des étapes et état de la table de hachage du vocabulaire
+ * Mêmes conventions que formaterStatistiquesDetaillees
+ *
+ * @param analyse Analyse terminée
+ * @param tampon Destination du rapport, terminé par un octet nul si taille > 0
+ * @param taille Taille du tampon en octets
+ * @return Longueur du rapport complet, sans l'octet nul
+ */
+size_t formaterPerformances(const AnalyseTexte* analyse, char* tampon, size_t taille) {
+    const DureesAnalyse* durees = &analyse->durees;
+    Redaction redaction = {tampon, taille, 0};
+    rediger(&redaction, "\nPerformances de l'analyse:\n"
+                        "  - Ouverture (cache compris): %.3f s\n"
+                        "  - Lecture et découpage: %.3f s\n",
+            durees->ouverture, durees->lecture);
+    if (PERIODE_MESURE_INSERTIONS > 0) {
+        rediger(&redaction, "      dont ajout de %llu mots (vocabulaire et n-grammes, estimé, tous threads): %.3f s\n",
+                durees->insertions, durees->insertion);
+    } else {
+        rediger(&redaction, "      dont ajout des mots: non mesuré\n");
+    }
+    rediger(&redaction, "      dont fusion des tranches (tous threads): %.3f s\n"
+                        "  - Finalisation (cache, métriques): %.3f s\n"
+                        "\nTable de hachage du vocabulaire:\n",
+            durees->fusion, durees->finalisation);
+    if (analyse->esquisses) {
+        rediger(&redaction, "  - Inutilisée en mode approché\n");
+        return redaction.longueur;
+    }
+    SanteTableMots sante;
+    mesurerTableMots(&analyse->vocabulaire, &sante);
+    rediger(&redaction, "  - Cases: %zu (%zu occupées, remplissage %.1f%%)\n"
+                        "  - Distance de sondage: %.2f en moyenne, %zu au plus\n"
+                        "  - Mémoire: %.2f Mio (cases %.2f, mots %.2f, textes %.2f, attributs %.2f), "
+                        "%.1f octets par mot\n",
+            sante.capacite, sante.cases_occupees, sante.taux_remplissage * 100, sante.sondage_moyen,
+            sante.sondage_max, sante.memoire_totale / 1048576.0, sante.memoire_cases / 1048576.0,
+            sante.memoire_mots / 1048576.0, sante.memoire_textes / 1048576.0, sante.memoire_membres / 1048576.0,
+            sante.octets_par_mot);
+    return redaction.longueur;
+}
@@ -0,0 +1,92 @@
+#ifndef ANALYSE_TEXTE_H
+#define ANALYSE_TEXTE_H
+
+#include <stddef.h>
+#include <time.h>
+#include <wchar.h>
+
+#include "cache_analyse.h"
+#include "esquisses.h"
+#include "ngrammes.h"
+#include "source_texte.h"
+#include "table_mots.h"
+#include "tokeniseur.h"
+
+#ifndef PERIODE_MESURE_INSERTIONS
+#define PERIODE_MESURE_INSERTIONS 64 // Une insertion chronométrée sur 64 (0 : durée des insertions non mesurée)
+#endif
+
+// Bibliothèque d'analyse partagée par l'interface graphique et l'outil en ligne de commande
+// Aucun état global : chaque AnalyseTexte est indépendante, et plusieurs analyses peuvent avancer en même temps sur
+// des threads différents (une même analyse ne doit être utilisée que par un thread à la fois). Les rapports sont
+// écrits dans des tampons fournis par l'appelant. Le découpage en mots et leur normalisation (normalisation.h) ne
+// dépendent pas de la locale : les résultats sont les mêmes sur toutes les machines
+
+// Durées des étapes d'une analyse, en secondes (quelques lectures de l'horloge par fichier, plus une insertion sur
+// PERIODE_MESURE_INSERTIONS)
+typedef struct {
+    double ouverture;           // Identification du fichier, chargement du cache et ouverture
+    double lecture;             // Découpage en mots, insertions et fusion des tranches comprises
+    double insertion;           // Insertion des mots, extrapolée des insertions chronométrées (tous threads confondus)
+    double fusion;              // Fusion des vocabulaires des tranches (tous threads confondus)
+    double finalisation;        // Enregistrement dans le cache, fin du découpage et calcul des métriques
+    unsigned long long insertions; // Mots insérés pendant la lecture
+} DureesAnalyse;
+
+// Structure principale pour analyser le texte
+typedef struct {
+    long long nb_espaces;
+    long long nb_chars_sans_espaces;
+    long long nb_lignes;            // Nombre total de lignes
+    long long nb_caracteres;        // Nombre total de caractères
+    wchar_t* phrase_plus_longue;    // Début de la phrase la plus longue (alloué, NULL si aucune)
+    wchar_t* phrase_plus_courte;    // Début de la phrase la plus courte (alloué, NULL si aucune)
+    long long longueur_plus_longue; // Longueur de la plus longue phrase
+    long long longueur_plus_courte; // Longueur de la plus courte phrase
+    long long nb_mots_total;    // Nombre total de mots analysés dans le texte
+    long long nb_mots_uniques;  // Nombre de mots uniques trouvés (sans répétition)
+    long long nb_phrases;       // Nombre total de phrases dans le texte
+    long long nb_paragraphes;   // Nombre total de paragraphes dans le texte
+    double longueur_mot_moyenne;    // Longueur moyenne des mots dans le texte
+    double longueur_phrase_moyenne; // Longueur moyenne des phrases dans le texte
+    double diversite_lexicale;      // Rapport entre les mots uniques et le nombre total de mots
+    double complexite_texte;        // Indicateur global de la complexité du texte (combinaison de métriques)
+    long long nb_verbes;        // Nombre total de verbes identifiés dans le texte
+    long long nb_noms_propres;  // Nombre total de noms propres identifiés dans le texte
+    TableMots vocabulaire;      // Table de hachage pour stocker et retrouver les mots rapidement
+    Ngrammes ngrammes;          // Bigrammes et trigrammes (indices des mots du vocabulaire)
+    int compter_ngrammes;       // 0 : les n-grammes ne sont pas comptés (analyse par lots)
+    EsquissesMots* esquisses;   // Mode approché : esquisses de taille fixe à la place du vocabulaire (NULL : exact)
+    int sans_cache;             // 1 : aucun instantané n'est chargé ni enregistré (analyse par lots avec -n)
+    DureesAnalyse durees;       // Durées des étapes de la dernière analyse
+    int erreur;                 // Première erreur rencontrée pendant la lecture (valeur d'errno, 0 si aucune)
+} AnalyseTexte;
+
+// Lecture d'un fichier en cours d'analyse : tokeniseur, source et état du cache entre le début et la fin de la lecture
+// (la structure ne doit pas être déplacée pendant la lecture : le tokeniseur pointe sur son propre tampon de mot)
+typedef struct {
+    Tokeniseur tokeniseur;
+    SourceTexte source;             // Ouverte sauf si le cache est à jour
+    IdentiteFichier identite;
+    RepriseAnalyse reprise;
+    int identifie;
+    EtatCache cache;
+    size_t taille;                  // Taille du fichier
+    struct timespec debut;          // Début de l'étape en cours (ouverture, puis lecture)
+} LectureFichier;
+
+void initialiserAnalyse(AnalyseTexte* analyse);
+void reinitialiserAnalyse(AnalyseTexte* analyse);
+int choisirModeAnalyse(AnalyseTexte* analyse, int approche);
+void libererAnalyse(AnalyseTexte* analyse);
+double calculerComplexiteTexte(const AnalyseTexte* analyse);
+int ajouterMot(AnalyseTexte* analyse, const wchar_t* mot, uint16_t attributs_texte);
+int fusionnerVocabulaire(AnalyseTexte* destination, AnalyseTexte* source);
+int commencerLecture(const char* chemin, AnalyseTexte* analyse, LectureFichier* lecture, SuiviLecture* suivi);
+DecoupageSource* decouperLecture(LectureFichier* lecture, int nb_tranches);
+int terminerLecture(AnalyseTexte* analyse, LectureFichier* lecture);
+int analyserFichier(const char* chemin, AnalyseTexte* analyse, SuiviLecture* suivi);
+size_t formaterStatistiquesDetaillees(const AnalyseTexte* analyse, char* tampon, size_t taille);
+size_t formaterPerformances(const AnalyseTexte* analyse, char* tampon, size_t taille);
+
+#endif
@@ -0,0 +1,710 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <wctype.h>
+#include <locale.h>
+#include <math.h>
+#include <errno.h>
+#include <stdint.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "normalisation.h"
+#include "sortie_texte.h"
+#include "source_texte.h"
+#include "table_mots.h"
+#include "tokeniseur.h"
+
+#define TAILLE_CORPUS_DEFAUT 64       // Taille du corpus généré (Mio)
+#define VOCABULAIRE_DEFAUT 200000     // Mots distincts du vocabulaire généré
+#define EXPOSANT_ZIPF_DEFAUT 1.0      // Fréquence du mot de rang r proportionnelle à 1 / r^exposant
+#define REPETITIONS_DEFAUT 3          // Mesures de chaque phase (la plus rapide est retenue)
+#define DUREE_REPETITION_MIN 0.05     // Secondes : une phase plus courte est enchaînée jusqu'à cette durée par mesure
+#define SEUIL_REGRESSION_DEFAUT 10.0  // Ralentissement (en %) au-delà duquel une phase est signalée
+#define MEILLEURS_MOTS_BANC 10        // K des recherches de mots les plus fréquents
+#define LONGUEUR_MOT_BANC 5           // Longueur cherchée par la recherche des mots d'une longueur donnée
+#define SYLLABES_MAX 4                // Syllabes d'un mot généré (hors terminaison de verbe)
+#define NB_PHASES_MAX 16
+#define LONGUEUR_LIGNE_REFERENCE 1024
+
+// Langue du générateur : des syllabes ASCII, des syllabes avec des caractères hors ASCII (choisies selon la
+// proportion Unicode demandée) et des terminaisons de verbes
+typedef struct {
+    const char* code;
+    const wchar_t* const* syllabes_ascii;      // NULL pour les écritures sans ASCII (cyrillique, grec)
+    const wchar_t* const* syllabes_unicode;
+    const wchar_t* const* terminaisons_verbes;
+} Langue;
+
+static const wchar_t* const syllabes_fr[] = {L"ma", L"ri", L"lo", L"ne", L"tu", L"pa", L"che", L"ron", L"de", L"li",
+                                             L"sa", L"vo", L"gne", L"que", L"ta", L"bou", NULL};
+static const wchar_t* const syllabes_fr_unicode[] = {L"é", L"è", L"ça", L"ê", L"où", L"ï", L"â", L"œu", NULL};
+static const wchar_t* const verbes_fr[] = {L"er", L"ir", NULL};
+static const wchar_t* const syllabes_en[] = {L"th", L"ing", L"ro", L"ba", L"st", L"ke", L"wa", L"ly", L"ter", L"on",
+                                             L"sh", L"ck", NULL};
+static const wchar_t* const syllabes_en_unicode[] = {L"é", L"ï", NULL};
+static const wchar_t* const verbes_en[] = {L"er", NULL};
+static const wchar_t* const syllabes_de[] = {L"sch", L"ei", L"ber", L"au", L"ge", L"ung", L"lich", L"ten", L"zu",
+                                             L"kr", NULL};
+static const wchar_t* const syllabes_de_unicode[] = {L"ü", L"ö", L"ä", L"ß", L"äu", NULL};
+static const wchar_t* const verbes_de[] = {L"ieren", L"ern", NULL};
+static const wchar_t* const syllabes_ru[] = {L"ка", L"ро", L"ни", L"ст", L"во", L"ла", L"те", L"ми", L"да", L"ль",
+                                             L"ны", L"ша", NULL};
+static const wchar_t* const verbes_ru[] = {L"ать", L"ить", NULL};
+static const wchar_t* const syllabes_el[] = {L"κα", L"λο", L"ση", L"μα", L"τη", L"πο", L"νι", L"ρα", L"ου", L"στ",
+                                             NULL};
+static const wchar_t* const verbes_el[] = {L"ειν", L"ω", NULL};
+
+static const Langue langues[] = {
+    {"fr", syllabes_fr, syllabes_fr_unicode, verbes_fr},
+    {"en", syllabes_en, syllabes_en_unicode, verbes_en},
+    {"de", syllabes_de, syllabes_de_unicode, verbes_de},
+    {"ru", NULL, syllabes_ru, verbes_ru},
+    {"el", NULL, syllabes_el, verbes_el},
+};
+#define NB_LANGUES (sizeof(langues) / sizeof(langues[0]))
+
+// Paramètres du corpus synthétique : deux générations avec les mêmes paramètres produisent les mêmes octets
+typedef struct {
+    size_t taille;                   // Octets à écrire (le corpus s'arrête à la fin de la phrase qui les dépasse)
+    size_t vocabulaire;
+    double exposant;
+    const Langue* langues[NB_LANGUES];
+    int nb_langues;
+    char codes_langues[64];          // Langues demandées, telles qu'écrites dans les résultats
+    double unicode;                  // Probabilité qu'une syllabe soit prise parmi les syllabes hors ASCII
+    uint64_t graine;
+} ParametresCorpus;
+
+// Mot du vocabulaire généré
+typedef struct {
+    wchar_t* texte;
+    int longueur;
+    int octets;                      // Longueur en UTF-8
+} MotGenere;
+
+// Résultat d'une phase : durée de la répétition la plus rapide et volume traité par répétition
+typedef struct {
+    const char* nom;
+    double secondes;
+    uint64_t octets;                 // 0 : sans objet (pas de débit en Mo/s)
+    uint64_t mots;                   // Mots (ou occurrences) traités
+    long pic_memoire;                // Pic de mémoire résidente pendant la phase (Kio)
+} ResultatPhase;
+
+// État partagé par les phases : corpus, vocabulaire de référence et second vocabulaire de la comparaison
+typedef struct {
+    const char* chemin_corpus;
+    char chemin_export[4096];
+    uint64_t octets_corpus;
+    uint64_t mots_corpus;
+    int nb_threads;
+    TableMots vocabulaire;           // Rempli par la phase d'ingestion, utilisé par les suivantes
+    TableMots autre;                 // Second vocabulaire de la comparaison
+    uint32_t controle;               // Reçoit les hachages et sommes calculés, pour que les boucles ne soient pas retirées
+} Banc;
+
+// Générateur pseudo-aléatoire reproductible (splitmix64)
+static uint64_t aleatoire(uint64_t* etat) {
+    uint64_t z = (*etat += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Nombre réel uniforme dans [0, 1)
+static double aleatoireReel(uint64_t* etat) {
+    return (double)(aleatoire(etat) >> 11) / 9007199254740992.0;
+}
+
+// Choisit un élément d'une liste terminée par NULL
+static const wchar_t* choisirSyllabe(const wchar_t* const* liste, uint64_t* etat) {
+    size_t n = 0;
+    while (liste[n] != NULL) n++;
+    return liste[aleatoire(etat) % n];
+}
+
+// Secondes écoulées depuis un instant de CLOCK_MONOTONIC
+static double secondesDepuis(const struct timespec* debut) {
+    struct timespec fin;
+    clock_gettime(CLOCK_MONOTONIC, &fin);
+    return (double)(fin.tv_sec - debut->tv_sec) + (fin.tv_nsec - debut->tv_nsec) / 1e9;
+}
+
+// Longueur en UTF-8 d'un texte de caractères larges
+static int octetsUtf8(const wchar_t* texte, int longueur) {
+    int octets = 0;
+    for (int i = 0; i < longueur; i++) {
+        unsigned long c = (unsigned long)texte[i];
+        octets += c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+    }
+    return octets;
+}
+
+// Génère un mot : quelques syllabes d'une langue, parfois une terminaison de verbe, une majuscule (nom propre) ou
+// un miroir qui en fait un palindrome
+static void genererMot(const ParametresCorpus* parametres, uint64_t* etat, MotGenere* mot) {
+    const Langue* langue = parametres->langues[aleatoire(etat) % parametres->nb_langues];
+    wchar_t texte[LONGUEUR_MOT_MAX];    // Au plus 2 * SYLLABES_MAX syllabes de 4 caractères (palindrome)
+    size_t longueur = 0;
+    int nb_syllabes = 1 + (int)(aleatoire(etat) % SYLLABES_MAX);
+    for (int s = 0; s < nb_syllabes; s++) {
+        int unicode = langue->syllabes_ascii == NULL || aleatoireReel(etat) < parametres->unicode;
+        const wchar_t* syllabe = choisirSyllabe(unicode ? langue->syllabes_unicode : langue->syllabes_ascii, etat);
+        wcscpy(texte + longueur, syllabe);
+        longueur += wcslen(syllabe);
+    }
+    unsigned tirage = (unsigned)(aleatoire(etat) % 100);
+    if (tirage < 8) {
+        const wchar_t* terminaison = choisirSyllabe(langue->terminaisons_verbes, etat);
+        wcscpy(texte + longueur, terminaison);
+        longueur += wcslen(terminaison);
+    } else if (tirage < 13) {
+        texte[0] = towupper(texte[0]);
+    } else if (tirage < 14) {
+        for (size_t i = longueur - 1; i-- > 0;) {
+            texte[longueur++] = texte[i];
+        }
+        texte[longueur] = L'\0';
+    }
+    mot->texte = wcsdup(texte);
+    if (mot->texte == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    mot->longueur = (int)longueur;
+    mot->octets = octetsUtf8(texte, (int)longueur);
+}
+
+// Écrit le corpus synthétique : phrases de 4 à 23 mots tirés selon une loi de Zipf sur le vocabulaire, ponctuation
+// variée, retours à la ligne et paragraphes. Retourne la taille écrite, ou 0 en cas d'erreur (errno est positionné)
+static size_t genererCorpus(const ParametresCorpus* parametres, const char* chemin) {
+    uint64_t etat = parametres->graine;
+    size_t n = parametres->vocabulaire;
+    MotGenere* mots = malloc(n * sizeof(MotGenere));
+    double* cumul = malloc(n * sizeof(double));   // Poids cumulés des rangs, pour le tirage par dichotomie
+    if (mots == NULL || cumul == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    double total = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        genererMot(parametres, &etat, &mots[i]);
+        total += pow((double)(i + 1), -parametres->exposant);
+        cumul[i] = total;
+    }
+
+    SortieTexte sortie;
+    if (ouvrirSortie(&sortie, chemin) != 0) {
+        int erreur = errno;
+        for (size_t i = 0; i < n; i++) free(mots[i].texte);
+        free(mots);
+        free(cumul);
+        errno = erreur;
+        return 0;
+    }
+    size_t ecrits = 0;
+    int phrases_paragraphe = 0;
+    while (ecrits < parametres->taille) {
+        int nb_mots = 4 + (int)(aleatoire(&etat) % 20);
+        for (int m = 0; m < nb_mots; m++) {
+            double cible = aleatoireReel(&etat) * total;
+            size_t bas = 0, haut = n - 1;
+            while (bas < haut) {
+                size_t milieu = (bas + haut) / 2;
+                if (cumul[milieu] < cible) bas = milieu + 1; else haut = milieu;
+            }
+            if (m > 0) {
+                int virgule = aleatoire(&etat) % 10 == 0;
+                ecrireChaine(&sortie, virgule ? ", " : " ");
+                ecrits += virgule ? 2 : 1;
+            }
+            ecrireMotUtf8(&sortie, mots[bas].texte, (size_t)mots[bas].longueur);
+            ecrits += (size_t)mots[bas].octets;
+        }
+        unsigned fin = (unsigned)(aleatoire(&etat) % 10);
+        ecrireOctet(&sortie, fin == 0 ? '!' : fin == 1 ? '?' : '.');
+        if (++phrases_paragraphe >= 3 + (int)(aleatoire(&etat) % 6)) {
+            ecrireChaine(&sortie, "\n\n");
+            phrases_paragraphe = 0;
+        } else {
+            ecrireOctet(&sortie, aleatoire(&etat) % 5 == 0 ? '\n' : ' ');
+        }
+        ecrits += 2;
+    }
+
+    for (size_t i = 0; i < n; i++) free(mots[i].texte);
+    free(mots);
+    free(cumul);
+    return fermerSortie(&sortie) == 0 ? ecrits : 0;
+}
+
+// Remet à zéro le pic de mémoire résidente du processus (Linux). Retourne -1 si le système ne le permet pas
+static int reinitialiserPicMemoire(void) {
+    FILE* fichier = fopen("/proc/self/clear_refs", "w");
+    if (fichier == NULL) {
+        return -1;
+    }
+    int erreur = fputs("5", fichier) < 0;
+    return fclose(fichier) != 0 || erreur ? -1 : 0;
+}
+
+// Pic de mémoire résidente (Kio) depuis la dernière remise à zéro, sinon depuis le lancement du processus
+static long picMemoire(void) {
+    FILE* fichier = fopen("/proc/self/status", "r");
+    if (fichier != NULL) {
+        char ligne[256];
+        long pic = -1;
+        while (pic < 0 && fgets(ligne, sizeof(ligne), fichier) != NULL) {
+            if (strncmp(ligne, "VmHWM:", 6) == 0) pic = strtol(ligne + 6, NULL, 10);
+        }
+        fclose(fichier);
+        if (pic >= 0) return pic;
+    }
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+}
+
+// Normalise un mot trouvé par le tokeniseur (même normalisation que les programmes d'analyse) et l'ajoute à la table
+// du contexte
+static void traiterMot(void* contexte, wchar_t* mot_lu) {
+    wchar_t tampon[512];
+    wchar_t* mot = tampon;
+    size_t longueur = wcslen(mot_lu);
+    if (longueur > (sizeof(tampon) / sizeof(wchar_t) - 1) / EXPANSION_NORMALISATION_MAX &&
+        (mot = malloc((longueur * EXPANSION_NORMALISATION_MAX + 1) * sizeof(wchar_t))) == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    uint16_t attributs_texte = longueur > 0 && estMajuscule(mot_lu[0]) ? 1u << ATTRIBUT_NOM_PROPRE : 0;
+    normaliserMot(mot_lu, longueur, mot);
+    int nouveau;
+    Mot* entree = insererMot((TableMots*)contexte, mot, attributs_texte, &nouveau);
+    if (entree == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    if (mot != tampon) {
+        free(mot);
+    }
+    entree->frequence++;
+}
+
+// Table qui reçoit les mots d'une tranche (ingestion parallèle)
+static void* creerTableTranche(void* principal) {
+    (void)principal;
+    TableMots* table = malloc(sizeof(TableMots));
+    if (table == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    initialiserTableMots(table);
+    return table;
+}
+
+// Libère la table d'une tranche
+static void libererTableTranche(void* tranche) {
+    libererTableMots((TableMots*)tranche);
+    free(tranche);
+}
+
+// Fusionne la table d'une tranche dans celle de la tranche précédente, puis libère la tranche
+static void fusionnerTableTranche(void* destination, void* tranche) {
+    const TableMots* source = (const TableMots*)tranche;
+    for (size_t i = 0; i < source->nb_mots; i++) {
+        int nouveau;
+        Mot* entree = insererMot((TableMots*)destination, texteMot(source, &source->mots[i]),
+                                 source->mots[i].attributs & ATTRIBUTS_TEXTE, &nouveau);
+        if (entree == NULL) {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+        entree->frequence += source->mots[i].frequence;
+    }
+    libererTableTranche(tranche);
+}
+
+static const OperationsTranches operations_tranches = {
+    creerTableTranche, fusionnerTableTranche, libererTableTranche
+};
+
+// Lit le corpus dans une table vide, en séquentiel (nb_threads = 1) ou par tranches en parallèle
+static void lireCorpus(Banc* banc, TableMots* table, int nb_threads, ResultatPhase* resultat) {
+    SourceTexte source;
+    if (ouvrirSource(&source, banc->chemin_corpus) != 0) {
+        perror("Erreur à l'ouverture du corpus");
+        exit(EXIT_FAILURE);
+    }
+    Tokeniseur tokeniseur;
+    initialiserTokeniseur(&tokeniseur, traiterMot, table);
+    if (nb_threads == 1) {
+        tokeniserSource(&tokeniseur, &source);
+    } else {
+        tokeniserSourceParallele(&tokeniseur, &source, nb_threads, &operations_tranches);
+    }
+    terminerTokeniseur(&tokeniseur, 1);
+    resultat->octets = tailleSource(&source);
+    resultat->mots = (uint64_t)tokeniseur.nb_mots_total;
+    libererTokeniseur(&tokeniseur);
+    fermerSource(&source);
+}
+
+// Ingestion séquentielle : découpage, normalisation et insertion de chaque mot (le vocabulaire obtenu sert aux
+// phases suivantes)
+static void phaseIngestion(Banc* banc, ResultatPhase* resultat) {
+    libererTableMots(&banc->vocabulaire);
+    initialiserTableMots(&banc->vocabulaire);
+    lireCorpus(banc, &banc->vocabulaire, 1, resultat);
+    banc->octets_corpus = resultat->octets;
+    banc->mots_corpus = resultat->mots;
+}
+
+// Ingestion par tranches réparties entre les threads, fusion des vocabulaires comprise
+static void phaseIngestionParallele(Banc* banc, ResultatPhase* resultat) {
+    TableMots table;
+    initialiserTableMots(&table);
+    lireCorpus(banc, &table, banc->nb_threads, resultat);
+    libererTableMots(&table);
+}
+
+// Hachage des mots du vocabulaire, répété pour traiter autant de mots que le corpus
+static void phaseHachage(Banc* banc, ResultatPhase* resultat) {
+    const TableMots* table = &banc->vocabulaire;
+    uint64_t passes = table->nb_mots > 0 && banc->mots_corpus > table->nb_mots ? banc->mots_corpus / table->nb_mots : 1;
+    uint32_t cumul = 0;
+    uint64_t caracteres = 0;
+    for (uint64_t p = 0; p < passes; p++) {
+        for (size_t i = 0; i < table->nb_mots; i++) {
+            cumul ^= hacherMot(texteMot(table, &table->mots[i]));
+            caracteres += (uint64_t)table->mots[i].longueur;
+        }
+    }
+    banc->controle ^= cumul;
+    resultat->octets = caracteres * sizeof(wchar_t);
+    resultat->mots = passes * table->nb_mots;
+}
+
+// Recherche des K mots les plus fréquents dans chaque catégorie
+static void phaseMeilleursMots(Banc* banc, ResultatPhase* resultat) {
+    const TableMots* table = &banc->vocabulaire;
+    static const CategorieMots categories[] = {CATEGORIE_TOUS, CATEGORIE_VERBES, CATEGORIE_NOMS_PROPRES,
+                                               CATEGORIE_LONGUEUR};
+    uint32_t meilleurs[MEILLEURS_MOTS_BANC];
+    resultat->mots = 0;
+    for (size_t c = 0; c < sizeof(categories) / sizeof(categories[0]); c++) {
+        size_t n = meilleursMots(table, MEILLEURS_MOTS_BANC, categories[c], LONGUEUR_MOT_BANC, meilleurs);
+        banc->controle ^= n > 0 ? meilleurs[0] : 0;
+        size_t candidats = table->nb_mots;
+        if (categories[c] == CATEGORIE_VERBES) membresAttribut(table, ATTRIBUT_VERBE, &candidats);
+        if (categories[c] == CATEGORIE_NOMS_PROPRES) membresAttribut(table, ATTRIBUT_NOM_PROPRE, &candidats);
+        resultat->mots += candidats;
+    }
+}
+
+// Détection des palindromes (calcul des attributs de chaque mot du vocabulaire), puis parcours de leur liste
+static void phasePalindromes(Banc* banc, ResultatPhase* resultat) {
+    const TableMots* table = &banc->vocabulaire;
+    uint32_t trouves = 0;
+    for (size_t i = 0; i < table->nb_mots; i++) {
+        const Mot* mot = &table->mots[i];
+        trouves += (calculerAttributs(texteMot(table, mot), (size_t)mot->longueur) >> ATTRIBUT_PALINDROME) & 1;
+    }
+    size_t nb_palindromes;
+    const uint32_t* palindromes = membresAttribut(table, ATTRIBUT_PALINDROME, &nb_palindromes);
+    long long occurrences = 0;
+    for (size_t i = 0; i < nb_palindromes; i++) {
+        occurrences += table->mots[palindromes[i]].frequence;
+    }
+    banc->controle ^= trouves ^ (uint32_t)occurrences;
+    resultat->mots = table->nb_mots;
+}
+
+// Exportation du vocabulaire au format JSON Lines, trié par fréquence croissante comme l'exportation de l'interface
+static void phaseExportation(Banc* banc, ResultatPhase* resultat) {
+    const TableMots* table = &banc->vocabulaire;
+    uint32_t* ordre = trierMots(table, 0, 0);
+    SortieTexte sortie;
+    if (ordre == NULL || ouvrirSortie(&sortie, banc->chemin_export) != 0) {
+        perror("Erreur à l'exportation");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < table->nb_mots; i++) {
+        const Mot* mot = &table->mots[ordre[i]];
+        ecrireChaine(&sortie, "{\"type\":\"word\",\"word\":");
+        ecrireChaineJson(&sortie, texteMot(table, mot), (size_t)mot->longueur);
+        ecrireChaine(&sortie, ",\"frequency\":");
+        ecrireEntier(&sortie, mot->frequence);
+        ecrireChaine(&sortie, ",\"length\":");
+        ecrireEntier(&sortie, mot->longueur);
+        ecrireChaine(&sortie, aAttribut(mot, ATTRIBUT_VERBE) ? ",\"verb\":true" : ",\"verb\":false");
+        ecrireChaine(&sortie, aAttribut(mot, ATTRIBUT_NOM_PROPRE) ? ",\"proper_noun\":true}\n"
+                                                                  : ",\"proper_noun\":false}\n");
+    }
+    free(ordre);
+    struct stat etat;
+    if (fermerSortie(&sortie) != 0 || stat(banc->chemin_export, &etat) != 0) {
+        perror("Erreur à l'exportation");
+        exit(EXIT_FAILURE);
+    }
+    resultat->octets = (uint64_t)etat.st_size;
+    resultat->mots = table->nb_mots;
+}
+
+// Comparaison du vocabulaire avec un second vocabulaire qui en partage les trois quarts
+static void phaseComparaison(Banc* banc, ResultatPhase* resultat) {
+    SimilariteVocabulaires similarite;
+    comparerVocabulaires(&banc->vocabulaire, &banc->autre, &similarite);
+    banc->controle ^= (uint32_t)similarite.mots_communs;
+    resultat->mots = banc->vocabulaire.nb_mots + banc->autre.nb_mots;
+}
+
+// Construit le second vocabulaire de la comparaison : un mot sur quatre est remplacé par une variante absente du
+// premier, et les fréquences sont redistribuées
+static void preparerComparaison(Banc* banc) {
+    const TableMots* table = &banc->vocabulaire;
+    wchar_t variante[LONGUEUR_MOT_MAX + 2];
+    for (size_t i = 0; i < table->nb_mots; i++) {
+        const wchar_t* texte = texteMot(table, &table->mots[i]);
+        if (i % 4 == 0) {
+            swprintf(variante, LONGUEUR_MOT_MAX + 2, L"%.*lsx", LONGUEUR_MOT_MAX, texte);
+            texte = variante;
+        }
+        int nouveau;
+        Mot* entree = insererMot(&banc->autre, texte, table->mots[i].attributs & ATTRIBUTS_TEXTE, &nouveau);
+        if (entree == NULL) {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+        entree->frequence += table->mots[(i * 7) % table->nb_mots].frequence;
+    }
+}
+
+// Mesure une phase : durée d'une exécution dans la plus rapide des répétitions, et le pic de mémoire résidente atteint pendant la phase
+static void mesurerPhase(Banc* banc, const char* nom, void (*phase)(Banc*, ResultatPhase*), int repetitions,
+                         ResultatPhase* resultat) {
+    memset(resultat, 0, sizeof(ResultatPhase));
+    resultat->nom = nom;
+    resultat->secondes = INFINITY;
+    int reinitialise = reinitialiserPicMemoire() == 0;
+    for (int r = 0; r < repetitions; r++) {
+        struct timespec debut;
+        clock_gettime(CLOCK_MONOTONIC, &debut);
+        double secondes;
+        int executions = 0;
+        do {
+            phase(banc, resultat);
+            executions++;
+        } while ((secondes = secondesDepuis(&debut)) < DUREE_REPETITION_MIN);
+        secondes /= executions;
+        if (secondes < resultat->secondes) resultat->secondes = secondes;
+    }
+    resultat->pic_memoire = picMemoire();
+    if (!reinitialise) {
+        fprintf(stderr, "Pic de mémoire de la phase %s indisponible : pic du processus\n", nom);
+    }
+}
+
+// Écrit le résultat d'une phase (une ligne JSON)
+static void ecrirePhase(SortieTexte* sortie, const ResultatPhase* resultat) {
+    double secondes = resultat->secondes > 0 ? resultat->secondes : 1e-9;
+    ecrireFormat(sortie, "{\"type\":\"phase\",\"name\":\"%s\",\"seconds\":%.6f,\"bytes\":%llu,\"tokens\":%llu,",
+                 resultat->nom, resultat->secondes, (unsigned long long)resultat->octets,
+                 (unsigned long long)resultat->mots);
+    if (resultat->octets > 0) {
+        ecrireFormat(sortie, "\"mb_per_s\":%.3f,", resultat->octets / secondes / 1e6);
+    } else {
+        ecrireChaine(sortie, "\"mb_per_s\":null,");
+    }
+    ecrireFormat(sortie, "\"tokens_per_s\":%.0f,\"peak_rss_kb\":%ld}\n", resultat->mots / secondes,
+                 resultat->pic_memoire);
+}
+
+// Compare les phases à celles d'une exécution de référence (fichier produit par ce programme) ; les écarts sont
+// affichés sur la sortie d'erreur. Retourne le nombre de phases ralenties au-delà du seuil, ou -1 si la référence
+// ne peut pas être lue
+static int comparerReference(const char* chemin, const ResultatPhase* phases, int nb_phases, uint64_t octets_corpus,
+                             double seuil) {
+    FILE* fichier = fopen(chemin, "r");
+    if (fichier == NULL) {
+        return -1;
+    }
+    fprintf(stderr, "\nComparaison avec la référence %s (seuil %.1f %%):\n", chemin, seuil);
+    char ligne[LONGUEUR_LIGNE_REFERENCE];
+    int regressions = 0;
+    while (fgets(ligne, sizeof(ligne), fichier) != NULL) {
+        const char* champ = strstr(ligne, "\"bytes\":");
+        if (strstr(ligne, "\"type\":\"corpus\"") != NULL && champ != NULL &&
+            strtoull(champ + 8, NULL, 10) != octets_corpus) {
+            fprintf(stderr, "Attention : le corpus de référence est différent (%llu octets au lieu de %llu)\n",
+                    strtoull(champ + 8, NULL, 10), (unsigned long long)octets_corpus);
+        }
+        const char* nom = strstr(ligne, "\"name\":\"");
+        champ = strstr(ligne, "\"seconds\":");
+        if (strstr(ligne, "\"type\":\"phase\"") == NULL || nom == NULL || champ == NULL) {
+            continue;
+        }
+        nom += 8;
+        size_t longueur = strcspn(nom, "\"");
+        double reference = strtod(champ + 10, NULL);
+        for (int i = 0; i < nb_phases; i++) {
+            if (strlen(phases[i].nom) != longueur || strncmp(phases[i].nom, nom, longueur) != 0 || reference <= 0) {
+                continue;
+            }
+            double ecart = (phases[i].secondes / reference - 1.0) * 100.0;
+            int regression = ecart > seuil;
+            regressions += regression;
+            fprintf(stderr, "  %-20s %10.4f s   référence %10.4f s   %+7.1f %%%s\n", phases[i].nom,
+                    phases[i].secondes, reference, ecart, regression ? "   RÉGRESSION" : "");
+        }
+    }
+    fclose(fichier);
+    return regressions;
+}
+
+// Ajoute une langue aux paramètres du corpus. Retourne -1 si son code est inconnu
+static int ajouterLangue(ParametresCorpus* parametres, const char* code, size_t longueur) {
+    for (size_t i = 0; i < NB_LANGUES; i++) {
+        if (strlen(langues[i].code) == longueur && strncmp(langues[i].code, code, longueur) == 0) {
+            if (parametres->nb_langues < (int)NB_LANGUES) {
+                parametres->langues[parametres->nb_langues++] = &langues[i];
+            }
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char* argv[]) {
+    // Le générateur et la normalisation ont besoin d'une locale UTF-8 (majuscules et minuscules hors ASCII)
+    setlocale(LC_ALL, "");
+    if (MB_CUR_MAX == 1) {
+        setlocale(LC_ALL, "C.UTF-8");
+    }
+    ParametresCorpus parametres;
+    memset(&parametres, 0, sizeof(ParametresCorpus));
+    parametres.taille = (size_t)TAILLE_CORPUS_DEFAUT << 20;
+    parametres.vocabulaire = VOCABULAIRE_DEFAUT;
+    parametres.exposant = EXPOSANT_ZIPF_DEFAUT;
+    parametres.unicode = 0.1;
+    parametres.graine = 1;
+    const char* codes = "fr,en";
+    const char* chemin_sortie = NULL;
+    const char* chemin_reference = NULL;
+    const char* chemin_corpus = NULL;
+    int repetitions = REPETITIONS_DEFAUT;
+    double seuil = SEUIL_REGRESSION_DEFAUT;
+    Banc banc;
+    memset(&banc, 0, sizeof(Banc));
+    int option;
+    while ((option = getopt(argc, argv, "b:g:j:k:l:o:r:s:t:u:v:z:")) != -1) {
+        switch (option) {
+            case 'b': chemin_reference = optarg; break;
+            case 'g': parametres.graine = strtoull(optarg, NULL, 10); break;
+            case 'j': banc.nb_threads = atoi(optarg); break;
+            case 'k': chemin_corpus = optarg; break;
+            case 'l': codes = optarg; break;
+            case 'o': chemin_sortie = optarg; break;
+            case 'r': repetitions = atoi(optarg) > 0 ? atoi(optarg) : 1; break;
+            case 's': parametres.taille = (size_t)(atof(optarg) * (1 << 20)); break;
+            case 't': seuil = atof(optarg); break;
+            case 'u': parametres.unicode = atof(optarg); break;
+            case 'v': parametres.vocabulaire = strtoull(optarg, NULL, 10); break;
+            case 'z': parametres.exposant = atof(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [-s taille_Mio] [-v mots_distincts] [-z exposant_zipf] [-l fr,en,de,ru,el] "
+                                "[-u proportion_unicode] [-g graine] [-k corpus.txt] [-r repetitions] [-j threads] "
+                                "[-o resultats.jsonl] [-b reference.jsonl] [-t seuil_%%]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    for (const char* code = codes; *code;) {
+        size_t longueur = strcspn(code, ",");
+        if (ajouterLangue(&parametres, code, longueur) != 0) {
+            fprintf(stderr, "Langue inconnue : %.*s (langues disponibles : fr, en, de, ru, el)\n", (int)longueur, code);
+            return EXIT_FAILURE;
+        }
+        code += longueur + (code[longueur] == ',');
+    }
+    if (parametres.nb_langues == 0 || parametres.vocabulaire == 0 || parametres.taille == 0) {
+        fprintf(stderr, "Le corpus demande au moins une langue, un mot de vocabulaire et un octet\n");
+        return EXIT_FAILURE;
+    }
+    snprintf(parametres.codes_langues, sizeof(parametres.codes_langues), "%s", codes);
+
+    // Corpus et exportation dans des fichiers temporaires (le corpus est gardé s'il est écrit à un chemin choisi)
+    const char* dossier = getenv("TMPDIR") != NULL ? getenv("TMPDIR") : "/tmp";
+    char chemin_temporaire[4096];
+    if (chemin_corpus == NULL) {
+        snprintf(chemin_temporaire, sizeof(chemin_temporaire), "%s/text_bench_corpus_%ld.txt", dossier,
+                 (long)getpid());
+        chemin_corpus = chemin_temporaire;
+    }
+    snprintf(banc.chemin_export, sizeof(banc.chemin_export), "%s/text_bench_export_%ld.jsonl", dossier, (long)getpid());
+    banc.chemin_corpus = chemin_corpus;
+
+    SortieTexte sortie;
+    int ouverte = chemin_sortie != NULL ? ouvrirSortie(&sortie, chemin_sortie)
+                                        : ouvrirSortieDescripteur(&sortie, STDOUT_FILENO);
+    if (ouverte != 0) {
+        perror("Erreur à l'ouverture de la sortie");
+        return EXIT_FAILURE;
+    }
+
+    struct timespec debut;
+    clock_gettime(CLOCK_MONOTONIC, &debut);
+    if (genererCorpus(&parametres, chemin_corpus) == 0) {
+        perror("Erreur à l'écriture du corpus");
+        return EXIT_FAILURE;
+    }
+    double secondes_generation = secondesDepuis(&debut);
+    initialiserTableMots(&banc.vocabulaire);
+    initialiserTableMots(&banc.autre);
+
+    ResultatPhase phases[NB_PHASES_MAX];
+    int nb_phases = 0;
+    fprintf(stderr, "Mesures en cours (%d répétitions par phase)...\n", repetitions);
+    mesurerPhase(&banc, "ingestion", phaseIngestion, repetitions, &phases[nb_phases++]);
+    mesurerPhase(&banc, "ingestion_parallel", phaseIngestionParallele, repetitions, &phases[nb_phases++]);
+    mesurerPhase(&banc, "hashing", phaseHachage, repetitions, &phases[nb_phases++]);
+    mesurerPhase(&banc, "top_k", phaseMeilleursMots, repetitions, &phases[nb_phases++]);
+    mesurerPhase(&banc, "palindromes", phasePalindromes, repetitions, &phases[nb_phases++]);
+    mesurerPhase(&banc, "export", phaseExportation, repetitions, &phases[nb_phases++]);
+    preparerComparaison(&banc);
+    mesurerPhase(&banc, "comparison", phaseComparaison, repetitions, &phases[nb_phases++]);
+
+    ecrireFormat(&sortie, "{\"type\":\"corpus\",\"bytes\":%llu,\"tokens\":%llu,\"unique_words\":%zu,"
+                          "\"vocabulary\":%zu,\"zipf_exponent\":%.3f,\"languages\":",
+                 (unsigned long long)banc.octets_corpus, (unsigned long long)banc.mots_corpus,
+                 banc.vocabulaire.nb_mots, parametres.vocabulaire, parametres.exposant);
+    ecrireTexteJson(&sortie, parametres.codes_langues);
+    ecrireFormat(&sortie, ",\"unicode\":%.3f,\"seed\":%llu,\"repetitions\":%d,\"generation_seconds\":%.6f}\n",
+                 parametres.unicode, (unsigned long long)parametres.graine, repetitions, secondes_generation);
+    for (int i = 0; i < nb_phases; i++) {
+        ecrirePhase(&sortie, &phases[i]);
+    }
+    int erreur_sortie = fermerSortie(&sortie) != 0;
+    if (erreur_sortie) {
+        perror("Erreur à l'écriture des résultats");
+    }
+
+    int regressions = 0;
+    if (chemin_reference != NULL) {
+        regressions = comparerReference(chemin_reference, phases, nb_phases, banc.octets_corpus, seuil);
+        if (regressions < 0) {
+            perror("Erreur à la lecture de la référence");
+        } else if (regressions > 0) {
+            fprintf(stderr, "%d phase(s) plus lente(s) que la référence au-delà du seuil\n", regressions);
+        }
+    }
+
+    libererTableMots(&banc.vocabulaire);
+    libererTableMots(&banc.autre);
+    unlink(banc.chemin_export);
+    if (chemin_corpus == chemin_temporaire) {
+        unlink(chemin_temporaire);
+    }
+    return erreur_sortie || regressions != 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
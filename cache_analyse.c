@@ -0,0 +1,549 @@
+#include "cache_analyse.h"
+
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sortie_texte.h"
+
+#define MAGIQUE_CACHE "TXTCACHE"
+
+// En-tête d'un instantané, suivi du chemin analysé, des textes du tokeniseur (mot inachevé et phrases), des cases,
+// des mots et de l'arène des textes de la table, puis des cases et de l'esquisse de chaque table de n-grammes
+// (chaque partie commence à un multiple de 8 octets)
+typedef struct {
+    char magique[8];
+    uint32_t version;
+    uint32_t taille_wchar;        // Rejette les instantanés d'une plateforme où wchar_t n'a pas la même taille
+    uint32_t taille_entete;       // Rejette les instantanés dont les structures n'ont pas la même disposition
+    uint32_t variante;            // Options d'analyse qui changent les résultats
+    uint64_t taille_fichier;      // Identité du fichier à la fin de la lecture enregistrée
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint64_t empreinte;
+    uint64_t longueur_chemin;     // Octets réservés au chemin (zéro final et remplissage compris)
+    uint64_t capacite_cases;
+    uint64_t nb_mots;
+    uint64_t taille_textes;
+    RepriseAnalyse reprise;
+    EtatTokeniseur tokeniseur;    // Ses textes (voir textesTokeniseur) suivent le chemin
+    EtatNgrammes ngrammes;        // Tables vides si l'analyse ne compte pas les n-grammes
+} EnteteCache;
+
+// Hachage FNV-1a sur 64 bits d'une suite d'octets, à partir d'une valeur précédente
+static uint64_t hacherOctets(uint64_t hachage, const void* octets, size_t taille) {
+    const unsigned char* p = octets;
+    for (size_t i = 0; i < taille; i++) {
+        hachage ^= p[i];
+        hachage *= 0x100000001B3ULL;
+    }
+    return hachage;
+}
+
+static size_t arrondir8(size_t n) {
+    return (n + 7) & ~(size_t)7;
+}
+
+/**
+ * Construit le chemin du répertoire du cache et le crée si besoin
+ * Le répertoire est $XDG_CACHE_HOME/text_analyzer, ou ~/.cache/text_analyzer
+ *
+ * @param repertoire Reçoit le chemin du répertoire
+ * @param taille Taille du tampon repertoire
+ * @return 0 en cas de succès, -1 si aucun répertoire de cache n'est utilisable
+ */
+static int repertoireCache(char* repertoire, size_t taille) {
+    const char* base = getenv("XDG_CACHE_HOME");
+    int n;
+    if (base != NULL && base[0] == '/') {
+        n = snprintf(repertoire, taille, "%s", base);
+    } else if ((base = getenv("HOME")) != NULL && base[0] != '\0') {
+        n = snprintf(repertoire, taille, "%s/.cache", base);
+    } else {
+        return -1;
+    }
+    if (n < 0 || (size_t)n >= taille) {
+        return -1;
+    }
+    mkdir(repertoire, 0700);
+    if (strlen(repertoire) + sizeof("/text_analyzer") > taille) {
+        return -1;
+    }
+    strcat(repertoire, "/text_analyzer");
+    if (mkdir(repertoire, 0700) != 0 && errno != EEXIST) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Construit le chemin de l'instantané d'un fichier et crée le répertoire du cache si besoin
+ *
+ * @param identite Identité du fichier analysé
+ * @param variante Options d'analyse (chaque variante a son propre instantané)
+ * @param chemin Reçoit le chemin de l'instantané
+ * @param taille Taille du tampon chemin
+ * @return 0 en cas de succès, -1 si aucun répertoire de cache n'est utilisable
+ */
+static int cheminInstantane(const IdentiteFichier* identite, int variante, char* chemin, size_t taille) {
+    char repertoire[PATH_MAX];
+    if (repertoireCache(repertoire, sizeof(repertoire)) != 0) {
+        return -1;
+    }
+    uint64_t cle = hacherOctets(0xCBF29CE484222325ULL, identite->chemin_absolu, strlen(identite->chemin_absolu));
+    int n = snprintf(chemin, taille, "%s/%016llx-%d.bin", repertoire, (unsigned long long)cle, variante);
+    return n < 0 || (size_t)n >= taille ? -1 : 0;
+}
+
+// Fichier du répertoire du cache, candidat à la suppression
+typedef struct {
+    char* nom;
+    int64_t date;                 // Date de modification en nanosecondes (mise à jour à chaque chargement)
+    uint64_t taille;
+} FichierCache;
+
+static pthread_mutex_t verrou_cache = PTHREAD_MUTEX_INITIALIZER;
+static int taille_cache_connue;
+static uint64_t taille_cache;     // Octets du cache au dernier parcours, plus ceux écrits depuis par ce processus
+
+static int comparerDatesFichiers(const void* a, const void* b) {
+    int64_t date_a = ((const FichierCache*)a)->date, date_b = ((const FichierCache*)b)->date;
+    return (date_a > date_b) - (date_a < date_b);
+}
+
+/**
+ * Mesure la place occupée par le cache et, si elle dépasse la limite, supprime les instantanés les moins récemment
+ * utilisés jusqu'à revenir aux trois quarts de la limite (la marge évite de parcourir le répertoire à chaque
+ * enregistrement)
+ *
+ * @param repertoire Répertoire du cache
+ * @param garde Nom de l'instantané qui vient d'être écrit, jamais supprimé
+ * @param limite Place maximale en octets
+ * @return Octets encore occupés par le cache
+ */
+static uint64_t nettoyerCache(const char* repertoire, const char* garde, uint64_t limite) {
+    DIR* dossier = opendir(repertoire);
+    if (dossier == NULL) {
+        return 0;
+    }
+    FichierCache* fichiers = NULL;
+    size_t nb_fichiers = 0, capacite = 0;
+    uint64_t total = 0;
+    struct dirent* entree;
+    while ((entree = readdir(dossier)) != NULL) {
+        struct stat infos;
+        if (fstatat(dirfd(dossier), entree->d_name, &infos, AT_SYMLINK_NOFOLLOW) != 0 || !S_ISREG(infos.st_mode)) {
+            continue;
+        }
+        total += (uint64_t)infos.st_size;
+        if (strcmp(entree->d_name, garde) == 0) {
+            continue;
+        }
+        if (nb_fichiers == capacite) {
+            size_t nouvelle_capacite = capacite ? capacite * 2 : 64;
+            FichierCache* agrandis = realloc(fichiers, nouvelle_capacite * sizeof(FichierCache));
+            if (agrandis == NULL) {
+                break;
+            }
+            fichiers = agrandis;
+            capacite = nouvelle_capacite;
+        }
+        char* nom = strdup(entree->d_name);
+        if (nom == NULL) {
+            break;
+        }
+        fichiers[nb_fichiers].nom = nom;
+        fichiers[nb_fichiers].date = (int64_t)infos.st_mtim.tv_sec * 1000000000 + infos.st_mtim.tv_nsec;
+        fichiers[nb_fichiers].taille = (uint64_t)infos.st_size;
+        nb_fichiers++;
+    }
+
+    if (total > limite) {
+        qsort(fichiers, nb_fichiers, sizeof(FichierCache), comparerDatesFichiers);
+        for (size_t i = 0; i < nb_fichiers && total > limite / 4 * 3; i++) {
+            if (unlinkat(dirfd(dossier), fichiers[i].nom, 0) == 0) {
+                total -= fichiers[i].taille;
+            }
+        }
+    }
+    for (size_t i = 0; i < nb_fichiers; i++) {
+        free(fichiers[i].nom);
+    }
+    free(fichiers);
+    closedir(dossier);
+    return total;
+}
+
+/**
+ * Tient compte d'un instantané qui vient d'être écrit et fait respecter TAILLE_CACHE_MAX_MIO
+ * Le répertoire n'est parcouru qu'au premier enregistrement du processus, puis chaque fois que le total tenu à jour
+ * dépasse la limite (les instantanés écrits par d'autres processus ne sont vus qu'à ce moment)
+ *
+ * @param chemin Chemin de l'instantané écrit
+ * @param ajout Variation de la place occupée (taille écrite moins celle de l'instantané remplacé)
+ */
+static void limiterCache(const char* chemin, int64_t ajout) {
+    uint64_t limite = (uint64_t)TAILLE_CACHE_MAX_MIO << 20;
+    if (limite == 0) {
+        return;
+    }
+    const char* separateur = strrchr(chemin, '/');
+    char repertoire[PATH_MAX];
+    snprintf(repertoire, sizeof(repertoire), "%.*s", (int)(separateur - chemin), chemin);
+
+    pthread_mutex_lock(&verrou_cache);
+    if (ajout < 0 && (uint64_t)-ajout > taille_cache) {
+        taille_cache = 0;
+    } else {
+        taille_cache += (uint64_t)ajout;
+    }
+    if (!taille_cache_connue || taille_cache > limite) {
+        taille_cache = nettoyerCache(repertoire, separateur + 1, limite);
+        taille_cache_connue = 1;
+    }
+    pthread_mutex_unlock(&verrou_cache);
+}
+
+/**
+ * Calcule l'empreinte des premiers octets d'un fichier : hachage de leur nombre et de NB_ECHANTILLONS_EMPREINTE
+ * blocs répartis entre eux (tous les octets s'ils sont peu nombreux), pour rester instantanée sur les très gros
+ * fichiers. L'empreinte d'un début de fichier peut ainsi être comparée à celle du fichier avant un ajout.
+ *
+ * @param descripteur Fichier ouvert en lecture
+ * @param taille Nombre d'octets couverts par l'empreinte
+ * @param empreinte Reçoit l'empreinte
+ * @return 0 en cas de succès, -1 en cas d'erreur de lecture
+ */
+static int calculerEmpreinte(int descripteur, uint64_t taille, uint64_t* empreinte) {
+    uint64_t hachage = hacherOctets(0xCBF29CE484222325ULL, &taille, sizeof(taille));
+    unsigned char bloc[TAILLE_ECHANTILLON_EMPREINTE];
+    uint64_t total = (uint64_t)NB_ECHANTILLONS_EMPREINTE * TAILLE_ECHANTILLON_EMPREINTE;
+    for (int i = 0; i < NB_ECHANTILLONS_EMPREINTE; i++) {
+        // Peu d'octets : blocs consécutifs ; sinon blocs régulièrement espacés, le dernier finissant la plage
+        uint64_t position = (uint64_t)i * TAILLE_ECHANTILLON_EMPREINTE;
+        if (taille > total) {
+            position = (taille - TAILLE_ECHANTILLON_EMPREINTE) * i / (NB_ECHANTILLONS_EMPREINTE - 1);
+        }
+        if (position >= taille) {
+            break;
+        }
+        size_t longueur = taille - position < sizeof(bloc) ? (size_t)(taille - position) : sizeof(bloc);
+        ssize_t lus = pread(descripteur, bloc, longueur, (off_t)position);
+        if (lus < 0) {
+            return -1;
+        }
+        hachage = hacherOctets(hachage, bloc, (size_t)lus);
+    }
+    *empreinte = hachage;
+    return 0;
+}
+
+/**
+ * Relève l'identité d'un fichier ordinaire : chemin absolu, taille, date de modification et empreinte
+ *
+ * @param chemin Chemin du fichier
+ * @param identite Reçoit l'identité du fichier
+ * @return 0 en cas de succès, -1 si le fichier n'est pas un fichier ordinaire lisible
+ */
+int identifierFichier(const char* chemin, IdentiteFichier* identite) {
+    memset(identite, 0, sizeof(IdentiteFichier));
+    if (realpath(chemin, identite->chemin_absolu) == NULL) {
+        return -1;
+    }
+    int descripteur = open(chemin, O_RDONLY);
+    if (descripteur < 0) {
+        return -1;
+    }
+    struct stat infos;
+    if (fstat(descripteur, &infos) != 0 || !S_ISREG(infos.st_mode)) {
+        close(descripteur);
+        return -1;
+    }
+    identite->taille = (uint64_t)infos.st_size;
+    identite->mtime_sec = (int64_t)infos.st_mtim.tv_sec;
+    identite->mtime_nsec = (int64_t)infos.st_mtim.tv_nsec;
+    int resultat = calculerEmpreinte(descripteur, identite->taille, &identite->empreinte);
+    close(descripteur);
+    return resultat;
+}
+
+/**
+ * Vérifie que le fichier a seulement été complété depuis l'instantané : il est plus grand, et ses premiers octets
+ * ont la même empreinte que le fichier enregistré (un fichier tronqué ou réécrit doit être relu entièrement)
+ *
+ * @param identite Identité actuelle du fichier
+ * @param entete En-tête de l'instantané
+ * @return 1 si la lecture peut reprendre où l'instantané s'est arrêté, 0 sinon
+ */
+static int estPrefixe(const IdentiteFichier* identite, const EnteteCache* entete) {
+    if (identite->taille <= entete->taille_fichier) {
+        return 0;
+    }
+    int descripteur = open(identite->chemin_absolu, O_RDONLY);
+    if (descripteur < 0) {
+        return 0;
+    }
+    uint64_t empreinte;
+    int prefixe = calculerEmpreinte(descripteur, entete->taille_fichier, &empreinte) == 0 &&
+                  empreinte == entete->empreinte;
+    close(descripteur);
+    return prefixe;
+}
+
+/**
+ * Vérifie un instantané projeté en mémoire et, s'il correspond au fichier ou à son début, en extrait l'analyse
+ *
+ * @param zone Contenu de l'instantané
+ * @param taille Taille de l'instantané (au moins sizeof(EnteteCache))
+ * @param identite Identité actuelle du fichier
+ * @param variante Options d'analyse
+ * @param reprise Reçoit la position de reprise et les compteurs de l'analyse
+ * @param vocabulaire Table qui reçoit le vocabulaire
+ * @param ngrammes N-grammes qui reçoivent ceux de l'instantané (NULL si l'analyse ne les compte pas)
+ * @param tokeniseur Tokeniseur initialisé qui reçoit l'état de la lecture
+ * @return CACHE_A_JOUR ou CACHE_PREFIXE si l'instantané est valable, CACHE_ABSENT sinon
+ */
+static EtatCache lireInstantane(const unsigned char* zone, size_t taille, const IdentiteFichier* identite,
+                                int variante, RepriseAnalyse* reprise, TableMots* vocabulaire, Ngrammes* ngrammes,
+                                Tokeniseur* tokeniseur) {
+    const EnteteCache* entete = (const EnteteCache*)zone;
+    size_t longueur_chemin = strlen(identite->chemin_absolu) + 1;
+    size_t caracteres_tokeniseur;
+    if (memcmp(entete->magique, MAGIQUE_CACHE, sizeof(entete->magique)) != 0 ||
+        entete->version != VERSION_CACHE ||
+        entete->taille_wchar != sizeof(wchar_t) ||
+        entete->taille_entete != sizeof(EnteteCache) ||
+        entete->variante != (uint32_t)variante ||
+        entete->longueur_chemin != arrondir8(longueur_chemin) ||
+        entete->reprise.octets_lus > entete->taille_fichier ||
+        textesTokeniseur(&entete->tokeniseur, &caracteres_tokeniseur) != 0) {
+        return CACHE_ABSENT;
+    }
+
+    // Chaque partie doit tenir dans le fichier (les tailles sont vérifiées avant d'être multipliées)
+    size_t reste = taille - sizeof(EnteteCache);
+    size_t taille_tokeniseur = arrondir8(caracteres_tokeniseur * sizeof(wchar_t));
+    if (entete->longueur_chemin > reste) {
+        return CACHE_ABSENT;
+    }
+    reste -= entete->longueur_chemin;
+    if (taille_tokeniseur > reste) {
+        return CACHE_ABSENT;
+    }
+    reste -= taille_tokeniseur;
+    if (entete->capacite_cases > reste / sizeof(CaseMot)) {
+        return CACHE_ABSENT;
+    }
+    reste -= entete->capacite_cases * sizeof(CaseMot);
+    if (entete->nb_mots > reste / sizeof(Mot)) {
+        return CACHE_ABSENT;
+    }
+    reste -= entete->nb_mots * sizeof(Mot);
+    if (entete->taille_textes > reste / sizeof(wchar_t) ||
+        arrondir8(entete->taille_textes * sizeof(wchar_t)) > reste) {
+        return CACHE_ABSENT;
+    }
+    reste -= arrondir8(entete->taille_textes * sizeof(wchar_t));
+    for (int t = 0; t < ORDRE_NGRAMME_MAX - 1; t++) {
+        const EtatTableNgrammes* table = &entete->ngrammes.tables[t];
+        if ((ngrammes == NULL && (table->capacite != 0 || table->largeur_esquisse != 0)) ||
+            table->capacite > reste / sizeof(Ngramme)) {
+            return CACHE_ABSENT;
+        }
+        reste -= table->capacite * sizeof(Ngramme);
+        if (table->largeur_esquisse > reste / (PROFONDEUR_ESQUISSE * sizeof(uint32_t))) {
+            return CACHE_ABSENT;
+        }
+        reste -= table->largeur_esquisse * PROFONDEUR_ESQUISSE * sizeof(uint32_t);
+    }
+    if (reste != 0) {
+        return CACHE_ABSENT;
+    }
+
+    const char* chemin_enregistre = (const char*)(zone + sizeof(EnteteCache));
+    if (memcmp(chemin_enregistre, identite->chemin_absolu, longueur_chemin) != 0) {
+        return CACHE_ABSENT; // Deux chemins avec le même hachage
+    }
+
+    // Fichier identique, ou seulement complété : toute autre modification impose une nouvelle lecture
+    EtatCache etat;
+    if (entete->taille_fichier == identite->taille && entete->mtime_sec == identite->mtime_sec &&
+        entete->mtime_nsec == identite->mtime_nsec && entete->empreinte == identite->empreinte) {
+        etat = CACHE_A_JOUR;
+    } else if (estPrefixe(identite, entete)) {
+        etat = CACHE_PREFIXE;
+    } else {
+        return CACHE_ABSENT;
+    }
+
+    const wchar_t* textes_tokeniseur = (const wchar_t*)(chemin_enregistre + entete->longueur_chemin);
+    const CaseMot* cases = (const CaseMot*)((const unsigned char*)textes_tokeniseur + taille_tokeniseur);
+    const Mot* mots = (const Mot*)(cases + entete->capacite_cases);
+    const wchar_t* textes = (const wchar_t*)(mots + entete->nb_mots);
+    const Ngramme* cases_ngrammes[ORDRE_NGRAMME_MAX - 1];
+    const uint32_t* esquisses[ORDRE_NGRAMME_MAX - 1];
+    const unsigned char* suite = (const unsigned char*)textes + arrondir8(entete->taille_textes * sizeof(wchar_t));
+    for (int t = 0; t < ORDRE_NGRAMME_MAX - 1; t++) {
+        cases_ngrammes[t] = (const Ngramme*)suite;
+        esquisses[t] = (const uint32_t*)(cases_ngrammes[t] + entete->ngrammes.tables[t].capacite);
+        suite = (const unsigned char*)(esquisses[t] + entete->ngrammes.tables[t].largeur_esquisse *
+                                                      PROFONDEUR_ESQUISSE);
+    }
+    if (restaurerTableMots(vocabulaire, cases, entete->capacite_cases, mots, entete->nb_mots,
+                           textes, entete->taille_textes) != 0) {
+        return CACHE_ABSENT;
+    }
+    if (ngrammes != NULL &&
+        restaurerNgrammes(ngrammes, &entete->ngrammes, cases_ngrammes, esquisses, vocabulaire->nb_mots) != 0) {
+        viderTableMots(vocabulaire);
+        return CACHE_ABSENT;
+    }
+    if (restaurerTokeniseur(tokeniseur, &entete->tokeniseur, textes_tokeniseur) != 0) {
+        viderTableMots(vocabulaire);
+        if (ngrammes != NULL) {
+            viderNgrammes(ngrammes);
+        }
+        return CACHE_ABSENT;
+    }
+    *reprise = entete->reprise;
+    return etat;
+}
+
+/**
+ * Charge l'instantané d'une analyse si le fichier n'a pas changé depuis son enregistrement, ou s'il a seulement été
+ * complété (journal, transcription...) : il ne reste alors qu'à lire les octets ajoutés
+ * L'instantané est projeté en mémoire (mmap), vérifié, puis le vocabulaire et les n-grammes sont recopiés dans
+ * leurs tables sans recalculer les hachages
+ *
+ * @param identite Identité actuelle du fichier
+ * @param variante Options d'analyse
+ * @param reprise Reçoit la position de reprise et les compteurs de l'analyse
+ * @param vocabulaire Table qui reçoit le vocabulaire (sa mémoire est réutilisée)
+ * @param ngrammes N-grammes initialisés qui reçoivent ceux de l'instantané (NULL si l'analyse ne les compte pas)
+ * @param tokeniseur Tokeniseur initialisé qui reçoit l'état de la lecture, à terminer par terminerTokeniseur
+ * @return CACHE_A_JOUR, CACHE_PREFIXE, ou CACHE_ABSENT si l'instantané est absent, périmé, d'une autre version
+ *         ou invalide (les tables sont alors vides et le tokeniseur inchangé)
+ */
+EtatCache chargerAnalyseCache(const IdentiteFichier* identite, int variante, RepriseAnalyse* reprise,
+                              TableMots* vocabulaire, Ngrammes* ngrammes, Tokeniseur* tokeniseur) {
+    char chemin[PATH_MAX];
+    if (cheminInstantane(identite, variante, chemin, sizeof(chemin)) != 0) {
+        return CACHE_ABSENT;
+    }
+    int descripteur = open(chemin, O_RDONLY);
+    if (descripteur < 0) {
+        return CACHE_ABSENT;
+    }
+    struct stat infos;
+    if (fstat(descripteur, &infos) != 0 || (size_t)infos.st_size < sizeof(EnteteCache)) {
+        close(descripteur);
+        return CACHE_ABSENT;
+    }
+    size_t taille = (size_t)infos.st_size;
+    void* zone = mmap(NULL, taille, PROT_READ, MAP_PRIVATE, descripteur, 0);
+    close(descripteur);
+    if (zone == MAP_FAILED) {
+        return CACHE_ABSENT;
+    }
+    EtatCache etat = lireInstantane(zone, taille, identite, variante, reprise, vocabulaire, ngrammes, tokeniseur);
+    munmap(zone, taille);
+    if (etat != CACHE_ABSENT) {
+        utimensat(AT_FDCWD, chemin, NULL, 0); // Date d'utilisation, qui ordonne les suppressions de limiterCache
+    }
+    return etat;
+}
+
+/**
+ * Enregistre l'instantané d'une analyse arrêtée à la fin du fichier, avant terminerTokeniseur
+ * L'instantané est écrit dans un fichier temporaire puis renommé, pour qu'un lecteur ne voie jamais
+ * un instantané incomplet ; les instantanés les moins récemment utilisés sont ensuite supprimés si le cache dépasse
+ * TAILLE_CACHE_MAX_MIO
+ *
+ * @param identite Identité du fichier relevée avant sa lecture
+ * @param variante Options d'analyse
+ * @param reprise Position atteinte par la lecture et compteurs de l'analyse
+ * @param vocabulaire Vocabulaire de l'analyse
+ * @param ngrammes N-grammes de l'analyse (NULL si elle ne les compte pas)
+ * @param tokeniseur Tokeniseur arrêté à la fin du fichier (pas encore terminé)
+ * @return 0 en cas de succès, -1 en cas d'erreur (l'analyse reste utilisable, elle n'est simplement pas en cache)
+ */
+int enregistrerAnalyseCache(const IdentiteFichier* identite, int variante, const RepriseAnalyse* reprise,
+                            const TableMots* vocabulaire, const Ngrammes* ngrammes, const Tokeniseur* tokeniseur) {
+    static atomic_uint compteur;
+    char chemin[PATH_MAX];
+    char temporaire[PATH_MAX + 32];
+    if (cheminInstantane(identite, variante, chemin, sizeof(chemin)) != 0) {
+        return -1;
+    }
+    snprintf(temporaire, sizeof(temporaire), "%s.%ld.%u", chemin, (long)getpid(), atomic_fetch_add(&compteur, 1));
+
+    EnteteCache entete;
+    memset(&entete, 0, sizeof(entete));
+    memcpy(entete.magique, MAGIQUE_CACHE, sizeof(entete.magique));
+    entete.version = VERSION_CACHE;
+    entete.taille_wchar = sizeof(wchar_t);
+    entete.taille_entete = sizeof(EnteteCache);
+    entete.variante = (uint32_t)variante;
+    entete.taille_fichier = identite->taille;
+    entete.mtime_sec = identite->mtime_sec;
+    entete.mtime_nsec = identite->mtime_nsec;
+    entete.empreinte = identite->empreinte;
+    size_t longueur_chemin = strlen(identite->chemin_absolu) + 1;
+    entete.longueur_chemin = arrondir8(longueur_chemin);
+    entete.capacite_cases = vocabulaire->capacite;
+    entete.nb_mots = vocabulaire->nb_mots;
+    entete.taille_textes = vocabulaire->taille_textes;
+    entete.reprise = *reprise;
+    sauvegarderTokeniseur(tokeniseur, &entete.tokeniseur);
+    if (ngrammes != NULL) {
+        sauvegarderNgrammes(ngrammes, &entete.ngrammes);
+    }
+
+    static const char zeros[8];
+    SortieTexte sortie;
+    if (ouvrirSortie(&sortie, temporaire) != 0) {
+        return -1;
+    }
+    ecrireOctets(&sortie, &entete, sizeof(entete));
+    ecrireOctets(&sortie, identite->chemin_absolu, longueur_chemin);
+    ecrireOctets(&sortie, zeros, entete.longueur_chemin - longueur_chemin);
+    ecrireOctets(&sortie, tokeniseur->mot_courant, (size_t)tokeniseur->pos_mot * sizeof(wchar_t));
+    ecrireOctets(&sortie, tokeniseur->phrase_plus_longue.texte,
+                 tokeniseur->phrase_plus_longue.conserves * sizeof(wchar_t));
+    ecrireOctets(&sortie, tokeniseur->phrase_plus_courte.texte,
+                 tokeniseur->phrase_plus_courte.conserves * sizeof(wchar_t));
+    ecrireOctets(&sortie, tokeniseur->phrase_courante.texte, tokeniseur->phrase_courante.conserves * sizeof(wchar_t));
+    size_t taille_tokeniseur;
+    textesTokeniseur(&entete.tokeniseur, &taille_tokeniseur);
+    taille_tokeniseur *= sizeof(wchar_t);
+    ecrireOctets(&sortie, zeros, arrondir8(taille_tokeniseur) - taille_tokeniseur);
+    if (vocabulaire->capacite > 0) {
+        ecrireOctets(&sortie, vocabulaire->cases, vocabulaire->capacite * sizeof(CaseMot));
+        ecrireOctets(&sortie, vocabulaire->mots, vocabulaire->nb_mots * sizeof(Mot));
+        ecrireOctets(&sortie, vocabulaire->textes, vocabulaire->taille_textes * sizeof(wchar_t));
+    }
+    size_t taille_textes = vocabulaire->taille_textes * sizeof(wchar_t);
+    ecrireOctets(&sortie, zeros, arrondir8(taille_textes) - taille_textes);
+    for (int t = 0; ngrammes != NULL && t < ORDRE_NGRAMME_MAX - 1; t++) {
+        const TableNgrammes* table = &ngrammes->tables[t];
+        ecrireOctets(&sortie, table->cases, entete.ngrammes.tables[t].capacite * sizeof(Ngramme));
+        ecrireOctets(&sortie, table->esquisse,
+                     entete.ngrammes.tables[t].largeur_esquisse * PROFONDEUR_ESQUISSE * sizeof(uint32_t));
+    }
+    struct stat ancien, nouveau;
+    int64_t taille_remplacee = stat(chemin, &ancien) == 0 ? (int64_t)ancien.st_size : 0;
+    if (fermerSortie(&sortie) != 0 || stat(temporaire, &nouveau) != 0 || rename(temporaire, chemin) != 0) {
+        unlink(temporaire);
+        return -1;
+    }
+    limiterCache(chemin, (int64_t)nouveau.st_size - taille_remplacee);
+    return 0;
+}
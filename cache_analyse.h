@@ -0,0 +1,51 @@
+#ifndef CACHE_ANALYSE_H
+#define CACHE_ANALYSE_H
+
+#include <limits.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#include "ngrammes.h"
+#include "table_mots.h"
+#include "tokeniseur.h"
+
+#define VERSION_CACHE 8                 // À incrémenter à chaque changement du format des instantanés ou des mots
+#define NB_ECHANTILLONS_EMPREINTE 16    // Nombre de blocs du fichier lus pour calculer son empreinte
+#define TAILLE_ECHANTILLON_EMPREINTE 4096
+
+#ifndef TAILLE_CACHE_MAX_MIO
+#define TAILLE_CACHE_MAX_MIO 1024       // Place au plus occupée par les instantanés, en Mio (0 : sans limite)
+#endif
+
+// État d'une analyse arrêtée à la fin du fichier, avant terminerTokeniseur, tel qu'il est enregistré dans le cache
+// avec le vocabulaire, les n-grammes et l'état du tokeniseur : si le fichier grandit, seuls les octets ajoutés sont lus
+typedef struct {
+    uint64_t octets_lus;          // Octets du fichier déjà découpés : la lecture reprend à cette position
+    long long nb_mots_uniques;
+    long long nb_verbes;
+    long long nb_noms_propres;
+} RepriseAnalyse;
+
+// Résultat de la recherche de l'instantané d'un fichier
+typedef enum {
+    CACHE_ABSENT = -1,   // Aucun instantané utilisable (absent, périmé, d'une autre version ou invalide)
+    CACHE_A_JOUR,        // Fichier inchangé : tous ses octets ont déjà été lus
+    CACHE_PREFIXE        // Fichier complété depuis l'instantané : la lecture reprend à octets_lus
+} EtatCache;
+
+// Identité d'un fichier analysé : un instantané n'est valable que si elle n'a pas changé
+typedef struct {
+    char chemin_absolu[PATH_MAX];
+    uint64_t taille;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint64_t empreinte;           // Hachage de la taille et de blocs répartis dans tout le fichier
+} IdentiteFichier;
+
+int identifierFichier(const char* chemin, IdentiteFichier* identite);
+EtatCache chargerAnalyseCache(const IdentiteFichier* identite, int variante, RepriseAnalyse* reprise,
+                              TableMots* vocabulaire, Ngrammes* ngrammes, Tokeniseur* tokeniseur);
+int enregistrerAnalyseCache(const IdentiteFichier* identite, int variante, const RepriseAnalyse* reprise,
+                            const TableMots* vocabulaire, const Ngrammes* ngrammes, const Tokeniseur* tokeniseur);
+
+#endif
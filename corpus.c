@@ -0,0 +1,295 @@
+#include "corpus.h"
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+/**
+ * Initialise un corpus vide
+ *
+ * @param corpus Pointeur vers le corpus
+ */
+void initialiserCorpus(Corpus* corpus) {
+    memset(corpus, 0, sizeof(Corpus));
+    initialiserTableMots(&corpus->vocabulaire);
+}
+
+/**
+ * Libère la mémoire d'un corpus et le remet à vide
+ *
+ * @param corpus Pointeur vers le corpus
+ */
+void libererCorpus(Corpus* corpus) {
+    libererTableMots(&corpus->vocabulaire);
+    free(corpus->documents);
+    initialiserCorpus(corpus);
+}
+
+// Agrandit le tableau des fréquences documentaires pour qu'il couvre n mots (nouveaux compteurs à zéro)
+static int agrandirDocuments(Corpus* corpus, size_t n) {
+    if (n <= corpus->capacite_documents) {
+        return 0;
+    }
+    size_t capacite = corpus->capacite_documents ? corpus->capacite_documents * 2 : CAPACITE_DOCUMENTS_INITIALE;
+    while (capacite < n) {
+        capacite *= 2;
+    }
+    uint32_t* documents = realloc(corpus->documents, capacite * sizeof(uint32_t));
+    if (documents == NULL) {
+        return -1;
+    }
+    memset(documents + corpus->capacite_documents, 0, (capacite - corpus->capacite_documents) * sizeof(uint32_t));
+    corpus->documents = documents;
+    corpus->capacite_documents = capacite;
+    return 0;
+}
+
+// Ajoute les mots d'une table au vocabulaire du corpus, en reprenant les hachages rangés dans ses cases
+// documents donne la fréquence documentaire de chaque mot de la table (NULL : chaque mot compte pour un document)
+static int ajouterVocabulaire(Corpus* corpus, const TableMots* table, const uint32_t* documents) {
+    for (size_t c = 0; c < table->capacite; c++) {
+        CaseMot case_mot = table->cases[c];
+        if (case_mot.indice == 0) {
+            continue;
+        }
+        const Mot* source = &table->mots[case_mot.indice - 1];
+        int nouveau;
+        Mot* mot = insererMotHache(&corpus->vocabulaire, texteMot(table, source), (size_t)source->longueur,
+                                   case_mot.hachage, source->attributs & ATTRIBUTS_TEXTE, &nouveau);
+        if (mot == NULL || agrandirDocuments(corpus, corpus->vocabulaire.nb_mots) != 0) {
+            return -1;
+        }
+        mot->frequence += source->frequence;
+        corpus->documents[mot - corpus->vocabulaire.mots] += documents != NULL ? documents[case_mot.indice - 1] : 1;
+    }
+    return 0;
+}
+
+/**
+ * Ajoute le vocabulaire d'un document au corpus
+ *
+ * @param corpus Pointeur vers le corpus
+ * @param document Vocabulaire du document
+ * @param nb_mots Nombre de mots du document (avec répétitions)
+ * @return 0 en cas de succès, -1 si la mémoire manque (le corpus est alors incomplet)
+ */
+int ajouterDocumentCorpus(Corpus* corpus, const TableMots* document, uint64_t nb_mots) {
+    if (ajouterVocabulaire(corpus, document, NULL) != 0) {
+        return -1;
+    }
+    corpus->nb_documents++;
+    corpus->nb_mots += nb_mots;
+    return 0;
+}
+
+/**
+ * Fusionne un corpus dans un autre : fréquences et fréquences documentaires s'additionnent
+ * (les deux corpus doivent porter sur des documents différents)
+ * Un corpus de destination vide reprend simplement la mémoire de la source, sans réinsérer ses mots
+ *
+ * @param destination Corpus qui reçoit les mots
+ * @param source Corpus fusionné, vidé et libéré par la fusion
+ * @return 0 en cas de succès, -1 si la mémoire manque (la destination est alors incomplète)
+ */
+int fusionnerCorpus(Corpus* destination, Corpus* source) {
+    if (destination->nb_documents == 0 && destination->vocabulaire.nb_mots == 0) {
+        Corpus vide = *destination;
+        *destination = *source;
+        *source = vide;
+        libererCorpus(source);
+        return 0;
+    }
+    int resultat = ajouterVocabulaire(destination, &source->vocabulaire, source->documents);
+    if (resultat == 0) {
+        destination->nb_documents += source->nb_documents;
+        destination->nb_mots += source->nb_mots;
+    }
+    libererCorpus(source);
+    return resultat;
+}
+
+// Fusion de deux corpus partiels, exécutée par une tâche de l'ordonnanceur
+typedef struct {
+    Corpus* destination;
+    Corpus* source;
+    atomic_int* echecs;
+} FusionCorpus;
+
+static void tacheFusionCorpus(void* argument) {
+    FusionCorpus* fusion = argument;
+    if (fusionnerCorpus(fusion->destination, fusion->source) != 0) {
+        atomic_fetch_add(fusion->echecs, 1);
+    }
+}
+
+/**
+ * Réduit des corpus partiels (par exemple un par thread) en un seul, rangé dans partiels[0]
+ * Les corpus sont fusionnés deux à deux en arbre : à chaque niveau, les fusions indépendantes sont confiées
+ * en parallèle à l'ordonnanceur, si bien que n corpus sont réduits en log2(n) niveaux
+ *
+ * @param partiels Tableau de corpus, tous vidés sauf le premier
+ * @param nb_partiels Nombre de corpus
+ * @param ordonnanceur Ordonnanceur qui exécute les fusions (NULL pour les faire dans le thread appelant)
+ * @return 0 en cas de succès, -1 si la mémoire manque
+ */
+int reduireCorpus(Corpus* partiels, size_t nb_partiels, Ordonnanceur* ordonnanceur) {
+    atomic_int echecs = 0;
+    FusionCorpus* fusions = malloc((nb_partiels / 2 + 1) * sizeof(FusionCorpus));
+    if (fusions == NULL) {
+        ordonnanceur = NULL; // Fusions faites une à une, sans tableau de tâches
+    }
+    for (size_t pas = 1; pas < nb_partiels; pas *= 2) {
+        size_t nb_fusions = 0;
+        for (size_t i = 0; i + pas < nb_partiels; i += 2 * pas) {
+            if (ordonnanceur == NULL) {
+                if (fusionnerCorpus(&partiels[i], &partiels[i + pas]) != 0) {
+                    atomic_fetch_add(&echecs, 1);
+                }
+                continue;
+            }
+            FusionCorpus* fusion = &fusions[nb_fusions++];
+            fusion->destination = &partiels[i];
+            fusion->source = &partiels[i + pas];
+            fusion->echecs = &echecs;
+            if (soumettreTache(ordonnanceur, tacheFusionCorpus, fusion) != 0) {
+                tacheFusionCorpus(fusion);
+            }
+        }
+        if (ordonnanceur != NULL) {
+            attendreTaches(ordonnanceur); // Un niveau doit être terminé avant de fusionner ses résultats
+        }
+    }
+    free(fusions);
+    return atomic_load(&echecs) == 0 ? 0 : -1;
+}
+
+/**
+ * Retourne le nombre de documents du corpus qui contiennent un mot
+ *
+ * @param corpus Pointeur vers le corpus
+ * @param mot Mot recherché
+ * @return Fréquence documentaire du mot (0 s'il est absent)
+ */
+uint32_t frequenceDocumentaire(const Corpus* corpus, const wchar_t* mot) {
+    const Mot* trouve = chercherMot(&corpus->vocabulaire, mot);
+    return trouve != NULL ? corpus->documents[trouve - corpus->vocabulaire.mots] : 0;
+}
+
+/**
+ * Calcule le poids TF-IDF d'un mot dans un document : (frequence / nb_mots) * ln(nb_documents / documents)
+ * Un mot présent dans tous les documents a un poids nul ; un mot absent du corpus compte pour un document
+ *
+ * @param corpus Corpus de référence
+ * @param frequence Fréquence du mot dans le document
+ * @param nb_mots Nombre de mots du document
+ * @param documents Fréquence documentaire du mot dans le corpus
+ * @return Poids du mot (0 pour un document sans mots ou un corpus vide)
+ */
+double poidsTfIdf(const Corpus* corpus, long long frequence, uint64_t nb_mots, uint32_t documents) {
+    if (nb_mots == 0 || corpus->nb_documents == 0) {
+        return 0.0;
+    }
+    if (documents == 0) {
+        documents = 1;
+    }
+    return (double)frequence / (double)nb_mots * log((double)corpus->nb_documents / (double)documents);
+}
+
+// Compare deux mots d'un document par poids décroissant, les égalités étant départagées par l'ordre des textes
+static int comparerPoids(const TableMots* document, double poids_a, uint32_t a, double poids_b, uint32_t b) {
+    if (poids_a != poids_b) {
+        return poids_a > poids_b ? -1 : 1;
+    }
+    return wcscmp(texteMot(document, &document->mots[a]), texteMot(document, &document->mots[b]));
+}
+
+// Fait descendre une entrée dans le tas (indices et poids rangés côte à côte), la racine étant le moins bon mot
+static void tamiserTasPoids(const TableMots* document, uint32_t* tas, double* poids, size_t taille,
+                            size_t position) {
+    for (;;) {
+        size_t pire = position;
+        size_t gauche = 2 * position + 1;
+        size_t droite = gauche + 1;
+        if (gauche < taille && comparerPoids(document, poids[gauche], tas[gauche], poids[pire], tas[pire]) > 0) {
+            pire = gauche;
+        }
+        if (droite < taille && comparerPoids(document, poids[droite], tas[droite], poids[pire], tas[pire]) > 0) {
+            pire = droite;
+        }
+        if (pire == position) {
+            return;
+        }
+        uint32_t echange = tas[position];
+        tas[position] = tas[pire];
+        tas[pire] = echange;
+        double echange_poids = poids[position];
+        poids[position] = poids[pire];
+        poids[pire] = echange_poids;
+        position = pire;
+    }
+}
+
+/**
+ * Recherche les k mots d'un document qui ont le plus grand poids TF-IDF par rapport au corpus
+ * Comme meilleursMots, un tas borné est construit directement dans resultat (et scores) ; la fréquence
+ * documentaire de chaque mot est retrouvée avec le hachage rangé dans les cases du document
+ *
+ * @param corpus Corpus de référence
+ * @param document Vocabulaire du document
+ * @param nb_mots Nombre de mots du document (avec répétitions)
+ * @param k Nombre maximal de mots à retenir
+ * @param resultat Tableau d'au moins k indices dans document->mots, rempli par poids décroissant
+ * @param scores Tableau d'au moins k poids, rempli en même temps que resultat
+ * @return Nombre de mots trouvés (au plus k)
+ */
+size_t meilleursTfIdf(const Corpus* corpus, const TableMots* document, uint64_t nb_mots, size_t k,
+                      uint32_t* resultat, double* scores) {
+    size_t taille = 0;
+    if (k == 0) {
+        return 0;
+    }
+
+    for (size_t c = 0; c < document->capacite; c++) {
+        CaseMot case_mot = document->cases[c];
+        if (case_mot.indice == 0) {
+            continue;
+        }
+        uint32_t i = case_mot.indice - 1;
+        const Mot* mot = &document->mots[i];
+        const Mot* commun = chercherMotHache(&corpus->vocabulaire, texteMot(document, mot), (size_t)mot->longueur,
+                                             case_mot.hachage);
+        uint32_t documents = commun != NULL ? corpus->documents[commun - corpus->vocabulaire.mots] : 0;
+        double poids = poidsTfIdf(corpus, mot->frequence, nb_mots, documents);
+
+        if (taille < k) {
+            // Remontée de la nouvelle entrée tant qu'elle est classée après son parent
+            size_t position = taille++;
+            while (position > 0 &&
+                   comparerPoids(document, poids, i, scores[(position - 1) / 2], resultat[(position - 1) / 2]) > 0) {
+                resultat[position] = resultat[(position - 1) / 2];
+                scores[position] = scores[(position - 1) / 2];
+                position = (position - 1) / 2;
+            }
+            resultat[position] = i;
+            scores[position] = poids;
+        } else if (comparerPoids(document, poids, i, scores[0], resultat[0]) < 0) {
+            resultat[0] = i;
+            scores[0] = poids;
+            tamiserTasPoids(document, resultat, scores, taille, 0);
+        }
+    }
+
+    // Tri par tas : le moins bon mot est placé à la fin, puis le tas se réduit d'une case
+    for (size_t fin = taille; fin > 1; fin--) {
+        uint32_t echange = resultat[0];
+        resultat[0] = resultat[fin - 1];
+        resultat[fin - 1] = echange;
+        double echange_poids = scores[0];
+        scores[0] = scores[fin - 1];
+        scores[fin - 1] = echange_poids;
+        tamiserTasPoids(document, resultat, scores, fin - 1, 0);
+    }
+    return taille;
+}
@@ -0,0 +1,33 @@
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ordonnanceur.h"
+#include "table_mots.h"
+
+#define CAPACITE_DOCUMENTS_INITIALE 1024   // Nombre de compteurs de documents alloués au premier mot
+
+// Vocabulaire commun à plusieurs documents analysés
+// Chaque mot garde sa fréquence totale (somme des fréquences dans les documents) et le nombre de documents
+// qui le contiennent : documents[i] correspond à vocabulaire.mots[i]
+typedef struct {
+    TableMots vocabulaire;
+    uint32_t* documents;          // Fréquence documentaire de chaque mot du vocabulaire
+    size_t capacite_documents;
+    uint64_t nb_documents;        // Documents ajoutés au corpus
+    uint64_t nb_mots;             // Mots lus dans tous les documents (avec répétitions)
+} Corpus;
+
+void initialiserCorpus(Corpus* corpus);
+void libererCorpus(Corpus* corpus);
+int ajouterDocumentCorpus(Corpus* corpus, const TableMots* document, uint64_t nb_mots);
+int fusionnerCorpus(Corpus* destination, Corpus* source);
+int reduireCorpus(Corpus* partiels, size_t nb_partiels, Ordonnanceur* ordonnanceur);
+uint32_t frequenceDocumentaire(const Corpus* corpus, const wchar_t* mot);
+double poidsTfIdf(const Corpus* corpus, long long frequence, uint64_t nb_mots, uint32_t documents);
+size_t meilleursTfIdf(const Corpus* corpus, const TableMots* document, uint64_t nb_mots, size_t k,
+                      uint32_t* resultat, double* scores);
+
+#endif
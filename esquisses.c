@@ -0,0 +1,469 @@
+#include "esquisses.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BITS_RANG (64 - PRECISION_HYPERLOGLOG)   // Bits du hachage dont les zéros de tête donnent le rang
+
+/**
+ * Calcule le hachage sur 64 bits d'un mot (FNV-1a, puis finalisation de MurmurHash3)
+ * Les bits de poids fort choisissent le registre HyperLogLog, les 32 bits de poids faible la case de l'index
+ * du résumé des mots fréquents
+ *
+ * @param mot Texte du mot
+ * @param longueur Nombre de caractères du mot
+ * @return Valeur de hachage
+ */
+static uint64_t hacherMot64(const wchar_t* mot, size_t longueur) {
+    uint64_t hachage = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < longueur; i++) {
+        hachage = (hachage ^ (uint32_t)mot[i]) * 0x100000001B3ULL;
+    }
+    hachage ^= hachage >> 33;
+    hachage *= 0xFF51AFD7ED558CCDULL;
+    hachage ^= hachage >> 33;
+    hachage *= 0xC4CEB9FE1A85EC53ULL;
+    hachage ^= hachage >> 33;
+    return hachage;
+}
+
+// Série σ de l'estimateur d'Ertl (registres restés à zéro)
+static double sigmaHyperLogLog(double x) {
+    if (x == 1.0) {
+        return INFINITY;
+    }
+    double y = 1.0;
+    double z = x;
+    for (;;) {
+        x *= x;
+        double precedent = z;
+        z += x * y;
+        y += y;
+        if (z == precedent) {
+            return z;
+        }
+    }
+}
+
+// Série τ de l'estimateur d'Ertl (registres au rang maximal)
+static double tauHyperLogLog(double x) {
+    if (x == 0.0 || x == 1.0) {
+        return 0.0;
+    }
+    double y = 1.0;
+    double z = 1.0 - x;
+    for (;;) {
+        x = sqrt(x);
+        double precedent = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+        if (z == precedent) {
+            return z / 3.0;
+        }
+    }
+}
+
+/**
+ * Estime le nombre d'éléments distincts vus par un HyperLogLog
+ * Estimateur d'Ertl (histogramme des rangs) : sans biais sur toute la plage, y compris pour les petits nombres,
+ * sans table de correction empirique
+ *
+ * @param hll Compteur à lire
+ * @return Nombre estimé d'éléments distincts (0 si aucun)
+ */
+double estimerDistincts(const HyperLogLog* hll) {
+    uint32_t histogramme[BITS_RANG + 2] = {0};
+    for (size_t i = 0; i < NB_REGISTRES_HYPERLOGLOG; i++) {
+        histogramme[hll->registres[i]]++;
+    }
+    double m = NB_REGISTRES_HYPERLOGLOG;
+    double z = m * tauHyperLogLog(1.0 - histogramme[BITS_RANG + 1] / m);
+    for (int k = BITS_RANG; k >= 1; k--) {
+        z = 0.5 * (z + histogramme[k]);
+    }
+    z += m * sigmaHyperLogLog(histogramme[0] / m);
+    return m * m / (2.0 * log(2.0) * z);
+}
+
+/**
+ * Alloue des esquisses vides
+ *
+ * @return Nouvelles esquisses (à libérer avec detruireEsquissesMots), ou NULL si la mémoire manque
+ */
+EsquissesMots* creerEsquissesMots(void) {
+    EsquissesMots* esquisses = calloc(1, sizeof(EsquissesMots));
+    if (esquisses == NULL) {
+        return NULL;
+    }
+    ResumeFrequents* resume = &esquisses->frequents;
+    resume->capacite = CAPACITE_MOTS_SUIVIS;
+    resume->capacite_index = 2;
+    while (resume->capacite_index < 2 * resume->capacite) {
+        resume->capacite_index *= 2;
+    }
+    resume->mots = calloc(resume->capacite, sizeof(MotSuivi));
+    resume->index = calloc(resume->capacite_index, sizeof(uint32_t));
+    if (resume->mots == NULL || resume->index == NULL) {
+        free(resume->mots);
+        free(resume->index);
+        free(esquisses);
+        return NULL;
+    }
+    return esquisses;
+}
+
+/**
+ * Libère des esquisses et le texte des mots suivis
+ *
+ * @param esquisses Esquisses créées par creerEsquissesMots (NULL accepté)
+ */
+void detruireEsquissesMots(EsquissesMots* esquisses) {
+    if (esquisses == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < esquisses->frequents.capacite; i++) {
+        free(esquisses->frequents.mots[i].texte);
+    }
+    free(esquisses->frequents.mots);
+    free(esquisses->frequents.index);
+    free(esquisses);
+}
+
+/**
+ * Vide les esquisses pour un autre texte, sans rendre la mémoire des textes des mots suivis
+ *
+ * @param esquisses Esquisses à vider
+ */
+void viderEsquissesMots(EsquissesMots* esquisses) {
+    memset(&esquisses->mots, 0, sizeof(HyperLogLog));
+    memset(&esquisses->verbes, 0, sizeof(HyperLogLog));
+    memset(&esquisses->noms_propres, 0, sizeof(HyperLogLog));
+    esquisses->frequents.nb_mots = 0;
+    memset(esquisses->frequents.index, 0, esquisses->frequents.capacite_index * sizeof(uint32_t));
+    esquisses->nb_mots = 0;
+}
+
+// Échange deux mots du tas et met à jour les cases de l'index qui les désignent
+static void echangerMotsSuivis(ResumeFrequents* resume, size_t a, size_t b) {
+    MotSuivi echange = resume->mots[a];
+    resume->mots[a] = resume->mots[b];
+    resume->mots[b] = echange;
+    resume->index[resume->mots[a].position_index] = (uint32_t)a + 1;
+    resume->index[resume->mots[b].position_index] = (uint32_t)b + 1;
+}
+
+// Fait descendre un mot dont la fréquence a augmenté jusqu'à sa place dans le tas
+static void tamiserMotSuivi(ResumeFrequents* resume, size_t position) {
+    for (;;) {
+        size_t plus_rare = position;
+        size_t gauche = 2 * position + 1;
+        size_t droite = gauche + 1;
+        if (gauche < resume->nb_mots && resume->mots[gauche].frequence < resume->mots[plus_rare].frequence) {
+            plus_rare = gauche;
+        }
+        if (droite < resume->nb_mots && resume->mots[droite].frequence < resume->mots[plus_rare].frequence) {
+            plus_rare = droite;
+        }
+        if (plus_rare == position) {
+            return;
+        }
+        echangerMotsSuivis(resume, position, plus_rare);
+        position = plus_rare;
+    }
+}
+
+// Cherche un mot dans l'index : retourne sa case, ou la case libre où l'insérer (*trouve vaut alors 0)
+static size_t chercherCaseIndex(const ResumeFrequents* resume, const wchar_t* mot, size_t longueur,
+                                uint32_t hachage, int* trouve) {
+    size_t masque = resume->capacite_index - 1;
+    size_t position = hachage & masque;
+    while (resume->index[position] != 0) {
+        const MotSuivi* suivi = &resume->mots[resume->index[position] - 1];
+        if (suivi->hachage == hachage && (size_t)suivi->longueur == longueur &&
+            wmemcmp(suivi->texte, mot, longueur) == 0) {
+            *trouve = 1;
+            return position;
+        }
+        position = (position + 1) & masque;
+    }
+    *trouve = 0;
+    return position;
+}
+
+// Retire une case de l'index par décalage arrière : les mots suivants du même groupe reculent pour combler le trou
+static void retirerCaseIndex(ResumeFrequents* resume, size_t trou) {
+    size_t masque = resume->capacite_index - 1;
+    size_t suivante = (trou + 1) & masque;
+    while (resume->index[suivante] != 0) {
+        MotSuivi* suivi = &resume->mots[resume->index[suivante] - 1];
+        size_t ideale = suivi->hachage & masque;
+        // Le mot peut reculer si sa case idéale n'est pas située entre le trou (exclu) et sa case actuelle
+        if (((suivante - ideale) & masque) >= ((suivante - trou) & masque)) {
+            resume->index[trou] = resume->index[suivante];
+            suivi->position_index = (uint32_t)trou;
+            trou = suivante;
+        }
+        suivante = (suivante + 1) & masque;
+    }
+    resume->index[trou] = 0;
+}
+
+// Range le texte d'un mot dans une case du tas, en agrandissant son tampon si besoin
+static int copierTexteSuivi(MotSuivi* suivi, const wchar_t* mot, size_t longueur) {
+    if (longueur + 1 > suivi->capacite_texte) {
+        size_t capacite = suivi->capacite_texte ? suivi->capacite_texte : 16;
+        while (capacite < longueur + 1) {
+            capacite *= 2;
+        }
+        wchar_t* texte = realloc(suivi->texte, capacite * sizeof(wchar_t));
+        if (texte == NULL) {
+            return -1;
+        }
+        suivi->texte = texte;
+        suivi->capacite_texte = capacite;
+    }
+    wmemcpy(suivi->texte, mot, longueur);
+    suivi->texte[longueur] = L'\0';
+    return 0;
+}
+
+// Compte une occurrence d'un mot dans le résumé : un mot suivi est incrémenté, un nouveau mot prend une case libre
+// ou la place du moins fréquent (fréquence héritée comme erreur). Un mot suivi garde les attributs tirés du texte
+// de toutes ses occurrences suivies
+static int compterMotResume(ResumeFrequents* resume, const wchar_t* mot, size_t longueur, uint32_t hachage,
+                            uint16_t attributs_texte) {
+    int trouve;
+    size_t position = chercherCaseIndex(resume, mot, longueur, hachage, &trouve);
+    if (trouve) {
+        size_t i = resume->index[position] - 1;
+        resume->mots[i].attributs |= attributs_texte & ATTRIBUTS_TEXTE;
+        resume->mots[i].frequence++;
+        tamiserMotSuivi(resume, i);
+        return 0;
+    }
+
+    int remplace = resume->nb_mots == resume->capacite;
+    size_t i = remplace ? 0 : resume->nb_mots;
+    MotSuivi* suivi = &resume->mots[i];
+    long long heritee = remplace ? suivi->frequence : 0;
+    // Le retrait de l'index ne compare que les hachages : le texte du mot remplacé peut être écrasé avant
+    // (si la mémoire manque, rien n'est modifié)
+    if (copierTexteSuivi(suivi, mot, longueur) != 0) {
+        return -1;
+    }
+    if (remplace) {
+        retirerCaseIndex(resume, suivi->position_index);
+        position = chercherCaseIndex(resume, mot, longueur, hachage, &trouve); // Le retrait a pu décaler les cases
+    }
+    suivi->longueur = (int)longueur;
+    suivi->hachage = hachage;
+    suivi->attributs = calculerAttributs(mot, longueur) | (attributs_texte & ATTRIBUTS_TEXTE);
+    suivi->frequence = heritee + 1;
+    suivi->erreur = heritee;
+    suivi->position_index = (uint32_t)position;
+    resume->index[position] = (uint32_t)i + 1;
+    if (remplace) {
+        tamiserMotSuivi(resume, 0);
+    } else {
+        // Un nouveau mot n'a été vu qu'une fois : il remonte vers la racine tant que son parent est plus fréquent
+        resume->nb_mots++;
+        while (i > 0 && resume->mots[(i - 1) / 2].frequence > resume->mots[i].frequence) {
+            echangerMotsSuivis(resume, i, (i - 1) / 2);
+            i = (i - 1) / 2;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Compte une occurrence d'un mot dans les esquisses
+ * Les attributs du mot ne sont calculés que s'il peut relever un registre des verbes ou des noms propres, ce qui
+ * devient rare une fois les registres remplis. Les esquisses ne savent pas quelle occurrence d'un mot est la
+ * première : un mot compte parmi les noms propres dès qu'une de ses occurrences commence par une majuscule
+ *
+ * @param esquisses Esquisses de l'analyse
+ * @param mot Texte du mot (normalisé)
+ * @param longueur Nombre de caractères du mot
+ * @param attributs_texte Attributs tirés du texte avant normalisation (voir ajouterMot)
+ * @return 0 en cas de succès, -1 si la mémoire manque pour le texte d'un mot suivi
+ */
+int compterMotEsquisses(EsquissesMots* esquisses, const wchar_t* mot, size_t longueur, uint16_t attributs_texte) {
+    uint64_t hachage = hacherMot64(mot, longueur);
+    esquisses->nb_mots++;
+
+    size_t registre = (size_t)(hachage >> BITS_RANG);
+    uint64_t reste = hachage << PRECISION_HYPERLOGLOG;
+    uint8_t rang = reste == 0 ? BITS_RANG + 1 : (uint8_t)(__builtin_clzll(reste) + 1);
+    if (rang > esquisses->mots.registres[registre]) {
+        esquisses->mots.registres[registre] = rang;
+    }
+    if (rang > esquisses->verbes.registres[registre] || rang > esquisses->noms_propres.registres[registre]) {
+        uint16_t attributs = calculerAttributs(mot, longueur) | (attributs_texte & ATTRIBUTS_TEXTE);
+        if (((attributs >> ATTRIBUT_VERBE) & 1) && rang > esquisses->verbes.registres[registre]) {
+            esquisses->verbes.registres[registre] = rang;
+        }
+        if (((attributs >> ATTRIBUT_NOM_PROPRE) & 1) && rang > esquisses->noms_propres.registres[registre]) {
+            esquisses->noms_propres.registres[registre] = rang;
+        }
+    }
+    return compterMotResume(&esquisses->frequents, mot, longueur, (uint32_t)hachage, attributs_texte);
+}
+
+// Réunit deux HyperLogLog : chaque registre garde le plus grand des deux rangs
+static void fusionnerHyperLogLog(HyperLogLog* destination, const HyperLogLog* source) {
+    for (size_t i = 0; i < NB_REGISTRES_HYPERLOGLOG; i++) {
+        if (source->registres[i] > destination->registres[i]) {
+            destination->registres[i] = source->registres[i];
+        }
+    }
+}
+
+// Ordre croissant des mots suivis par fréquence (égalités départagées par le texte, le premier dans l'ordre
+// alphabétique étant classé le plus haut)
+static int comparerMotsSuivis(const void* a, const void* b) {
+    const MotSuivi* mot_a = a;
+    const MotSuivi* mot_b = b;
+    if (mot_a->frequence != mot_b->frequence) {
+        return mot_a->frequence < mot_b->frequence ? -1 : 1;
+    }
+    return wcscmp(mot_b->texte, mot_a->texte);
+}
+
+// Fusionne deux résumés (résumés fusionnables d'Agarwal et al.) : les fréquences et erreurs d'un mot suivi des deux
+// côtés s'additionnent ; un mot absent d'un résumé plein reçoit la plus petite fréquence de ce résumé, qui majore
+// ses occurrences manquées. Les mots les plus fréquents sont gardés, rangés par fréquence croissante (donc en tas)
+static int fusionnerResumes(ResumeFrequents* destination, ResumeFrequents* source) {
+    long long plancher_destination = frequenceMaximaleNonSuivie(destination);
+    long long plancher_source = frequenceMaximaleNonSuivie(source);
+    size_t total = destination->nb_mots + source->nb_mots;
+    if (source->nb_mots == 0) {
+        return 0;
+    }
+    MotSuivi* tous = malloc(total * sizeof(MotSuivi));
+    if (tous == NULL) {
+        return -1;
+    }
+
+    size_t n = 0;
+    for (size_t i = 0; i < destination->nb_mots; i++) {
+        MotSuivi mot = destination->mots[i];
+        int trouve;
+        size_t position = chercherCaseIndex(source, mot.texte, (size_t)mot.longueur, mot.hachage, &trouve);
+        if (trouve) {
+            const MotSuivi* commun = &source->mots[source->index[position] - 1];
+            mot.frequence += commun->frequence;
+            mot.erreur += commun->erreur;
+            mot.attributs |= commun->attributs;
+        } else {
+            mot.frequence += plancher_source;
+            mot.erreur += plancher_source;
+        }
+        tous[n++] = mot;
+    }
+    for (size_t i = 0; i < source->nb_mots; i++) {
+        MotSuivi* mot = &source->mots[i];
+        int trouve;
+        chercherCaseIndex(destination, mot->texte, (size_t)mot->longueur, mot->hachage, &trouve);
+        if (trouve) {
+            continue;
+        }
+        tous[n] = *mot;
+        tous[n].frequence += plancher_destination;
+        tous[n].erreur += plancher_destination;
+        n++;
+        mot->texte = NULL; // Le texte appartient maintenant à la destination
+        mot->capacite_texte = 0;
+    }
+
+    // Les mots les moins fréquents en surnombre sont abandonnés, ainsi que les tampons des cases libres
+    qsort(tous, n, sizeof(MotSuivi), comparerMotsSuivis);
+    size_t garde = n < destination->capacite ? n : destination->capacite;
+    for (size_t i = 0; i < n - garde; i++) {
+        free(tous[i].texte);
+    }
+    for (size_t i = destination->nb_mots; i < destination->capacite; i++) {
+        free(destination->mots[i].texte);
+    }
+    memset(destination->mots, 0, destination->capacite * sizeof(MotSuivi));
+    memcpy(destination->mots, tous + (n - garde), garde * sizeof(MotSuivi));
+    free(tous);
+
+    destination->nb_mots = garde;
+    memset(destination->index, 0, destination->capacite_index * sizeof(uint32_t));
+    for (size_t i = 0; i < garde; i++) {
+        MotSuivi* mot = &destination->mots[i];
+        int trouve;
+        size_t position = chercherCaseIndex(destination, mot->texte, (size_t)mot->longueur, mot->hachage, &trouve);
+        mot->position_index = (uint32_t)position;
+        destination->index[position] = (uint32_t)i + 1;
+    }
+    return 0;
+}
+
+/**
+ * Fusionne les esquisses d'une analyse dans celles d'une autre (par exemple deux tranches d'un même fichier)
+ * Les HyperLogLog sont réunis registre par registre, les résumés des mots fréquents sont fusionnés ; la source
+ * est vidée
+ *
+ * @param destination Esquisses qui reçoivent les mots
+ * @param source Esquisses fusionnées
+ * @return 0 en cas de succès, -1 si la mémoire manque (la destination est alors inchangée)
+ */
+int fusionnerEsquissesMots(EsquissesMots* destination, EsquissesMots* source) {
+    if (fusionnerResumes(&destination->frequents, &source->frequents) != 0) {
+        return -1;
+    }
+    fusionnerHyperLogLog(&destination->mots, &source->mots);
+    fusionnerHyperLogLog(&destination->verbes, &source->verbes);
+    fusionnerHyperLogLog(&destination->noms_propres, &source->noms_propres);
+    destination->nb_mots += source->nb_mots;
+    viderEsquissesMots(source);
+    return 0;
+}
+
+/**
+ * Recherche les k mots suivis les plus fréquents d'une catégorie
+ * Seuls les mots suivis par le résumé sont candidats : un mot de la catégorie moins fréquent que le seuil
+ * frequenceMaximaleNonSuivie peut manquer
+ *
+ * @param resume Résumé des mots fréquents
+ * @param k Nombre maximal de mots à retenir
+ * @param categorie Catégorie des mots (tous, verbes, noms propres, longueur donnée)
+ * @param longueur Longueur des mots pour CATEGORIE_LONGUEUR
+ * @param resultat Tableau d'au moins k pointeurs, rempli par fréquence décroissante
+ * @return Nombre de mots trouvés (au plus k)
+ */
+size_t meilleursMotsSuivis(const ResumeFrequents* resume, size_t k, CategorieMots categorie, int longueur,
+                           const MotSuivi** resultat) {
+    size_t taille = 0;
+    for (size_t i = 0; i < resume->nb_mots; i++) {
+        const MotSuivi* mot = &resume->mots[i];
+        if ((categorie == CATEGORIE_VERBES && !((mot->attributs >> ATTRIBUT_VERBE) & 1)) ||
+            (categorie == CATEGORIE_NOMS_PROPRES && !((mot->attributs >> ATTRIBUT_NOM_PROPRE) & 1)) ||
+            (categorie == CATEGORIE_LONGUEUR && mot->longueur != longueur)) {
+            continue;
+        }
+        // Insertion dans la liste triée des k meilleurs (le résumé est petit : au plus CAPACITE_MOTS_SUIVIS mots)
+        if (taille == k && (k == 0 || comparerMotsSuivis(mot, resultat[k - 1]) <= 0)) {
+            continue;
+        }
+        size_t position = taille < k ? taille++ : k - 1;
+        while (position > 0 && comparerMotsSuivis(mot, resultat[position - 1]) > 0) {
+            resultat[position] = resultat[position - 1];
+            position--;
+        }
+        resultat[position] = mot;
+    }
+    return taille;
+}
+
+/**
+ * Retourne la fréquence maximale d'un mot qui n'est pas suivi par le résumé
+ *
+ * @param resume Résumé des mots fréquents
+ * @return Plus petite fréquence des mots suivis si le résumé est plein, 0 sinon (tous les mots vus sont suivis)
+ */
+long long frequenceMaximaleNonSuivie(const ResumeFrequents* resume) {
+    return resume->nb_mots == resume->capacite && resume->nb_mots > 0 ? resume->mots[0].frequence : 0;
+}
@@ -0,0 +1,66 @@
+#ifndef ESQUISSES_H
+#define ESQUISSES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#include "table_mots.h"
+
+#define PRECISION_HYPERLOGLOG 14                          // Bits du hachage qui choisissent le registre
+#define NB_REGISTRES_HYPERLOGLOG (1u << PRECISION_HYPERLOGLOG) // Erreur type de 1,04 / sqrt(registres), soit 0,8 %
+#ifndef CAPACITE_MOTS_SUIVIS
+#define CAPACITE_MOTS_SUIVIS 4096   // Mots suivis par le résumé Space-Saving (erreur au plus mots du texte / capacité)
+#endif
+
+// Compteur approché d'éléments distincts (HyperLogLog) : chaque registre garde le rang le plus élevé (zéros de tête
+// plus un) parmi les hachages qui lui reviennent
+typedef struct {
+    uint8_t registres[NB_REGISTRES_HYPERLOGLOG];
+} HyperLogLog;
+
+// Mot suivi par le résumé des mots fréquents
+typedef struct {
+    wchar_t* texte;            // Alloué, réutilisé (et agrandi au besoin) quand un autre mot prend la place
+    size_t capacite_texte;
+    int longueur;
+    uint16_t attributs;        // Voir calculerAttributs
+    uint32_t hachage;
+    uint32_t position_index;   // Case de l'index qui désigne ce mot
+    long long frequence;       // Majorant de la fréquence du mot
+    long long erreur;          // Surestimation maximale : la fréquence réelle est comprise entre frequence - erreur et
+                               // frequence
+} MotSuivi;
+
+// Résumé Space-Saving des mots les plus fréquents, de taille fixe : les mots suivis sont rangés en tas (le moins
+// fréquent à la racine) ; un mot absent du résumé prend la place du moins fréquent et hérite de sa fréquence,
+// qui devient son erreur
+typedef struct {
+    MotSuivi* mots;            // Tas min par fréquence
+    size_t nb_mots;
+    size_t capacite;
+    uint32_t* index;           // Adressage ouvert (sondage linéaire) : position + 1 dans mots (0 : case libre)
+    size_t capacite_index;     // Puissance de 2, au moins le double de capacite
+} ResumeFrequents;
+
+// Esquisses qui remplacent le vocabulaire d'une analyse en mode approché : leur mémoire ne dépend pas de la taille
+// du texte (quelques centaines de Kio)
+typedef struct {
+    HyperLogLog mots;          // Mots distincts
+    HyperLogLog verbes;        // Verbes distincts
+    HyperLogLog noms_propres;  // Mots distincts écrits au moins une fois avec une majuscule initiale
+    ResumeFrequents frequents;
+    uint64_t nb_mots;          // Mots comptés (avec répétitions)
+} EsquissesMots;
+
+EsquissesMots* creerEsquissesMots(void);
+void detruireEsquissesMots(EsquissesMots* esquisses);
+void viderEsquissesMots(EsquissesMots* esquisses);
+int compterMotEsquisses(EsquissesMots* esquisses, const wchar_t* mot, size_t longueur, uint16_t attributs_texte);
+int fusionnerEsquissesMots(EsquissesMots* destination, EsquissesMots* source);
+double estimerDistincts(const HyperLogLog* hll);
+size_t meilleursMotsSuivis(const ResumeFrequents* resume, size_t k, CategorieMots categorie, int longueur,
+                           const MotSuivi** resultat);
+long long frequenceMaximaleNonSuivie(const ResumeFrequents* resume);
+
+#endif
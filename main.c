@@ -3,52 +3,35 @@
 #include <stdlib.h>
 #include <string.h>
 #include <wchar.h>
-#include <wctype.h>
 #include <locale.h>
 #include <math.h>
 #include <limits.h>
+#include <errno.h>
+#include <time.h>
+
+#include "analyse_texte.h"
+#include "esquisses.h"
+#include "ngrammes.h"
+#include "normalisation.h"
+#include "sortie_texte.h"
+#include "table_mots.h"
 
-#define LONGUEUR_MOT_MAX 50 // Définit la longueur maximale d'un mot à analyser
-#define NB_MOTS_MAX 20000   // Définit le nombre maximal de mots pouvant être analysés
 #define LONGUEUR_CHEMIN_MAX 256  // Définit la longueur maximale pour un chemin de fichier
-#define TAILLE_HASHTABLE 10007   // Définit la taille de la table de hachage utilisée pour stocker les mots
 
-// Structure représentant un mot analysé
-typedef struct {
-    wchar_t mot[LONGUEUR_MOT_MAX]; // Tableau pour stocker le mot (en caractères larges, compatible Unicode)
-    int frequence;   // Fréquence d'apparition du mot dans le texte
-    int longueur;    // Longueur du mot (nombre de caractères)
-    int est_verbe;   // Indicateur si le mot est un verbe (1 si vrai, 0 sinon)
-    int est_nom_propre;  // Indicateur si le mot est un nom propre (1 si vrai, 0 sinon)
-} Mot;
-// Structure représentant un nœud dans la table de hachage
-typedef struct NoeudHash {
-    Mot mot;                     // Le mot stocké dans ce nœud
-    struct NoeudHash* suivant;   // Pointeur vers le prochain nœud en cas de collision (chaînage)
-} NoeudHash;
-
-// Structure principale pour analyser le texte
-typedef struct {
-    int nb_espaces;
-    int nb_chars_sans_espaces;      
-    int nb_lignes;                  // Nombre total de lignes
-    int nb_caracteres;              // Nombre total de caractères
-    wchar_t phrase_plus_longue[1000];  // Pour stocker la phrase la plus longue
-    wchar_t phrase_plus_courte[1000];  // Pour stocker la phrase la plus courte
-    int longueur_plus_longue;       // Longueur de la plus longue phrase
-    int longueur_plus_courte;       // Longueur de la plus courte phrase
-    int nb_mots_total;          // Nombre total de mots analysés dans le texte
-    int nb_mots_uniques;        // Nombre de mots uniques trouvés (sans répétition)
-    int nb_phrases;             // Nombre total de phrases dans le texte
-    int nb_paragraphes;         // Nombre total de paragraphes dans le texte
-    double longueur_mot_moyenne;    // Longueur moyenne des mots dans le texte
-    double longueur_phrase_moyenne; // Longueur moyenne des phrases dans le texte
-    double diversite_lexicale;      // Rapport entre les mots uniques et le nombre total de mots
-    double complexite_texte;        // Indicateur global de la complexité du texte (combinaison de métriques)
-    int nb_verbes;              // Nombre total de verbes identifiés dans le texte
-    int nb_noms_propres;        // Nombre total de noms propres identifiés dans le texte
-    NoeudHash* table_hash[TAILLE_HASHTABLE];  // Table de hachage pour stocker et retrouver les mots rapidement
-} AnalyseTexte;
+// Formats d'exportation de l'analyse (même ordre que la liste déroulante de l'interface)
+typedef enum {
+    FORMAT_TEXTE,   // Rapport lisible (statistiques et fréquence de tous les mots)
+    FORMAT_CSV,     // Une ligne par mot : word,frequency,length,verb,proper_noun
+    FORMAT_JSONL    // Un objet JSON par ligne : statistiques, puis un objet par mot
+} FormatExport;
+
+// Word of the word frequency view (created on demand for the visible rows, see WordList)
+#define WORD_TYPE_ROW (word_row_get_type())
+G_DECLARE_FINAL_TYPE(WordRow, word_row, WORD, ROW, GObject)
+
+// List model of the word frequency view: sorted and filtered indices into the vocabulary table
+#define WORD_TYPE_LIST (word_list_get_type())
+G_DECLARE_FINAL_TYPE(WordList, word_list, WORD, LIST, GObject)
 
 typedef struct {
     GtkWidget *main_menu_box;
@@ -61,725 +44,794 @@ typedef struct {
     GtkWidget *result_label; //element to display results on a single line
     GtkWidget *window;
     AnalyseTexte* current_analysis;
+    AnalyseTexte* compare_analyses[2];  // Analyses reused by every file comparison
     AnalyseTexte* file1_analysis; //for comparison
     AnalyseTexte* file2_analysis; //for comparison
     GtkWidget *result_text_view;       // For long results
     GtkWidget *result_scroll_window;   // Scrollable container
     GtkTextBuffer *result_buffer;      // Text buffer for text view
+    GtkWidget *word_frequency_box;     // "Word Frequency" view: filter entry and virtualized word table
+    WordList *word_list;               // Model of the word frequency view (shows current_analysis)
+    GtkWidget *top_k_spin;             // Number of words shown by "Top K Words" (and of n-grams by "Top K N-grams")
+    GtkWidget *top_category_dropdown;  // Word category for "Top K Words"
+    GtkWidget *top_length_spin;        // Word length for the "Words of length" category
+    GtkWidget *export_path_entry;      // Output file of "Download analysis"
+    GtkWidget *export_format_dropdown; // Output format of "Download analysis" (see FormatExport)
+    GtkWidget *analyze_file_button;
+    GtkWidget *approximate_check;      // Analyze in approximate mode (fixed-size sketches instead of the vocabulary)
+    GtkWidget *approximate_notice;     // Metrics menu notice shown when the current analysis is approximate
+    GtkWidget *analysis_progress_bar;  // Bytes consumed by the running analysis
+    GtkWidget *cancel_analysis_button;
+    struct AnalysisJob *running_job;   // Analysis running on a worker thread (NULL if none)
+    guint progress_source;             // Timeout refreshing the progress bar
+    GtkWidget *compare_files_button;
+    struct CompareJob *running_compare; // Comparison whose two analyses are running (NULL if none)
 } MenuWidgets;
 
+// File analysis running on a worker thread (see on_analyze_file)
+typedef struct AnalysisJob {
+    MenuWidgets *widgets;              // NULL once the window is destroyed
+    AnalyseTexte *analysis;            // Owned by the job until it completes
+    char *path;
+    SuiviLecture progress;             // Bytes consumed and cancellation request
+    int error;                         // errno of the failure (ECANCELED if cancelled), 0 on success
+} AnalysisJob;
+
+// Two-file comparison: both files are analyzed at the same time, each on its own worker thread
+typedef struct CompareJob {
+    MenuWidgets *widgets;              // NULL once the window is destroyed
+    AnalysisJob files[2];              // Only analysis, path, progress and error are used
+    int pending;                       // Analyses not finished yet
+} CompareJob;
+
 
 /**
- * Initialise une structure AnalyseTexte avec des valeurs par défaut
- * Met à zéro tous les compteurs et initialise la table de hachage
+ * Convertit une chaîne de caractères larges (wchar_t) en UTF-8 dans un tampon fourni par l'appelant
+ * La conversion ne dépend pas de la locale ; une chaîne trop longue est tronquée sans couper de caractère
  *
- * @param analyse Pointeur vers la structure à initialiser
+ * @param str Chaîne wchar_t à convertir
+ * @param buffer Tampon qui reçoit la chaîne convertie
+ * @param size Taille du tampon en octets
+ * @return Le tampon, qui contient la chaîne convertie en UTF-8
  */
-void initialiserAnalyse(AnalyseTexte* analyse) {
-    // Remplit toute la structure AnalyseTexte avec des zéros (initialisation complète)
-    memset(analyse, 0, sizeof(AnalyseTexte));
-    // Initialise chaque élément de la table de hachage à NULL (aucun mot n'est encore stocké)
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        analyse->table_hash[i] = NULL;
-    }
-    // Initialisation pour la phrase la plus courte
-    analyse->longueur_plus_courte = INT_MAX;
-    wcscpy(analyse->phrase_plus_courte, L"");
-    wcscpy(analyse->phrase_plus_longue, L"");
+static const char* wchar_to_utf8(const wchar_t* str, char* buffer, size_t size) {
+    encoderUtf8(str, wcslen(str), buffer, size);
+    return buffer;
 }
 
 /**
- * Gère le traitement d'une phrase complète dans l'analyse
- * Met à jour les phrases les plus longues et les plus courtes
+ * Génère un rapport détaillé des statistiques d'analyse
+ * Inclut des informations sur les caractères, la structure et les phrases extrêmes
  *
  * @param analyse Pointeur vers la structure d'analyse
- * @param phrase La phrase à traiter
- * @param longueur Longueur de la phrase en caractères
+ * @return Chaîne de caractères contenant le rapport (doit être libérée par l'appelant avec g_free)
  */
-void gererPhrase(AnalyseTexte* analyse, const wchar_t* phrase, int longueur) {
-    if (longueur > 0) {
-        // Mise à jour de la phrase la plus longue
-        if (longueur > analyse->longueur_plus_longue) {
-            analyse->longueur_plus_longue = longueur;
-            wcsncpy(analyse->phrase_plus_longue, phrase, 999);
-            analyse->phrase_plus_longue[999] = L'\0';
-        }
-        // Mise à jour de la phrase la plus courte
-        if (longueur < analyse->longueur_plus_courte) {
-            analyse->longueur_plus_courte = longueur;
-            wcsncpy(analyse->phrase_plus_courte, phrase, 999);
-            analyse->phrase_plus_courte[999] = L'\0';
-        }
-    }
+static char* get_detailed_statistics(const AnalyseTexte* analyse) {
+    size_t size = formaterStatistiquesDetaillees(analyse, NULL, 0) + 1;
+    char* report = g_malloc(size);
+    formaterStatistiquesDetaillees(analyse, report, size);
+    return report;
 }
 
 /**
- * Libère la mémoire allouée pour une analyse de texte
- * Parcourt la table de hachage et libère tous les noeuds
+ * Génère le rapport des performances de l'analyse : durées des étapes et état de la table de hachage du vocabulaire
+ * Affiché avec les statistiques détaillées, mais pas exporté (les durées changent d'une analyse à l'autre)
  *
- * @param analyse Pointeur vers la structure à libérer
+ * @param analyse Pointeur vers la structure d'analyse
+ * @return Chaîne de caractères contenant le rapport (doit être libérée par l'appelant avec g_free)
  */
-
-void libererAnalyse(AnalyseTexte* analyse) {
-    // Parcourt chaque entrée de la table de hachage
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i]; // Pointe vers le premier nœud de la liste chaînée
-        // Parcourt la liste chaînée pour libérer chaque nœud
-        while (courant != NULL) {
-            NoeudHash* temp = courant; // Stocke l'adresse actuelle avant de passer au suivant
-            courant = courant->suivant; // Passe au nœud suivant dans la liste
-            free(temp); // Libère la mémoire du nœud actuel
-        }
-        // Réinitialise la table de hachage à NULL après avoir libéré tous les nœuds
-        analyse->table_hash[i] = NULL;
-    }
+static char* get_performance_statistics(const AnalyseTexte* analyse) {
+    size_t size = formaterPerformances(analyse, NULL, 0) + 1;
+    char* report = g_malloc(size);
+    formaterPerformances(analyse, report, size);
+    return report;
 }
 
 /**
- * Vérifie si un caractère peut faire partie d'un mot
- * Retourne vrai pour les caractères alphanumériques, tirets, apostrophes et underscores
+ * Retourne la mention ajoutée aux métriques tirées du vocabulaire, estimées en mode approché
  *
- * @param c Caractère à vérifier
- * @return 1 si le caractère est valide, 0 sinon
+ * @param analyse Pointeur vers la structure d'analyse
+ * @return " (estimate)" en mode approché, chaîne vide sinon
  */
-int estCaractereMot(wchar_t c) {
-    // Retourne vrai si le caractère est alphanumérique (lettre ou chiffre),
-    // ou s'il s'agit d'un tiret, d'une apostrophe ou d'un underscore
-    return iswalnum(c) || c == L'-' || c == L'\'' || c == L'_';
+static const char* estimate_suffix(const AnalyseTexte* analyse) {
+    return analyse->esquisses ? " (estimate)" : "";
 }
 
 /**
- * Normalise un mot en le convertissant en minuscules et en retirant les caractères invalides
- * Modifie directement la chaîne passée en paramètre
+ * Fonctions de récupération des métriques individuelles
+ * Chacune écrit la métrique spécifique dans un tampon fourni par l'appelant
  *
- * @param mot Chaîne de caractères à normaliser
+ * @param analyse Pointeur vers la structure d'analyse
+ * @param result Tampon qui reçoit la métrique à afficher dans l'interface
+ * @param size Taille du tampon en octets
  */
-void normaliserMot(wchar_t* mot) {
-    int i, j = 0; // `i` parcourt le mot d'origine, `j` construit le mot normalisé
-    for (i = 0; mot[i]; i++) {
-        // Si le caractère actuel est valide (fait partie d'un mot)
-        if (estCaractereMot(mot[i])) {
-            mot[j] = towlower(mot[i]); // Convertit le caractère en minuscule
-            j++; // Avance l'indice pour le mot normalisé
-        }
-    }
-    mot[j] = L'\0'; // Termine la chaîne de caractères normalisée avec un caractère nul
+static void total_words(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Total Words: %lld", analyse->nb_mots_total);
 }
 
-/**
- * Calcule la valeur de hachage d'un mot pour la table de hachage
- * Utilise l'algorithme DJB2
- *
- * @param mot Mot dont on veut calculer la valeur de hachage
- * @return Valeur de hachage entre 0 et TAILLE_HASHTABLE-1
- */
-unsigned int calculerHash(const wchar_t* mot) {
-    unsigned int hash = 5381; // Initialisation de la valeur de hachage avec une constante
-    int c; // Variable pour stocker chaque caractère du mot
-    // Parcourt chaque caractère du mot jusqu'à la fin de la chaîne
-    while ((c = *mot++)) {
-        // Applique l'algorithme de hachage de type DJB2 : hash = hash * 33 + c
-        hash = ((hash << 5) + hash) + c;
-    }
-    // Retourne la valeur de hachage modulo la taille de la table pour rester dans les limites
-    return hash % TAILLE_HASHTABLE;
+static void unique_words(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Unique Words: %lld%s", analyse->nb_mots_uniques,
+             estimate_suffix(analyse));
+}
+
+static void sentence_count(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Sentences: %lld", analyse->nb_phrases);
+}
+
+static void paragraph_count(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Paragraphs: %lld", analyse->nb_paragraphes);
+}
+
+static void avg_sentence_length(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Average Sentence Length: %.2f words", analyse->longueur_phrase_moyenne);
+}
+
+static void lexical_diversity(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Lexical Diversity: %.2f%%%s", analyse->diversite_lexicale * 100,
+             estimate_suffix(analyse));
+}
+
+static void text_complexity(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Text Complexity: %.2f%s", analyse->complexite_texte,
+             estimate_suffix(analyse));
+}
+
+static void verb_count(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Verbs: %lld%s", analyse->nb_verbes, estimate_suffix(analyse));
 }
 
+static void proper_noun_count(const AnalyseTexte* analyse, char* result, size_t size) {
+    snprintf(result, size, "Proper Nouns: %lld%s", analyse->nb_noms_propres,
+             estimate_suffix(analyse));
+}
 /**
- * Détermine si un mot est un verbe ou un nom propre en fonction de critères simples
- * Met à jour les champs est_verbe et est_nom_propre de la structure Mot
+ * Écrit un nombre réel dans une valeur JSON (null s'il n'est pas fini, par exemple pour un texte vide)
  *
- * @param mot Pointeur vers la structure Mot à analyser
+ * @param sortie Sortie ouverte
+ * @param valeur Nombre à écrire
  */
-void detecterTypeMot(Mot* mot) {
-    int len = wcslen(mot->mot); // Calcule la longueur du mot
-    // Vérifie si le mot commence par une lettre majuscule, indiquant un nom propre
-    mot->est_nom_propre = iswupper(mot->mot[0]);
-    mot->est_verbe = 0; // Initialise à 0, supposant que le mot n'est pas un verbe
-    // Si le mot a plus de 2 caractères, vérifie les terminaisons possibles d'un verbe
-    if (len > 2) {
-        wchar_t* fin = mot->mot + len - 2; // Pointe vers les deux derniers caractères
-        // Vérifie si le mot se termine par "er", "ir", ou "re" (indicateurs de verbes)
-        if (wcscmp(fin, L"er") == 0 || wcscmp(fin, L"ir") == 0 ||
-            (len > 3 && wcscmp(fin-1, L"re") == 0)) {
-            mot->est_verbe = 1; // Marque le mot comme un verbe
-        }
+static void write_json_number(SortieTexte* sortie, double valeur) {
+    if (isfinite(valeur)) {
+        ecrireFormat(sortie, "%.6g", valeur);
+    } else {
+        ecrireChaine(sortie, "null");
     }
 }
 
 /**
- * Calcule la complexité globale du texte basée sur plusieurs métriques
- * Combine la longueur des phrases, diversité lexicale, proportion de verbes et autres facteurs
+ * Écrit l'analyse dans le format texte lisible (statistiques, puis fréquence de tous les mots)
  *
- * @param analyse Pointeur vers la structure contenant les données d'analyse
- * @return Score de complexité (plus le score est élevé, plus le texte est complexe)
+ * @param sortie Sortie ouverte
+ * @param analyse Pointeur vers la structure d'analyse
+ * @param ordre Indices des mots dans l'ordre d'écriture
  */
-double calculerComplexiteTexte(const AnalyseTexte* analyse) {
-    return (
-        0.3 * analyse->longueur_phrase_moyenne + // Pondère la longueur moyenne des phrases
-        0.2 * analyse->diversite_lexicale * 100 + // Pondère la diversité lexicale (en pourcentage)
-        0.2 * ((double)analyse->nb_verbes / analyse->nb_mots_total) * 100 + // Pondère le ratio de verbes
-        0.15 * ((double)analyse->nb_mots_uniques / analyse->nb_mots_total) * 100 + // Pondère la diversité des mots uniques
-        0.15 * analyse->longueur_mot_moyenne // Pondère la longueur moyenne des mots
-    );
+static void write_text_export(SortieTexte* sortie, const AnalyseTexte* analyse, const uint32_t* ordre) {
+    ecrireFormat(sortie, "Total Words: %lld\n", analyse->nb_mots_total);
+    ecrireFormat(sortie, "Unique Words: %lld\n", analyse->nb_mots_uniques);
+    ecrireFormat(sortie, "Sentences: %lld\n", analyse->nb_phrases);
+    ecrireFormat(sortie, "Paragraphs: %lld\n", analyse->nb_paragraphes);
+    ecrireFormat(sortie, "Average Sentence Length: %.2f words\n", analyse->longueur_phrase_moyenne);
+    ecrireFormat(sortie, "Lexical Diversity: %.2f%%\n", analyse->diversite_lexicale * 100);
+    ecrireFormat(sortie, "Text Complexity: %.2f\n", analyse->complexite_texte);
+    ecrireFormat(sortie, "Verbs: %lld\n", analyse->nb_verbes);
+    ecrireFormat(sortie, "Proper Nouns: %lld\n", analyse->nb_noms_propres);
+
+    char* statistiques = get_detailed_statistics(analyse);
+    if (statistiques != NULL) {
+        ecrireChaine(sortie, statistiques);
+        g_free(statistiques);
+    }
+
+    ecrireChaine(sortie, "\nComplete Word Frequency:\n");
+    ecrireChaine(sortie, "---------------------------------\n");
+
+    for (size_t i = 0; i < analyse->vocabulaire.nb_mots; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[ordre[i]];
+        ecrireMotUtf8(sortie, texteMot(&analyse->vocabulaire, mot), (size_t)mot->longueur);
+        ecrireChaine(sortie, ": ");
+        ecrireEntier(sortie, mot->frequence);
+        ecrireChaine(sortie, " occurrences");
+        if (aAttribut(mot, ATTRIBUT_VERBE)) ecrireChaine(sortie, " (verbe)");
+        if (aAttribut(mot, ATTRIBUT_NOM_PROPRE)) ecrireChaine(sortie, " (nom propre)");
+        ecrireOctet(sortie, '\n');
+    }
 }
+
 /**
- * Ajoute ou met à jour un mot dans la table de hachage
- * Crée une nouvelle entrée si le mot n'existe pas, sinon incrémente sa fréquence
+ * Écrit le vocabulaire au format CSV : une ligne d'en-tête, puis une ligne par mot
  *
+ * @param sortie Sortie ouverte
  * @param analyse Pointeur vers la structure d'analyse
- * @param mot Mot à ajouter ou mettre à jour
+ * @param ordre Indices des mots dans l'ordre d'écriture
  */
-void ajouterMot(AnalyseTexte* analyse, const wchar_t* mot) {
-    // Calcule l'index de hachage pour le mot
-    unsigned int index = calculerHash(mot);
-    // Récupère le premier noeud dans la liste chaînée à cet index
-    NoeudHash* courant = analyse->table_hash[index];
-
-    // Parcourt la liste chaînée pour vérifier si le mot existe déjà
-    while (courant != NULL) {
-        if (wcscmp(courant->mot.mot, mot) == 0) { // Si le mot est trouvé
-            courant->mot.frequence++; // Incrémente sa fréquence
-            return; // Fin de la fonction
-        }
-        courant = courant->suivant; // Passe au noeud suivant
-    }
-
-    // Si le mot n'est pas trouvé, on l'ajoute comme un nouveau noeud
-    NoeudHash* nouveau = (NoeudHash*)malloc(sizeof(NoeudHash));
-    if (!nouveau) { // Vérifie si l'allocation mémoire a échoué
-        perror("Erreur d'allocation mémoire");
-        exit(EXIT_FAILURE); // Termine le programme avec une erreur
+static void write_csv_export(SortieTexte* sortie, const AnalyseTexte* analyse, const uint32_t* ordre) {
+    ecrireChaine(sortie, "word,frequency,length,verb,proper_noun\n");
+    for (size_t i = 0; i < analyse->vocabulaire.nb_mots; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[ordre[i]];
+        ecrireChampCsv(sortie, texteMot(&analyse->vocabulaire, mot), (size_t)mot->longueur);
+        ecrireOctet(sortie, ',');
+        ecrireEntier(sortie, mot->frequence);
+        ecrireOctet(sortie, ',');
+        ecrireEntier(sortie, mot->longueur);
+        ecrireChaine(sortie, aAttribut(mot, ATTRIBUT_VERBE) ? ",1" : ",0");
+        ecrireChaine(sortie, aAttribut(mot, ATTRIBUT_NOM_PROPRE) ? ",1\n" : ",0\n");
     }
-
-    // Copie le mot dans la structure du noeud
-    wcscpy(nouveau->mot.mot, mot);
-    nouveau->mot.frequence = 1; // Initialise la fréquence à 1
-    nouveau->mot.longueur = wcslen(mot); // Calcule la longueur du mot
-    detecterTypeMot(&nouveau->mot); // Détecte les propriétés grammaticales du mot
-    nouveau->suivant = analyse->table_hash[index]; // Pointe vers l'ancien premier noeud
-    analyse->table_hash[index] = nouveau; // Met à jour la tête de la liste
-    analyse->nb_mots_uniques++; // Incrémente le compteur de mots uniques
-
-    // Met à jour les statistiques si le mot est un verbe ou un nom propre
-    if (nouveau->mot.est_verbe) analyse->nb_verbes++;
-    if (nouveau->mot.est_nom_propre) analyse->nb_noms_propres++;
 }
 
 /**
- * Convertit une chaîne de caractères larges (wchar_t) en UTF-8
- * Utilise un buffer statique pour stocker la conversion
+ * Écrit l'analyse au format JSON Lines : un objet "summary" avec les statistiques, puis un objet "word" par mot
  *
- * @param str Chaîne wchar_t à convertir
- * @return Pointeur vers la chaîne convertie en UTF-8
+ * @param sortie Sortie ouverte
+ * @param analyse Pointeur vers la structure d'analyse
+ * @param ordre Indices des mots dans l'ordre d'écriture
  */
-static char* wchar_to_utf8(const wchar_t* str) {
-    static char buffer[8192];  // Static buffer for the converted string
-    memset(buffer, 0, sizeof(buffer));
-    wcstombs(buffer, str, sizeof(buffer) - 1);
-    return buffer;
+static void write_jsonl_export(SortieTexte* sortie, const AnalyseTexte* analyse, const uint32_t* ordre) {
+    ecrireFormat(sortie, "{\"type\":\"summary\",\"total_words\":%lld,\"unique_words\":%lld,\"sentences\":%lld,"
+                         "\"paragraphs\":%lld,\"characters\":%lld,\"characters_without_spaces\":%lld,\"spaces\":%lld,"
+                         "\"verbs\":%lld,\"proper_nouns\":%lld,",
+                 analyse->nb_mots_total, analyse->nb_mots_uniques, analyse->nb_phrases,
+                 analyse->nb_paragraphes, analyse->nb_caracteres, analyse->nb_chars_sans_espaces,
+                 analyse->nb_espaces, analyse->nb_verbes, analyse->nb_noms_propres);
+    ecrireChaine(sortie, "\"average_sentence_length\":");
+    write_json_number(sortie, analyse->longueur_phrase_moyenne);
+    ecrireChaine(sortie, ",\"lexical_diversity\":");
+    write_json_number(sortie, analyse->diversite_lexicale);
+    ecrireChaine(sortie, ",\"text_complexity\":");
+    write_json_number(sortie, analyse->complexite_texte);
+    ecrireChaine(sortie, ",\"longest_sentence\":");
+    if (analyse->phrase_plus_longue != NULL) {
+        ecrireChaineJson(sortie, analyse->phrase_plus_longue, wcslen(analyse->phrase_plus_longue));
+    } else {
+        ecrireChaine(sortie, "\"\"");
+    }
+    ecrireChaine(sortie, ",\"shortest_sentence\":");
+    if (analyse->phrase_plus_courte != NULL) {
+        ecrireChaineJson(sortie, analyse->phrase_plus_courte, wcslen(analyse->phrase_plus_courte));
+    } else {
+        ecrireChaine(sortie, "\"\"");
+    }
+    ecrireChaine(sortie, "}\n");
+
+    for (size_t i = 0; i < analyse->vocabulaire.nb_mots; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[ordre[i]];
+        ecrireChaine(sortie, "{\"type\":\"word\",\"word\":");
+        ecrireChaineJson(sortie, texteMot(&analyse->vocabulaire, mot), (size_t)mot->longueur);
+        ecrireChaine(sortie, ",\"frequency\":");
+        ecrireEntier(sortie, mot->frequence);
+        ecrireChaine(sortie, ",\"length\":");
+        ecrireEntier(sortie, mot->longueur);
+        ecrireChaine(sortie, aAttribut(mot, ATTRIBUT_VERBE) ? ",\"verb\":true" : ",\"verb\":false");
+        ecrireChaine(sortie, aAttribut(mot, ATTRIBUT_NOM_PROPRE) ? ",\"proper_noun\":true}\n" : ",\"proper_noun\":false}\n");
+    }
 }
 
 /**
- * Vérifie si une chaîne de caractères est un palindrome
- * Ignore la casse et les caractères non alphanumériques
+ * Exporte l'analyse complète dans un fichier
+ * Les octets passent par un seul tampon d'écriture de grande taille et les mots sont écrits
+ * directement depuis la table, triés par fréquence croissante (égalités dans l'ordre alphabétique)
  *
- * @param texte Chaîne à vérifier
- * @return 1 si la chaîne est un palindrome, 0 sinon
+ * @param analyse Pointeur vers la structure d'analyse
+ * @param chemin Chemin du fichier à créer ou remplacer
+ * @param format Format du fichier (texte, CSV ou JSON Lines)
+ * @return 0 en cas de succès, -1 en cas d'erreur (errno est positionné)
  */
-int estPalindrome(const wchar_t* texte) {
-    if (!texte || !*texte) return 0;
-
-    size_t len = wcslen(texte);
-    wchar_t* texte_normalise = (wchar_t*)malloc((len + 1) * sizeof(wchar_t));
-    if (!texte_normalise) return 0;
-
-    size_t j = 0;
-    for (size_t i = 0; i < len; i++) {
-        if (iswalnum(texte[i])) {
-            texte_normalise[j++] = towlower(texte[i]);
-        }
+static int export_analysis(const AnalyseTexte* analyse, const char* chemin, FormatExport format) {
+    // Sort word indices by ascending frequency (ties in alphabetical order, so exports can be diffed)
+    uint32_t* ordre = trierMots(&analyse->vocabulaire, 0, 0);
+    if (ordre == NULL) {
+        errno = ENOMEM;
+        return -1;
     }
-    texte_normalise[j] = L'\0';
 
-    size_t debut = 0;
-    size_t fin = j - 1;
-    int est_palindrome = 1;
+    SortieTexte sortie;
+    if (ouvrirSortie(&sortie, chemin) != 0) {
+        int erreur = errno;
+        free(ordre);
+        errno = erreur;
+        return -1;
+    }
 
-    while (debut < fin) {
-        if (texte_normalise[debut] != texte_normalise[fin]) {
-            est_palindrome = 0;
+    switch (format) {
+        case FORMAT_CSV:
+            write_csv_export(&sortie, analyse, ordre);
+            break;
+        case FORMAT_JSONL:
+            write_jsonl_export(&sortie, analyse, ordre);
+            break;
+        default:
+            write_text_export(&sortie, analyse, ordre);
             break;
-        }
-        debut++;
-        fin--;
     }
 
-    free(texte_normalise);
-    return est_palindrome;
+    free(ordre);
+    return fermerSortie(&sortie);
 }
 /**
- * Affiche la fréquence de tous les mots du texte
- * Parcourt la table de hachage et affiche chaque mot avec sa fréquence et son type
+ * Mode approché : retourne les K mots les plus fréquents d'une catégorie parmi les mots suivis par le résumé
+ * Space-Saving, avec l'intervalle de leur fréquence et la fréquence maximale des mots qui ne sont pas suivis
  *
- * @param analyse Pointeur vers la structure contenant l'analyse
+ * @param analyse Pointeur vers une analyse approchée
+ * @param k Nombre de mots à afficher
+ * @param categorie Catégorie des mots (tous, verbes, noms propres, longueur donnée)
+ * @param longueur Longueur des mots pour CATEGORIE_LONGUEUR
+ * @param category_name Nom de la catégorie dans le titre
+ * @return Chaîne formatée contenant les K mots (doit être libérée par l'appelant avec g_free)
  */
-void afficherFrequenceComplete(const AnalyseTexte* analyse) {
-    printf("\nFréquence complète des mots:\n");
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL) {
-            printf("%ls: %d occurrences", courant->mot.mot, courant->mot.frequence);
-            if (courant->mot.est_verbe) printf(" (verbe)");
-            if (courant->mot.est_nom_propre) printf(" (nom propre)");
-            printf("\n");
-            courant = courant->suivant;
+static char* get_top_tracked_words(const AnalyseTexte* analyse, int k, CategorieMots categorie, int longueur,
+                                   const char* category_name) {
+    GString* result = g_string_new(NULL);
+    const ResumeFrequents* resume = &analyse->esquisses->frequents;
+    // The list never holds more entries than the summary
+    size_t capacity = k > 0 ? (size_t)k : 0;
+    if (capacity > resume->nb_mots) capacity = resume->nb_mots;
+    if (capacity == 0) {
+        g_string_append(result, "No words to display.\n");
+        return g_string_free(result, FALSE);
+    }
+    const MotSuivi** best = malloc(capacity * sizeof(MotSuivi*));
+    if (best == NULL) {
+        g_string_append(result, "Memory allocation error\n");
+        return g_string_free(result, FALSE);
+    }
+    size_t nb_mots = meilleursMotsSuivis(resume, capacity, categorie, longueur, best);
+    if (nb_mots == 0) {
+        g_string_append(result, "No words in this category.\n");
+        free(best);
+        return g_string_free(result, FALSE);
+    }
+
+    if (categorie == CATEGORIE_LONGUEUR) {
+        g_string_append_printf(result, "Top %zu %s %d by frequency (estimate):\n\n", nb_mots, category_name, longueur);
+    } else {
+        g_string_append_printf(result, "Top %zu %s by frequency (estimate):\n\n", nb_mots, category_name);
+    }
+    char word[8192];
+    for (size_t i = 0; i < nb_mots; i++) {
+        const MotSuivi* mot = best[i];
+        g_string_append_printf(result, "%zu. %s: ", i + 1, wchar_to_utf8(mot->texte, word, sizeof(word)));
+        if (mot->erreur > 0) {
+            g_string_append_printf(result, "between %lld and %lld occurrences", mot->frequence - mot->erreur,
+                                   mot->frequence);
+        } else {
+            g_string_append_printf(result, "%lld occurrence%s", mot->frequence, mot->frequence > 1 ? "s" : "");
         }
+        g_string_append_printf(result, "%s%s\n",
+                ((mot->attributs >> ATTRIBUT_VERBE) & 1) ? " (verb)" : "",
+                ((mot->attributs >> ATTRIBUT_NOM_PROPRE) & 1) ? " (proper noun)" : "");
+    }
+    long long untracked = frequenceMaximaleNonSuivie(resume);
+    if (untracked > 0) {
+        g_string_append_printf(result, "\nWords missing from this list occur at most %lld times\n", untracked);
     }
+    free(best);
+    return g_string_free(result, FALSE);
 }
 
 /**
- * Analyse un fichier texte et remplit une structure AnalyseTexte avec diverses statistiques
- * Compte les caractères, mots, phrases, et calcule différentes métriques
+ * Retourne les K mots les plus fréquents d'une catégorie
+ * Les mots sont choisis en un seul parcours du vocabulaire avec un tas borné (sans copie des mots)
  *
- * @param chemin Chemin du fichier à analyser
- * @param analyse Pointeur vers la structure qui contiendra les résultats
+ * @param analyse Pointeur vers la structure d'analyse
+ * @param k Nombre de mots à afficher
+ * @param categorie Catégorie des mots (tous, verbes, noms propres, longueur donnée)
+ * @param longueur Longueur des mots pour CATEGORIE_LONGUEUR
+ * @return Chaîne formatée contenant les K mots (doit être libérée par l'appelant avec g_free)
  */
-void analyserFichier(const char* chemin, AnalyseTexte* analyse) {
-    FILE* fichier = fopen(chemin, "r");
-    if (fichier == NULL) {
-        perror("Erreur à l'ouverture du fichier");
-        exit(EXIT_FAILURE);
-    }
-
-    wchar_t mot_courant[LONGUEUR_MOT_MAX];
-    wchar_t phrase_courante[1000] = {0};
-    wint_t c;
-    int pos_mot = 0;
-    int pos_phrase = 0;
-    int en_mot = 0;
-    int mots_dans_phrase = 0;
-    int en_paragraphe = 0;
-
-    // Initialisation des compteurs
-    analyse->nb_lignes = 1;
-    analyse->nb_caracteres = 0;
-    analyse->nb_espaces = 0;
-    analyse->nb_chars_sans_espaces = 0;
-    analyse->longueur_plus_longue = 0;
-    analyse->longueur_plus_courte = INT_MAX;
-
-    while ((c = fgetwc(fichier)) != WEOF) {
-
-        // Gestion du comptage des caractères
-        if (c == L' ') {
-            analyse->nb_espaces++;
-            analyse->nb_caracteres++;
-        } else if (c != L'\n' && c != L'\r') {
-            analyse->nb_chars_sans_espaces++;
-            analyse->nb_caracteres++;
-        }
+static char* get_top_words(const AnalyseTexte* analyse, int k, CategorieMots categorie, int longueur) {
+    static const char* category_names[] = {"words", "verbs", "proper nouns", "words of length"};
+    GString* result = g_string_new(NULL);
 
-        if (estCaractereMot(c)) {
-            if (!en_mot) {
-                en_mot = 1;
-                analyse->nb_mots_total++;
-                mots_dans_phrase++;
-            }
-            if (pos_mot < LONGUEUR_MOT_MAX - 1) {
-                mot_courant[pos_mot++] = c;
-            }
-            if (pos_phrase < 999) {
-                phrase_courante[pos_phrase++] = c;
-                phrase_courante[pos_phrase] = L'\0';
-            }
-        } else {
-            if (en_mot) {
-                mot_courant[pos_mot] = L'\0';
-                normaliserMot(mot_courant);
-                ajouterMot(analyse, mot_courant);
-                pos_mot = 0;
-                en_mot = 0;
-            }
-            if (c == L'\n') {
-                analyse->nb_lignes++;
-                if (!en_paragraphe) {
-                    analyse->nb_paragraphes++;
-                    en_paragraphe = 1;
-                }
-            } else {
-                en_paragraphe = 0;
-            }
-            if (c != L'\n' && c != L'\r') {
-                if (pos_phrase < 999) {
-                    phrase_courante[pos_phrase++] = c;
-                    phrase_courante[pos_phrase] = L'\0';
-                }
-            }
-            if (c == L'.' || c == L'!' || c == L'?') {
-                analyse->nb_phrases++;
-                analyse->longueur_phrase_moyenne += mots_dans_phrase;
-                // Gérer la phrase complète
-                if (pos_phrase > 0) {
-                    if (pos_phrase > analyse->longueur_plus_longue) {
-                        analyse->longueur_plus_longue = pos_phrase;
-                        wcsncpy(analyse->phrase_plus_longue, phrase_courante, 999);
-                        analyse->phrase_plus_longue[999] = L'\0';
-                    }
-                    if (pos_phrase < analyse->longueur_plus_courte && mots_dans_phrase > 0) {
-                        analyse->longueur_plus_courte = pos_phrase;
-                        wcsncpy(analyse->phrase_plus_courte, phrase_courante, 999);
-                        analyse->phrase_plus_courte[999] = L'\0';
-                    }
-                }
-                pos_phrase = 0;
-                phrase_courante[0] = L'\0';
-                mots_dans_phrase = 0;
-            }
-        }
+    if (analyse->esquisses) {
+        return get_top_tracked_words(analyse, k, categorie, longueur, category_names[categorie]);
     }
-
-    // Traiter le dernier mot s'il y en a un
-    if (en_mot) {
-        mot_courant[pos_mot] = L'\0';
-        normaliserMot(mot_courant);
-        ajouterMot(analyse, mot_courant);
+    if (analyse->nb_mots_uniques == 0 || k <= 0) {
+        g_string_append(result, "No words to display.\n");
+        return g_string_free(result, FALSE);
     }
 
-    // Traiter la dernière phrase si elle ne se termine pas par un point
-    if (mots_dans_phrase > 0) {
-        analyse->nb_phrases++;
-        analyse->longueur_phrase_moyenne += mots_dans_phrase;
+    // The heap never holds more entries than the vocabulary
+    size_t capacity = (size_t)k < analyse->vocabulaire.nb_mots ? (size_t)k : analyse->vocabulaire.nb_mots;
+    uint32_t* indices = malloc(capacity * sizeof(uint32_t));
+    if (indices == NULL) {
+        g_string_append(result, "Memory allocation error\n");
+        return g_string_free(result, FALSE);
     }
-
-    // Calcul des moyennes et métriques finales
-    if (analyse->nb_phrases > 0) {
-        analyse->longueur_phrase_moyenne /= analyse->nb_phrases;
+    size_t nb_mots = meilleursMots(&analyse->vocabulaire, capacity, categorie, longueur, indices);
+    if (nb_mots == 0) {
+        g_string_append(result, "No words in this category.\n");
+        free(indices);
+        return g_string_free(result, FALSE);
     }
 
-    analyse->diversite_lexicale = (double)analyse->nb_mots_uniques / analyse->nb_mots_total;
-    analyse->complexite_texte = calculerComplexiteTexte(analyse);
-
-    fclose(fichier);
+    if (categorie == CATEGORIE_LONGUEUR) {
+        g_string_append_printf(result, "Top %zu %s %d by frequency:\n\n", nb_mots, category_names[categorie], longueur);
+    } else {
+        g_string_append_printf(result, "Top %zu %s by frequency:\n\n", nb_mots, category_names[categorie]);
+    }
+    char word[8192];
+    for (size_t i = 0; i < nb_mots; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[indices[i]];
+        g_string_append_printf(result, "%zu. %s: %lld occurrence%s%s%s\n",
+                i + 1,
+                wchar_to_utf8(texteMot(&analyse->vocabulaire, mot), word, sizeof(word)),  // Convert to UTF-8
+                mot->frequence,
+                mot->frequence > 1 ? "s" : "",
+                aAttribut(mot, ATTRIBUT_VERBE) ? " (verb)" : "",
+                aAttribut(mot, ATTRIBUT_NOM_PROPRE) ? " (proper noun)" : "");
+    }
+    free(indices);
+    return g_string_free(result, FALSE);
 }
+
 /**
- * Génère un rapport détaillé des statistiques d'analyse
- * Inclut des informations sur les caractères, la structure et les phrases extrêmes
+ * Retourne les K bigrammes et les K trigrammes les plus fréquents du texte
+ * Comme pour les mots, chaque table est parcourue une seule fois avec un tas borné ; une table élaguée pour tenir
+ * dans son budget mémoire est signalée avec l'écart maximal de ses fréquences
  *
  * @param analyse Pointeur vers la structure d'analyse
- * @return Chaîne de caractères contenant le rapport (doit être libérée par l'appelant)
+ * @param k Nombre de n-grammes à afficher pour chaque ordre
+ * @return Chaîne formatée contenant les n-grammes (doit être libérée par l'appelant avec g_free)
  */
-static char* get_detailed_statistics(const AnalyseTexte* analyse) {
-    char* result = malloc(1000 * sizeof(char));
-    if (result == NULL) {
-        return NULL;
+static char* get_top_ngrams(const AnalyseTexte* analyse, int k) {
+    static const char* order_names[] = {"bigrams", "trigrams"};
+    GString* result = g_string_new(NULL);
+
+    // The heap never holds more entries than the largest table
+    size_t capacity = 0;
+    for (int ordre = 2; ordre <= ORDRE_NGRAMME_MAX; ordre++) {
+        size_t nb = tableNgrammes(&analyse->ngrammes, ordre)->nb_ngrammes;
+        if (nb > capacity) capacity = nb;
     }
-    snprintf(result, 1000, "\nStatistiques détaillées du texte:\n"
-                            "-----------------------------------\n"
-                            "Caractères:\n"
-                            "  - Total avec espaces: %d\n"
-                            "  - Total sans espaces: %d\n"
-                            "  - Nombre d'espaces: %d\n"
-                            "\nStructure:\n"
-                            "  - Nombre de mots: %d\n"
-                            "  - Nombre de phrases: %d\n"
-                            "  - Nombre de paragraphes: %d\n"
-                            "\nPhrases extrêmes:\n"
-                            "Plus longue phrase (%d caractères):\n%ls\n"
-                            "\nPlus courte phrase (%d caractères):\n%ls\n",
-                            analyse->nb_caracteres,
-                            analyse->nb_chars_sans_espaces,
-                            analyse->nb_espaces,
-                            analyse->nb_mots_total,
-                            analyse->nb_phrases,
-                            analyse->nb_paragraphes,
-                            analyse->longueur_plus_longue,
-                            analyse->phrase_plus_longue,
-                            analyse->longueur_plus_courte,
-                            analyse->phrase_plus_courte);
-    return result;
+    if (k <= 0 || capacity == 0) {
+        g_string_append(result, "No n-grams to display.\n");
+        return g_string_free(result, FALSE);
+    }
+    if ((size_t)k < capacity) capacity = (size_t)k;
+    Ngramme* best = malloc(capacity * sizeof(Ngramme));
+    if (best == NULL) {
+        g_string_append(result, "Memory allocation error\n");
+        return g_string_free(result, FALSE);
+    }
+
+    const TableMots* vocabulaire = &analyse->vocabulaire;
+    char word[8192];
+    for (int ordre = 2; ordre <= ORDRE_NGRAMME_MAX; ordre++) {
+        const TableNgrammes* table = tableNgrammes(&analyse->ngrammes, ordre);
+        size_t nb = meilleursNgrammes(table, capacity, best);
+        g_string_append_printf(result, "%sTop %zu %s by frequency:\n\n", ordre > 2 ? "\n" : "", nb,
+                               order_names[ordre - 2]);
+        for (size_t i = 0; i < nb; i++) {
+            g_string_append_printf(result, "%zu.", i + 1);
+            for (int j = 0; j < ordre; j++) {
+                const Mot* mot = &vocabulaire->mots[best[i].mots[j]];
+                g_string_append_printf(result, " %s", wchar_to_utf8(texteMot(vocabulaire, mot), word, sizeof(word)));
+            }
+            g_string_append_printf(result, ": %lld occurrence%s\n", best[i].frequence,
+                                   best[i].frequence > 1 ? "s" : "");
+        }
+        long long erreur = erreurNgrammes(table);
+        if (erreur > 0) {
+            g_string_append_printf(result,
+                    "Approximate counts (memory budget reached): off by at most %lld occurrences\n", erreur);
+        }
+    }
+    free(best);
+    return g_string_free(result, FALSE);
 }
 
 /**
- * Fonctions de récupération des métriques individuelles
- * Chacune retourne une chaîne formatée contenant la métrique spécifique
+ * Trouve et retourne tous les palindromes du texte
  *
  * @param analyse Pointeur vers la structure d'analyse
- * @return Chaîne formatée contenant la métrique a afficher dans l'interface
+ * @return Chaîne formatée contenant la liste des palindromes trouvés (doit être libérée par l'appelant avec g_free)
  */
-static char* total_words(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Total Words: %d", analyse->nb_mots_total);
-    return result;
+static char* get_palindromes(const AnalyseTexte* analyse) {
+    GString *result = g_string_new("Palindromes found in text:\n\n");
+    int palindromes_trouves = 0;
+
+    // Palindromes listed by the word table (attribute computed when each word was inserted)
+    size_t nb_palindromes;
+    const uint32_t* palindromes = membresAttribut(&analyse->vocabulaire, ATTRIBUT_PALINDROME, &nb_palindromes);
+    char word[8192];
+    for (size_t i = 0; i < nb_palindromes; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[palindromes[i]];
+        g_string_append_printf(result, "%s (frequency: %lld)\n",
+                wchar_to_utf8(texteMot(&analyse->vocabulaire, mot), word, sizeof(word)),  // Convert to UTF-8
+                mot->frequence);
+        palindromes_trouves++;
+    }
+
+    if (palindromes_trouves == 0) {
+        g_string_append(result, "No palindromes found in text.\n");
+    } else {
+        g_string_append_printf(result, "\nTotal palindromes found: %d\n", palindromes_trouves);
+    }
+
+    return g_string_free(result, FALSE);
 }
 
-static char* unique_words(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Unique Words: %d", analyse->nb_mots_uniques);
-    return result;
+// Word frequency view: a GListModel over the vocabulary table
+// The model only keeps word indices (sorted, then filtered); a WordRow is created when the column view asks
+// for a visible position, so the view never materializes more rows than it shows
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+struct _WordRow {
+    GObject parent_instance;
+    guint index;                       // Position of the word in the vocabulary
+};
+
+G_DEFINE_TYPE(WordRow, word_row, G_TYPE_OBJECT)
+
+static void word_row_class_init(WordRowClass *klass) {
+    (void)klass;
 }
 
-static char* sentence_count(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Sentences: %d", analyse->nb_phrases);
-    return result;
+static void word_row_init(WordRow *row) {
+    (void)row;
 }
 
-static char* paragraph_count(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Paragraphs: %d", analyse->nb_paragraphes);
-    return result;
+struct _WordList {
+    GObject parent_instance;
+    const TableMots *vocabulary;       // Vocabulary shown (NULL when detached from any analysis)
+    CleTriMots sort_key;
+    gboolean descending;
+    uint32_t *order;                   // Every word index, in sort order
+    uint32_t *visible;                 // Indices matching the filter (order itself when there is no filter)
+    guint n_visible;
+    wchar_t *filter;                   // Lowercase text searched in the words (NULL: all words)
+};
+
+static GType word_list_get_item_type(GListModel *model) {
+    (void)model;
+    return WORD_TYPE_ROW;
 }
 
-static char* avg_sentence_length(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Average Sentence Length: %.2f words", analyse->longueur_phrase_moyenne);
-    return result;
+static guint word_list_get_n_items(GListModel *model) {
+    return WORD_LIST(model)->n_visible;
 }
 
-static char* lexical_diversity(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Lexical Diversity: %.2f%%", analyse->diversite_lexicale * 100);
-    return result;
+static gpointer word_list_get_item(GListModel *model, guint position) {
+    WordList *list = WORD_LIST(model);
+    if (position >= list->n_visible) {
+        return NULL;
+    }
+    WordRow *row = g_object_new(WORD_TYPE_ROW, NULL);
+    row->index = list->visible[position];
+    return row;
 }
 
-static char* text_complexity(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Text Complexity: %.2f", analyse->complexite_texte);
-    return result;
+static void word_list_model_init(GListModelInterface *iface) {
+    iface->get_item_type = word_list_get_item_type;
+    iface->get_n_items = word_list_get_n_items;
+    iface->get_item = word_list_get_item;
 }
 
-static char* verb_count(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Verbs: %d", analyse->nb_verbes);
-    return result;
+G_DEFINE_TYPE_WITH_CODE(WordList, word_list, G_TYPE_OBJECT,
+                        G_IMPLEMENT_INTERFACE(G_TYPE_LIST_MODEL, word_list_model_init))
+
+// Forgets the filtered indices (order is kept)
+static void word_list_clear_visible(WordList *list) {
+    if (list->visible != list->order) {
+        free(list->visible);
+    }
+    list->visible = NULL;
+    list->n_visible = 0;
+}
+
+static void word_list_clear(WordList *list) {
+    word_list_clear_visible(list);
+    free(list->order);
+    list->order = NULL;
 }
 
-static char* proper_noun_count(const AnalyseTexte* analyse) {
-    static char result[100];
-    snprintf(result, sizeof(result), "Proper Nouns: %d", analyse->nb_noms_propres);
-    return result;
+static void word_list_finalize(GObject *object) {
+    WordList *list = WORD_LIST(object);
+    word_list_clear(list);
+    free(list->filter);
+    G_OBJECT_CLASS(word_list_parent_class)->finalize(object);
 }
+
+static void word_list_class_init(WordListClass *klass) {
+    G_OBJECT_CLASS(klass)->finalize = word_list_finalize;
+}
+
+static void word_list_init(WordList *list) {
+    list->sort_key = TRI_FREQUENCE;
+    list->descending = TRUE;
+}
+
 /**
- * Exporte l'analyse complète dans un fichier texte
- * Crée un fichier 'analyse.txt' avec toutes les statistiques et fréquences
+ * Recalcule les mots visibles : tri du vocabulaire selon la clé choisie si besoin, puis filtre sur le texte des mots
+ * La vue est prévenue par un seul signal items-changed (elle ne relit que les lignes affichées)
  *
- * @param analyse Pointeur vers la structure d'analyse
+ * @param list Modèle de la vue des fréquences
+ * @param resort TRUE si le vocabulaire ou la clé de tri ont changé ; FALSE si seul le filtre a changé (l'ordre
+ *               déjà calculé est réutilisé)
  */
-static void export_analysis(const AnalyseTexte* analyse) {
-    FILE* fichier = fopen("analyse.txt", "w");
-    if (fichier == NULL) {
-        perror("Erreur à l'ouverture du fichier");
-        exit(EXIT_FAILURE);
-    }
-
-    fprintf(fichier, "Total Words: %d\n", analyse->nb_mots_total);
-    fprintf(fichier, "Unique Words: %d\n", analyse->nb_mots_uniques);
-    fprintf(fichier, "Sentences: %d\n", analyse->nb_phrases);
-    fprintf(fichier, "Paragraphs: %d\n", analyse->nb_paragraphes);
-    fprintf(fichier, "Average Sentence Length: %.2f words\n", analyse->longueur_phrase_moyenne);
-    fprintf(fichier, "Lexical Diversity: %.2f%%\n", analyse->diversite_lexicale * 100);
-    fprintf(fichier, "Text Complexity: %.2f\n", analyse->complexite_texte);
-    fprintf(fichier, "Verbs: %d\n", analyse->nb_verbes);
-    fprintf(fichier, "Proper Nouns: %d\n", analyse->nb_noms_propres);
-
-    fprintf(fichier, get_detailed_statistics(analyse));
-
-    fprintf(fichier, "\nComplete Word Frequency:\n");
-    fprintf(fichier, "---------------------------------\n");
-
-    // Count the number of unique words
-    int unique_words_count = 0;
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL) {
-            unique_words_count++;
-            courant = courant->suivant;
-        }
-    }
-
-    // Create an array to store the unique words and their frequencies
-    Mot* unique_words_array = malloc(unique_words_count * sizeof(Mot));
-    int index = 0;
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL) {
-            unique_words_array[index] = courant->mot;
-            index++;
-            courant = courant->suivant;
+static void word_list_refresh(WordList *list, gboolean resort) {
+    guint removed = list->n_visible;
+    if (resort) {
+        word_list_clear(list);
+        if (list->vocabulary != NULL && list->vocabulary->nb_mots > 0) {
+            list->order = trierMotsSelon(list->vocabulary, list->sort_key, list->descending, 0);
         }
+    } else {
+        word_list_clear_visible(list);
     }
-
-    // Sort the array in ascending order of frequency
-    for (int i = 0; i < unique_words_count - 1; i++) {
-        for (int j = 0; j < unique_words_count - i - 1; j++) {
-            if (unique_words_array[j].frequence > unique_words_array[j + 1].frequence) {
-                Mot temp = unique_words_array[j];
-                unique_words_array[j] = unique_words_array[j + 1];
-                unique_words_array[j + 1] = temp;
+    if (list->order != NULL) {
+        size_t n = list->vocabulary->nb_mots;
+        if (list->filter == NULL) {
+            list->visible = list->order;
+            list->n_visible = (guint)n;
+        } else if ((list->visible = malloc(n * sizeof(uint32_t))) != NULL) {
+            for (size_t i = 0; i < n; i++) {
+                const Mot *mot = &list->vocabulary->mots[list->order[i]];
+                if (wcsstr(texteMot(list->vocabulary, mot), list->filter) != NULL) {
+                    list->visible[list->n_visible++] = list->order[i];
+                }
             }
         }
     }
-
-    // Print the sorted array to the file
-    for (int i = 0; i < unique_words_count; i++) {
-        fprintf(fichier, "%ls: %d occurrences", unique_words_array[i].mot, unique_words_array[i].frequence);
-        if (unique_words_array[i].est_verbe) fprintf(fichier, " (verbe)");
-        if (unique_words_array[i].est_nom_propre) fprintf(fichier, " (nom propre)");
-        fprintf(fichier, "\n");
+    if (removed > 0 || list->n_visible > 0) {
+        g_list_model_items_changed(G_LIST_MODEL(list), 0, removed, list->n_visible);
     }
-
-    free(unique_words_array);
-
-    fclose(fichier);
 }
-/**
- * Retourne les 10 mots les plus fréquents du texte
- * Trie les mots par fréquence et formate le résultat
- *
- * @param analyse Pointeur vers la structure d'analyse
- * @return Chaîne formatée contenant les 10 mots les plus fréquents
- */
-static char* get_top_ten_words(const AnalyseTexte* analyse) {
-    static char result[8192];
-    char temp[1024];  // Increased buffer size for UTF-8 characters
-    result[0] = '\0';
-    
-    if (analyse->nb_mots_uniques == 0) {
-        strcat(result, "No words to display.\n");
-        return result;
-    }
 
-    Mot* mots = (Mot*)malloc(analyse->nb_mots_uniques * sizeof(Mot));
-    if (mots == NULL) {
-        strcat(result, "Memory allocation error\n");
-        return result;
-    }
+// Shows another vocabulary (NULL to detach the view before the analysis is reused or freed)
+static void word_list_set_vocabulary(WordList *list, const TableMots *vocabulary) {
+    list->vocabulary = vocabulary;
+    word_list_refresh(list, TRUE);
+}
 
-    // Collect words from hash table
-    int nb_mots = 0;
-    for (int i = 0; i < TAILLE_HASHTABLE && nb_mots < analyse->nb_mots_uniques; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL && nb_mots < analyse->nb_mots_uniques) {
-            mots[nb_mots] = courant->mot;
-            nb_mots++;
-            courant = courant->suivant;
-        }
+static void word_list_set_sort(WordList *list, CleTriMots key, gboolean descending) {
+    if (list->sort_key == key && list->descending == descending) {
+        return;
     }
+    list->sort_key = key;
+    list->descending = descending;
+    word_list_refresh(list, TRUE);
+}
 
-    // Sort first 10 words by frequency
-    for (int i = 0; i < 10 && i < nb_mots; i++) {
-        int max_idx = i;
-        for (int j = i + 1; j < nb_mots; j++) {
-            if (mots[j].frequence > mots[max_idx].frequence) {
-                max_idx = j;
-            }
+// Keeps the words containing text (normalized like the words of the table: case folded, NFC)
+// The entry text is always UTF-8: it is decoded directly, whatever the locale
+static void word_list_set_filter(WordList *list, const char *text) {
+    free(list->filter);
+    list->filter = NULL;
+    size_t length = (size_t)g_utf8_strlen(text, -1);
+    wchar_t *wide = NULL;
+    if (length > 0 && (wide = malloc(length * sizeof(wchar_t))) != NULL &&
+        (list->filter = malloc((length * EXPANSION_NORMALISATION_MAX + 1) * sizeof(wchar_t))) != NULL) {
+        const char *p = text;
+        for (size_t i = 0; i < length; i++, p = g_utf8_next_char(p)) {
+            wide[i] = (wchar_t)g_utf8_get_char(p);
         }
-        if (max_idx != i) {
-            Mot temp_mot = mots[i];
-            mots[i] = mots[max_idx];
-            mots[max_idx] = temp_mot;
+        if (normaliserMot(wide, length, list->filter) == 0) {
+            free(list->filter);
+            list->filter = NULL;
         }
     }
+    free(wide);
+    word_list_refresh(list, FALSE);
+}
 
-    strcat(result, "Top words by frequency:\n\n");
-
-    // Use wide character formatting
-    for (int i = 0; i < 10 && i < nb_mots; i++) {
-        temp[0] = '\0';  // Clear temp buffer
-        
-        // Convert the numeric parts and fixed strings to a temporary buffer
-        char prefix[64];
-        snprintf(prefix, sizeof(prefix), "%d. ", i + 1);
-        strcat(temp, prefix);
-        
-        // Convert wide string to multibyte
-        char word_buffer[512];
-        wcstombs(word_buffer, mots[i].mot, sizeof(word_buffer));
-        strcat(temp, word_buffer);
-        
-        // Add frequency and other information
-        char suffix[256];
-        snprintf(suffix, sizeof(suffix), ": %d occurrence%s%s%s\n",
-                mots[i].frequence,
-                mots[i].frequence > 1 ? "s" : "",
-                mots[i].est_verbe ? " (verb)" : "",
-                mots[i].est_nom_propre ? " (proper noun)" : "");
-        strcat(temp, suffix);
-        
-        // Add to final result
-        strcat(result, temp);
-    }
-    free(mots);
-    return result;
+// Columns of the word frequency view, in display order
+typedef enum {
+    WORD_COLUMN_TEXT,
+    WORD_COLUMN_FREQUENCY,
+    WORD_COLUMN_LENGTH,
+    WORD_COLUMN_TYPE,
+    WORD_COLUMN_COUNT
+} WordColumn;
+
+static void on_word_cell_setup(GtkSignalListItemFactory *factory, GtkListItem *item, gpointer user_data) {
+    (void)factory;
+    GtkWidget *label = gtk_label_new(NULL);
+    gtk_label_set_xalign(GTK_LABEL(label), GPOINTER_TO_INT(user_data) == WORD_COLUMN_TEXT ||
+                                           GPOINTER_TO_INT(user_data) == WORD_COLUMN_TYPE ? 0.0f : 1.0f);
+    gtk_list_item_set_child(item, label);
 }
 
-/**
- * Trouve et retourne tous les palindromes du texte
- *
- * @param analyse Pointeur vers la structure d'analyse
- * @return Chaîne formatée contenant la liste des palindromes trouvés
- */
-static char* get_palindromes(const AnalyseTexte* analyse) {
-    static char result[8192];
-    char temp[256];
-    int palindromes_trouves = 0;
-    
-    result[0] = '\0';
-    strcat(result, "Palindromes found in text:\n\n");
-
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL) {
-            if (wcslen(courant->mot.mot) > 2 && estPalindrome(courant->mot.mot)) {
-                snprintf(temp, sizeof(temp), "%s (frequency: %d)\n",
-                        wchar_to_utf8(courant->mot.mot),  // Convert to UTF-8
-                        courant->mot.frequence);
-                strcat(result, temp);
-                palindromes_trouves++;
-            }
-            courant = courant->suivant;
-        }
+static void on_word_cell_bind(GtkSignalListItemFactory *factory, GtkListItem *item, gpointer user_data) {
+    WordList *list = g_object_get_data(G_OBJECT(factory), "word-list");
+    WordRow *row = gtk_list_item_get_item(item);
+    GtkLabel *label = GTK_LABEL(gtk_list_item_get_child(item));
+    if (list->vocabulary == NULL || row->index >= list->vocabulary->nb_mots) {
+        gtk_label_set_text(label, "");
+        return;
     }
+    const Mot *mot = &list->vocabulary->mots[row->index];
+    char number[32];
+    char word[8192];
+    switch (GPOINTER_TO_INT(user_data)) {
+        case WORD_COLUMN_TEXT:
+            gtk_label_set_text(label, wchar_to_utf8(texteMot(list->vocabulary, mot), word, sizeof(word)));
+            break;
+        case WORD_COLUMN_FREQUENCY:
+            snprintf(number, sizeof(number), "%lld", mot->frequence);
+            gtk_label_set_text(label, number);
+            break;
+        case WORD_COLUMN_LENGTH:
+            snprintf(number, sizeof(number), "%d", mot->longueur);
+            gtk_label_set_text(label, number);
+            break;
+        default:
+            gtk_label_set_text(label, aAttribut(mot, ATTRIBUT_VERBE) && aAttribut(mot, ATTRIBUT_NOM_PROPRE) ? "verb, proper noun" :
+                                      aAttribut(mot, ATTRIBUT_VERBE) ? "verb" : aAttribut(mot, ATTRIBUT_NOM_PROPRE) ? "proper noun" : "");
+            break;
+    }
+}
 
-    if (palindromes_trouves == 0) {
-        strcat(result, "No palindromes found in text.\n");
-    } else {
-        snprintf(temp, sizeof(temp), "\nTotal palindromes found: %d\n", palindromes_trouves);
-        strcat(result, temp);
+// Called when a column header is clicked: the model sorts the indices itself instead of a GtkSortListModel,
+// which would have to create a row object for every word
+static void on_word_sort_changed(GtkSorter *sorter, GtkSorterChange change, gpointer user_data) {
+    (void)change;
+    WordList *list = WORD_LIST(user_data);
+    GtkColumnViewSorter *column_sorter = GTK_COLUMN_VIEW_SORTER(sorter);
+    GtkColumnViewColumn *column = gtk_column_view_sorter_get_primary_sort_column(column_sorter);
+    if (column == NULL) {
+        return;
     }
+    CleTriMots key = (CleTriMots)GPOINTER_TO_INT(g_object_get_data(G_OBJECT(column), "sort-key"));
+    word_list_set_sort(list, key,
+                       gtk_column_view_sorter_get_primary_sort_order(column_sorter) == GTK_SORT_DESCENDING);
+}
 
-    return result;
+static void on_word_filter_changed(GtkSearchEntry *entry, gpointer user_data) {
+    word_list_set_filter(WORD_LIST(user_data), gtk_editable_get_text(GTK_EDITABLE(entry)));
 }
+
 /**
- * Retourne la fréquence de tous les mots du texte
+ * Crée la vue des fréquences : champ de recherche et tableau virtualisé (mot, fréquence, longueur, type)
+ * Cliquer sur l'en-tête d'une colonne trie les mots selon cette colonne
  *
- * @param analyse Pointeur vers la structure d'analyse
- * @return Chaîne formatée contenant la fréquence de tous les mots
+ * @param list Modèle affiché par la vue
+ * @return Conteneur de la vue
  */
-static char* get_word_frequency(const AnalyseTexte* analyse) {
-    static char result[8192];
-    char temp[256];
-    
-    result[0] = '\0';
-    strcat(result, "Complete word frequency:\n\n");
-
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL) {
-            snprintf(temp, sizeof(temp), "%s: %d occurrence%s%s%s\n",
-                    wchar_to_utf8(courant->mot.mot),  // Convert to UTF-8
-                    courant->mot.frequence,
-                    courant->mot.frequence > 1 ? "s" : "",
-                    courant->mot.est_verbe ? " (verb)" : "",
-                    courant->mot.est_nom_propre ? " (proper noun)" : "");
-            strcat(result, temp);
-            courant = courant->suivant;
+static GtkWidget* create_word_frequency_view(WordList *list) {
+    static const char *titles[] = {"Word", "Frequency", "Length", "Type"};
+    static const int sort_keys[] = {TRI_TEXTE, TRI_FREQUENCE, TRI_LONGUEUR, -1};
+
+    GtkWidget *box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    GtkWidget *search_entry = gtk_search_entry_new();
+    gtk_search_entry_set_placeholder_text(GTK_SEARCH_ENTRY(search_entry), "Filter words");
+    g_signal_connect(search_entry, "search-changed", G_CALLBACK(on_word_filter_changed), list);
+
+    GtkWidget *view = gtk_column_view_new(GTK_SELECTION_MODEL(gtk_no_selection_new(g_object_ref(G_LIST_MODEL(list)))));
+    gtk_column_view_set_show_column_separators(GTK_COLUMN_VIEW(view), TRUE);
+    GtkColumnViewColumn *frequency_column = NULL;
+    for (int i = 0; i < WORD_COLUMN_COUNT; i++) {
+        GtkListItemFactory *factory = gtk_signal_list_item_factory_new();
+        g_object_set_data(G_OBJECT(factory), "word-list", list);
+        g_signal_connect(factory, "setup", G_CALLBACK(on_word_cell_setup), GINT_TO_POINTER(i));
+        g_signal_connect(factory, "bind", G_CALLBACK(on_word_cell_bind), GINT_TO_POINTER(i));
+        GtkColumnViewColumn *column = gtk_column_view_column_new(titles[i], factory);
+        if (sort_keys[i] >= 0) {
+            // Any sorter makes the header clickable; the order itself is computed by the model
+            g_object_set_data(G_OBJECT(column), "sort-key", GINT_TO_POINTER(sort_keys[i]));
+            GtkSorter *sorter = GTK_SORTER(gtk_custom_sorter_new(NULL, NULL, NULL));
+            gtk_column_view_column_set_sorter(column, sorter);
+            g_object_unref(sorter);
+        }
+        gtk_column_view_column_set_expand(column, i == WORD_COLUMN_TEXT);
+        gtk_column_view_append_column(GTK_COLUMN_VIEW(view), column);
+        if (i == WORD_COLUMN_FREQUENCY) {
+            frequency_column = column;
         }
+        g_object_unref(column);
     }
-
-    return result;
+    g_signal_connect(gtk_column_view_get_sorter(GTK_COLUMN_VIEW(view)), "changed",
+                     G_CALLBACK(on_word_sort_changed), list);
+    gtk_column_view_sort_by_column(GTK_COLUMN_VIEW(view), frequency_column, GTK_SORT_DESCENDING);
+
+    GtkWidget *scroll = gtk_scrolled_window_new();
+    gtk_scrolled_window_set_child(GTK_SCROLLED_WINDOW(scroll), view);
+    gtk_widget_set_vexpand(scroll, TRUE);
+    gtk_widget_set_size_request(scroll, -1, 200);
+
+    gtk_box_append(GTK_BOX(box), search_entry);
+    gtk_box_append(GTK_BOX(box), scroll);
+    return box;
 }
+//--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
  * Fonctions de gestion de l'interface GTK
@@ -837,6 +889,7 @@ static void on_back_clicked(GtkWidget *button, gpointer user_data) {
     MenuWidgets *widgets = (MenuWidgets *)user_data;
     show_main_menu(widgets);
     gtk_widget_set_visible(widgets->result_scroll_window, FALSE); //hide the result text view when back to main menu
+    gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
     gtk_widget_set_visible(widgets->result_label, FALSE);
 }
 
@@ -845,6 +898,7 @@ static void on_back_to_analyze_clicked(GtkWidget *button, gpointer user_data) {
     MenuWidgets *widgets = (MenuWidgets *)user_data;
     show_analyze_menu(widgets);
     gtk_widget_set_visible(widgets->result_scroll_window, FALSE); //hide the result text view when back to main menu
+    gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
     gtk_widget_set_visible(widgets->result_label, FALSE);
 }
 
@@ -858,27 +912,142 @@ static void on_compare_clicked(GtkWidget *button, gpointer user_data) {
     show_compare_menu(widgets); //sends to compare menu
 }
 
-//function to get the file path entered by user and send it to the analysis function
+//Runs on a GTask worker thread: the widgets must not be touched here
+static void analysis_thread(GTask *task, gpointer source_object, gpointer task_data, GCancellable *cancellable) {
+    AnalysisJob *job = task_data;
+    if (analyserFichier(job->path, job->analysis, &job->progress) != 0) {
+        job->error = errno;
+    }
+    g_task_return_boolean(task, TRUE);
+}
+
+//Shows (or hides) the progress bar and cancel button while an analysis is running
+static void set_analysis_running(MenuWidgets *widgets, gboolean running) {
+    gtk_widget_set_sensitive(widgets->analyze_file_button, !running);
+    gtk_widget_set_visible(widgets->analysis_progress_bar, running);
+    gtk_widget_set_visible(widgets->cancel_analysis_button, running);
+    if (running) {
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(widgets->analysis_progress_bar), 0.0);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(widgets->analysis_progress_bar), NULL);
+    }
+}
+
+//Timeout refreshing the progress bar from the bytes consumed by the worker thread
+static gboolean update_analysis_progress(gpointer user_data) {
+    MenuWidgets *widgets = (MenuWidgets *)user_data;
+    AnalysisJob *job = widgets->running_job;
+    if (job == NULL) {
+        widgets->progress_source = 0;
+        return G_SOURCE_REMOVE;
+    }
+    size_t done = atomic_load(&job->progress.octets_traites);
+    size_t total = atomic_load(&job->progress.octets_total);
+    char text[64];
+    if (total > 0) {
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(widgets->analysis_progress_bar),
+                                      done < total ? (double)done / total : 1.0);
+        snprintf(text, sizeof(text), "%.1f / %.1f MB", done / 1e6, total / 1e6);
+    } else {
+        gtk_progress_bar_pulse(GTK_PROGRESS_BAR(widgets->analysis_progress_bar));
+        snprintf(text, sizeof(text), "%.1f MB", done / 1e6);
+    }
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(widgets->analysis_progress_bar), text);
+    return G_SOURCE_CONTINUE;
+}
+
+//Called on the main loop when the worker thread is done
+static void on_analysis_done(GObject *source_object, GAsyncResult *res, gpointer user_data) {
+    AnalysisJob *job = g_task_get_task_data(G_TASK(res));
+    MenuWidgets *widgets = job->widgets;
+
+    if (widgets == NULL) { //window destroyed while the analysis was running
+        libererAnalyse(job->analysis);
+        free(job->analysis);
+    } else {
+        widgets->running_job = NULL;
+        widgets->current_analysis = job->analysis; //the analysis (and its word table memory) goes back to the window
+        if (widgets->progress_source != 0) {
+            g_source_remove(widgets->progress_source);
+            widgets->progress_source = 0;
+        }
+        set_analysis_running(widgets, FALSE);
+
+        char result[LONGUEUR_CHEMIN_MAX + 128];
+        if (job->error == 0) {
+            snprintf(result, sizeof(result), "File loaded: %s\nSelect a metric to analyze", job->path);
+            gtk_widget_set_visible(widgets->approximate_notice, widgets->current_analysis->esquisses != NULL);
+            show_metrics_menu(widgets);
+        } else {
+            reinitialiserAnalyse(widgets->current_analysis); //never expose a partial analysis
+            if (job->error == ECANCELED) {
+                snprintf(result, sizeof(result), "Analysis of %s cancelled", job->path);
+            } else {
+                snprintf(result, sizeof(result), "Could not analyze %s: %s", job->path, strerror(job->error));
+            }
+        }
+        gtk_label_set_text(GTK_LABEL(widgets->result_label), result);
+        gtk_widget_set_visible(widgets->result_label, TRUE);
+    }
+    g_free(job->path);
+    g_free(job);
+}
+
+//function to get the file path entered by user and start its analysis on a worker thread
 static void on_analyze_file(GtkWidget *button, gpointer user_data) {
     MenuWidgets *widgets = (MenuWidgets *)user_data;
     const char *filepath = gtk_editable_get_text(GTK_EDITABLE(widgets->entry_file1)); //get the file path entered by user
 
-    // Free previous analysis if it exists
+    if (widgets->running_job != NULL) {
+        return;
+    }
+
+    // Reuse the previous analysis (and its word table memory) if it exists, otherwise allocate it
+    word_list_set_vocabulary(widgets->word_list, NULL); //the word frequency view must not read the table being refilled
     if (widgets->current_analysis != NULL) {
-        libererAnalyse(widgets->current_analysis);
-        free(widgets->current_analysis);
+        reinitialiserAnalyse(widgets->current_analysis);
+    } else {
+        widgets->current_analysis = malloc(sizeof(AnalyseTexte));
+        if (!widgets->current_analysis) {
+            gtk_label_set_text(GTK_LABEL(widgets->result_label), "Memory allocation error!");
+            gtk_widget_set_visible(widgets->result_label, TRUE);
+            return;
+        }
+        initialiserAnalyse(widgets->current_analysis);
+    }
+    if (choisirModeAnalyse(widgets->current_analysis,
+                           gtk_check_button_get_active(GTK_CHECK_BUTTON(widgets->approximate_check))) != 0) {
+        gtk_label_set_text(GTK_LABEL(widgets->result_label), "Memory allocation error!");
+        gtk_widget_set_visible(widgets->result_label, TRUE);
+        return;
     }
 
-    // Allocate new analysis
-    widgets->current_analysis = malloc(sizeof(AnalyseTexte));
-    initialiserAnalyse(widgets->current_analysis);
-    analyserFichier(filepath, widgets->current_analysis);
-    
-    char result[256];
-    snprintf(result, sizeof(result), "File loaded: %s\nSelect a metric to analyze", filepath);
-    gtk_label_set_text(GTK_LABEL(widgets->result_label), result);
-    
-    show_metrics_menu(widgets);
+    // The job owns the analysis until on_analysis_done gives it back
+    AnalysisJob *job = g_new0(AnalysisJob, 1);
+    job->widgets = widgets;
+    job->analysis = widgets->current_analysis;
+    job->path = g_strdup(filepath);
+    widgets->current_analysis = NULL;
+    widgets->running_job = job;
+
+    set_analysis_running(widgets, TRUE);
+    gtk_label_set_text(GTK_LABEL(widgets->result_label), "Analyzing...");
+    gtk_widget_set_visible(widgets->result_label, TRUE);
+    gtk_widget_set_visible(widgets->result_scroll_window, FALSE);
+    gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
+    widgets->progress_source = g_timeout_add(100, update_analysis_progress, widgets);
+
+    GTask *task = g_task_new(NULL, NULL, on_analysis_done, NULL);
+    g_task_set_task_data(task, job, NULL);
+    g_task_run_in_thread(task, analysis_thread);
+    g_object_unref(task);
+}
+
+//Asks the running analysis to stop; on_analysis_done reports the cancellation
+static void on_cancel_analysis(GtkWidget *button, gpointer user_data) {
+    MenuWidgets *widgets = (MenuWidgets *)user_data;
+    if (widgets->running_job != NULL) {
+        atomic_store(&widgets->running_job->progress.annulation, 1);
+    }
 }
 //--------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -914,59 +1083,55 @@ static void set_text_buffer_safely(GtkTextBuffer *buffer, const char *text) {
     }
 }
 
-//function used when user entered 2 file path to compare, it displays the comparison between the 2 files in the text view (scrollable)
-static void on_compare_files(GtkWidget *button, gpointer user_data) {
-    MenuWidgets *widgets = (MenuWidgets *)user_data;
-    //gets separate file paths entered by user
-    const char *filepath1 = gtk_editable_get_text(GTK_EDITABLE(widgets->entry_file_1));
-    const char *filepath2 = gtk_editable_get_text(GTK_EDITABLE(widgets->entry_file_2));
-    
-    // Create two separate analyses for each file
-    AnalyseTexte *analyse1 = malloc(sizeof(AnalyseTexte));
-    AnalyseTexte *analyse2 = malloc(sizeof(AnalyseTexte));
-    
-    if (!analyse1 || !analyse2) {
-        gtk_label_set_text(GTK_LABEL(widgets->result_label), "Memory allocation error!");
-        free(analyse1);
-        free(analyse2);
-        return;
-    }
-
-    // Initialize and analyze both files
-    initialiserAnalyse(analyse1);
-    initialiserAnalyse(analyse2);
-    analyserFichier(filepath1, analyse1);
-    analyserFichier(filepath2, analyse2);
+//displays the comparison between the 2 analyzed files in the text view (scrollable)
+static void show_comparison(MenuWidgets *widgets, const AnalyseTexte *analyse1, const AnalyseTexte *analyse2,
+                            const char *filepath1, const char *filepath2) {
+    // Vocabulary similarity: shared words are looked up in the larger table, in time linear in the vocabularies
+    SimilariteVocabulaires similarity;
+    comparerVocabulaires(&analyse1->vocabulaire, &analyse2->vocabulaire, &similarity);
 
     // Create formatted comparison text
     char result[4096];
     snprintf(result, sizeof(result),
         "Comparison of metrics between files:\n\n"
-        "Total Words difference: %d\n"
-        "Unique Words difference: %d\n"
-        "Sentences difference: %d\n"
+        "Total Words difference: %lld\n"
+        "Unique Words difference: %lld\n"
+        "Sentences difference: %lld\n"
         "Average Sentence Length difference: %.2f\n"
         "Lexical Diversity difference: %.2f%%\n"
         "Text Complexity difference: %.2f\n"
-        "Verbs difference: %d\n"
-        "Proper Nouns difference: %d\n\n"
+        "Verbs difference: %lld\n"
+        "Proper Nouns difference: %lld\n\n"
+        "Vocabulary similarity:\n"
+        "- Shared words: %zu\n"
+        "- Words only in file 1: %zu\n"
+        "- Words only in file 2: %zu\n"
+        "- Jaccard index: %.4f\n"
+        "- Overlap coefficient: %.4f\n"
+        "- Cosine similarity of frequencies: %.4f\n\n"
         "Individual Statistics:\n"
         "File 1: %s\n"
-        "- Total Words: %d\n"
-        "- Unique Words: %d\n"
+        "- Total Words: %lld\n"
+        "- Unique Words: %lld\n"
         "- Text Complexity: %.2f\n\n"
         "File 2: %s\n"
-        "- Total Words: %d\n"
-        "- Unique Words: %d\n"
+        "- Total Words: %lld\n"
+        "- Unique Words: %lld\n"
         "- Text Complexity: %.2f",
-        abs(analyse1->nb_mots_total - analyse2->nb_mots_total),
-        abs(analyse1->nb_mots_uniques - analyse2->nb_mots_uniques),
-        abs(analyse1->nb_phrases - analyse2->nb_phrases),
+        llabs(analyse1->nb_mots_total - analyse2->nb_mots_total),
+        llabs(analyse1->nb_mots_uniques - analyse2->nb_mots_uniques),
+        llabs(analyse1->nb_phrases - analyse2->nb_phrases),
         fabs(analyse1->longueur_phrase_moyenne - analyse2->longueur_phrase_moyenne),
         fabs(analyse1->diversite_lexicale - analyse2->diversite_lexicale) * 100,
         fabs(analyse1->complexite_texte - analyse2->complexite_texte),
-        abs(analyse1->nb_verbes - analyse2->nb_verbes),
-        abs(analyse1->nb_noms_propres - analyse2->nb_noms_propres),
+        llabs(analyse1->nb_verbes - analyse2->nb_verbes),
+        llabs(analyse1->nb_noms_propres - analyse2->nb_noms_propres),
+        similarity.mots_communs,
+        similarity.mots_propres_a,
+        similarity.mots_propres_b,
+        similarity.jaccard,
+        similarity.recouvrement,
+        similarity.cosinus,
         filepath1,
         analyse1->nb_mots_total,
         analyse1->nb_mots_uniques,
@@ -981,12 +1146,97 @@ static void on_compare_files(GtkWidget *button, gpointer user_data) {
     set_text_buffer_safely(widgets->result_buffer, result);
     gtk_widget_set_visible(widgets->result_label, FALSE);
     gtk_widget_set_visible(widgets->result_scroll_window, TRUE);
+    gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
+}
+
+//Called on the main loop each time one of the two analyses of a comparison is done
+static void on_compare_file_done(GObject *source_object, GAsyncResult *res, gpointer user_data) {
+    CompareJob *job = user_data;
+    if (--job->pending > 0) {
+        return; //wait for the other file
+    }
+    MenuWidgets *widgets = job->widgets;
+
+    if (widgets == NULL) { //window destroyed while the analyses were running
+        for (int i = 0; i < 2; i++) {
+            libererAnalyse(job->files[i].analysis);
+            free(job->files[i].analysis);
+        }
+    } else {
+        widgets->running_compare = NULL;
+        gtk_widget_set_sensitive(widgets->compare_files_button, TRUE);
+        for (int i = 0; i < 2; i++) {
+            widgets->compare_analyses[i] = job->files[i].analysis; //given back for the next comparison
+        }
 
-    // Clean up
-    libererAnalyse(analyse1);
-    libererAnalyse(analyse2);
-    free(analyse1);
-    free(analyse2);
+        int failed = job->files[0].error != 0 ? 0 : (job->files[1].error != 0 ? 1 : -1);
+        if (failed >= 0) {
+            char message[LONGUEUR_CHEMIN_MAX + 128];
+            snprintf(message, sizeof(message), "Could not analyze %s: %s",
+                     job->files[failed].path, strerror(job->files[failed].error));
+            gtk_label_set_text(GTK_LABEL(widgets->result_label), message);
+            gtk_widget_set_visible(widgets->result_scroll_window, FALSE);
+            gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
+            gtk_widget_set_visible(widgets->result_label, TRUE);
+        } else {
+            show_comparison(widgets, job->files[0].analysis, job->files[1].analysis,
+                            job->files[0].path, job->files[1].path);
+        }
+    }
+    for (int i = 0; i < 2; i++) {
+        g_free(job->files[i].path);
+    }
+    g_free(job);
+}
+
+//function used when user entered 2 file path to compare: both files are analyzed at the same time on worker threads
+static void on_compare_files(GtkWidget *button, gpointer user_data) {
+    MenuWidgets *widgets = (MenuWidgets *)user_data;
+    //gets separate file paths entered by user
+    const char *filepaths[2] = {
+        gtk_editable_get_text(GTK_EDITABLE(widgets->entry_file_1)),
+        gtk_editable_get_text(GTK_EDITABLE(widgets->entry_file_2))
+    };
+
+    if (widgets->running_compare != NULL) {
+        return;
+    }
+    
+    // One analysis per file, allocated by the first comparison and reused by the next ones
+    for (int i = 0; i < 2; i++) {
+        if (widgets->compare_analyses[i] != NULL) {
+            reinitialiserAnalyse(widgets->compare_analyses[i]);
+            continue;
+        }
+        widgets->compare_analyses[i] = malloc(sizeof(AnalyseTexte));
+        if (!widgets->compare_analyses[i]) {
+            gtk_label_set_text(GTK_LABEL(widgets->result_label), "Memory allocation error!");
+            return;
+        }
+        initialiserAnalyse(widgets->compare_analyses[i]);
+    }
+
+    // The job owns both analyses until on_compare_file_done gives them back
+    CompareJob *job = g_new0(CompareJob, 1);
+    job->widgets = widgets;
+    job->pending = 2;
+    widgets->running_compare = job;
+    gtk_widget_set_sensitive(widgets->compare_files_button, FALSE);
+    gtk_label_set_text(GTK_LABEL(widgets->result_label), "Analyzing both files...");
+    gtk_widget_set_visible(widgets->result_scroll_window, FALSE);
+    gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
+    gtk_widget_set_visible(widgets->result_label, TRUE);
+
+    for (int i = 0; i < 2; i++) {
+        job->files[i].analysis = widgets->compare_analyses[i];
+        job->files[i].path = g_strdup(filepaths[i]);
+        widgets->compare_analyses[i] = NULL;
+
+        GTask *task = g_task_new(NULL, NULL, on_compare_file_done, job);
+        g_task_set_task_data(task, &job->files[i], NULL);
+        g_task_run_in_thread(task, analysis_thread);
+        g_object_unref(task);
+    }
 }
 
 /**
@@ -996,15 +1246,40 @@ static void on_compare_files(GtkWidget *button, gpointer user_data) {
  * @param user_data Pointeur vers la structure des widgets
  */
 
+//shows the vocabulary of the current analysis in the word frequency view (sorted once, rows built while scrolling)
+static void show_word_frequency(MenuWidgets *widgets) {
+    if (widgets->word_list->vocabulary != &widgets->current_analysis->vocabulaire) {
+        word_list_set_vocabulary(widgets->word_list, &widgets->current_analysis->vocabulaire);
+    }
+    gtk_widget_set_visible(widgets->result_label, FALSE);
+    gtk_widget_set_visible(widgets->result_scroll_window, FALSE);
+    gtk_widget_set_visible(widgets->word_frequency_box, TRUE);
+}
+
 static void on_metric_clicked(GtkWidget *button, gpointer user_data) {
     MenuWidgets *widgets = (MenuWidgets *)user_data;
     //we get the label of the button clicked to use it to call the right metric function
     const char *label = gtk_button_get_label(GTK_BUTTON(button));
     char *result = NULL;
+    char *owned_result = NULL; // Result allocated by the metric function, freed once displayed
+    char metric[128] = ""; // Result of the single line metrics
     
     if (!widgets->current_analysis) { //should not happen, but just in case
         gtk_label_set_text(GTK_LABEL(widgets->result_label), "No file analyzed yet!");
         gtk_widget_set_visible(widgets->result_scroll_window, FALSE);
+        gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
+        gtk_widget_set_visible(widgets->result_label, TRUE);
+        return;
+    }
+
+    // Approximate mode keeps no exact vocabulary: the full word lists (and the n-grams built on it) do not exist
+    if (widgets->current_analysis->esquisses &&
+        (strstr(label, "11. Word Frequency") || strstr(label, "12. Palindromes") ||
+         strstr(label, "14. Download analysis") || strstr(label, "15. Top K N-grams"))) {
+        gtk_label_set_text(GTK_LABEL(widgets->result_label),
+                           "Not available in approximate mode (the exact vocabulary is not kept)");
+        gtk_widget_set_visible(widgets->result_scroll_window, FALSE);
+        gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
         gtk_widget_set_visible(widgets->result_label, TRUE);
         return;
     }
@@ -1021,50 +1296,82 @@ static void on_metric_clicked(GtkWidget *button, gpointer user_data) {
         strstr(label, "9. Proper Nouns")||
         strstr(label, "14. Download analysis")) {
         
+        result = metric;
         if (strstr(label, "1. Total Words")) 
-            result = total_words(widgets->current_analysis);
+            total_words(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "2. Unique Words")) 
-            result = unique_words(widgets->current_analysis);
+            unique_words(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "3. Sentences")) 
-            result = sentence_count(widgets->current_analysis);
+            sentence_count(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "4. Paragraphs")) 
-            result = paragraph_count(widgets->current_analysis);
+            paragraph_count(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "5. Average Sentence Length")) 
-            result = avg_sentence_length(widgets->current_analysis);
+            avg_sentence_length(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "6. Lexical Diversity")) 
-            result = lexical_diversity(widgets->current_analysis);
+            lexical_diversity(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "7. Text Complexity")) 
-            result = text_complexity(widgets->current_analysis);
+            text_complexity(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "8. Verbs")) 
-            result = verb_count(widgets->current_analysis);
+            verb_count(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "9. Proper Nouns")) 
-            result = proper_noun_count(widgets->current_analysis);
+            proper_noun_count(widgets->current_analysis, metric, sizeof(metric));
         else if (strstr(label, "14. Download analysis")){
-            export_analysis(widgets->current_analysis);
-            result = "Analysis saved in file 'analyse.txt'";
+            const char *path = gtk_editable_get_text(GTK_EDITABLE(widgets->export_path_entry));
+            FormatExport format = (FormatExport)gtk_drop_down_get_selected(GTK_DROP_DOWN(widgets->export_format_dropdown));
+            if (path[0] == '\0') {
+                result = "Enter an output file path first!";
+            } else if (export_analysis(widgets->current_analysis, path, format) != 0) {
+                owned_result = g_strdup_printf("Could not write '%s': %s", path, strerror(errno));
+                result = owned_result;
+            } else {
+                owned_result = g_strdup_printf("Analysis saved in file '%s'", path);
+                result = owned_result;
+            }
         } 
         
         gtk_label_set_text(GTK_LABEL(widgets->result_label), result);
         gtk_widget_set_visible(widgets->result_scroll_window, FALSE); //hide long text view
+        gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
         gtk_widget_set_visible(widgets->result_label, TRUE); //show short text label
     }
     // For longer metrics, use scrollable text view
     else {
-        if (strstr(label, "10. Top 10 Words")) 
-            result = get_top_ten_words(widgets->current_analysis);
-        else if (strstr(label, "11. Word Frequency")) 
-            result = get_word_frequency(widgets->current_analysis);
-        else if (strstr(label, "12. Palindromes")) 
-            result = get_palindromes(widgets->current_analysis);
-        else if(strstr(label, "13. Detailed statistics")) 
-            result = get_detailed_statistics(widgets->current_analysis);
+        if (strstr(label, "10. Top K Words")) {
+            owned_result = get_top_words(widgets->current_analysis,
+                gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(widgets->top_k_spin)),
+                (CategorieMots)gtk_drop_down_get_selected(GTK_DROP_DOWN(widgets->top_category_dropdown)),
+                gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(widgets->top_length_spin)));
+            result = owned_result;
+        }
+        else if (strstr(label, "11. Word Frequency")) {
+            show_word_frequency(widgets);
+            return;
+        }
+        else if (strstr(label, "12. Palindromes")) {
+            owned_result = get_palindromes(widgets->current_analysis);
+            result = owned_result;
+        }
+        else if(strstr(label, "13. Detailed statistics")) {
+            char *statistics = get_detailed_statistics(widgets->current_analysis);
+            char *performance = get_performance_statistics(widgets->current_analysis);
+            owned_result = g_strconcat(statistics, performance, NULL);
+            g_free(statistics);
+            g_free(performance);
+            result = owned_result;
+        }
+        else if (strstr(label, "15. Top K N-grams")) {
+            owned_result = get_top_ngrams(widgets->current_analysis,
+                gtk_spin_button_get_value_as_int(GTK_SPIN_BUTTON(widgets->top_k_spin)));
+            result = owned_result;
+        }
         if (result) {
             set_text_buffer_safely(widgets->result_buffer, result);
             gtk_widget_set_visible(widgets->result_label, FALSE); //hide short text label
             gtk_widget_set_visible(widgets->result_scroll_window, TRUE); //show long text view
+            gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
         }
-        
     }
+    g_free(owned_result);
 }
 
 /**
@@ -1073,10 +1380,32 @@ static void on_metric_clicked(GtkWidget *button, gpointer user_data) {
  * @param widgets Pointeur vers la structure des widgets à libérer
  */
 static void cleanup_widgets(MenuWidgets *widgets) {
+    // A running analysis is told to stop; it frees its own analysis when it completes
+    if (widgets->running_job != NULL) {
+        atomic_store(&widgets->running_job->progress.annulation, 1);
+        widgets->running_job->widgets = NULL;
+    }
+    if (widgets->progress_source != 0) {
+        g_source_remove(widgets->progress_source);
+    }
+    if (widgets->running_compare != NULL) {
+        for (int i = 0; i < 2; i++) {
+            atomic_store(&widgets->running_compare->files[i].progress.annulation, 1);
+        }
+        widgets->running_compare->widgets = NULL;
+    }
+    word_list_set_vocabulary(widgets->word_list, NULL);
+    g_object_unref(widgets->word_list);
     if (widgets->current_analysis != NULL) {
         libererAnalyse(widgets->current_analysis);
         free(widgets->current_analysis);
     }
+    for (int i = 0; i < 2; i++) {
+        if (widgets->compare_analyses[i] != NULL) {
+            libererAnalyse(widgets->compare_analyses[i]);
+            free(widgets->compare_analyses[i]);
+        }
+    }
     g_free(widgets);
 }
 /**
@@ -1090,6 +1419,12 @@ static void on_activate(GtkApplication *app) {
 
     MenuWidgets *widgets = g_new(MenuWidgets, 1);
     widgets->current_analysis = NULL;
+    widgets->compare_analyses[0] = NULL;
+    widgets->compare_analyses[1] = NULL;
+    widgets->running_job = NULL;
+    widgets->progress_source = 0;
+    widgets->running_compare = NULL;
+    widgets->word_list = g_object_new(WORD_TYPE_LIST, NULL);
     
     widgets->window = gtk_application_window_new(app);
     gtk_window_set_title(GTK_WINDOW(widgets->window), "Text Analysis Tool");
@@ -1115,29 +1450,44 @@ static void on_activate(GtkApplication *app) {
     widgets->analyze_menu_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 10);
     widgets->entry_file1 = gtk_entry_new();
     GtkWidget *analyze_label = gtk_label_new("Enter file path to analyze:");
-    GtkWidget *analyze_file_button = gtk_button_new_with_label("Analyze");
+    widgets->analyze_file_button = gtk_button_new_with_label("Analyze");
+    widgets->approximate_check =
+        gtk_check_button_new_with_label("Approximate mode (constant memory, estimated vocabulary metrics)");
+    widgets->analysis_progress_bar = gtk_progress_bar_new();
+    gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(widgets->analysis_progress_bar), TRUE);
+    widgets->cancel_analysis_button = gtk_button_new_with_label("Cancel");
     GtkWidget *back_button1 = gtk_button_new_with_label("Back to main menu");
     
     gtk_box_append(GTK_BOX(widgets->analyze_menu_box), analyze_label);
     gtk_box_append(GTK_BOX(widgets->analyze_menu_box), widgets->entry_file1);
-    gtk_box_append(GTK_BOX(widgets->analyze_menu_box), analyze_file_button);
+    gtk_box_append(GTK_BOX(widgets->analyze_menu_box), widgets->approximate_check);
+    gtk_box_append(GTK_BOX(widgets->analyze_menu_box), widgets->analyze_file_button);
+    gtk_box_append(GTK_BOX(widgets->analyze_menu_box), widgets->analysis_progress_bar);
+    gtk_box_append(GTK_BOX(widgets->analyze_menu_box), widgets->cancel_analysis_button);
     gtk_box_append(GTK_BOX(widgets->analyze_menu_box), back_button1);
+    gtk_widget_set_visible(widgets->analysis_progress_bar, FALSE);
+    gtk_widget_set_visible(widgets->cancel_analysis_button, FALSE);
 
     // Metrics menu with 2-column layout
     widgets->metrics_menu_box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 10);
     GtkWidget *metrics_label = gtk_label_new("Available Metrics:");
     gtk_box_append(GTK_BOX(widgets->metrics_menu_box), metrics_label);
+    widgets->approximate_notice = gtk_label_new("Approximate mode: unique words, lexical diversity, complexity, "
+                                                "verbs, proper nouns and top words are estimates");
+    gtk_box_append(GTK_BOX(widgets->metrics_menu_box), widgets->approximate_notice);
+    gtk_widget_set_visible(widgets->approximate_notice, FALSE);
 
     const char *metric_labels[] = {
         "1. Total Words", "2. Unique Words", "3. Sentences",
         "4. Paragraphs", "5. Average Sentence Length",
         "6. Lexical Diversity", "7. Text Complexity",
-        "8. Verbs", "9. Proper Nouns", "10. Top 10 Words",
-        "11. Word Frequency", "12. Palindromes", "13. Detailed statistics","14. Download analysis"
+        "8. Verbs", "9. Proper Nouns", "10. Top K Words",
+        "11. Word Frequency", "12. Palindromes", "13. Detailed statistics","14. Download analysis",
+        "15. Top K N-grams"
     };
 
     // Create pairs of metric buttons
-    for (int i = 0; i < 14; i += 2) {
+    for (int i = 0; i < 15; i += 2) {
         GtkWidget *row = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
         // Make the row expand horizontally
         gtk_widget_set_hexpand(row, TRUE);
@@ -1151,7 +1501,7 @@ static void on_activate(GtkApplication *app) {
         g_signal_connect(metric_button1, "clicked", G_CALLBACK(on_metric_clicked), widgets);
         
         // Second button in pair (if it exists)
-        if (i + 1 < 14) {
+        if (i + 1 < 15) {
             GtkWidget *metric_button2 = gtk_button_new_with_label(metric_labels[i + 1]);
             // Make the button expand to fill available space
             gtk_widget_set_hexpand(metric_button2, TRUE);
@@ -1169,6 +1519,34 @@ static void on_activate(GtkApplication *app) {
         gtk_box_append(GTK_BOX(widgets->metrics_menu_box), row);
     }
 
+    // Settings of "10. Top K Words": K, word category and word length for the "Words of length" category
+    // (K is also the number of bigrams and trigrams shown by "15. Top K N-grams")
+    const char *top_categories[] = {"All words", "Verbs", "Proper nouns", "Words of length", NULL};
+    GtkWidget *top_row = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
+    widgets->top_k_spin = gtk_spin_button_new_with_range(1, 1000000, 1);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(widgets->top_k_spin), 10);
+    widgets->top_category_dropdown = gtk_drop_down_new_from_strings(top_categories);
+    widgets->top_length_spin = gtk_spin_button_new_with_range(1, 1000, 1);
+    gtk_spin_button_set_value(GTK_SPIN_BUTTON(widgets->top_length_spin), 5);
+    gtk_box_append(GTK_BOX(top_row), gtk_label_new("Top K:"));
+    gtk_box_append(GTK_BOX(top_row), widgets->top_k_spin);
+    gtk_box_append(GTK_BOX(top_row), widgets->top_category_dropdown);
+    gtk_box_append(GTK_BOX(top_row), gtk_label_new("Length:"));
+    gtk_box_append(GTK_BOX(top_row), widgets->top_length_spin);
+    gtk_box_append(GTK_BOX(widgets->metrics_menu_box), top_row);
+
+    // Settings of "14. Download analysis": output file and format
+    const char *export_formats[] = {"Text", "CSV", "JSON Lines", NULL};
+    GtkWidget *export_row = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
+    widgets->export_path_entry = gtk_entry_new();
+    gtk_editable_set_text(GTK_EDITABLE(widgets->export_path_entry), "analyse.txt");
+    gtk_widget_set_hexpand(widgets->export_path_entry, TRUE);
+    widgets->export_format_dropdown = gtk_drop_down_new_from_strings(export_formats);
+    gtk_box_append(GTK_BOX(export_row), gtk_label_new("Export to:"));
+    gtk_box_append(GTK_BOX(export_row), widgets->export_path_entry);
+    gtk_box_append(GTK_BOX(export_row), widgets->export_format_dropdown);
+    gtk_box_append(GTK_BOX(widgets->metrics_menu_box), export_row);
+
     GtkWidget *back_button_metrics = gtk_button_new_with_label("Back to file selection");
     gtk_box_append(GTK_BOX(widgets->metrics_menu_box), back_button_metrics);
 
@@ -1178,14 +1556,14 @@ static void on_activate(GtkApplication *app) {
     widgets->entry_file_2 = gtk_entry_new();
     GtkWidget *compare_label1 = gtk_label_new("Enter first file path:");
     GtkWidget *compare_label2 = gtk_label_new("Enter second file path:");
-    GtkWidget *compare_files_button = gtk_button_new_with_label("Compare");
+    widgets->compare_files_button = gtk_button_new_with_label("Compare");
     GtkWidget *back_button2 = gtk_button_new_with_label("Back to main menu");
     
     gtk_box_append(GTK_BOX(widgets->compare_menu_box), compare_label1);
     gtk_box_append(GTK_BOX(widgets->compare_menu_box), widgets->entry_file_1);
     gtk_box_append(GTK_BOX(widgets->compare_menu_box), compare_label2);
     gtk_box_append(GTK_BOX(widgets->compare_menu_box), widgets->entry_file_2);
-    gtk_box_append(GTK_BOX(widgets->compare_menu_box), compare_files_button);
+    gtk_box_append(GTK_BOX(widgets->compare_menu_box), widgets->compare_files_button);
     gtk_box_append(GTK_BOX(widgets->compare_menu_box), back_button2);
 
     // Result label
@@ -1206,6 +1584,9 @@ static void on_activate(GtkApplication *app) {
                                 widgets->result_text_view);
     gtk_widget_set_size_request(widgets->result_scroll_window, -1, 200);
 
+    // Word frequency view (only the visible rows of the vocabulary are built)
+    widgets->word_frequency_box = create_word_frequency_view(widgets->word_list);
+
     // Add all containers to main box
     gtk_box_append(GTK_BOX(main_box), widgets->main_menu_box);
     gtk_box_append(GTK_BOX(main_box), widgets->analyze_menu_box);
@@ -1213,9 +1594,11 @@ static void on_activate(GtkApplication *app) {
     gtk_box_append(GTK_BOX(main_box), widgets->compare_menu_box);
     gtk_box_append(GTK_BOX(main_box), widgets->result_label);
     gtk_box_append(GTK_BOX(main_box), widgets->result_scroll_window);
+    gtk_box_append(GTK_BOX(main_box), widgets->word_frequency_box);
 
-    // Initially hide both result displays
+    // Initially hide all result displays
     gtk_widget_set_visible(widgets->result_scroll_window, FALSE);
+    gtk_widget_set_visible(widgets->word_frequency_box, FALSE);
     gtk_widget_set_visible(widgets->result_label, FALSE);
 
     // Connect signals
@@ -1225,8 +1608,9 @@ static void on_activate(GtkApplication *app) {
     g_signal_connect(back_button1, "clicked", G_CALLBACK(on_back_clicked), widgets);
     g_signal_connect(back_button2, "clicked", G_CALLBACK(on_back_clicked), widgets);
     g_signal_connect(back_button_metrics, "clicked", G_CALLBACK(on_back_to_analyze_clicked), widgets);
-    g_signal_connect(analyze_file_button, "clicked", G_CALLBACK(on_analyze_file), widgets);
-    g_signal_connect(compare_files_button, "clicked", G_CALLBACK(on_compare_files), widgets);
+    g_signal_connect(widgets->analyze_file_button, "clicked", G_CALLBACK(on_analyze_file), widgets);
+    g_signal_connect(widgets->cancel_analysis_button, "clicked", G_CALLBACK(on_cancel_analysis), widgets);
+    g_signal_connect(widgets->compare_files_button, "clicked", G_CALLBACK(on_compare_files), widgets);
 
     // Show main menu, hide others
     show_main_menu(widgets);
@@ -0,0 +1,609 @@
+#include "ngrammes.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TAILLE_FENETRE (ORDRE_NGRAMME_MAX - 1)   // Mots gardés de la fin du texte pour former les n-grammes suivants
+
+/**
+ * Calcule le hachage sur 64 bits des indices d'un n-gramme
+ * Les 32 bits de poids faible choisissent la case de la table, les autres les compteurs de l'esquisse
+ *
+ * @param mots Indices des mots (ORDRE_NGRAMME_MAX cases, les cases au-delà de l'ordre à zéro)
+ * @param ordre Nombre de mots du n-gramme
+ * @return Valeur de hachage
+ */
+static uint64_t hacherIndices(const uint32_t* mots, int ordre) {
+    uint64_t hachage = (uint64_t)ordre * 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < ordre; i++) {
+        hachage = (hachage ^ mots[i]) * 0xFF51AFD7ED558CCDULL;
+        hachage ^= hachage >> 32;
+    }
+    // Finalisation de MurmurHash3 sur 64 bits
+    hachage ^= hachage >> 33;
+    hachage *= 0xFF51AFD7ED558CCDULL;
+    hachage ^= hachage >> 33;
+    hachage *= 0xC4CEB9FE1A85EC53ULL;
+    hachage ^= hachage >> 33;
+    return hachage;
+}
+
+// Largeur de l'esquisse Count-Min : un quart du budget, en PROFONDEUR_ESQUISSE lignes de compteurs sur 32 bits
+static size_t largeurEsquisse(ModeNgrammes mode, size_t budget) {
+    if (mode != NGRAMMES_COUNT_MIN) {
+        return 0;
+    }
+    size_t largeur = CAPACITE_NGRAMMES_INITIALE;
+    while (largeur * 2 * PROFONDEUR_ESQUISSE * sizeof(uint32_t) <= budget / 4) {
+        largeur *= 2;
+    }
+    return largeur;
+}
+
+// Nombre de cases au-delà duquel la table est élaguée au lieu d'être agrandie (reste du budget après l'esquisse)
+static size_t capaciteMaximale(const TableNgrammes* table) {
+    if (table->mode == NGRAMMES_EXACT) {
+        return SIZE_MAX;
+    }
+    size_t octets_esquisse = table->largeur_esquisse * PROFONDEUR_ESQUISSE * sizeof(uint32_t);
+    size_t octets = table->budget > octets_esquisse ? table->budget - octets_esquisse : 0;
+    size_t capacite = CAPACITE_NGRAMMES_INITIALE;
+    while (capacite * 2 * sizeof(Ngramme) <= octets) {
+        capacite *= 2;
+    }
+    return capacite;
+}
+
+// Initialise une table vide d'un ordre donné
+static void initialiserTable(TableNgrammes* table, int ordre, ModeNgrammes mode, size_t budget) {
+    memset(table, 0, sizeof(TableNgrammes));
+    table->ordre = ordre;
+    table->mode = mode;
+    table->budget = budget;
+    table->largeur_esquisse = largeurEsquisse(mode, budget);
+}
+
+/**
+ * Initialise les n-grammes d'une analyse, avec le mode et le budget par défaut (MODE_NGRAMMES, BUDGET_NGRAMMES)
+ * Aucune allocation n'est faite avant le premier n-gramme
+ *
+ * @param ngrammes Pointeur vers les n-grammes à initialiser
+ */
+void initialiserNgrammes(Ngrammes* ngrammes) {
+    memset(ngrammes, 0, sizeof(Ngrammes));
+    configurerNgrammes(ngrammes, MODE_NGRAMMES, BUDGET_NGRAMMES);
+}
+
+/**
+ * Choisit le comportement des tables une fois leur budget mémoire atteint
+ * À appeler avant le premier mot ; deux n-grammes fusionnés doivent avoir la même configuration
+ *
+ * @param ngrammes N-grammes initialisés et vides
+ * @param mode Comportement des tables (voir ModeNgrammes)
+ * @param budget Octets accordés à la table de chaque ordre (cases et esquisse), ignoré en mode exact
+ */
+void configurerNgrammes(Ngrammes* ngrammes, ModeNgrammes mode, size_t budget) {
+    for (int t = 0; t < TAILLE_FENETRE; t++) {
+        initialiserTable(&ngrammes->tables[t], t + 2, mode, budget);
+    }
+}
+
+/**
+ * Libère la mémoire des tables ; les n-grammes redeviennent vides avec la même configuration
+ *
+ * @param ngrammes Pointeur vers les n-grammes
+ */
+void libererNgrammes(Ngrammes* ngrammes) {
+    for (int t = 0; t < TAILLE_FENETRE; t++) {
+        TableNgrammes* table = &ngrammes->tables[t];
+        free(table->cases);
+        free(table->esquisse);
+        initialiserTable(table, table->ordre, table->mode, table->budget);
+    }
+    memset(ngrammes->debut, 0, sizeof(ngrammes->debut));
+    memset(ngrammes->fin, 0, sizeof(ngrammes->fin));
+    ngrammes->nb_mots = 0;
+}
+
+/**
+ * Vide les n-grammes sans rendre la mémoire des cases, pour les réutiliser sur un autre texte
+ *
+ * @param ngrammes Pointeur vers les n-grammes
+ */
+void viderNgrammes(Ngrammes* ngrammes) {
+    for (int t = 0; t < TAILLE_FENETRE; t++) {
+        TableNgrammes* table = &ngrammes->tables[t];
+        if (table->cases != NULL) {
+            memset(table->cases, 0, table->capacite * sizeof(Ngramme));
+        }
+        free(table->esquisse);
+        table->esquisse = NULL;
+        table->nb_ngrammes = 0;
+        table->occurrences = 0;
+        table->perte_elagage = 0;
+        table->nb_elagages = 0;
+    }
+    memset(ngrammes->debut, 0, sizeof(ngrammes->debut));
+    memset(ngrammes->fin, 0, sizeof(ngrammes->fin));
+    ngrammes->nb_mots = 0;
+}
+
+// Ajoute un poids aux PROFONDEUR_ESQUISSE compteurs d'un n-gramme (compteurs saturés à UINT32_MAX)
+static void ajouterEsquisse(TableNgrammes* table, uint64_t hachage, long long poids) {
+    uint32_t h1 = (uint32_t)(hachage >> 32);
+    uint32_t h2 = (uint32_t)hachage | 1;
+    size_t masque = table->largeur_esquisse - 1;
+    for (int ligne = 0; ligne < PROFONDEUR_ESQUISSE; ligne++) {
+        uint32_t* compteur = &table->esquisse[ligne * table->largeur_esquisse + ((h1 + ligne * h2) & masque)];
+        *compteur = poids >= (long long)(UINT32_MAX - *compteur) ? UINT32_MAX : *compteur + (uint32_t)poids;
+    }
+}
+
+// Estimation Count-Min de la fréquence d'un n-gramme : le plus petit de ses compteurs (jamais inférieur à la vraie)
+static long long estimerEsquisse(const TableNgrammes* table, uint64_t hachage) {
+    uint32_t h1 = (uint32_t)(hachage >> 32);
+    uint32_t h2 = (uint32_t)hachage | 1;
+    size_t masque = table->largeur_esquisse - 1;
+    uint32_t minimum = UINT32_MAX;
+    for (int ligne = 0; ligne < PROFONDEUR_ESQUISSE; ligne++) {
+        uint32_t compteur = table->esquisse[ligne * table->largeur_esquisse + ((h1 + ligne * h2) & masque)];
+        if (compteur < minimum) {
+            minimum = compteur;
+        }
+    }
+    return minimum;
+}
+
+// Alloue l'esquisse au premier élagage et y reporte les fréquences exactes des n-grammes de la table
+static int activerEsquisse(TableNgrammes* table) {
+    table->esquisse = calloc(table->largeur_esquisse * PROFONDEUR_ESQUISSE, sizeof(uint32_t));
+    if (table->esquisse == NULL) {
+        return -1;
+    }
+    for (size_t i = 0; i < table->capacite; i++) {
+        const Ngramme* ngramme = &table->cases[i];
+        if (ngramme->frequence != 0) {
+            ajouterEsquisse(table, hacherIndices(ngramme->mots, table->ordre), ngramme->frequence);
+        }
+    }
+    return 0;
+}
+
+// Cherche la case d'un n-gramme, ou la case libre où il doit être rangé (la table a au moins une case libre)
+static Ngramme* chercherCase(const TableNgrammes* table, const uint32_t* mots, uint32_t hachage) {
+    size_t masque = table->capacite - 1;
+    for (size_t position = hachage & masque;; position = (position + 1) & masque) {
+        Ngramme* courante = &table->cases[position];
+        if (courante->frequence == 0 ||
+            (courante->hachage == hachage && memcmp(courante->mots, mots, sizeof(courante->mots)) == 0)) {
+            return courante;
+        }
+    }
+}
+
+// Double le nombre de cases et y replace tous les n-grammes (les hachages conservés évitent de les recalculer)
+static int agrandirCases(TableNgrammes* table) {
+    size_t ancienne_capacite = table->capacite;
+    Ngramme* anciennes = table->cases;
+    size_t capacite = ancienne_capacite ? ancienne_capacite * 2 : CAPACITE_NGRAMMES_INITIALE;
+    Ngramme* cases = calloc(capacite, sizeof(Ngramme));
+    if (cases == NULL) {
+        return -1;
+    }
+    table->cases = cases;
+    table->capacite = capacite;
+    for (size_t i = 0; i < ancienne_capacite; i++) {
+        if (anciennes[i].frequence != 0) {
+            *chercherCase(table, anciennes[i].mots, anciennes[i].hachage) = anciennes[i];
+        }
+    }
+    free(anciennes);
+    return 0;
+}
+
+// Vide une case sans laisser de trou dans les séquences de sondage : les n-grammes suivants qui peuvent
+// occuper la case libérée y reculent (suppression par décalage arrière)
+static void retirerCase(TableNgrammes* table, size_t position) {
+    size_t masque = table->capacite - 1;
+    size_t trou = position;
+    for (size_t courante = (trou + 1) & masque; table->cases[courante].frequence != 0;
+         courante = (courante + 1) & masque) {
+        size_t ideale = table->cases[courante].hachage & masque;
+        // Le n-gramme peut reculer si le trou se trouve entre sa case idéale et sa case actuelle
+        if (((courante - ideale) & masque) >= ((courante - trou) & masque)) {
+            table->cases[trou] = table->cases[courante];
+            trou = courante;
+        }
+    }
+    memset(&table->cases[trou], 0, sizeof(Ngramme));
+    table->nb_ngrammes--;
+}
+
+// Retire les n-grammes les moins fréquents, sur place, jusqu'à ce que la table ne soit plus remplie qu'à 3/8 :
+// d'abord ceux vus une fois, puis le seuil double à chaque passage
+static void elaguerCases(TableNgrammes* table) {
+    size_t cible = table->capacite / 8 * 3;
+    long long seuil = 1;
+    for (;;) {
+        // Une case vidée reçoit le n-gramme suivant, qui est examiné à son tour avant d'avancer
+        for (size_t i = 0; i < table->capacite;) {
+            if (table->cases[i].frequence != 0 && table->cases[i].frequence <= seuil) {
+                retirerCase(table, i);
+            } else {
+                i++;
+            }
+        }
+        if (table->nb_ngrammes <= cible) {
+            break;
+        }
+        seuil *= 2;
+    }
+    table->perte_elagage += seuil;
+    table->nb_elagages++;
+}
+
+/**
+ * Ajoute un poids à la fréquence d'un n-gramme, en l'insérant s'il est absent
+ * Quand la table est remplie aux 3/4, elle est agrandie tant que le budget le permet, sinon élaguée
+ * En mode Count-Min, un n-gramme inséré après un élagage prend la fréquence estimée par l'esquisse
+ *
+ * @param table Table des n-grammes
+ * @param mots Indices des mots du n-gramme (table->ordre indices)
+ * @param poids Occurrences à ajouter
+ * @param dans_esquisse Non nul si ces occurrences sont déjà comptées dans l'esquisse (fusion de deux esquisses)
+ * @return 0 en cas de succès, -1 si la mémoire manque
+ */
+static int ajouterNgramme(TableNgrammes* table, const uint32_t* mots, long long poids, int dans_esquisse) {
+    uint32_t cle[ORDRE_NGRAMME_MAX] = {0};
+    memcpy(cle, mots, (size_t)table->ordre * sizeof(uint32_t));
+    uint64_t hachage = hacherIndices(cle, table->ordre);
+    Ngramme* ngramme = table->capacite > 0 ? chercherCase(table, cle, (uint32_t)hachage) : NULL;
+
+    if (ngramme == NULL || ngramme->frequence == 0) {
+        if ((table->nb_ngrammes + 1) * 4 > table->capacite * 3) {
+            if (table->capacite < capaciteMaximale(table)) {
+                if (agrandirCases(table) != 0) {
+                    return -1;
+                }
+            } else {
+                if (table->mode == NGRAMMES_COUNT_MIN && table->esquisse == NULL && activerEsquisse(table) != 0) {
+                    return -1;
+                }
+                elaguerCases(table);
+            }
+            ngramme = chercherCase(table, cle, (uint32_t)hachage);
+        }
+        if (table->esquisse != NULL && !dans_esquisse) {
+            ajouterEsquisse(table, hachage, poids);
+        }
+        memcpy(ngramme->mots, cle, sizeof(cle));
+        ngramme->hachage = (uint32_t)hachage;
+        ngramme->frequence = table->esquisse != NULL ? estimerEsquisse(table, hachage) : poids;
+        table->nb_ngrammes++;
+        return 0;
+    }
+
+    if (table->esquisse != NULL && !dans_esquisse) {
+        ajouterEsquisse(table, hachage, poids);
+    }
+    ngramme->frequence += poids;
+    return 0;
+}
+
+// Compte les n-grammes qui se terminent par un mot, à partir de l'ordre ordre_min, puis fait glisser la fenêtre
+static int avancerFenetre(Ngrammes* ngrammes, uint32_t mot, int ordre_min) {
+    uint32_t fenetre[ORDRE_NGRAMME_MAX];
+    memcpy(fenetre, ngrammes->fin, sizeof(ngrammes->fin));
+    fenetre[TAILLE_FENETRE] = mot;
+    for (int ordre = ordre_min; ordre <= ORDRE_NGRAMME_MAX && ngrammes->nb_mots >= (uint64_t)(ordre - 1); ordre++) {
+        TableNgrammes* table = &ngrammes->tables[ordre - 2];
+        if (ajouterNgramme(table, fenetre + ORDRE_NGRAMME_MAX - ordre, 1, 0) != 0) {
+            return -1;
+        }
+        table->occurrences++;
+    }
+
+    if (ngrammes->nb_mots < TAILLE_FENETRE) {
+        ngrammes->debut[ngrammes->nb_mots] = mot;
+    }
+    memmove(ngrammes->fin, ngrammes->fin + 1, (TAILLE_FENETRE - 1) * sizeof(uint32_t));
+    ngrammes->fin[TAILLE_FENETRE - 1] = mot;
+    ngrammes->nb_mots++;
+    return 0;
+}
+
+/**
+ * Compte le mot suivant du texte : les n-grammes qu'il termine avec les mots précédents sont ajoutés aux tables
+ *
+ * @param ngrammes N-grammes du texte
+ * @param mot Indice du mot dans le vocabulaire de l'analyse
+ * @return 0 en cas de succès, -1 si la mémoire manque
+ */
+int compterMotNgrammes(Ngrammes* ngrammes, uint32_t mot) {
+    return avancerFenetre(ngrammes, mot, 2);
+}
+
+// Ajoute les n-grammes d'une table à ceux d'une autre, en traduisant les indices de mots
+static int fusionnerTables(TableNgrammes* destination, const TableNgrammes* source, const uint32_t* correspondance) {
+    int dans_esquisse = source->esquisse != NULL;
+    if (dans_esquisse) {
+        // Les deux esquisses ont la même largeur et les mêmes fonctions de hachage : elles s'additionnent
+        if (destination->largeur_esquisse != source->largeur_esquisse ||
+            (destination->esquisse == NULL && activerEsquisse(destination) != 0)) {
+            return -1;
+        }
+        for (size_t i = 0; i < source->largeur_esquisse * PROFONDEUR_ESQUISSE; i++) {
+            uint32_t reste = UINT32_MAX - destination->esquisse[i];
+            destination->esquisse[i] = source->esquisse[i] >= reste ? UINT32_MAX
+                                                                    : destination->esquisse[i] + source->esquisse[i];
+        }
+    }
+    for (size_t i = 0; i < source->capacite; i++) {
+        const Ngramme* ngramme = &source->cases[i];
+        if (ngramme->frequence == 0) {
+            continue;
+        }
+        uint32_t mots[ORDRE_NGRAMME_MAX];
+        for (int j = 0; j < source->ordre; j++) {
+            mots[j] = correspondance[ngramme->mots[j]];
+        }
+        if (ajouterNgramme(destination, mots, ngramme->frequence, dans_esquisse) != 0) {
+            return -1;
+        }
+    }
+    destination->occurrences += source->occurrences;
+    destination->perte_elagage += source->perte_elagage;
+    destination->nb_elagages += source->nb_elagages;
+    return 0;
+}
+
+/**
+ * Fusionne les n-grammes de la suite d'un texte (par exemple la tranche suivante d'un fichier) dans ceux du début
+ * Les n-grammes à cheval sur la coupure sont formés avec la fin de la destination et le début de la source,
+ * ce qui donne les mêmes fréquences qu'une lecture en série
+ *
+ * @param destination N-grammes du début du texte
+ * @param source N-grammes de la suite du texte, vidés et libérés par la fusion
+ * @param correspondance Indice dans le vocabulaire de la destination de chaque mot du vocabulaire de la source
+ * @return 0 en cas de succès, -1 si la mémoire manque ou si les configurations diffèrent
+ */
+int fusionnerNgrammes(Ngrammes* destination, Ngrammes* source, const uint32_t* correspondance) {
+    int resultat = 0;
+    for (int t = 0; t < TAILLE_FENETRE && resultat == 0; t++) {
+        resultat = fusionnerTables(&destination->tables[t], &source->tables[t], correspondance);
+    }
+
+    // Le i-ème mot de la source termine les n-grammes commencés dans la destination : ceux d'ordre au moins i + 2
+    uint64_t nb_mots = destination->nb_mots + source->nb_mots;
+    size_t premiers = source->nb_mots < TAILLE_FENETRE ? (size_t)source->nb_mots : TAILLE_FENETRE;
+    for (size_t i = 0; i < premiers && resultat == 0; i++) {
+        resultat = avancerFenetre(destination, correspondance[source->debut[i]], (int)i + 2);
+    }
+    if (source->nb_mots > TAILLE_FENETRE) {
+        for (int i = 0; i < TAILLE_FENETRE; i++) {
+            destination->fin[i] = correspondance[source->fin[i]];
+        }
+    }
+    destination->nb_mots = nb_mots;
+    libererNgrammes(source);
+    return resultat;
+}
+
+// Compare deux n-grammes par fréquence décroissante, les égalités étant départagées par les indices des mots
+static int comparerNgrammes(const Ngramme* a, const Ngramme* b) {
+    if (a->frequence != b->frequence) {
+        return a->frequence > b->frequence ? -1 : 1;
+    }
+    for (int i = 0; i < ORDRE_NGRAMME_MAX; i++) {
+        if (a->mots[i] != b->mots[i]) {
+            return a->mots[i] < b->mots[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// Fait descendre un n-gramme dans le tas dont la racine est le moins bon n-gramme
+static void tamiserTasNgrammes(Ngramme* tas, size_t taille, size_t position) {
+    for (;;) {
+        size_t pire = position;
+        size_t gauche = 2 * position + 1;
+        size_t droite = gauche + 1;
+        if (gauche < taille && comparerNgrammes(&tas[gauche], &tas[pire]) > 0) {
+            pire = gauche;
+        }
+        if (droite < taille && comparerNgrammes(&tas[droite], &tas[pire]) > 0) {
+            pire = droite;
+        }
+        if (pire == position) {
+            return;
+        }
+        Ngramme echange = tas[position];
+        tas[position] = tas[pire];
+        tas[pire] = echange;
+        position = pire;
+    }
+}
+
+/**
+ * Recherche les k n-grammes les plus fréquents d'une table
+ * Comme meilleursMots, un tas borné est construit directement dans resultat en un seul parcours des cases
+ *
+ * @param table Table des n-grammes
+ * @param k Nombre maximal de n-grammes à retenir
+ * @param resultat Tableau d'au moins k n-grammes, rempli par fréquence décroissante (copies des cases)
+ * @return Nombre de n-grammes trouvés (au plus k)
+ */
+size_t meilleursNgrammes(const TableNgrammes* table, size_t k, Ngramme* resultat) {
+    size_t taille = 0;
+    if (k == 0) {
+        return 0;
+    }
+
+    for (size_t c = 0; c < table->capacite; c++) {
+        const Ngramme* ngramme = &table->cases[c];
+        if (ngramme->frequence == 0) {
+            continue;
+        }
+        if (taille < k) {
+            // Remontée du nouveau n-gramme tant qu'il est classé après son parent
+            size_t position = taille++;
+            while (position > 0 && comparerNgrammes(ngramme, &resultat[(position - 1) / 2]) > 0) {
+                resultat[position] = resultat[(position - 1) / 2];
+                position = (position - 1) / 2;
+            }
+            resultat[position] = *ngramme;
+        } else if (comparerNgrammes(ngramme, &resultat[0]) < 0) {
+            resultat[0] = *ngramme;
+            tamiserTasNgrammes(resultat, taille, 0);
+        }
+    }
+
+    // Tri par tas : le moins bon n-gramme est placé à la fin, puis le tas se réduit d'une case
+    for (size_t fin = taille; fin > 1; fin--) {
+        Ngramme echange = resultat[0];
+        resultat[0] = resultat[fin - 1];
+        resultat[fin - 1] = echange;
+        tamiserTasNgrammes(resultat, fin - 1, 0);
+    }
+    return taille;
+}
+
+/**
+ * Donne l'écart maximal entre les fréquences de la table et les vraies fréquences, dû aux élagages
+ * En mode élagage, les fréquences sont sous-estimées au plus de la somme des seuils des élagages ; en mode Count-Min,
+ * elles sont surestimées au plus de e × occurrences / largeur de l'esquisse (avec une probabilité de 1 - e^-profondeur)
+ *
+ * @param table Table des n-grammes
+ * @return Écart maximal (0 si la table n'a jamais été élaguée : fréquences exactes)
+ */
+long long erreurNgrammes(const TableNgrammes* table) {
+    if (table->nb_elagages == 0) {
+        return 0;
+    }
+    if (table->mode == NGRAMMES_COUNT_MIN) {
+        return (long long)ceil(exp(1.0) * (double)table->occurrences / (double)table->largeur_esquisse);
+    }
+    return table->perte_elagage;
+}
+
+/**
+ * Relève l'état des n-grammes pour l'enregistrer ; les cases puis l'esquisse de chaque table sont à enregistrer
+ * à la suite (capacite n-grammes, puis PROFONDEUR_ESQUISSE × largeur_esquisse compteurs)
+ *
+ * @param ngrammes N-grammes d'une lecture arrêtée à la fin du texte
+ * @param etat Reçoit les compteurs, la configuration et la fenêtre
+ */
+void sauvegarderNgrammes(const Ngrammes* ngrammes, EtatNgrammes* etat) {
+    memset(etat, 0, sizeof(EtatNgrammes));
+    for (int t = 0; t < TAILLE_FENETRE; t++) {
+        const TableNgrammes* table = &ngrammes->tables[t];
+        EtatTableNgrammes* etat_table = &etat->tables[t];
+        etat_table->capacite = table->capacite;
+        etat_table->nb_ngrammes = table->nb_ngrammes;
+        etat_table->occurrences = table->occurrences;
+        etat_table->perte_elagage = table->perte_elagage;
+        etat_table->nb_elagages = table->nb_elagages;
+        etat_table->largeur_esquisse = table->esquisse != NULL ? table->largeur_esquisse : 0;
+        etat_table->budget = table->budget;
+        etat_table->mode = (uint32_t)table->mode;
+        etat_table->ordre = (uint32_t)table->ordre;
+    }
+    memcpy(etat->debut, ngrammes->debut, sizeof(etat->debut));
+    memcpy(etat->fin, ngrammes->fin, sizeof(etat->fin));
+    etat->nb_mots = ngrammes->nb_mots;
+}
+
+// Vérifie l'état et les cases d'une table enregistrée avant de les reprendre
+static int verifierTable(const TableNgrammes* table, const EtatTableNgrammes* etat, const Ngramme* cases,
+                         size_t nb_mots) {
+    if (etat->ordre != (uint32_t)table->ordre || etat->mode != (uint32_t)table->mode ||
+        etat->budget != table->budget ||
+        (etat->largeur_esquisse != 0 && etat->largeur_esquisse != table->largeur_esquisse) ||
+        (etat->capacite != 0 && (etat->capacite < CAPACITE_NGRAMMES_INITIALE ||
+                                 (etat->capacite & (etat->capacite - 1)) != 0 ||
+                                 etat->capacite > capaciteMaximale(table))) ||
+        etat->nb_ngrammes > etat->capacite / 4 * 3 || etat->perte_elagage < 0) {
+        return -1;
+    }
+    size_t occupees = 0;
+    for (size_t i = 0; i < etat->capacite; i++) {
+        const Ngramme* ngramme = &cases[i];
+        if (ngramme->frequence == 0) {
+            continue;
+        }
+        if (ngramme->frequence < 0 || ngramme->hachage != (uint32_t)hacherIndices(ngramme->mots, table->ordre)) {
+            return -1;
+        }
+        for (int j = 0; j < ORDRE_NGRAMME_MAX; j++) {
+            if (j < table->ordre ? ngramme->mots[j] >= nb_mots : ngramme->mots[j] != 0) {
+                return -1;
+            }
+        }
+        occupees++;
+    }
+    return occupees == etat->nb_ngrammes ? 0 : -1;
+}
+
+/**
+ * Replace des n-grammes (initialisés, avec la configuration de l'enregistrement) dans un état enregistré
+ * L'état est vérifié avant d'être appliqué : il peut provenir d'un fichier
+ *
+ * @param ngrammes N-grammes à restaurer (leur mémoire est réutilisée si possible)
+ * @param etat État relevé par sauvegarderNgrammes
+ * @param cases Cases de chaque table (etat->tables[t].capacite n-grammes)
+ * @param esquisses Esquisse de chaque table (PROFONDEUR_ESQUISSE × etat->tables[t].largeur_esquisse compteurs)
+ * @param nb_mots Nombre de mots du vocabulaire restauré (les indices des n-grammes doivent y être inférieurs)
+ * @return 0 en cas de succès, -1 si l'état est incohérent, d'une autre configuration, ou si la mémoire manque
+ *         (les n-grammes sont alors vides)
+ */
+int restaurerNgrammes(Ngrammes* ngrammes, const EtatNgrammes* etat, const Ngramme* const* cases,
+                      const uint32_t* const* esquisses, size_t nb_mots) {
+    size_t fenetre = etat->nb_mots < TAILLE_FENETRE ? (size_t)etat->nb_mots : TAILLE_FENETRE;
+    for (size_t i = 0; i < fenetre; i++) {
+        if (etat->debut[i] >= nb_mots || etat->fin[TAILLE_FENETRE - 1 - i] >= nb_mots) {
+            return -1;
+        }
+    }
+    for (int t = 0; t < TAILLE_FENETRE; t++) {
+        if (verifierTable(&ngrammes->tables[t], &etat->tables[t], cases[t], nb_mots) != 0) {
+            return -1;
+        }
+    }
+
+    viderNgrammes(ngrammes);
+    for (int t = 0; t < TAILLE_FENETRE; t++) {
+        TableNgrammes* table = &ngrammes->tables[t];
+        const EtatTableNgrammes* etat_table = &etat->tables[t];
+        if (table->capacite != etat_table->capacite) {
+            free(table->cases);
+            table->capacite = 0;
+            table->cases = etat_table->capacite ? malloc(etat_table->capacite * sizeof(Ngramme)) : NULL;
+            if (etat_table->capacite != 0 && table->cases == NULL) {
+                libererNgrammes(ngrammes);
+                return -1;
+            }
+            table->capacite = etat_table->capacite;
+        }
+        if (table->capacite != 0) {
+            memcpy(table->cases, cases[t], table->capacite * sizeof(Ngramme));
+        }
+        if (etat_table->largeur_esquisse != 0) {
+            size_t compteurs = table->largeur_esquisse * PROFONDEUR_ESQUISSE;
+            table->esquisse = malloc(compteurs * sizeof(uint32_t));
+            if (table->esquisse == NULL) {
+                libererNgrammes(ngrammes);
+                return -1;
+            }
+            memcpy(table->esquisse, esquisses[t], compteurs * sizeof(uint32_t));
+        }
+        table->nb_ngrammes = etat_table->nb_ngrammes;
+        table->occurrences = etat_table->occurrences;
+        table->perte_elagage = etat_table->perte_elagage;
+        table->nb_elagages = etat_table->nb_elagages;
+    }
+    memcpy(ngrammes->debut, etat->debut, sizeof(ngrammes->debut));
+    memcpy(ngrammes->fin, etat->fin, sizeof(ngrammes->fin));
+    ngrammes->nb_mots = etat->nb_mots;
+    return 0;
+}
@@ -0,0 +1,100 @@
+#ifndef NGRAMMES_H
+#define NGRAMMES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ORDRE_NGRAMME_MAX 3               // Ordre des plus longs n-grammes comptés (trigrammes)
+#define CAPACITE_NGRAMMES_INITIALE 1024   // Nombre de cases allouées au premier n-gramme (puissance de 2)
+#define PROFONDEUR_ESQUISSE 4             // Nombre de lignes de l'esquisse Count-Min
+#ifndef BUDGET_NGRAMMES
+#define BUDGET_NGRAMMES (64 << 20)        // Mémoire (en octets) accordée par défaut aux n-grammes de chaque ordre
+#endif
+#ifndef MODE_NGRAMMES
+#define MODE_NGRAMMES NGRAMMES_COUNT_MIN  // Comportement par défaut une fois le budget atteint (voir ModeNgrammes)
+#endif
+
+// Comportement d'une table de n-grammes qui atteint son budget mémoire
+typedef enum {
+    NGRAMMES_EXACT,       // Aucun budget : la table grandit avec le texte, les fréquences sont exactes
+    NGRAMMES_ELAGAGE,     // Les n-grammes les moins fréquents sont retirés : les fréquences sont sous-estimées
+    NGRAMMES_COUNT_MIN    // Élagage, mais une esquisse Count-Min compte toutes les occurrences : un n-gramme retiré
+                          // qui revient reprend sa fréquence estimée (fréquences surestimées)
+} ModeNgrammes;
+
+// N-gramme compté : indices de ses mots dans le vocabulaire de l'analyse (pas de copie de texte)
+typedef struct {
+    uint32_t mots[ORDRE_NGRAMME_MAX];   // Les cases au-delà de l'ordre de la table valent 0
+    uint32_t hachage;
+    long long frequence;                // 0 : case libre
+} Ngramme;
+
+// Table de n-grammes d'un ordre donné, à adressage ouvert (sondage linéaire) : les n-grammes sont rangés
+// directement dans les cases, si bien qu'une occurrence ne coûte qu'un hachage d'entiers et un sondage
+typedef struct {
+    Ngramme* cases;
+    size_t capacite;              // Nombre de cases (puissance de 2, 0 tant que la table est vide)
+    size_t nb_ngrammes;
+    int ordre;                    // 2 : bigrammes, 3 : trigrammes
+    ModeNgrammes mode;
+    size_t budget;                // Octets accordés aux cases et à l'esquisse (ignoré en mode exact)
+    uint64_t occurrences;         // N-grammes lus dans le texte (avec répétitions)
+    long long perte_elagage;      // Fréquence qu'un n-gramme a pu perdre dans les élagages (mode élagage)
+    uint64_t nb_elagages;
+    uint32_t* esquisse;           // PROFONDEUR_ESQUISSE lignes de largeur_esquisse compteurs (NULL avant le premier élagage)
+    size_t largeur_esquisse;      // Puissance de 2, fixée par le budget
+} TableNgrammes;
+
+// Bigrammes et trigrammes d'un texte, comptés au fil des mots avec une fenêtre glissante d'indices de mots
+// Les n-grammes suivent les mots du texte sans s'arrêter aux fins de phrase
+typedef struct {
+    TableNgrammes tables[ORDRE_NGRAMME_MAX - 1];   // tables[ordre - 2]
+    uint32_t debut[ORDRE_NGRAMME_MAX - 1];         // Premiers mots du texte (raccord avec le texte précédent)
+    uint32_t fin[ORDRE_NGRAMME_MAX - 1];           // Derniers mots lus, le plus récent à la fin (fenêtre glissante)
+    uint64_t nb_mots;                              // Mots lus
+} Ngrammes;
+
+// État des n-grammes enregistré dans le cache des analyses (les cases et l'esquisse de chaque table suivent)
+typedef struct {
+    uint64_t capacite;
+    uint64_t nb_ngrammes;
+    uint64_t occurrences;
+    int64_t perte_elagage;
+    uint64_t nb_elagages;
+    uint64_t largeur_esquisse;    // 0 si l'esquisse n'est pas allouée
+    uint64_t budget;
+    uint32_t mode;
+    uint32_t ordre;
+} EtatTableNgrammes;
+
+typedef struct {
+    EtatTableNgrammes tables[ORDRE_NGRAMME_MAX - 1];
+    uint32_t debut[ORDRE_NGRAMME_MAX - 1];
+    uint32_t fin[ORDRE_NGRAMME_MAX - 1];
+    uint64_t nb_mots;
+} EtatNgrammes;
+
+void initialiserNgrammes(Ngrammes* ngrammes);
+void configurerNgrammes(Ngrammes* ngrammes, ModeNgrammes mode, size_t budget);
+void libererNgrammes(Ngrammes* ngrammes);
+void viderNgrammes(Ngrammes* ngrammes);
+int compterMotNgrammes(Ngrammes* ngrammes, uint32_t mot);
+int fusionnerNgrammes(Ngrammes* destination, Ngrammes* source, const uint32_t* correspondance);
+size_t meilleursNgrammes(const TableNgrammes* table, size_t k, Ngramme* resultat);
+long long erreurNgrammes(const TableNgrammes* table);
+void sauvegarderNgrammes(const Ngrammes* ngrammes, EtatNgrammes* etat);
+int restaurerNgrammes(Ngrammes* ngrammes, const EtatNgrammes* etat, const Ngramme* const* cases,
+                      const uint32_t* const* esquisses, size_t nb_mots);
+
+/**
+ * Retourne la table des n-grammes d'un ordre
+ *
+ * @param ngrammes N-grammes d'une analyse
+ * @param ordre 2 pour les bigrammes, 3 pour les trigrammes
+ * @return Table des n-grammes de cet ordre
+ */
+static inline const TableNgrammes* tableNgrammes(const Ngrammes* ngrammes, int ordre) {
+    return &ngrammes->tables[ordre - 2];
+}
+
+#endif
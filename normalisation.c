@@ -0,0 +1,178 @@
+#include "normalisation.h"
+
+// Syllabes hangûl : décomposition et composition par calcul (chapitre 3.12 du standard Unicode)
+#define HANGUL_S 0xAC00
+#define HANGUL_L 0x1100
+#define HANGUL_V 0x1161
+#define HANGUL_T 0x11A7
+#define HANGUL_NB_L 19
+#define HANGUL_NB_V 21
+#define HANGUL_NB_T 28
+#define HANGUL_NB_N (HANGUL_NB_V * HANGUL_NB_T)
+#define HANGUL_NB_S (HANGUL_NB_L * HANGUL_NB_N)
+
+// Seule marque combinante changée par le repli : gardée dans les tables pour l'ordre canonique, repliée ensuite
+#define IOTA_SOUSCRIT 0x0345
+#define IOTA_MINUSCULE 0x03B9
+
+/**
+ * Vérifie si un caractère ASCII peut faire partie d'un mot (lettre, chiffre, tiret, apostrophe ou underscore)
+ *
+ * @param c Caractère ASCII
+ * @return 1 si le caractère est valide, 0 sinon
+ */
+static inline int estMotAscii(wchar_t c) {
+    return (c >= L'a' && c <= L'z') || (c >= L'A' && c <= L'Z') || (c >= L'0' && c <= L'9') ||
+           c == L'-' || c == L'\'' || c == L'_';
+}
+
+/**
+ * Retourne la classe canonique de combinaison d'un caractère
+ *
+ * @param c Caractère
+ * @return Classe du caractère (0 pour un caractère de base)
+ */
+static inline int classeCombinaison(wchar_t c) {
+    return (uint32_t)c < 0x80 ? 0 : proprieteUnicode(c)->classe;
+}
+
+/**
+ * Cherche la composée primaire de deux caractères
+ *
+ * @param premier Caractère de base (éventuellement déjà composé)
+ * @param second Caractère qui le suit
+ * @return Composée, ou 0 si les deux caractères ne se composent pas
+ */
+static wchar_t composer(wchar_t premier, wchar_t second) {
+    uint32_t p = (uint32_t)premier, s = (uint32_t)second;
+    if (p - HANGUL_L < HANGUL_NB_L && s - HANGUL_V < HANGUL_NB_V) {
+        return (wchar_t)(HANGUL_S + ((p - HANGUL_L) * HANGUL_NB_V + (s - HANGUL_V)) * HANGUL_NB_T);
+    }
+    if (p - HANGUL_S < HANGUL_NB_S && (p - HANGUL_S) % HANGUL_NB_T == 0 && s - HANGUL_T - 1 < HANGUL_NB_T - 1) {
+        return (wchar_t)(p + (s - HANGUL_T));
+    }
+    const ProprieteUnicode* propriete = proprieteUnicode(premier);
+    const CompositionUnicode* composition = &compositions_unicode[propriete->compositions];
+    // Listes courtes triées par second caractère : parcours linéaire arrêté dès qu'il est dépassé
+    for (int i = 0; i < propriete->nb_compositions && composition[i].second <= s; i++) {
+        if (composition[i].second == s) {
+            return (wchar_t)composition[i].composee;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Normalise un mot sans dépendre de la locale : retire les caractères qui n'appartiennent pas aux mots, replie les
+ * casses (repli simple d'Unicode, qui met notamment en minuscules) et met le résultat en forme NFC, pour qu'un même
+ * mot saisi avec des caractères précomposés ou des accents combinants donne la même chaîne
+ * Les mots entièrement ASCII (cas courant) sont traités sans consulter les tables
+ *
+ * @param mot Mot à normaliser
+ * @param longueur Nombre de caractères du mot
+ * @param resultat Tampon recevant le mot normalisé, d'au moins longueur * EXPANSION_NORMALISATION_MAX + 1
+ *                 caractères (ne doit pas recouvrir mot)
+ * @return Longueur du mot normalisé (terminé par un caractère nul)
+ */
+size_t normaliserMot(const wchar_t* mot, size_t longueur, wchar_t* resultat) {
+    size_t i, n = 0;
+    for (i = 0; i < longueur && (uint32_t)mot[i] < 0x80; i++) {
+        wchar_t c = mot[i];
+        if (c >= L'A' && c <= L'Z') {
+            resultat[n++] = c + (L'a' - L'A');
+        } else if (estMotAscii(c)) {
+            resultat[n++] = c;
+        }
+    }
+    if (i == longueur) {
+        resultat[n] = L'\0';
+        return n;
+    }
+
+    // Repli et décomposition canonique de la suite du mot
+    size_t debut = n;
+    int iota = 0;
+    for (; i < longueur; i++) {
+        wchar_t c = mot[i];
+        uint32_t u = (uint32_t)c;
+        if (u < 0x80) {
+            if (c >= L'A' && c <= L'Z') {
+                resultat[n++] = c + (L'a' - L'A');
+            } else if (estMotAscii(c)) {
+                resultat[n++] = c;
+            }
+        } else if (u - HANGUL_S < HANGUL_NB_S) {
+            uint32_t indice = u - HANGUL_S;
+            resultat[n++] = (wchar_t)(HANGUL_L + indice / HANGUL_NB_N);
+            resultat[n++] = (wchar_t)(HANGUL_V + indice % HANGUL_NB_N / HANGUL_NB_T);
+            if (indice % HANGUL_NB_T != 0) {
+                resultat[n++] = (wchar_t)(HANGUL_T + indice % HANGUL_NB_T);
+            }
+        } else {
+            const ProprieteUnicode* propriete = proprieteUnicode(c);
+            if (!(propriete->drapeaux & UNICODE_MOT)) {
+                continue;
+            }
+            if (propriete->longueur == 0) {
+                resultat[n++] = c;
+                iota |= u == IOTA_SOUSCRIT;
+            } else {
+                for (int k = 0; k < propriete->longueur; k++) {
+                    uint32_t e = expansions_unicode[propriete->expansion + k];
+                    resultat[n++] = (wchar_t)e;
+                    iota |= e == IOTA_SOUSCRIT;
+                }
+            }
+        }
+    }
+
+    // Ordre canonique : tri stable de chaque suite de marques combinantes selon leur classe (les caractères ASCII
+    // qui précèdent sont tous de base)
+    for (size_t k = debut + 1; k < n; k++) {
+        wchar_t c = resultat[k];
+        int classe = classeCombinaison(c);
+        if (classe == 0) {
+            continue;
+        }
+        size_t j = k;
+        while (j > debut && classeCombinaison(resultat[j - 1]) > classe) {
+            resultat[j] = resultat[j - 1];
+            j--;
+        }
+        resultat[j] = c;
+    }
+    if (iota) {
+        for (size_t k = debut; k < n; k++) {
+            if (resultat[k] == IOTA_SOUSCRIT) {
+                resultat[k] = IOTA_MINUSCULE;
+            }
+        }
+    }
+
+    // Composition canonique, à partir du dernier caractère ASCII (qui peut se composer avec un accent)
+    size_t depart = debut > 0 ? debut - 1 : 0;
+    if (n > depart) {
+        size_t position_base = depart, ecrits = depart + 1;
+        wchar_t base = resultat[depart];
+        int derniere_classe = classeCombinaison(base) ? 256 : 0; // Pas de composition sans caractère de base
+        for (size_t k = depart + 1; k < n; k++) {
+            wchar_t c = resultat[k];
+            int classe = classeCombinaison(c);
+            wchar_t composee = composer(base, c);
+            if (composee != 0 && (derniere_classe < classe || derniere_classe == 0)) {
+                resultat[position_base] = composee;
+                base = composee;
+                continue;
+            }
+            if (classe == 0) {
+                position_base = ecrits;
+                base = c;
+            }
+            derniere_classe = classe;
+            resultat[ecrits++] = c;
+        }
+        n = ecrits;
+    }
+    resultat[n] = L'\0';
+    return n;
+}
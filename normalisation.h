@@ -0,0 +1,94 @@
+#ifndef NORMALISATION_H
+#define NORMALISATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+// Normalisation des mots indépendante de la locale : repli des casses (repli simple d'Unicode) puis forme NFC,
+// avec des tables précalculées (tables_unicode.c, généré par outils/generer_tables_unicode.py)
+
+#define LIMITE_TABLES_UNICODE 0xE01F0   // Premier caractère dont les propriétés sont toutes nulles
+#define BITS_PAGE_UNICODE 7             // Caractères par page des tables : 1 << BITS_PAGE_UNICODE
+#define EXPANSION_NORMALISATION_MAX 4   // Caractères au plus produits par un caractère repli et décomposé
+#define UNICODE_MOT 1                   // Drapeau : lettre, chiffre ou marque combinante
+#define UNICODE_MAJUSCULE 2             // Drapeau : majuscule ou capitale de titre
+
+// Propriétés d'un caractère (partagées entre tous les caractères qui ont les mêmes)
+typedef struct {
+    uint16_t expansion;         // Début dans expansions_unicode de la forme repliée et décomposée du caractère
+    uint8_t longueur;           // Longueur de cette forme (0 : le caractère reste tel quel)
+    uint8_t classe;             // Classe canonique de combinaison (0 : caractère de base)
+    uint16_t compositions;      // Début dans compositions_unicode des composées dont le caractère est le premier
+    uint8_t nb_compositions;    // Nombre de ces composées (triées par second caractère)
+    uint8_t drapeaux;           // UNICODE_MOT et UNICODE_MAJUSCULE
+} ProprieteUnicode;
+
+// Composée primaire : le premier caractère est donné par la propriété qui désigne cette entrée
+typedef struct {
+    uint32_t second;
+    uint32_t composee;
+} CompositionUnicode;
+
+extern const uint16_t pages_unicode[];
+extern const uint16_t blocs_unicode[][1 << BITS_PAGE_UNICODE];
+extern const ProprieteUnicode proprietes_unicode[];
+extern const uint32_t expansions_unicode[];
+extern const CompositionUnicode compositions_unicode[];
+
+/**
+ * Retourne les propriétés d'un caractère (deux lectures de table)
+ * Les syllabes hangûl précomposées (U+AC00 à U+D7A3) n'y figurent pas : elles sont traitées par calcul
+ *
+ * @param c Caractère
+ * @return Propriétés du caractère (toutes nulles pour un caractère hors des tables)
+ */
+static inline const ProprieteUnicode* proprieteUnicode(wchar_t c) {
+    uint32_t u = (uint32_t)c;
+    if (u >= LIMITE_TABLES_UNICODE) {
+        return &proprietes_unicode[0];
+    }
+    return &proprietes_unicode[blocs_unicode[pages_unicode[u >> BITS_PAGE_UNICODE]]
+                                            [u & ((1u << BITS_PAGE_UNICODE) - 1)]];
+}
+
+/**
+ * Indique si un caractère hors ASCII est une lettre, un chiffre ou une marque combinante, quelle que soit la locale
+ *
+ * @param c Caractère (au-delà de U+007F)
+ * @return 1 si le caractère appartient à un mot, 0 sinon
+ */
+static inline int estLettreUnicode(wchar_t c) {
+    return ((uint32_t)c >= 0xAC00 && (uint32_t)c <= 0xD7A3) || (proprieteUnicode(c)->drapeaux & UNICODE_MOT);
+}
+
+/**
+ * Indique si un caractère est une lettre, un chiffre ou une marque combinante (ni tiret, ni apostrophe, ni
+ * underscore), quelle que soit la locale
+ *
+ * @param c Caractère
+ * @return 1 si le caractère est alphanumérique, 0 sinon
+ */
+static inline int estAlphanumerique(wchar_t c) {
+    if ((uint32_t)c < 0x80) {
+        return (c >= L'a' && c <= L'z') || (c >= L'A' && c <= L'Z') || (c >= L'0' && c <= L'9');
+    }
+    return estLettreUnicode(c);
+}
+
+/**
+ * Indique si un caractère est une majuscule (ou une capitale de titre), quelle que soit la locale
+ *
+ * @param c Caractère
+ * @return 1 si le caractère est une majuscule, 0 sinon
+ */
+static inline int estMajuscule(wchar_t c) {
+    if ((uint32_t)c < 0x80) {
+        return c >= L'A' && c <= L'Z';
+    }
+    return (proprieteUnicode(c)->drapeaux & UNICODE_MAJUSCULE) != 0;
+}
+
+size_t normaliserMot(const wchar_t* mot, size_t longueur, wchar_t* resultat);
+
+#endif
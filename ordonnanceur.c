@@ -0,0 +1,287 @@
+#include "ordonnanceur.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Tâche en attente d'exécution
+typedef struct {
+    FonctionTache fonction;
+    void* argument;
+} Tache;
+
+// File de tâches d'un thread (tableau circulaire)
+// Le thread propriétaire ajoute et reprend ses tâches à la fin (les plus récentes, encore en cache) ;
+// un thread inoccupé vole les tâches du début (les plus anciennes, souvent les plus grosses)
+typedef struct {
+    pthread_mutex_t verrou;
+    Tache* taches;
+    size_t capacite;          // Puissance de 2
+    size_t debut;             // Position de la plus ancienne tâche
+    size_t nombre;
+} FileTaches;
+
+struct Ordonnanceur {
+    int nb_threads;                   // Threads lancés
+    int nb_files;                     // Files allouées (une par thread demandé)
+    FileTaches* files;                // Une file par thread
+    pthread_t* threads;
+    pthread_mutex_t verrou;           // Protège l'attente des threads inoccupés et la fin des tâches
+    pthread_cond_t travail;           // Signalé à chaque nouvelle tâche
+    pthread_cond_t termine;           // Signalé quand toutes les tâches soumises sont terminées
+    atomic_size_t en_attente;         // Tâches présentes dans les files
+    atomic_size_t en_cours;           // Tâches soumises et pas encore terminées
+    atomic_uint prochaine_file;       // File recevant la prochaine tâche soumise hors des threads
+    int arret;
+};
+
+// Thread de l'ordonnanceur qui exécute le code courant (NULL hors des threads de l'ordonnanceur)
+static _Thread_local Ordonnanceur* ordonnanceur_courant;
+static _Thread_local int numero_courant;
+
+// Paramètres d'un thread de l'ordonnanceur
+typedef struct {
+    Ordonnanceur* ordonnanceur;
+    int numero;
+} Travailleur;
+
+// Ajoute une tâche à la fin d'une file, en l'agrandissant si elle est pleine
+static int empiler(FileTaches* file, Tache tache) {
+    pthread_mutex_lock(&file->verrou);
+    if (file->nombre == file->capacite) {
+        size_t capacite = file->capacite * 2;
+        Tache* taches = malloc(capacite * sizeof(Tache));
+        if (taches == NULL) {
+            pthread_mutex_unlock(&file->verrou);
+            return -1;
+        }
+        for (size_t i = 0; i < file->nombre; i++) {
+            taches[i] = file->taches[(file->debut + i) & (file->capacite - 1)];
+        }
+        free(file->taches);
+        file->taches = taches;
+        file->capacite = capacite;
+        file->debut = 0;
+    }
+    file->taches[(file->debut + file->nombre) & (file->capacite - 1)] = tache;
+    file->nombre++;
+    pthread_mutex_unlock(&file->verrou);
+    return 0;
+}
+
+// Retire la tâche la plus récente (par le propriétaire) ou la plus ancienne (par un voleur) d'une file
+static int depiler(FileTaches* file, int plus_ancienne, Tache* tache) {
+    int trouvee = 0;
+    pthread_mutex_lock(&file->verrou);
+    if (file->nombre > 0) {
+        if (plus_ancienne) {
+            *tache = file->taches[file->debut];
+            file->debut = (file->debut + 1) & (file->capacite - 1);
+        } else {
+            *tache = file->taches[(file->debut + file->nombre - 1) & (file->capacite - 1)];
+        }
+        file->nombre--;
+        trouvee = 1;
+    }
+    pthread_mutex_unlock(&file->verrou);
+    return trouvee;
+}
+
+// Cherche une tâche pour un thread : d'abord dans sa propre file, puis dans celles des autres threads
+static int prendreTache(Ordonnanceur* ordonnanceur, int numero, Tache* tache) {
+    if (atomic_load(&ordonnanceur->en_attente) == 0) {
+        return 0;
+    }
+    for (int i = 0; i < ordonnanceur->nb_threads; i++) {
+        int victime = (numero + i) % ordonnanceur->nb_threads;
+        if (depiler(&ordonnanceur->files[victime], i > 0, tache)) {
+            atomic_fetch_sub(&ordonnanceur->en_attente, 1);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void* executerTravailleur(void* argument) {
+    Travailleur* travailleur = argument;
+    Ordonnanceur* ordonnanceur = travailleur->ordonnanceur;
+    int numero = travailleur->numero;
+    free(travailleur);
+    ordonnanceur_courant = ordonnanceur;
+    numero_courant = numero;
+
+    for (;;) {
+        Tache tache;
+        if (prendreTache(ordonnanceur, numero, &tache)) {
+            tache.fonction(tache.argument);
+            if (atomic_fetch_sub(&ordonnanceur->en_cours, 1) == 1) {
+                pthread_mutex_lock(&ordonnanceur->verrou);
+                pthread_cond_broadcast(&ordonnanceur->termine);
+                pthread_mutex_unlock(&ordonnanceur->verrou);
+            }
+            continue;
+        }
+
+        // Aucune tâche visible : le thread s'endort jusqu'à la prochaine soumission
+        pthread_mutex_lock(&ordonnanceur->verrou);
+        while (atomic_load(&ordonnanceur->en_attente) == 0 && !ordonnanceur->arret) {
+            pthread_cond_wait(&ordonnanceur->travail, &ordonnanceur->verrou);
+        }
+        int arret = ordonnanceur->arret && atomic_load(&ordonnanceur->en_attente) == 0;
+        pthread_mutex_unlock(&ordonnanceur->verrou);
+        if (arret) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Crée un ensemble de threads qui exécutent des tâches par vol de travail
+ * Chaque thread a sa propre file ; un thread dont la file est vide prend les tâches les plus anciennes des autres,
+ * si bien qu'aucun processeur ne reste inoccupé tant qu'il reste des tâches
+ *
+ * @param nb_threads Nombre de threads (0 pour un thread par processeur)
+ * @return Ordonnanceur créé, ou NULL si la mémoire ou les threads manquent
+ */
+Ordonnanceur* creerOrdonnanceur(int nb_threads) {
+    if (nb_threads <= 0) {
+        long processeurs = sysconf(_SC_NPROCESSORS_ONLN);
+        nb_threads = processeurs > 0 ? (int)processeurs : 1;
+    }
+    Ordonnanceur* ordonnanceur = calloc(1, sizeof(Ordonnanceur));
+    if (ordonnanceur == NULL) {
+        return NULL;
+    }
+    ordonnanceur->files = calloc(nb_threads, sizeof(FileTaches));
+    ordonnanceur->threads = calloc(nb_threads, sizeof(pthread_t));
+    if (ordonnanceur->files == NULL || ordonnanceur->threads == NULL) {
+        free(ordonnanceur->files);
+        free(ordonnanceur->threads);
+        free(ordonnanceur);
+        return NULL;
+    }
+    ordonnanceur->nb_files = nb_threads;
+    pthread_mutex_init(&ordonnanceur->verrou, NULL);
+    pthread_cond_init(&ordonnanceur->travail, NULL);
+    pthread_cond_init(&ordonnanceur->termine, NULL);
+    for (int i = 0; i < nb_threads; i++) {
+        pthread_mutex_init(&ordonnanceur->files[i].verrou, NULL);
+        ordonnanceur->files[i].capacite = CAPACITE_FILE_INITIALE;
+        ordonnanceur->files[i].taches = malloc(CAPACITE_FILE_INITIALE * sizeof(Tache));
+    }
+
+    // Les threads sont lancés un par un ; si l'un échoue, seuls les précédents sont gardés
+    for (int i = 0; i < nb_threads; i++) {
+        Travailleur* travailleur = malloc(sizeof(Travailleur));
+        if (ordonnanceur->files[i].taches == NULL || travailleur == NULL) {
+            free(travailleur);
+            break;
+        }
+        travailleur->ordonnanceur = ordonnanceur;
+        travailleur->numero = i;
+        if (pthread_create(&ordonnanceur->threads[i], NULL, executerTravailleur, travailleur) != 0) {
+            free(travailleur);
+            break;
+        }
+        ordonnanceur->nb_threads = i + 1;
+    }
+    if (ordonnanceur->nb_threads == 0) {
+        detruireOrdonnanceur(ordonnanceur);
+        return NULL;
+    }
+    return ordonnanceur;
+}
+
+/**
+ * Retourne le nombre de threads d'un ordonnanceur
+ *
+ * @param ordonnanceur Ordonnanceur créé par creerOrdonnanceur
+ * @return Nombre de threads
+ */
+int nombreTravailleurs(const Ordonnanceur* ordonnanceur) {
+    return ordonnanceur->nb_threads;
+}
+
+/**
+ * Retourne le numéro du thread de l'ordonnanceur qui exécute le code courant
+ * Une tâche peut ainsi utiliser des données propres à son thread (une case par travailleur) sans verrou
+ *
+ * @param ordonnanceur Ordonnanceur créé par creerOrdonnanceur
+ * @return Numéro entre 0 et nombreTravailleurs - 1, ou -1 hors des threads de cet ordonnanceur
+ */
+int numeroTravailleur(const Ordonnanceur* ordonnanceur) {
+    return ordonnanceur_courant == ordonnanceur ? numero_courant : -1;
+}
+
+/**
+ * Soumet une tâche à l'ordonnanceur
+ * Depuis une tâche, la nouvelle tâche est placée dans la file du thread courant ; depuis un autre thread,
+ * les tâches sont réparties à tour de rôle entre les files
+ *
+ * @param ordonnanceur Ordonnanceur créé par creerOrdonnanceur
+ * @param fonction Fonction à exécuter
+ * @param argument Argument transmis à la fonction
+ * @return 0 en cas de succès, -1 si la mémoire manque (errno vaut ENOMEM, la tâche n'est pas soumise)
+ */
+int soumettreTache(Ordonnanceur* ordonnanceur, FonctionTache fonction, void* argument) {
+    int numero;
+    if (ordonnanceur_courant == ordonnanceur) {
+        numero = numero_courant;
+    } else {
+        numero = (int)(atomic_fetch_add(&ordonnanceur->prochaine_file, 1) % (unsigned)ordonnanceur->nb_threads);
+    }
+    Tache tache = {fonction, argument};
+    atomic_fetch_add(&ordonnanceur->en_cours, 1);
+    if (empiler(&ordonnanceur->files[numero], tache) != 0) {
+        atomic_fetch_sub(&ordonnanceur->en_cours, 1);
+        errno = ENOMEM;
+        return -1;
+    }
+    pthread_mutex_lock(&ordonnanceur->verrou);
+    atomic_fetch_add(&ordonnanceur->en_attente, 1);
+    pthread_cond_signal(&ordonnanceur->travail);
+    pthread_mutex_unlock(&ordonnanceur->verrou);
+    return 0;
+}
+
+/**
+ * Attend la fin de toutes les tâches soumises, y compris celles soumises par les tâches elles-mêmes
+ * À appeler hors des threads de l'ordonnanceur
+ *
+ * @param ordonnanceur Ordonnanceur créé par creerOrdonnanceur
+ */
+void attendreTaches(Ordonnanceur* ordonnanceur) {
+    pthread_mutex_lock(&ordonnanceur->verrou);
+    while (atomic_load(&ordonnanceur->en_cours) > 0) {
+        pthread_cond_wait(&ordonnanceur->termine, &ordonnanceur->verrou);
+    }
+    pthread_mutex_unlock(&ordonnanceur->verrou);
+}
+
+/**
+ * Termine les tâches restantes, arrête les threads et libère l'ordonnanceur
+ *
+ * @param ordonnanceur Ordonnanceur créé par creerOrdonnanceur
+ */
+void detruireOrdonnanceur(Ordonnanceur* ordonnanceur) {
+    pthread_mutex_lock(&ordonnanceur->verrou);
+    ordonnanceur->arret = 1;
+    pthread_cond_broadcast(&ordonnanceur->travail);
+    pthread_mutex_unlock(&ordonnanceur->verrou);
+    for (int i = 0; i < ordonnanceur->nb_threads; i++) {
+        pthread_join(ordonnanceur->threads[i], NULL);
+    }
+    for (int i = 0; i < ordonnanceur->nb_files; i++) {
+        pthread_mutex_destroy(&ordonnanceur->files[i].verrou);
+        free(ordonnanceur->files[i].taches);
+    }
+    pthread_mutex_destroy(&ordonnanceur->verrou);
+    pthread_cond_destroy(&ordonnanceur->travail);
+    pthread_cond_destroy(&ordonnanceur->termine);
+    free(ordonnanceur->files);
+    free(ordonnanceur->threads);
+    free(ordonnanceur);
+}
@@ -0,0 +1,19 @@
+#ifndef ORDONNANCEUR_H
+#define ORDONNANCEUR_H
+
+#define CAPACITE_FILE_INITIALE 64   // Nombre de tâches prévues dans la file de chaque thread (agrandie si besoin)
+
+// Tâche exécutée par un thread de l'ordonnanceur (une tâche peut soumettre d'autres tâches)
+typedef void (*FonctionTache)(void* argument);
+
+// Ensemble de threads à vol de tâches (voir creerOrdonnanceur)
+typedef struct Ordonnanceur Ordonnanceur;
+
+Ordonnanceur* creerOrdonnanceur(int nb_threads);
+int nombreTravailleurs(const Ordonnanceur* ordonnanceur);
+int numeroTravailleur(const Ordonnanceur* ordonnanceur);
+int soumettreTache(Ordonnanceur* ordonnanceur, FonctionTache fonction, void* argument);
+void attendreTaches(Ordonnanceur* ordonnanceur);
+void detruireOrdonnanceur(Ordonnanceur* ordonnanceur);
+
+#endif
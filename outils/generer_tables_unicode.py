@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+# Génère tables_unicode.c à partir des données Unicode de Python (module unicodedata)
+#   python3 outils/generer_tables_unicode.py > tables_unicode.c
+#
+# Pour chaque caractère : drapeaux (caractère de mot, majuscule), classe canonique de combinaison, forme repliée et
+# décomposée NFD(repli(NFD(c))) avec le repli simple des casses (CaseFolding.txt, statuts C et S), et liste des
+# caractères avec lesquels il forme une composée primaire (NFC). U+0345 (iota souscrit), seule marque combinante
+# changée par le repli, est conservé dans les formes : normalisation.c le replie après l'ordre canonique, comme
+# NFC(repli(NFD(mot))). Les syllabes hangûl sont traitées par calcul dans
+# normalisation.c et n'apparaissent pas dans les tables.
+# Les tables sont à deux niveaux : une page de TAILLE_PAGE caractères par entrée de pages_unicode, pages identiques
+# partagées, et une propriété par caractère dans proprietes_unicode (propriétés identiques partagées).
+
+import sys
+import unicodedata
+
+DEBUT_HANGUL = 0xAC00
+IOTA_SOUSCRIT = "\u0345"
+DRAPEAU_MOT = 1                           # Mêmes valeurs que UNICODE_MOT et UNICODE_MAJUSCULE (normalisation.h)
+DRAPEAU_MAJUSCULE = 2
+FIN_HANGUL = 0xD7A4
+BITS_PAGE = 7
+TAILLE_PAGE = 1 << BITS_PAGE
+
+
+def repli_simple(c):
+    # casefold donne le repli complet (statuts C et F) ; quand il change la longueur, le repli simple (statut S)
+    # est la minuscule si elle tient en un caractère, sinon le caractère reste tel quel
+    replie = c.casefold()
+    if len(replie) == 1:
+        return replie
+    minuscule = c.lower()
+    return minuscule if len(minuscule) == 1 else c
+
+
+def est_caractere_mot(c):
+    # Lettres, chiffres et nombres, marques combinantes (les accents isolés restent attachés au mot)
+    return unicodedata.category(c)[0] in "LNM"
+
+
+def est_majuscule(c):
+    # Majuscules et capitales de titre : initiale des noms propres
+    return unicodedata.category(c) in ("Lu", "Lt")
+
+
+def forme_normalisee(c):
+    nfd = unicodedata.normalize("NFD", c)
+    replie = "".join(x if x == IOTA_SOUSCRIT else repli_simple(x) for x in nfd)
+    return unicodedata.normalize("NFD", replie)
+
+
+def main():
+    limite = 0
+    proprietes = [(0, 0, 0, 0, 0, 0)]     # (expansion, longueur, classe, compositions, nb, drapeaux)
+    index_proprietes = {proprietes[0]: 0}
+    expansions = [0]                      # Indice 0 réservé : « pas d'expansion »
+    index_expansions = {}
+    compositions = []
+    par_premier = {}
+    expansion_max = 1
+
+    # Composées primaires : décomposition canonique en deux caractères, sans exclusion de composition
+    for code in range(0x110000):
+        c = chr(code)
+        if DEBUT_HANGUL <= code < FIN_HANGUL:
+            continue
+        decomposition = unicodedata.decomposition(c)
+        if not decomposition or decomposition.startswith("<"):
+            continue
+        parties = [int(x, 16) for x in decomposition.split()]
+        if len(parties) != 2:
+            continue
+        if unicodedata.normalize("NFC", unicodedata.normalize("NFD", c)) != c:
+            continue                      # Exclusion de composition
+        par_premier.setdefault(parties[0], []).append((parties[1], code))
+
+    for code in range(0x110000):
+        c = chr(code)
+        if not 0xD800 <= code < 0xE000 and unicodedata.combining(c) and repli_simple(c) != c:
+            assert c == IOTA_SOUSCRIT, "marque combinante changée par le repli : U+%04X" % code
+
+    code_propriete = [0] * 0x110000
+    for code in range(0x110000):
+        if DEBUT_HANGUL <= code < FIN_HANGUL or 0xD800 <= code < 0xE000:
+            continue
+        c = chr(code)
+        classe = unicodedata.combining(c)
+        drapeaux = (DRAPEAU_MOT if est_caractere_mot(c) else 0) | (DRAPEAU_MAJUSCULE if est_majuscule(c) else 0)
+        forme = forme_normalisee(c)
+        debut_expansion, longueur = 0, 0
+        if forme != c:
+            cle = tuple(ord(x) for x in forme)
+            if cle not in index_expansions:
+                index_expansions[cle] = len(expansions)
+                expansions.extend(cle)
+            debut_expansion, longueur = index_expansions[cle], len(cle)
+            expansion_max = max(expansion_max, longueur)
+        debut_compositions, nb = 0, 0
+        if code in par_premier:
+            liste = sorted(par_premier[code])
+            debut_compositions, nb = len(compositions), len(liste)
+            compositions.extend(liste)
+        propriete = (debut_expansion, longueur, classe, debut_compositions, nb, drapeaux)
+        if propriete not in index_proprietes:
+            index_proprietes[propriete] = len(proprietes)
+            proprietes.append(propriete)
+        code_propriete[code] = index_proprietes[propriete]
+        if code_propriete[code] != 0:
+            limite = code + 1
+
+    nb_pages = (limite + TAILLE_PAGE - 1) // TAILLE_PAGE
+    pages, index_pages, blocs = [], {}, []
+    for page in range(nb_pages):
+        bloc = tuple(code_propriete[page * TAILLE_PAGE:(page + 1) * TAILLE_PAGE])
+        if bloc not in index_pages:
+            index_pages[bloc] = len(blocs)
+            blocs.append(bloc)
+        pages.append(index_pages[bloc])
+
+    assert len(expansions) < 1 << 16 and len(compositions) < 1 << 16 and len(proprietes) < 1 << 16
+    assert max(len(v) for v in par_premier.values()) < 256
+
+    sortie = sys.stdout
+    sortie.write("// Tables générées par outils/generer_tables_unicode.py (Unicode %s) : ne pas modifier\n"
+                 % unicodedata.unidata_version)
+    sortie.write("#include \"normalisation.h\"\n\n")
+    sortie.write("#if LIMITE_TABLES_UNICODE != 0x%X || BITS_PAGE_UNICODE != %d || EXPANSION_NORMALISATION_MAX < %d"
+                 " || \\\n    UNICODE_MOT != %d || UNICODE_MAJUSCULE != %d\n"
+                 % (limite, BITS_PAGE, expansion_max, DRAPEAU_MOT, DRAPEAU_MAJUSCULE))
+    sortie.write("#error \"normalisation.h ne correspond pas aux tables générées\"\n#endif\n\n")
+
+    def ecrire(declaration, valeurs, largeur):
+        sortie.write(declaration + " = {\n")
+        for i in range(0, len(valeurs), largeur):
+            sortie.write("    " + ", ".join(valeurs[i:i + largeur]) + ",\n")
+        sortie.write("};\n\n")
+
+    ecrire("const uint16_t pages_unicode[%d]" % len(pages), [str(p) for p in pages], 16)
+    sortie.write("const uint16_t blocs_unicode[%d][%d] = {\n" % (len(blocs), TAILLE_PAGE))
+    for bloc in blocs:
+        sortie.write("    {\n")
+        for i in range(0, TAILLE_PAGE, 16):
+            sortie.write("        " + ", ".join(str(x) for x in bloc[i:i + 16]) + ",\n")
+        sortie.write("    },\n")
+    sortie.write("};\n\n")
+    ecrire("const ProprieteUnicode proprietes_unicode[%d]" % len(proprietes),
+           ["{%d, %d, %d, %d, %d, %d}" % p for p in proprietes], 4)
+    ecrire("const uint32_t expansions_unicode[%d]" % len(expansions), ["0x%X" % x for x in expansions], 10)
+    ecrire("const CompositionUnicode compositions_unicode[%d]" % len(compositions),
+           ["{0x%X, 0x%X}" % x for x in compositions], 5)
+
+
+if __name__ == "__main__":
+    main()
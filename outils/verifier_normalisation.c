@@ -0,0 +1,32 @@
+// Programme de vérification de normalisation.h, piloté par outils/verifier_normalisation.py (make check)
+// Chaque ligne lue donne les caractères d'un mot en hexadécimal ; chaque ligne écrite donne les indicateurs
+// estAlphanumerique et estMajuscule de son premier caractère, puis le mot normalisé par normaliserMot, en hexadécimal
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../normalisation.h"
+
+#define LONGUEUR_MOT_MAX 256
+
+int main(void) {
+    char ligne[LONGUEUR_MOT_MAX * 9 + 2];
+    wchar_t mot[LONGUEUR_MOT_MAX];
+    wchar_t resultat[LONGUEUR_MOT_MAX * EXPANSION_NORMALISATION_MAX + 1];
+    while (fgets(ligne, sizeof(ligne), stdin) != NULL) {
+        size_t longueur = 0;
+        char* position = ligne;
+        char* fin;
+        unsigned long code;
+        while (longueur < LONGUEUR_MOT_MAX && (code = strtoul(position, &fin, 16), fin != position)) {
+            mot[longueur++] = (wchar_t)code;
+            position = fin;
+        }
+        size_t n = normaliserMot(mot, longueur, resultat);
+        printf("%d %d :", longueur > 0 && estAlphanumerique(mot[0]), longueur > 0 && estMajuscule(mot[0]));
+        for (size_t i = 0; i < n; i++) {
+            printf(" %X", (unsigned)resultat[i]);
+        }
+        putchar('\n');
+    }
+    return ferror(stdout) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
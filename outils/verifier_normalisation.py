@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# Vérifie normalisation.h et les tables générées contre la référence Python (module unicodedata), pour make check
+#   python3 outils/verifier_normalisation.py build/verification/verifier_normalisation
+#
+# Cas vérifiés : chaque caractère d'Unicode seul (hors demi-codets), puis NB_MOTS_ALEATOIRES mots tirés (graine fixe)
+# parmi des caractères qui se décomposent, se composent ou se réordonnent (latin, grec, devanagari, jamos et syllabes
+# hangûl, marques combinantes). Pour chaque cas, le programme de vérification doit donner comme la référence :
+#   - estAlphanumerique et estMajuscule du premier caractère
+#   - normaliserMot : NFC(repli(NFD(mot))), après retrait des caractères qui n'appartiennent pas aux mots
+
+import os
+import random
+import re
+import subprocess
+import sys
+import unicodedata
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from generer_tables_unicode import est_caractere_mot, est_majuscule, repli_simple  # noqa: E402
+
+NB_MOTS_ALEATOIRES = 200000
+NB_ECARTS_AFFICHES = 10
+GRAINE = 1
+
+
+def est_alphanumerique(c):
+    return c.isascii() and c.isalnum() or not c.isascii() and est_caractere_mot(c)
+
+
+def reference(mot):
+    garde = "".join(c for c in mot if c in "-'_" or est_alphanumerique(c))
+    replie = "".join(repli_simple(c) for c in unicodedata.normalize("NFD", garde))
+    normalise = unicodedata.normalize("NFC", replie)
+    premier = mot[0]
+    majuscule = "A" <= premier <= "Z" if premier.isascii() else est_majuscule(premier)
+    return "%d %d :%s" % (est_alphanumerique(premier), majuscule, "".join(" %X" % ord(c) for c in normalise))
+
+
+def cas():
+    for code in range(0x110000):
+        if not 0xD800 <= code < 0xE000:
+            yield chr(code)
+    plages = [(0x20, 0x250), (0x300, 0x370), (0x370, 0x400), (0x900, 0x980), (0x1100, 0x1200), (0x1E00, 0x2000),
+              (0xAC00, 0xAC60)]
+    reservoir = [chr(c) for debut, fin in plages for c in range(debut, fin)]
+    reservoir += ["\u0345", "\u0399", "\u0F73", "\u1E9E", "\u2126", "\u212B"]
+    hasard = random.Random(GRAINE)
+    for _ in range(NB_MOTS_ALEATOIRES):
+        yield "".join(hasard.choice(reservoir) for _ in range(hasard.randint(1, 8)))
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("Usage: %s verifier_normalisation" % sys.argv[0])
+    # Les tables ne concordent qu'avec la version d'Unicode qui les a produites
+    tables = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "tables_unicode.c")
+    with open(tables, encoding="utf-8") as fichier:
+        version = re.search(r"\(Unicode ([0-9.]+)\)", fichier.readline())
+    if version is None or version.group(1) != unicodedata.unidata_version:
+        print("Normalisation non vérifiée : tables_unicode.c n'a pas été généré avec Unicode %s"
+              % unicodedata.unidata_version)
+        return 0
+
+    mots = list(cas())
+    entree = "".join(" ".join("%X" % ord(c) for c in mot) + "\n" for mot in mots)
+    sortie = subprocess.run([sys.argv[1]], input=entree, capture_output=True, text=True, check=True).stdout
+    obtenus = sortie.splitlines()
+    if len(obtenus) != len(mots):
+        print("Normalisation : %d lignes obtenues pour %d mots" % (len(obtenus), len(mots)))
+        return 1
+    ecarts = 0
+    for mot, obtenu in zip(mots, obtenus):
+        attendu = reference(mot)
+        if obtenu != attendu:
+            if ecarts < NB_ECARTS_AFFICHES:
+                print("Écart pour %s : obtenu « %s », attendu « %s »"
+                      % (" ".join("U+%04X" % ord(c) for c in mot), obtenu, attendu))
+            ecarts += 1
+    if ecarts:
+        print("Normalisation : %d écarts sur %d mots" % (ecarts, len(mots)))
+        return 1
+    print("Normalisation conforme à Unicode %s sur %d mots" % (unicodedata.unidata_version, len(mots)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
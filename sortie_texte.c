@@ -0,0 +1,365 @@
+#include "sortie_texte.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * Ouvre (ou crée) un fichier pour l'écriture d'une exportation
+ * Un fichier existant est tronqué
+ *
+ * @param sortie Pointeur vers la structure à initialiser
+ * @param chemin Chemin du fichier à écrire
+ * @return 0 en cas de succès, -1 en cas d'erreur (errno est positionné)
+ */
+int ouvrirSortie(SortieTexte* sortie, const char* chemin) {
+    memset(sortie, 0, sizeof(SortieTexte));
+    sortie->tampon = malloc(TAILLE_TAMPON_ECRITURE);
+    if (sortie->tampon == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+    sortie->descripteur = open(chemin, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (sortie->descripteur < 0) {
+        int erreur = errno;
+        free(sortie->tampon);
+        sortie->tampon = NULL;
+        errno = erreur;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Prépare l'écriture dans un descripteur déjà ouvert (sortie standard...)
+ * Le descripteur est fermé par fermerSortie
+ *
+ * @param sortie Pointeur vers la structure à initialiser
+ * @param descripteur Descripteur ouvert en écriture
+ * @return 0 en cas de succès, -1 si la mémoire manque (errno est positionné)
+ */
+int ouvrirSortieDescripteur(SortieTexte* sortie, int descripteur) {
+    memset(sortie, 0, sizeof(SortieTexte));
+    sortie->tampon = malloc(TAILLE_TAMPON_ECRITURE);
+    if (sortie->tampon == NULL) {
+        errno = ENOMEM;
+        return -1;
+    }
+    sortie->descripteur = descripteur;
+    return 0;
+}
+
+/**
+ * Écrit les octets en attente dans le fichier
+ * Après une erreur, les écritures suivantes sont ignorées ; l'erreur est rapportée par fermerSortie
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ */
+void viderSortie(SortieTexte* sortie) {
+    size_t ecrits = 0;
+    while (ecrits < sortie->utilise && sortie->erreur == 0) {
+        ssize_t n = write(sortie->descripteur, sortie->tampon + ecrits, sortie->utilise - ecrits);
+        if (n < 0) {
+            if (errno != EINTR) {
+                sortie->erreur = errno;
+            }
+            continue;
+        }
+        ecrits += (size_t)n;
+    }
+    sortie->utilise = 0;
+}
+
+/**
+ * Écrit les derniers octets, ferme le fichier et libère le tampon
+ *
+ * @param sortie Pointeur vers la sortie à fermer
+ * @return 0 si toutes les écritures ont réussi, -1 sinon (errno est positionné)
+ */
+int fermerSortie(SortieTexte* sortie) {
+    viderSortie(sortie);
+    if (close(sortie->descripteur) != 0 && sortie->erreur == 0) {
+        sortie->erreur = errno;
+    }
+    int erreur = sortie->erreur;
+    free(sortie->tampon);
+    memset(sortie, 0, sizeof(SortieTexte));
+    sortie->descripteur = -1;
+    if (erreur != 0) {
+        errno = erreur;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Ajoute une suite d'octets à la sortie
+ * Les blocs plus grands que le tampon sont écrits directement
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param octets Octets à écrire
+ * @param taille Nombre d'octets
+ */
+void ecrireOctets(SortieTexte* sortie, const void* octets, size_t taille) {
+    if (taille == 0) {
+        return;
+    }
+    if (sortie->utilise + taille > TAILLE_TAMPON_ECRITURE) {
+        viderSortie(sortie);
+        if (taille > TAILLE_TAMPON_ECRITURE) {
+            const unsigned char* p = octets;
+            while (taille > 0 && sortie->erreur == 0) {
+                ssize_t n = write(sortie->descripteur, p, taille);
+                if (n < 0) {
+                    if (errno != EINTR) {
+                        sortie->erreur = errno;
+                    }
+                    continue;
+                }
+                p += n;
+                taille -= (size_t)n;
+            }
+            return;
+        }
+    }
+    memcpy(sortie->tampon + sortie->utilise, octets, taille);
+    sortie->utilise += taille;
+}
+
+/**
+ * Ajoute une chaîne terminée par un zéro à la sortie
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param chaine Chaîne à écrire (telle quelle, sans interprétation de '%')
+ */
+void ecrireChaine(SortieTexte* sortie, const char* chaine) {
+    ecrireOctets(sortie, chaine, strlen(chaine));
+}
+
+/**
+ * Ajoute un texte formaté à la sortie, directement dans le tampon quand il y tient
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param format Format de type printf
+ */
+void ecrireFormat(SortieTexte* sortie, const char* format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    size_t libre = TAILLE_TAMPON_ECRITURE - sortie->utilise;
+    int taille = vsnprintf((char*)sortie->tampon + sortie->utilise, libre, format, arguments);
+    va_end(arguments);
+    if (taille < 0) {
+        return;
+    }
+    if ((size_t)taille < libre) {
+        sortie->utilise += (size_t)taille;
+        return;
+    }
+
+    // Pas assez de place : le texte est formaté à part puis écrit
+    char* texte = malloc((size_t)taille + 1);
+    if (texte == NULL) {
+        if (sortie->erreur == 0) {
+            sortie->erreur = ENOMEM;
+        }
+        return;
+    }
+    va_start(arguments, format);
+    vsnprintf(texte, (size_t)taille + 1, format, arguments);
+    va_end(arguments);
+    ecrireOctets(sortie, texte, (size_t)taille);
+    free(texte);
+}
+
+/**
+ * Ajoute un entier écrit en décimal à la sortie (sans passer par printf)
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param valeur Entier à écrire
+ */
+void ecrireEntier(SortieTexte* sortie, long long valeur) {
+    char chiffres[24];
+    int pos = sizeof(chiffres);
+    unsigned long long reste = valeur < 0 ? 0ULL - (unsigned long long)valeur : (unsigned long long)valeur;
+    do {
+        chiffres[--pos] = (char)('0' + reste % 10);
+        reste /= 10;
+    } while (reste > 0);
+    if (valeur < 0) {
+        chiffres[--pos] = '-';
+    }
+    ecrireOctets(sortie, chiffres + pos, sizeof(chiffres) - (size_t)pos);
+}
+
+/**
+ * Encode un caractère en UTF-8
+ *
+ * @param c Caractère à encoder
+ * @param p Destination, d'au moins 4 octets
+ * @return Nombre d'octets écrits (de 1 à 4)
+ */
+static size_t encoderCaractereUtf8(wchar_t c, unsigned char* p) {
+    unsigned long u = (unsigned long)c;
+    if (u < 0x80) {
+        p[0] = (unsigned char)u;
+        return 1;
+    } else if (u < 0x800) {
+        p[0] = (unsigned char)(0xC0 | (u >> 6));
+        p[1] = (unsigned char)(0x80 | (u & 0x3F));
+        return 2;
+    } else if (u < 0x10000) {
+        p[0] = (unsigned char)(0xE0 | (u >> 12));
+        p[1] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+        p[2] = (unsigned char)(0x80 | (u & 0x3F));
+        return 3;
+    }
+    p[0] = (unsigned char)(0xF0 | ((u >> 18) & 0x07));
+    p[1] = (unsigned char)(0x80 | ((u >> 12) & 0x3F));
+    p[2] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+    p[3] = (unsigned char)(0x80 | (u & 0x3F));
+    return 4;
+}
+
+/**
+ * Ajoute un caractère encodé en UTF-8 à la sortie
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param c Caractère à écrire
+ */
+static void ecrireCaractereUtf8(SortieTexte* sortie, wchar_t c) {
+    if (sortie->utilise + 4 > TAILLE_TAMPON_ECRITURE) {
+        viderSortie(sortie);
+    }
+    sortie->utilise += encoderCaractereUtf8(c, sortie->tampon + sortie->utilise);
+}
+
+/**
+ * Encode un mot en UTF-8 dans un tampon fourni par l'appelant, sans dépendre de la locale
+ * Le résultat est toujours terminé par un octet nul ; s'il ne tient pas, il est tronqué sans couper de caractère
+ *
+ * @param mot Caractères du mot
+ * @param longueur Nombre de caractères du mot
+ * @param tampon Destination
+ * @param taille Taille de la destination en octets (au moins 1)
+ * @return Nombre d'octets du mot encodé en entier, sans l'octet nul (comme snprintf)
+ */
+size_t encoderUtf8(const wchar_t* mot, size_t longueur, char* tampon, size_t taille) {
+    size_t necessaire = 0;
+    size_t ecrits = 0;
+    int tronque = 0;
+    for (size_t i = 0; i < longueur; i++) {
+        unsigned char octets[4];
+        size_t n = encoderCaractereUtf8(mot[i], octets);
+        if (!tronque && ecrits + n < taille) {
+            memcpy(tampon + ecrits, octets, n);
+            ecrits += n;
+        } else {
+            tronque = 1;
+        }
+        necessaire += n;
+    }
+    tampon[ecrits] = '\0';
+    return necessaire;
+}
+
+/**
+ * Ajoute un mot à la sortie en l'encodant directement en UTF-8 (sans chaîne intermédiaire)
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param mot Caractères du mot
+ * @param longueur Nombre de caractères du mot
+ */
+void ecrireMotUtf8(SortieTexte* sortie, const wchar_t* mot, size_t longueur) {
+    for (size_t i = 0; i < longueur; i++) {
+        if ((unsigned long)mot[i] < 0x80 && sortie->utilise < TAILLE_TAMPON_ECRITURE) {
+            sortie->tampon[sortie->utilise++] = (unsigned char)mot[i];
+        } else {
+            ecrireCaractereUtf8(sortie, mot[i]);
+        }
+    }
+}
+
+/**
+ * Ajoute un mot comme champ CSV (RFC 4180)
+ * Le champ n'est entouré de guillemets que s'il contient une virgule, un guillemet ou une fin de ligne
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param mot Caractères du mot
+ * @param longueur Nombre de caractères du mot
+ */
+void ecrireChampCsv(SortieTexte* sortie, const wchar_t* mot, size_t longueur) {
+    int guillemets = 0;
+    for (size_t i = 0; i < longueur && !guillemets; i++) {
+        guillemets = mot[i] == L',' || mot[i] == L'"' || mot[i] == L'\n' || mot[i] == L'\r';
+    }
+    if (!guillemets) {
+        ecrireMotUtf8(sortie, mot, longueur);
+        return;
+    }
+    ecrireOctet(sortie, '"');
+    for (size_t i = 0; i < longueur; i++) {
+        if (mot[i] == L'"') {
+            ecrireOctet(sortie, '"');
+        }
+        ecrireCaractereUtf8(sortie, mot[i]);
+    }
+    ecrireOctet(sortie, '"');
+}
+
+/**
+ * Ajoute un mot comme chaîne JSON, guillemets compris
+ * Les guillemets, barres obliques inverses et caractères de contrôle sont échappés
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param mot Caractères du mot
+ * @param longueur Nombre de caractères du mot
+ */
+void ecrireChaineJson(SortieTexte* sortie, const wchar_t* mot, size_t longueur) {
+    static const char hexa[] = "0123456789abcdef";
+    ecrireOctet(sortie, '"');
+    for (size_t i = 0; i < longueur; i++) {
+        wchar_t c = mot[i];
+        if (c == L'"' || c == L'\\') {
+            ecrireOctet(sortie, '\\');
+            ecrireOctet(sortie, (unsigned char)c);
+        } else if (c == L'\n') {
+            ecrireOctets(sortie, "\\n", 2);
+        } else if (c == L'\t') {
+            ecrireOctets(sortie, "\\t", 2);
+        } else if ((unsigned long)c < 0x20) {
+            char echappement[6] = {'\\', 'u', '0', '0', hexa[(c >> 4) & 0xF], hexa[c & 0xF]};
+            ecrireOctets(sortie, echappement, sizeof(echappement));
+        } else {
+            ecrireCaractereUtf8(sortie, c);
+        }
+    }
+    ecrireOctet(sortie, '"');
+}
+
+/**
+ * Ajoute une chaîne d'octets (chemin de fichier, message d'erreur...) comme chaîne JSON, guillemets compris
+ * Les octets non ASCII sont recopiés tels quels
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param texte Chaîne terminée par un zéro
+ */
+void ecrireTexteJson(SortieTexte* sortie, const char* texte) {
+    static const char hexa[] = "0123456789abcdef";
+    ecrireOctet(sortie, '"');
+    for (const unsigned char* p = (const unsigned char*)texte; *p != '\0'; p++) {
+        if (*p == '"' || *p == '\\') {
+            ecrireOctet(sortie, '\\');
+            ecrireOctet(sortie, *p);
+        } else if (*p < 0x20) {
+            char echappement[6] = {'\\', 'u', '0', '0', hexa[*p >> 4], hexa[*p & 0xF]};
+            ecrireOctets(sortie, echappement, sizeof(echappement));
+        } else {
+            ecrireOctet(sortie, *p);
+        }
+    }
+    ecrireOctet(sortie, '"');
+}
@@ -0,0 +1,45 @@
+#ifndef SORTIE_TEXTE_H
+#define SORTIE_TEXTE_H
+
+#include <stddef.h>
+#include <wchar.h>
+
+#define TAILLE_TAMPON_ECRITURE (1 << 20) // Taille du tampon accumulant les octets avant chaque appel à write
+
+// Structure représentant un fichier ouvert en écriture
+// Les octets sont accumulés dans un grand tampon et écrits en un seul appel système quand il est plein
+typedef struct {
+    int descripteur;          // Descripteur du fichier ouvert
+    unsigned char* tampon;    // Octets en attente d'écriture
+    size_t utilise;           // Nombre d'octets en attente
+    int erreur;               // Première erreur d'écriture rencontrée (valeur d'errno, 0 si aucune)
+} SortieTexte;
+
+int ouvrirSortie(SortieTexte* sortie, const char* chemin);
+int ouvrirSortieDescripteur(SortieTexte* sortie, int descripteur);
+int fermerSortie(SortieTexte* sortie);
+void viderSortie(SortieTexte* sortie);
+void ecrireOctets(SortieTexte* sortie, const void* octets, size_t taille);
+void ecrireChaine(SortieTexte* sortie, const char* chaine);
+void ecrireFormat(SortieTexte* sortie, const char* format, ...) __attribute__((format(printf, 2, 3)));
+void ecrireEntier(SortieTexte* sortie, long long valeur);
+void ecrireMotUtf8(SortieTexte* sortie, const wchar_t* mot, size_t longueur);
+void ecrireChampCsv(SortieTexte* sortie, const wchar_t* mot, size_t longueur);
+void ecrireChaineJson(SortieTexte* sortie, const wchar_t* mot, size_t longueur);
+void ecrireTexteJson(SortieTexte* sortie, const char* texte);
+size_t encoderUtf8(const wchar_t* mot, size_t longueur, char* tampon, size_t taille);
+
+/**
+ * Ajoute un octet au tampon de la sortie
+ *
+ * @param sortie Pointeur vers la sortie ouverte
+ * @param octet Octet à écrire
+ */
+static inline void ecrireOctet(SortieTexte* sortie, unsigned char octet) {
+    if (sortie->utilise == TAILLE_TAMPON_ECRITURE) {
+        viderSortie(sortie);
+    }
+    sortie->tampon[sortie->utilise++] = octet;
+}
+
+#endif
@@ -0,0 +1,216 @@
+#include "source_texte.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Ouvre un fichier texte pour l'analyse
+ * Projette le fichier en mémoire s'il s'agit d'un fichier ordinaire, sinon prépare une lecture par blocs
+ *
+ * @param source Pointeur vers la structure à initialiser
+ * @param chemin Chemin du fichier à ouvrir
+ * @return 0 en cas de succès, -1 en cas d'erreur (errno est positionné)
+ */
+int ouvrirSource(SourceTexte* source, const char* chemin) {
+    memset(source, 0, sizeof(SourceTexte));
+    source->descripteur = open(chemin, O_RDONLY);
+    if (source->descripteur < 0) {
+        return -1;
+    }
+
+    struct stat infos;
+    if (fstat(source->descripteur, &infos) == 0 && S_ISREG(infos.st_mode)) {
+        if (infos.st_size == 0) {
+            // Fichier vide : rien à projeter, la source est directement épuisée
+            source->fin_fichier = 1;
+            return 0;
+        }
+        void* zone = mmap(NULL, (size_t)infos.st_size, PROT_READ, MAP_PRIVATE, source->descripteur, 0);
+        if (zone != MAP_FAILED) {
+            madvise(zone, (size_t)infos.st_size, MADV_SEQUENTIAL);
+            source->projection = zone;
+            source->taille_projection = (size_t)infos.st_size;
+            source->courant = source->projection;
+            source->fin = source->projection + source->taille_projection;
+            source->fin_fichier = 1;
+            return 0;
+        }
+    }
+
+    // Tube, périphérique ou projection impossible : lecture par blocs
+    source->tampon = malloc(TAILLE_TAMPON_LECTURE);
+    if (source->tampon == NULL) {
+        close(source->descripteur);
+        errno = ENOMEM;
+        return -1;
+    }
+    source->courant = source->tampon;
+    source->fin = source->tampon;
+    return 0;
+}
+
+/**
+ * Ferme une source et libère la projection ou le tampon associé
+ *
+ * @param source Pointeur vers la source à fermer
+ */
+void fermerSource(SourceTexte* source) {
+    if (source->projection != NULL) {
+        munmap(source->projection, source->taille_projection);
+    }
+    free(source->tampon);
+    close(source->descripteur);
+    memset(source, 0, sizeof(SourceTexte));
+    source->descripteur = -1;
+}
+
+/**
+ * Retourne la taille totale du fichier d'une source (pour afficher une progression)
+ *
+ * @param source Pointeur vers la source ouverte
+ * @return Taille en octets, ou 0 si elle est inconnue (tube, terminal...)
+ */
+size_t tailleSource(const SourceTexte* source) {
+    if (source->projection != NULL) {
+        return source->taille_projection;
+    }
+    struct stat infos;
+    if (fstat(source->descripteur, &infos) == 0 && S_ISREG(infos.st_mode)) {
+        return (size_t)infos.st_size;
+    }
+    return 0;
+}
+
+/**
+ * Retourne la position de lecture d'une source : nombre d'octets du fichier déjà décodés
+ *
+ * @param source Pointeur vers la source ouverte
+ * @return Position du prochain octet à décoder depuis le début du fichier
+ */
+size_t positionSource(const SourceTexte* source) {
+    if (source->projection != NULL) {
+        return (size_t)(source->courant - source->projection);
+    }
+    return source->decalage_tampon + (size_t)(source->courant - source->tampon);
+}
+
+/**
+ * Place la lecture d'une source à une position du fichier, avant de commencer à décoder
+ * En mode projeté, seules les pages lues ensuite sont chargées : reprendre près de la fin ne coûte que la suite
+ *
+ * @param source Pointeur vers la source ouverte (aucun octet encore décodé)
+ * @param position Position du prochain octet à décoder (au plus la taille du fichier)
+ * @return 0 en cas de succès, -1 en cas d'erreur (errno est positionné)
+ */
+int positionnerSource(SourceTexte* source, size_t position) {
+    if (source->projection != NULL) {
+        if (position > source->taille_projection) {
+            errno = EINVAL;
+            return -1;
+        }
+        source->courant = source->projection + position;
+        return 0;
+    }
+    if (source->tampon == NULL) {
+        // Fichier vide
+        if (position > 0) {
+            errno = EINVAL;
+            return -1;
+        }
+        return 0;
+    }
+    if (lseek(source->descripteur, (off_t)position, SEEK_SET) < 0) {
+        return -1;
+    }
+    source->decalage_tampon = position;
+    source->courant = source->tampon;
+    source->fin = source->tampon;
+    source->fin_fichier = 0;
+    return 0;
+}
+
+/**
+ * Lit un nouveau bloc d'octets en mode lecture par blocs
+ * Les octets non encore consommés (début d'une séquence UTF-8 coupée) sont conservés en tête du tampon
+ *
+ * @param source Pointeur vers la source
+ * @return 1 si des octets sont disponibles, 0 en fin de fichier
+ */
+int rechargerSource(SourceTexte* source) {
+    while (!source->fin_fichier) {
+        size_t restants = (size_t)(source->fin - source->courant);
+        source->decalage_tampon += (size_t)(source->courant - source->tampon);
+        memmove(source->tampon, source->courant, restants);
+        source->courant = source->tampon;
+        source->fin = source->tampon + restants;
+
+        ssize_t lus = read(source->descripteur, source->tampon + restants, TAILLE_TAMPON_LECTURE - restants);
+        if (lus < 0 && errno == EINTR) {
+            continue;
+        }
+        if (lus <= 0) {
+            // Comme fgetwc, une erreur de lecture est traitée comme la fin du fichier
+            source->fin_fichier = 1;
+            break;
+        }
+        source->fin += lus;
+        return 1;
+    }
+    return source->courant < source->fin;
+}
+
+/**
+ * Décode une séquence UTF-8 multi-octets à la position courante
+ * Rejette les mêmes séquences que le décodeur de la glibc (formes trop longues, surrogates, au-delà de U+10FFFF)
+ *
+ * @param source Pointeur vers la source, positionnée sur un octet de tête >= 0x80
+ * @return Le caractère décodé, ou WEOF si la séquence est invalide ou tronquée en fin de fichier
+ */
+wint_t decoderSequenceUtf8(SourceTexte* source) {
+    unsigned char tete = *source->courant;
+    unsigned char min_suite = 0x80, max_suite = 0xBF; // Bornes du deuxième octet
+    int longueur;
+    wint_t c;
+
+    if (tete >= 0xC2 && tete <= 0xDF) {
+        longueur = 2;
+        c = tete & 0x1F;
+    } else if (tete >= 0xE0 && tete <= 0xEF) {
+        longueur = 3;
+        c = tete & 0x0F;
+        if (tete == 0xE0) min_suite = 0xA0;  // Forme trop longue
+        if (tete == 0xED) max_suite = 0x9F;  // Surrogates UTF-16
+    } else if (tete >= 0xF0 && tete <= 0xF4) {
+        longueur = 4;
+        c = tete & 0x07;
+        if (tete == 0xF0) min_suite = 0x90;  // Forme trop longue
+        if (tete == 0xF4) max_suite = 0x8F;  // Au-delà de U+10FFFF
+    } else {
+        return WEOF;
+    }
+
+    // La séquence peut être coupée par la fin du bloc en mode lecture
+    while (source->fin - source->courant < longueur) {
+        if (source->fin_fichier || !rechargerSource(source)) {
+            return WEOF;
+        }
+    }
+
+    const unsigned char* p = source->courant;
+    if (p[1] < min_suite || p[1] > max_suite) {
+        return WEOF;
+    }
+    for (int i = 1; i < longueur; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            return WEOF;
+        }
+        c = (c << 6) | (p[i] & 0x3F);
+    }
+    source->courant += longueur;
+    return c;
+}
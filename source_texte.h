@@ -0,0 +1,47 @@
+#ifndef SOURCE_TEXTE_H
+#define SOURCE_TEXTE_H
+
+#include <stddef.h>
+#include <wchar.h>
+
+#define TAILLE_TAMPON_LECTURE (1 << 20) // Taille du tampon utilisé quand le fichier ne peut pas être projeté en mémoire
+
+// Structure représentant un fichier texte ouvert en lecture
+// Le fichier est projeté en mémoire (mmap) quand c'est possible, sinon il est lu par gros blocs (tubes, terminaux...)
+typedef struct {
+    const unsigned char* courant;   // Prochain octet à décoder
+    const unsigned char* fin;       // Fin des octets disponibles
+    int descripteur;                // Descripteur du fichier ouvert
+    unsigned char* projection;      // Zone projetée par mmap (NULL en mode lecture par blocs)
+    size_t taille_projection;       // Taille de la zone projetée
+    unsigned char* tampon;          // Tampon du mode lecture par blocs (NULL en mode projeté)
+    size_t decalage_tampon;         // Position dans le fichier du premier octet du tampon (mode lecture par blocs)
+    int fin_fichier;                // Indique que tous les octets du fichier ont été lus
+} SourceTexte;
+
+int ouvrirSource(SourceTexte* source, const char* chemin);
+void fermerSource(SourceTexte* source);
+size_t tailleSource(const SourceTexte* source);
+size_t positionSource(const SourceTexte* source);
+int positionnerSource(SourceTexte* source, size_t position);
+int rechargerSource(SourceTexte* source);
+wint_t decoderSequenceUtf8(SourceTexte* source);
+
+/**
+ * Lit le prochain caractère de la source en décodant l'UTF-8 directement depuis les octets
+ * Remplace fgetwc : les caractères ASCII sont traités sans appel de fonction
+ *
+ * @param source Pointeur vers la source ouverte
+ * @return Le caractère lu, ou WEOF en fin de fichier ou sur une séquence UTF-8 invalide
+ */
+static inline wint_t lireCaractere(SourceTexte* source) {
+    if (source->courant >= source->fin && !rechargerSource(source)) {
+        return WEOF;
+    }
+    if (*source->courant < 0x80) {
+        return *source->courant++;
+    }
+    return decoderSequenceUtf8(source);
+}
+
+#endif
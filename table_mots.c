@@ -0,0 +1,777 @@
+#include "table_mots.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "normalisation.h"
+
+/**
+ * Calcule la valeur de hachage complète d'un mot
+ * Utilise l'algorithme DJB2, suivi d'un brassage des bits car la table n'utilise que les bits de poids faible
+ *
+ * @param mot Mot dont on veut calculer la valeur de hachage
+ * @return Valeur de hachage sur 32 bits
+ */
+uint32_t hacherMot(const wchar_t* mot) {
+    uint32_t hash = 5381;
+    int c;
+    while ((c = *mot++)) {
+        hash = ((hash << 5) + hash) + c;
+    }
+    // Finalisation de MurmurHash3
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+// Vérifie si les lettres et chiffres d'un mot se lisent de la même façon dans les deux sens, sans copier le mot :
+// deux positions avancent l'une vers l'autre en sautant les autres caractères. Le mot est déjà normalisé (casses
+// repliées, forme NFC) : les caractères sont comparés tels quels, sans dépendre de la locale
+static int estPalindromeMot(const wchar_t* mot, size_t longueur) {
+    size_t debut = 0, fin = longueur;
+    int compares = 0;
+    for (;;) {
+        while (debut < fin && !estAlphanumerique(mot[debut])) debut++;
+        while (fin > debut && !estAlphanumerique(mot[fin - 1])) fin--;
+        if (fin - debut <= 1) {
+            return compares || fin > debut; // Au moins une lettre ou un chiffre
+        }
+        if (mot[debut] != mot[fin - 1]) {
+            return 0;
+        }
+        compares = 1;
+        debut++;
+        fin--;
+    }
+}
+
+/**
+ * Calcule les attributs d'un mot (voir AttributMot) en un seul parcours, sans allocation
+ * Les attributs tirés du texte d'origine (ATTRIBUTS_TEXTE) ne peuvent pas être calculés sur le mot normalisé
+ *
+ * @param mot Texte du mot
+ * @param longueur Longueur du mot
+ * @return Attributs du mot (un bit par AttributMot)
+ */
+uint16_t calculerAttributs(const wchar_t* mot, size_t longueur) {
+    uint16_t attributs = 0;
+    int chiffres = longueur > 0;
+    for (size_t i = 0; i < longueur; i++) {
+        if (mot[i] < L'0' || mot[i] > L'9') {
+            chiffres = 0;
+        }
+        if (mot[i] == L'-') {
+            attributs |= 1u << ATTRIBUT_COMPOSE;
+        } else if (mot[i] == L'\'') {
+            attributs |= 1u << ATTRIBUT_ELISION;
+        }
+    }
+    if (chiffres) {
+        attributs |= 1u << ATTRIBUT_NUMERIQUE;
+    }
+    if (longueur > 2 && mot[longueur - 1] == L'r' && (mot[longueur - 2] == L'e' || mot[longueur - 2] == L'i')) {
+        attributs |= 1u << ATTRIBUT_VERBE;
+    }
+    if (longueur > 2 && estPalindromeMot(mot, longueur)) {
+        attributs |= 1u << ATTRIBUT_PALINDROME;
+    }
+    if (longueur <= LONGUEUR_MOT_COURT) {
+        attributs |= 1u << ATTRIBUT_COURT;
+    }
+    if (longueur >= LONGUEUR_MOT_LONG) {
+        attributs |= 1u << ATTRIBUT_LONG;
+    }
+    return attributs;
+}
+
+/**
+ * Initialise une table de mots vide (aucune allocation avant la première insertion)
+ *
+ * @param table Pointeur vers la table à initialiser
+ */
+void initialiserTableMots(TableMots* table) {
+    memset(table, 0, sizeof(TableMots));
+}
+
+/**
+ * Libère les cases, les mots et l'arène des textes d'une table, qui redevient vide
+ *
+ * @param table Pointeur vers la table à libérer
+ */
+void libererTableMots(TableMots* table) {
+    free(table->cases);
+    free(table->mots);
+    free(table->textes);
+    for (int a = 0; a < NB_ATTRIBUTS; a++) {
+        free(table->membres[a]);
+    }
+    initialiserTableMots(table);
+}
+
+/**
+ * Vide une table sans rendre sa mémoire, pour la réutiliser sur un autre texte
+ * Les cases, le tableau des mots, l'arène et les listes d'attributs gardent leur capacité : les insertions suivantes ne font
+ * plus d'allocation tant que le nouveau vocabulaire n'est pas plus grand que l'ancien
+ *
+ * @param table Pointeur vers la table à vider
+ */
+void viderTableMots(TableMots* table) {
+    if (table->cases != NULL) {
+        memset(table->cases, 0, table->capacite * sizeof(CaseMot));
+    }
+    table->nb_mots = 0;
+    table->taille_textes = 0;
+    memset(table->nb_membres, 0, sizeof(table->nb_membres));
+}
+
+// Agrandit les listes des attributs donnés pour qu'elles puissent recevoir un mot de plus
+static int reserverMembres(TableMots* table, uint16_t attributs) {
+    for (int a = 0; a < NB_ATTRIBUTS; a++) {
+        if (((attributs >> a) & 1) == 0 || table->nb_membres[a] < table->capacite_membres[a]) {
+            continue;
+        }
+        size_t capacite = table->capacite_membres[a] ? table->capacite_membres[a] * 2 : CAPACITE_MEMBRES_INITIALE;
+        uint32_t* membres = realloc(table->membres[a], capacite * sizeof(uint32_t));
+        if (membres == NULL) {
+            return -1;
+        }
+        table->membres[a] = membres;
+        table->capacite_membres[a] = capacite;
+    }
+    return 0;
+}
+
+// Range un mot dans les listes de ses attributs (la place doit avoir été réservée par reserverMembres)
+static void indexerAttributs(TableMots* table, uint32_t indice) {
+    uint16_t attributs = table->mots[indice].attributs;
+    for (int a = 0; a < NB_ATTRIBUTS; a++) {
+        if ((attributs >> a) & 1) {
+            table->membres[a][table->nb_membres[a]++] = indice;
+        }
+    }
+}
+
+// Distance entre une case et la case idéale du mot qu'elle contient
+static inline size_t distanceCase(const TableMots* table, size_t position, uint32_t hachage) {
+    return (position - (hachage & (table->capacite - 1))) & (table->capacite - 1);
+}
+
+// Range une case en déplaçant les mots plus proches de leur case idéale (Robin Hood)
+static void placerCase(TableMots* table, CaseMot entree) {
+    size_t masque = table->capacite - 1;
+    size_t position = entree.hachage & masque;
+    size_t distance = 0;
+    for (;;) {
+        CaseMot* courante = &table->cases[position];
+        if (courante->indice == 0) {
+            *courante = entree;
+            return;
+        }
+        size_t distance_courante = distanceCase(table, position, courante->hachage);
+        if (distance_courante < distance) {
+            CaseMot deplacee = *courante;
+            *courante = entree;
+            entree = deplacee;
+            distance = distance_courante;
+        }
+        position = (position + 1) & masque;
+        distance++;
+    }
+}
+
+// Double le nombre de cases et y replace tous les mots (les hachages conservés évitent de les recalculer)
+static int agrandirCases(TableMots* table) {
+    size_t ancienne_capacite = table->capacite;
+    CaseMot* anciennes = table->cases;
+    size_t capacite = ancienne_capacite ? ancienne_capacite * 2 : CAPACITE_TABLE_INITIALE;
+    CaseMot* cases = calloc(capacite, sizeof(CaseMot));
+    if (cases == NULL) {
+        return -1;
+    }
+    table->cases = cases;
+    table->capacite = capacite;
+    for (size_t i = 0; i < ancienne_capacite; i++) {
+        if (anciennes[i].indice != 0) {
+            placerCase(table, anciennes[i]);
+        }
+    }
+    free(anciennes);
+    return 0;
+}
+
+/**
+ * Recherche un mot dont le hachage et la longueur sont déjà connus (par exemple lus dans les cases d'une autre table)
+ *
+ * @param table Pointeur vers la table
+ * @param mot Mot recherché
+ * @param longueur Longueur du mot
+ * @param hachage Valeur de hacherMot(mot)
+ * @return Pointeur vers le mot (valable jusqu'à la prochaine insertion), ou NULL s'il est absent
+ */
+Mot* chercherMotHache(const TableMots* table, const wchar_t* mot, size_t longueur, uint32_t hachage) {
+    if (table->capacite == 0) {
+        return NULL;
+    }
+    size_t masque = table->capacite - 1;
+    size_t position = hachage & masque;
+    for (size_t distance = 0;; distance++) {
+        const CaseMot* courante = &table->cases[position];
+        // Robin Hood : le mot serait rangé avant une case libre ou un mot plus proche de sa case idéale
+        if (courante->indice == 0 || distanceCase(table, position, courante->hachage) < distance) {
+            return NULL;
+        }
+        if (courante->hachage == hachage) {
+            Mot* candidat = &table->mots[courante->indice - 1];
+            if ((size_t)candidat->longueur == longueur &&
+                wmemcmp(texteMot(table, candidat), mot, longueur) == 0) {
+                return candidat;
+            }
+        }
+        position = (position + 1) & masque;
+    }
+}
+
+/**
+ * Recherche un mot dans la table
+ *
+ * @param table Pointeur vers la table
+ * @param mot Mot recherché
+ * @return Pointeur vers le mot (valable jusqu'à la prochaine insertion), ou NULL s'il est absent
+ */
+Mot* chercherMot(const TableMots* table, const wchar_t* mot) {
+    return chercherMotHache(table, mot, wcslen(mot), hacherMot(mot));
+}
+
+/**
+ * Recherche un mot et l'ajoute s'il est absent (fréquence 0, longueur calculée, autres champs à zéro)
+ * Le texte d'un nouveau mot est copié dans l'arène, sans limite de longueur
+ * La table est agrandie pour que le taux de remplissage des cases reste inférieur à 7/8
+ *
+ * @param table Pointeur vers la table
+ * @param mot Mot à rechercher ou à ajouter
+ * @param attributs_texte Attributs tirés du texte d'origine (parmi ATTRIBUTS_TEXTE), gardés si le mot est nouveau
+ * @param nouveau Reçoit 1 si le mot vient d'être ajouté, 0 s'il existait déjà
+ * @return Pointeur vers le mot (valable jusqu'à la prochaine insertion), ou NULL si la mémoire manque ou si la table
+ *         est pleine (UINT32_MAX - 1 mots)
+ */
+Mot* insererMot(TableMots* table, const wchar_t* mot, uint16_t attributs_texte, int* nouveau) {
+    return insererMotHache(table, mot, wcslen(mot), hacherMot(mot), attributs_texte, nouveau);
+}
+
+/**
+ * Recherche un mot dont le hachage et la longueur sont déjà connus, et l'ajoute s'il est absent (voir insererMot)
+ * Évite de recalculer le hachage des mots recopiés depuis une autre table
+ *
+ * @param table Pointeur vers la table
+ * @param mot Mot à rechercher ou à ajouter (terminé par un zéro)
+ * @param longueur Longueur du mot
+ * @param hachage Valeur de hacherMot(mot)
+ * @param attributs_texte Attributs tirés du texte d'origine (parmi ATTRIBUTS_TEXTE), gardés si le mot est nouveau
+ * @param nouveau Reçoit 1 si le mot vient d'être ajouté, 0 s'il existait déjà
+ * @return Pointeur vers le mot (valable jusqu'à la prochaine insertion), ou NULL si la mémoire manque ou si la table
+ *         est pleine
+ */
+Mot* insererMotHache(TableMots* table, const wchar_t* mot, size_t longueur, uint32_t hachage,
+                     uint16_t attributs_texte, int* nouveau) {
+    Mot* existant = chercherMotHache(table, mot, longueur, hachage);
+    *nouveau = 0;
+    if (existant != NULL) {
+        return existant;
+    }
+
+    uint16_t attributs = calculerAttributs(mot, longueur) | (attributs_texte & ATTRIBUTS_TEXTE);
+    if (table->nb_mots >= UINT32_MAX - 1 || reserverMembres(table, attributs) != 0 ||
+        ((table->nb_mots + 1) * 8 > table->capacite * 7 && agrandirCases(table) != 0)) {
+        return NULL;
+    }
+    if (table->nb_mots == table->capacite_mots) {
+        size_t capacite = table->capacite_mots ? table->capacite_mots * 2 : CAPACITE_TABLE_INITIALE;
+        Mot* mots = realloc(table->mots, capacite * sizeof(Mot));
+        if (mots == NULL) {
+            return NULL;
+        }
+        table->mots = mots;
+        table->capacite_mots = capacite;
+    }
+
+    if (table->taille_textes + longueur + 1 > table->capacite_textes) {
+        size_t capacite = table->capacite_textes ? table->capacite_textes * 2 : CAPACITE_TEXTES_INITIALE;
+        while (capacite < table->taille_textes + longueur + 1) {
+            capacite *= 2;
+        }
+        wchar_t* textes = realloc(table->textes, capacite * sizeof(wchar_t));
+        if (textes == NULL) {
+            return NULL;
+        }
+        table->textes = textes;
+        table->capacite_textes = capacite;
+    }
+
+    Mot* entree = &table->mots[table->nb_mots];
+    memset(entree, 0, sizeof(Mot));
+    entree->decalage = table->taille_textes;
+    entree->longueur = (int)longueur;
+    entree->attributs = attributs;
+    wmemcpy(table->textes + table->taille_textes, mot, longueur + 1);
+    table->taille_textes += longueur + 1;
+    indexerAttributs(table, (uint32_t)table->nb_mots);
+    table->nb_mots++;
+    placerCase(table, (CaseMot){hachage, (uint32_t)table->nb_mots});
+    *nouveau = 1;
+    return entree;
+}
+
+// Agrandit un tableau de la table si sa capacité est insuffisante (le contenu n'est pas conservé)
+static int reserverTableau(void** tableau, size_t* capacite, size_t n, size_t taille_element) {
+    if (n <= *capacite) {
+        return 0;
+    }
+    void* nouveau = malloc(n * taille_element);
+    if (nouveau == NULL) {
+        return -1;
+    }
+    free(*tableau);
+    *tableau = nouveau;
+    *capacite = n;
+    return 0;
+}
+
+/**
+ * Remplace le contenu d'une table par des cases, des mots et des textes enregistrés (cache d'analyse)
+ * Les tableaux sont copiés tels quels, sans recalculer les hachages. Ils sont d'abord vérifiés, pour
+ * qu'un enregistrement corrompu ne puisse pas provoquer d'accès en dehors des tableaux
+ *
+ * @param table Pointeur vers la table à remplir (sa mémoire est réutilisée si elle suffit)
+ * @param cases Cases enregistrées
+ * @param capacite Nombre de cases (puissance de 2, ou 0 pour une table vide)
+ * @param mots Mots enregistrés, dans l'ordre d'insertion
+ * @param nb_mots Nombre de mots
+ * @param textes Arène des textes enregistrée
+ * @param taille_textes Nombre de caractères de l'arène
+ * @return 0 en cas de succès, -1 si les données sont incohérentes ou si la mémoire manque (la table est alors vidée)
+ */
+int restaurerTableMots(TableMots* table, const CaseMot* cases, size_t capacite, const Mot* mots, size_t nb_mots,
+                       const wchar_t* textes, size_t taille_textes) {
+    viderTableMots(table);
+    if ((capacite & (capacite - 1)) != 0 || nb_mots * 8 > capacite * 7 || nb_mots > UINT32_MAX - 1) {
+        return -1;
+    }
+    size_t occupees = 0;
+    for (size_t i = 0; i < capacite; i++) {
+        if (cases[i].indice > nb_mots) {
+            return -1;
+        }
+        occupees += cases[i].indice != 0;
+    }
+    if (occupees != nb_mots) {
+        return -1;
+    }
+    for (size_t i = 0; i < nb_mots; i++) {
+        if (mots[i].longueur < 0 || mots[i].frequence < 0 || (mots[i].attributs >> NB_ATTRIBUTS) != 0 ||
+            mots[i].decalage >= taille_textes ||
+            (uint64_t)mots[i].longueur >= taille_textes - mots[i].decalage ||
+            textes[mots[i].decalage + (size_t)mots[i].longueur] != L'\0') {
+            return -1;
+        }
+    }
+    if (capacite == 0) {
+        return 0;
+    }
+
+    // Les cases sont réallouées si leur nombre change, car il détermine la position des mots
+    if (capacite != table->capacite) {
+        CaseMot* nouvelles = malloc(capacite * sizeof(CaseMot));
+        if (nouvelles == NULL) {
+            return -1;
+        }
+        free(table->cases);
+        table->cases = nouvelles;
+        table->capacite = capacite;
+    }
+    if (reserverTableau((void**)&table->mots, &table->capacite_mots, nb_mots, sizeof(Mot)) != 0 ||
+        reserverTableau((void**)&table->textes, &table->capacite_textes, taille_textes, sizeof(wchar_t)) != 0) {
+        memset(table->cases, 0, table->capacite * sizeof(CaseMot));
+        return -1;
+    }
+    memcpy(table->cases, cases, capacite * sizeof(CaseMot));
+    memcpy(table->mots, mots, nb_mots * sizeof(Mot));
+    wmemcpy(table->textes, textes, taille_textes);
+    table->nb_mots = nb_mots;
+    table->taille_textes = taille_textes;
+
+    // Les listes d'attributs ne sont pas enregistrées : elles sont reconstruites à partir des bits des mots
+    for (size_t i = 0; i < nb_mots; i++) {
+        if (reserverMembres(table, table->mots[i].attributs) != 0) {
+            viderTableMots(table);
+            return -1;
+        }
+        indexerAttributs(table, (uint32_t)i);
+    }
+    return 0;
+}
+
+// Ordre de tri des mots : clé (croissante ou décroissante), puis texte pour départager les égalités
+typedef struct {
+    const TableMots* table;
+    CleTriMots cle;
+    int decroissant;
+} OrdreMots;
+
+// Compare deux mots de la table désignés par leur indice (aucune égalité possible : les textes sont uniques)
+static int comparerMots(const OrdreMots* ordre, uint32_t a, uint32_t b) {
+    const Mot* mot_a = &ordre->table->mots[a];
+    const Mot* mot_b = &ordre->table->mots[b];
+    long long cle_a = 0, cle_b = 0;
+    if (ordre->cle == TRI_FREQUENCE) {
+        cle_a = mot_a->frequence;
+        cle_b = mot_b->frequence;
+    } else if (ordre->cle == TRI_LONGUEUR) {
+        cle_a = mot_a->longueur;
+        cle_b = mot_b->longueur;
+    }
+    if (cle_a != cle_b) {
+        int croissant = cle_a < cle_b ? -1 : 1;
+        return ordre->decroissant ? -croissant : croissant;
+    }
+    int texte = wcscmp(texteMot(ordre->table, mot_a), texteMot(ordre->table, mot_b));
+    return ordre->cle == TRI_TEXTE && ordre->decroissant ? -texte : texte;
+}
+
+// Fusionne deux suites triées consécutives de source dans destination
+static void fusionnerSuites(const OrdreMots* ordre, const uint32_t* source, size_t milieu, size_t n,
+                            uint32_t* destination) {
+    size_t i = 0, j = milieu, k = 0;
+    while (i < milieu && j < n) {
+        destination[k++] = comparerMots(ordre, source[j], source[i]) < 0 ? source[j++] : source[i++];
+    }
+    while (i < milieu) destination[k++] = source[i++];
+    while (j < n) destination[k++] = source[j++];
+}
+
+// Tri fusion récursif (tri par insertion pour les petites suites) ; tampon doit pouvoir contenir n indices
+static void trierFusion(const OrdreMots* ordre, uint32_t* indices, uint32_t* tampon, size_t n) {
+    if (n <= 16) {
+        for (size_t i = 1; i < n; i++) {
+            uint32_t courant = indices[i];
+            size_t j = i;
+            while (j > 0 && comparerMots(ordre, courant, indices[j - 1]) < 0) {
+                indices[j] = indices[j - 1];
+                j--;
+            }
+            indices[j] = courant;
+        }
+        return;
+    }
+    size_t milieu = n / 2;
+    trierFusion(ordre, indices, tampon, milieu);
+    trierFusion(ordre, indices + milieu, tampon + milieu, n - milieu);
+    if (comparerMots(ordre, indices[milieu - 1], indices[milieu]) <= 0) {
+        return; // Les deux moitiés sont déjà dans l'ordre
+    }
+    memcpy(tampon, indices, n * sizeof(uint32_t));
+    fusionnerSuites(ordre, tampon, milieu, n, indices);
+}
+
+// Tri ou fusion d'une portion du tableau d'indices, exécuté par un thread
+typedef struct {
+    const OrdreMots* ordre;
+    uint32_t* indices;
+    uint32_t* tampon;
+    size_t milieu;          // 0 : trier la portion ; sinon fusionner les suites [0, milieu) et [milieu, n)
+    size_t n;
+    int thread_lance;
+    pthread_t thread;
+} TacheTri;
+
+static void* executerTacheTri(void* argument) {
+    TacheTri* tache = argument;
+    if (tache->milieu == 0) {
+        trierFusion(tache->ordre, tache->indices, tache->tampon, tache->n);
+    } else {
+        memcpy(tache->tampon, tache->indices, tache->n * sizeof(uint32_t));
+        fusionnerSuites(tache->ordre, tache->tampon, tache->milieu, tache->n, tache->indices);
+    }
+    return NULL;
+}
+
+// Lance les tâches dans des threads (ou directement si la création échoue) et attend leur fin
+static void executerTachesTri(TacheTri* taches, int nb_taches) {
+    for (int i = 0; i < nb_taches; i++) {
+        taches[i].thread_lance = pthread_create(&taches[i].thread, NULL, executerTacheTri, &taches[i]) == 0;
+        if (!taches[i].thread_lance) {
+            executerTacheTri(&taches[i]);
+        }
+    }
+    for (int i = 0; i < nb_taches; i++) {
+        if (taches[i].thread_lance) {
+            pthread_join(taches[i].thread, NULL);
+        }
+    }
+}
+
+/**
+ * Trie les mots d'une table par fréquence, les égalités étant départagées par l'ordre des textes
+ * L'ordre obtenu ne dépend ni de l'ordre d'insertion ni du nombre de threads.
+ * Au-delà de SEUIL_TRI_PARALLELE mots, chaque thread trie une portion du tableau, puis les portions
+ * sont fusionnées deux à deux en parallèle.
+ *
+ * @param table Table dont on veut trier les mots
+ * @param decroissant 0 pour les fréquences croissantes, 1 pour les fréquences décroissantes
+ * @param nb_threads Nombre de threads à utiliser (0 pour un thread par processeur)
+ * @return Tableau de table->nb_mots indices dans table->mots (à libérer par l'appelant), ou NULL si la mémoire manque
+ */
+uint32_t* trierMots(const TableMots* table, int decroissant, int nb_threads) {
+    return trierMotsSelon(table, TRI_FREQUENCE, decroissant, nb_threads);
+}
+
+/**
+ * Trie les mots d'une table selon une clé : fréquence, texte ou longueur
+ * Les égalités de fréquence ou de longueur sont départagées par l'ordre croissant des textes ;
+ * le tri est réparti entre plusieurs threads comme pour trierMots.
+ *
+ * @param table Table dont on veut trier les mots
+ * @param cle Clé de tri
+ * @param decroissant 0 pour l'ordre croissant de la clé, 1 pour l'ordre décroissant
+ * @param nb_threads Nombre de threads à utiliser (0 pour un thread par processeur)
+ * @return Tableau de table->nb_mots indices dans table->mots (à libérer par l'appelant), ou NULL si la mémoire manque
+ */
+uint32_t* trierMotsSelon(const TableMots* table, CleTriMots cle, int decroissant, int nb_threads) {
+    size_t n = table->nb_mots;
+    uint32_t* indices = malloc((n ? n : 1) * sizeof(uint32_t));
+    uint32_t* tampon = malloc((n ? n : 1) * sizeof(uint32_t));
+    if (indices == NULL || tampon == NULL) {
+        free(indices);
+        free(tampon);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) {
+        indices[i] = (uint32_t)i;
+    }
+    OrdreMots ordre = {table, cle, decroissant};
+
+    if (nb_threads <= 0) {
+        long processeurs = sysconf(_SC_NPROCESSORS_ONLN);
+        nb_threads = processeurs > 0 ? (int)processeurs : 1;
+    }
+    if ((size_t)nb_threads > n / 1024) {
+        nb_threads = (int)(n / 1024); // Portions d'au moins 1024 mots
+    }
+    TacheTri* taches = NULL;
+    if (n >= SEUIL_TRI_PARALLELE && nb_threads > 1) {
+        taches = calloc(nb_threads, sizeof(TacheTri));
+    }
+    if (taches == NULL) {
+        trierFusion(&ordre, indices, tampon, n);
+        free(tampon);
+        return indices;
+    }
+
+    // Portion k : [k * n / nb_threads, (k + 1) * n / nb_threads)
+    for (int k = 0; k < nb_threads; k++) {
+        size_t debut = n * k / nb_threads;
+        taches[k] = (TacheTri){&ordre, indices + debut, tampon + debut, 0, n * (k + 1) / nb_threads - debut, 0, 0};
+    }
+    executerTachesTri(taches, nb_threads);
+
+    for (int pas = 1; pas < nb_threads; pas *= 2) {
+        int nb_fusions = 0;
+        for (int k = 0; k + pas < nb_threads; k += 2 * pas) {
+            size_t debut = n * k / nb_threads;
+            size_t milieu = n * (k + pas) / nb_threads;
+            int fin = k + 2 * pas < nb_threads ? k + 2 * pas : nb_threads;
+            size_t n_fusion = n * fin / nb_threads - debut;
+            taches[nb_fusions++] = (TacheTri){&ordre, indices + debut, tampon + debut, milieu - debut, n_fusion, 0, 0};
+        }
+        executerTachesTri(taches, nb_fusions);
+    }
+    free(taches);
+    free(tampon);
+    return indices;
+}
+
+// Indique si un mot appartient à une catégorie
+static int estDansCategorie(const Mot* mot, CategorieMots categorie, int longueur) {
+    switch (categorie) {
+        case CATEGORIE_VERBES:
+            return aAttribut(mot, ATTRIBUT_VERBE);
+        case CATEGORIE_NOMS_PROPRES:
+            return aAttribut(mot, ATTRIBUT_NOM_PROPRE);
+        case CATEGORIE_LONGUEUR:
+            return mot->longueur == longueur;
+        default:
+            return 1;
+    }
+}
+
+// Fait descendre un indice dans le tas : chaque parent est classé après ses enfants, la racine est le moins bon mot
+static void tamiserTas(const OrdreMots* ordre, uint32_t* tas, size_t taille, size_t position) {
+    for (;;) {
+        size_t pire = position;
+        size_t gauche = 2 * position + 1;
+        size_t droite = gauche + 1;
+        if (gauche < taille && comparerMots(ordre, tas[gauche], tas[pire]) > 0) pire = gauche;
+        if (droite < taille && comparerMots(ordre, tas[droite], tas[pire]) > 0) pire = droite;
+        if (pire == position) {
+            return;
+        }
+        uint32_t echange = tas[position];
+        tas[position] = tas[pire];
+        tas[pire] = echange;
+        position = pire;
+    }
+}
+
+/**
+ * Recherche les k mots les plus fréquents d'une catégorie, en un seul parcours de la table
+ * Un tas borné de k indices, construit directement dans resultat, garde les meilleurs mots rencontrés :
+ * aucune copie du vocabulaire n'est faite et le coût est en O(n log k).
+ *
+ * @param table Table des mots
+ * @param k Nombre maximal de mots à retenir
+ * @param categorie Catégorie des mots retenus
+ * @param longueur Longueur des mots retenus (pour CATEGORIE_LONGUEUR uniquement)
+ * @param resultat Tableau d'au moins k indices, rempli par fréquence décroissante (égalités dans l'ordre des textes)
+ * @return Nombre de mots trouvés (au plus k)
+ */
+size_t meilleursMots(const TableMots* table, size_t k, CategorieMots categorie, int longueur, uint32_t* resultat) {
+    OrdreMots ordre = {table, TRI_FREQUENCE, 1};
+    size_t taille = 0;
+    if (k == 0) {
+        return 0;
+    }
+
+    // Les verbes et les noms propres sont pris dans la liste de leur attribut, sans parcourir tout le vocabulaire
+    const uint32_t* candidats = NULL;
+    size_t nb_candidats = table->nb_mots;
+    if (categorie == CATEGORIE_VERBES) {
+        candidats = membresAttribut(table, ATTRIBUT_VERBE, &nb_candidats);
+    } else if (categorie == CATEGORIE_NOMS_PROPRES) {
+        candidats = membresAttribut(table, ATTRIBUT_NOM_PROPRE, &nb_candidats);
+    }
+
+    for (size_t c = 0; c < nb_candidats; c++) {
+        uint32_t i = candidats != NULL ? candidats[c] : (uint32_t)c;
+        if (candidats == NULL && !estDansCategorie(&table->mots[i], categorie, longueur)) {
+            continue;
+        }
+        if (taille < k) {
+            // Remontée du nouvel indice tant qu'il est classé après son parent
+            size_t position = taille++;
+            while (position > 0 && comparerMots(&ordre, i, resultat[(position - 1) / 2]) > 0) {
+                resultat[position] = resultat[(position - 1) / 2];
+                position = (position - 1) / 2;
+            }
+            resultat[position] = i;
+        } else if (comparerMots(&ordre, i, resultat[0]) < 0) {
+            resultat[0] = i;
+            tamiserTas(&ordre, resultat, taille, 0);
+        }
+    }
+
+    // Tri par tas : le moins bon mot est placé à la fin, puis le tas se réduit d'une case
+    for (size_t fin = taille; fin > 1; fin--) {
+        uint32_t echange = resultat[0];
+        resultat[0] = resultat[fin - 1];
+        resultat[fin - 1] = echange;
+        tamiserTas(&ordre, resultat, fin - 1, 0);
+    }
+    return taille;
+}
+
+// Somme des carrés des fréquences d'une table (carré de la norme de son vecteur de fréquences)
+static double normeCarreeFrequences(const TableMots* table) {
+    double somme = 0.0;
+    for (size_t i = 0; i < table->nb_mots; i++) {
+        double frequence = (double)table->mots[i].frequence;
+        somme += frequence * frequence;
+    }
+    return somme;
+}
+
+/**
+ * Mesure la similarité des vocabulaires de deux textes : mots communs et propres à chacun, indices de Jaccard
+ * et de recouvrement sur les ensembles de mots, cosinus sur les vecteurs de fréquences
+ * Les mots du plus petit vocabulaire sont cherchés dans l'autre table avec le hachage rangé dans leur case :
+ * le calcul est linéaire, sans tri ni recalcul des hachages
+ *
+ * @param a Vocabulaire du premier texte
+ * @param b Vocabulaire du second texte
+ * @param similarite Reçoit les mesures
+ */
+void comparerVocabulaires(const TableMots* a, const TableMots* b, SimilariteVocabulaires* similarite) {
+    const TableMots* petite = a->nb_mots <= b->nb_mots ? a : b;
+    const TableMots* grande = petite == a ? b : a;
+    size_t communs = 0;
+    double produit = 0.0;
+
+    for (size_t c = 0; c < petite->capacite; c++) {
+        CaseMot case_mot = petite->cases[c];
+        if (case_mot.indice == 0) {
+            continue;
+        }
+        const Mot* mot = &petite->mots[case_mot.indice - 1];
+        const Mot* autre = chercherMotHache(grande, texteMot(petite, mot), (size_t)mot->longueur, case_mot.hachage);
+        if (autre != NULL) {
+            communs++;
+            produit += (double)mot->frequence * (double)autre->frequence;
+        }
+    }
+
+    memset(similarite, 0, sizeof(SimilariteVocabulaires));
+    similarite->mots_communs = communs;
+    similarite->mots_propres_a = a->nb_mots - communs;
+    similarite->mots_propres_b = b->nb_mots - communs;
+    if (petite->nb_mots == 0) {
+        return;
+    }
+    similarite->jaccard = (double)communs / (double)(a->nb_mots + b->nb_mots - communs);
+    similarite->recouvrement = (double)communs / (double)petite->nb_mots;
+    double normes = sqrt(normeCarreeFrequences(a)) * sqrt(normeCarreeFrequences(b));
+    similarite->cosinus = normes > 0.0 ? fmin(produit / normes, 1.0) : 0.0; // fmin : arrondis des textes identiques
+}
+
+/**
+ * Relève l'état de la table de hachage : remplissage des cases, distances de sondage et mémoire allouée
+ * Parcourt toutes les cases : à appeler pour un diagnostic, pas pendant une analyse
+ *
+ * @param table Pointeur vers la table
+ * @param sante Reçoit les mesures
+ */
+void mesurerTableMots(const TableMots* table, SanteTableMots* sante) {
+    memset(sante, 0, sizeof(SanteTableMots));
+    sante->capacite = table->capacite;
+    uint64_t somme_distances = 0;
+    for (size_t i = 0; i < table->capacite; i++) {
+        if (table->cases[i].indice == 0) {
+            continue;
+        }
+        size_t distance = distanceCase(table, i, table->cases[i].hachage);
+        sante->cases_occupees++;
+        somme_distances += distance;
+        if (distance > sante->sondage_max) sante->sondage_max = distance;
+    }
+    if (table->capacite > 0) {
+        sante->taux_remplissage = (double)sante->cases_occupees / (double)table->capacite;
+    }
+    if (sante->cases_occupees > 0) {
+        sante->sondage_moyen = (double)somme_distances / (double)sante->cases_occupees;
+    }
+
+    sante->memoire_cases = table->capacite * sizeof(CaseMot);
+    sante->memoire_mots = table->capacite_mots * sizeof(Mot);
+    sante->memoire_textes = table->capacite_textes * sizeof(wchar_t);
+    for (int a = 0; a < NB_ATTRIBUTS; a++) {
+        sante->memoire_membres += table->capacite_membres[a] * sizeof(uint32_t);
+    }
+    sante->memoire_totale = sante->memoire_cases + sante->memoire_mots + sante->memoire_textes +
+                            sante->memoire_membres;
+    if (table->nb_mots > 0) {
+        sante->octets_par_mot = (double)sante->memoire_totale / (double)table->nb_mots;
+    }
+}
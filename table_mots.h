@@ -0,0 +1,161 @@
+#ifndef TABLE_MOTS_H
+#define TABLE_MOTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#define CAPACITE_TABLE_INITIALE 1024   // Nombre de cases allouées à la première insertion (puissance de 2)
+#define CAPACITE_TEXTES_INITIALE 8192  // Nombre de caractères alloués pour les premiers textes de mots
+#define CAPACITE_MEMBRES_INITIALE 256  // Nombre d'indices alloués dans la liste d'un attribut à son premier mot
+#define SEUIL_TRI_PARALLELE 65536      // Nombre de mots à partir duquel le tri est réparti entre plusieurs threads
+
+// Attributs d'un mot, calculés une seule fois quand il entre dans une table (voir calculerAttributs)
+// Un mot en garde un bit par attribut ; la table garde la liste des mots de chaque attribut
+// ATTRIBUT_NOM_PROPRE vient du texte avant normalisation : il est fourni à insererMot par l'appelant
+typedef enum {
+    ATTRIBUT_VERBE,           // Plus de 2 caractères et terminaison en « er » ou « ir »
+    ATTRIBUT_NOM_PROPRE,      // Première occurrence commençant par une majuscule dans le texte
+    ATTRIBUT_PALINDROME,      // Plus de 2 caractères, lettres et chiffres identiques dans les deux sens
+    ATTRIBUT_NUMERIQUE,       // Uniquement des chiffres
+    ATTRIBUT_COMPOSE,         // Contient un trait d'union
+    ATTRIBUT_ELISION,         // Contient une apostrophe
+    ATTRIBUT_COURT,           // Au plus LONGUEUR_MOT_COURT caractères
+    ATTRIBUT_LONG,            // Au moins LONGUEUR_MOT_LONG caractères
+    NB_ATTRIBUTS
+} AttributMot;
+
+// Attributs tirés du texte d'origine et non du mot normalisé : ils suivent le mot quand il est recopié d'une table
+// dans une autre
+#define ATTRIBUTS_TEXTE (1u << ATTRIBUT_NOM_PROPRE)
+
+#define LONGUEUR_MOT_COURT 3    // Longueur maximale d'un mot court
+#define LONGUEUR_MOT_LONG 10    // Longueur minimale d'un mot long
+
+// Structure représentant un mot analysé
+// Le texte du mot est rangé une seule fois dans l'arène de la table (voir texteMot)
+typedef struct {
+    uint64_t decalage;        // Position du texte du mot dans l'arène des textes
+    long long frequence;      // Fréquence d'apparition du mot dans le texte
+    int longueur;             // Longueur du mot (nombre de caractères)
+    uint16_t attributs;       // Un bit par AttributMot (voir aAttribut)
+} Mot;
+
+// Catégories de mots pour la recherche des mots les plus fréquents
+typedef enum {
+    CATEGORIE_TOUS,
+    CATEGORIE_VERBES,         // Mots de ATTRIBUT_VERBE
+    CATEGORIE_NOMS_PROPRES,   // Mots de ATTRIBUT_NOM_PROPRE (première occurrence avec une majuscule initiale)
+    CATEGORIE_LONGUEUR        // Mots d'une longueur donnée
+} CategorieMots;
+
+// Clés de tri des mots (voir trierMotsSelon)
+typedef enum {
+    TRI_FREQUENCE,
+    TRI_TEXTE,
+    TRI_LONGUEUR
+} CleTriMots;
+
+// Case de la table d'adressage ouvert : hachage complet du mot et position du mot dans le tableau des mots
+typedef struct {
+    uint32_t hachage;
+    uint32_t indice;     // Position + 1 dans mots (0 : case libre) : une table contient au plus UINT32_MAX - 1 mots
+} CaseMot;
+
+// Table de hachage à adressage ouvert (Robin Hood, sondage linéaire) qui s'agrandit avec le vocabulaire
+// Les mots sont rangés à la suite dans l'ordre de leur première apparition : on les parcourt avec
+// for (size_t i = 0; i < table.nb_mots; i++) { Mot* mot = &table.mots[i]; ... }
+typedef struct {
+    CaseMot* cases;
+    size_t capacite;         // Nombre de cases (puissance de 2, 0 tant que la table est vide)
+    Mot* mots;               // Mots de la table, dans l'ordre d'insertion
+    size_t nb_mots;
+    size_t capacite_mots;
+    wchar_t* textes;         // Arène des textes : mots terminés par un zéro, mis bout à bout (repérés par leur décalage)
+    size_t taille_textes;
+    size_t capacite_textes;
+    uint32_t* membres[NB_ATTRIBUTS];        // Pour chaque attribut, indices des mots qui l'ont (ordre d'insertion)
+    size_t nb_membres[NB_ATTRIBUTS];
+    size_t capacite_membres[NB_ATTRIBUTS];
+} TableMots;
+
+// Similarité entre les vocabulaires de deux textes (voir comparerVocabulaires)
+// Les rapports valent 0 quand l'un des vocabulaires est vide
+typedef struct {
+    size_t mots_communs;      // Mots présents dans les deux vocabulaires
+    size_t mots_propres_a;    // Mots présents seulement dans le premier vocabulaire
+    size_t mots_propres_b;    // Mots présents seulement dans le second vocabulaire
+    double jaccard;           // Mots communs / mots de l'union des deux vocabulaires
+    double recouvrement;      // Mots communs / mots du plus petit vocabulaire (coefficient de recouvrement)
+    double cosinus;           // Cosinus de l'angle entre les vecteurs de fréquences des deux textes
+} SimilariteVocabulaires;
+
+// État de la table de hachage d'un vocabulaire (voir mesurerTableMots)
+typedef struct {
+    size_t capacite;          // Nombre de cases
+    size_t cases_occupees;    // Cases qui désignent un mot
+    double taux_remplissage;  // Cases occupées / cases (la table double au-delà de 7/8)
+    double sondage_moyen;     // Distance moyenne entre un mot et sa case idéale (cases lues en plus par une recherche)
+    size_t sondage_max;       // Plus grande de ces distances
+    size_t memoire_cases;     // Octets alloués aux cases
+    size_t memoire_mots;      // Octets alloués au tableau des mots
+    size_t memoire_textes;    // Octets alloués à l'arène des textes
+    size_t memoire_membres;   // Octets alloués aux listes des attributs
+    size_t memoire_totale;
+    double octets_par_mot;    // Mémoire totale / nombre de mots (0 pour une table vide)
+} SanteTableMots;
+
+uint32_t hacherMot(const wchar_t* mot);
+uint16_t calculerAttributs(const wchar_t* mot, size_t longueur);
+void initialiserTableMots(TableMots* table);
+void libererTableMots(TableMots* table);
+void viderTableMots(TableMots* table);
+Mot* chercherMot(const TableMots* table, const wchar_t* mot);
+Mot* chercherMotHache(const TableMots* table, const wchar_t* mot, size_t longueur, uint32_t hachage);
+Mot* insererMot(TableMots* table, const wchar_t* mot, uint16_t attributs_texte, int* nouveau);
+Mot* insererMotHache(TableMots* table, const wchar_t* mot, size_t longueur, uint32_t hachage,
+                     uint16_t attributs_texte, int* nouveau);
+int restaurerTableMots(TableMots* table, const CaseMot* cases, size_t capacite, const Mot* mots, size_t nb_mots,
+                       const wchar_t* textes, size_t taille_textes);
+uint32_t* trierMots(const TableMots* table, int decroissant, int nb_threads);
+uint32_t* trierMotsSelon(const TableMots* table, CleTriMots cle, int decroissant, int nb_threads);
+size_t meilleursMots(const TableMots* table, size_t k, CategorieMots categorie, int longueur, uint32_t* resultat);
+void comparerVocabulaires(const TableMots* a, const TableMots* b, SimilariteVocabulaires* similarite);
+void mesurerTableMots(const TableMots* table, SanteTableMots* sante);
+
+/**
+ * Indique si un mot a un attribut
+ *
+ * @param mot Mot de la table
+ * @param attribut Attribut recherché
+ * @return 1 si le mot a l'attribut, 0 sinon
+ */
+static inline int aAttribut(const Mot* mot, AttributMot attribut) {
+    return (mot->attributs >> attribut) & 1;
+}
+
+/**
+ * Retourne les mots d'une table qui ont un attribut, sans parcourir tout le vocabulaire
+ *
+ * @param table Table des mots
+ * @param attribut Attribut recherché
+ * @param nombre Reçoit le nombre de mots qui ont l'attribut
+ * @return Indices de ces mots dans table->mots, dans l'ordre d'insertion (valables jusqu'à la prochaine insertion)
+ */
+static inline const uint32_t* membresAttribut(const TableMots* table, AttributMot attribut, size_t* nombre) {
+    *nombre = table->nb_membres[attribut];
+    return table->membres[attribut];
+}
+
+/**
+ * Retourne le texte d'un mot de la table
+ *
+ * @param table Table contenant le mot
+ * @param mot Mot de la table
+ * @return Texte du mot terminé par un zéro (valable jusqu'à la prochaine insertion)
+ */
+static inline const wchar_t* texteMot(const TableMots* table, const Mot* mot) {
+    return table->textes + mot->decalage;
+}
+
+#endif
@@ -0,0 +1,4090 @@
+// Tables générées par outils/generer_tables_unicode.py (Unicode 14.0.0) : ne pas modifier
+#include "normalisation.h"
+
+#if LIMITE_TABLES_UNICODE != 0xE01F0 || BITS_PAGE_UNICODE != 7 || EXPANSION_NORMALISATION_MAX < 4 || \
+    UNICODE_MOT != 1 || UNICODE_MAJUSCULE != 2
+#error "normalisation.h ne correspond pas aux tables générées"
+#endif
+
+const uint16_t pages_unicode[7172] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 34, 35, 36, 37, 38, 39, 34, 34, 34, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 34, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 66, 66, 66, 66, 69, 70,
+    66, 66, 66, 66, 66, 71, 66, 66, 72, 73, 74, 75, 76, 66, 66, 66,
+    77, 78, 79, 80, 81, 82, 66, 66, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 83, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 84, 34, 34, 85, 86, 87, 88,
+    89, 90, 91, 92, 93, 94, 95, 96, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 97,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 98, 99, 100, 101, 102, 103, 34, 34, 104, 105, 106, 107, 108, 109,
+    110, 111, 112, 113, 66, 114, 115, 116, 117, 118, 119, 120, 34, 34, 121, 122,
+    123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 66, 134, 135, 136, 137,
+    138, 139, 140, 141, 142, 143, 144, 66, 145, 146, 66, 147, 148, 149, 150, 66,
+    151, 152, 153, 154, 155, 156, 66, 66, 157, 158, 159, 160, 66, 161, 66, 162,
+    34, 34, 34, 34, 34, 34, 34, 163, 164, 34, 165, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 166,
+    34, 34, 34, 34, 34, 34, 34, 34, 167, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 34, 34, 34, 34, 168, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    34, 34, 34, 34, 169, 170, 171, 172, 66, 66, 66, 66, 173, 174, 175, 176,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 177,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 178, 179, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 180,
+    34, 34, 181, 34, 34, 182, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 183, 184, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 185, 66,
+    66, 66, 186, 187, 188, 189, 190, 66, 191, 192, 193, 194, 195, 196, 197, 198,
+    66, 66, 66, 66, 199, 200, 66, 66, 66, 66, 66, 66, 66, 66, 201, 66,
+    202, 66, 203, 66, 66, 204, 66, 66, 66, 66, 66, 66, 66, 66, 66, 205,
+    34, 206, 207, 66, 66, 66, 66, 66, 208, 209, 210, 66, 211, 212, 66, 66,
+    66, 66, 213, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 214, 66, 66, 66, 66, 66, 66, 66, 66,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 215, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 216, 34,
+    217, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 218, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 219, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    220, 221, 222, 223, 224, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 225, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 34, 226,
+};
+
+const uint16_t blocs_unicode[227][128] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 2, 3, 4, 0,
+        0, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+        20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 0, 0, 0, 0, 0,
+        0, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+        46, 1, 47, 48, 49, 50, 51, 52, 53, 54, 55, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 1, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 0, 57, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0,
+        58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+        74, 75, 76, 77, 78, 79, 80, 0, 81, 82, 83, 84, 85, 86, 87, 1,
+        88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+        1, 104, 105, 106, 107, 108, 109, 0, 110, 111, 112, 113, 114, 115, 1, 116,
+    },
+    {
+        117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+        133, 1, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+        148, 149, 150, 151, 152, 153, 154, 1, 155, 156, 157, 158, 159, 160, 161, 162,
+        163, 1, 164, 1, 165, 166, 167, 168, 1, 169, 170, 171, 172, 173, 174, 175,
+        1, 176, 1, 177, 178, 179, 180, 181, 182, 1, 183, 1, 184, 185, 186, 187,
+        188, 189, 190, 1, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 1, 210, 211, 212, 213, 214, 215, 216, 217,
+        218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233,
+    },
+    {
+        1, 234, 235, 1, 236, 1, 237, 238, 1, 239, 240, 241, 1, 1, 242, 243,
+        244, 245, 1, 246, 247, 1, 248, 249, 250, 1, 1, 1, 251, 252, 1, 253,
+        254, 255, 256, 1, 257, 1, 258, 259, 1, 260, 1, 1, 261, 1, 262, 263,
+        264, 265, 266, 267, 1, 268, 1, 269, 270, 1, 1, 1, 271, 1, 1, 1,
+        1, 1, 1, 1, 272, 272, 1, 273, 273, 1, 274, 274, 1, 275, 276, 277,
+        278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 1, 291, 292,
+        293, 294, 295, 296, 297, 1, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+        308, 309, 309, 1, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    },
+    {
+        322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+        338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 1, 351, 352,
+        353, 1, 354, 1, 355, 1, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+        366, 367, 368, 369, 1, 1, 1, 1, 1, 1, 370, 371, 1, 372, 373, 1,
+        1, 374, 1, 375, 376, 377, 378, 1, 379, 1, 380, 1, 381, 1, 382, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 383, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 385, 386, 386, 386, 386, 385, 387, 386, 386, 386, 386,
+        386, 388, 388, 386, 386, 386, 386, 388, 388, 386, 386, 386, 386, 386, 386, 386,
+        386, 386, 386, 386, 389, 389, 389, 389, 389, 386, 386, 386, 386, 384, 384, 384,
+        390, 391, 384, 392, 393, 394, 384, 386, 386, 386, 384, 384, 384, 386, 386, 1,
+        384, 384, 384, 386, 386, 386, 386, 384, 385, 386, 386, 384, 395, 396, 396, 395,
+        396, 396, 395, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+        397, 1, 398, 1, 399, 0, 400, 1, 0, 0, 1, 1, 1, 1, 401, 402,
+    },
+    {
+        0, 0, 0, 0, 0, 403, 404, 405, 406, 407, 408, 0, 409, 0, 410, 411,
+        412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+        428, 429, 0, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442,
+        443, 444, 1, 1, 1, 445, 1, 446, 1, 447, 1, 1, 1, 1, 1, 448,
+        1, 449, 450, 1, 1, 451, 1, 1, 1, 452, 453, 454, 455, 456, 457, 458,
+        459, 460, 461, 462, 463, 464, 465, 1, 466, 1, 467, 1, 468, 1, 469, 1,
+        470, 1, 471, 1, 472, 1, 473, 1, 474, 1, 475, 1, 476, 1, 477, 1,
+        478, 479, 1, 1, 420, 480, 0, 481, 1, 482, 483, 1, 1, 484, 485, 486,
+    },
+    {
+        487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+        503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518,
+        519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+        535, 1, 1, 536, 1, 537, 538, 539, 540, 541, 542, 1, 1, 1, 543, 1,
+        1, 1, 1, 544, 1, 1, 1, 545, 1, 1, 1, 546, 1, 547, 1, 1,
+        548, 549, 1, 550, 1, 1, 551, 552, 1, 1, 1, 1, 553, 554, 555, 1,
+        556, 1, 557, 1, 558, 1, 559, 1, 560, 1, 561, 1, 562, 1, 563, 1,
+        564, 1, 565, 1, 566, 567, 568, 569, 570, 1, 571, 1, 572, 1, 573, 1,
+    },
+    {
+        574, 1, 0, 384, 384, 384, 384, 384, 1, 1, 575, 1, 576, 1, 577, 1,
+        578, 1, 579, 1, 580, 1, 581, 1, 582, 1, 583, 1, 584, 1, 585, 1,
+        586, 1, 587, 1, 588, 1, 589, 1, 590, 1, 591, 1, 592, 1, 593, 1,
+        594, 1, 595, 1, 596, 1, 597, 1, 598, 1, 599, 1, 600, 1, 601, 1,
+        602, 603, 604, 605, 1, 606, 1, 607, 1, 608, 1, 609, 1, 610, 1, 1,
+        611, 612, 613, 614, 615, 1, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+        626, 1, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640,
+        641, 642, 643, 644, 645, 646, 647, 1, 648, 649, 650, 1, 651, 1, 652, 1,
+    },
+    {
+        653, 1, 654, 1, 655, 1, 656, 1, 657, 1, 658, 1, 659, 1, 660, 1,
+        661, 1, 662, 1, 663, 1, 664, 1, 665, 1, 666, 1, 667, 1, 668, 1,
+        669, 1, 670, 1, 671, 1, 672, 1, 673, 1, 674, 1, 675, 1, 676, 1,
+        0, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691,
+        692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707,
+        708, 709, 710, 711, 712, 713, 714, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 386, 384, 384, 384, 384, 386, 384, 384, 384, 715, 386, 384, 384, 384, 384,
+        384, 384, 386, 386, 386, 386, 386, 386, 384, 384, 386, 384, 384, 715, 716, 384,
+        717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 726, 727, 728, 729, 0, 730,
+        0, 731, 732, 0, 384, 386, 0, 725, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        384, 384, 384, 384, 384, 384, 384, 384, 733, 734, 735, 0, 0, 0, 0, 0,
+        1, 1, 736, 737, 738, 739, 740, 741, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 742, 1, 743, 744, 745, 746, 733, 734,
+        735, 747, 748, 384, 384, 386, 386, 384, 384, 384, 384, 384, 386, 384, 384, 386,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+        749, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        750, 751, 752, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 753, 754, 0, 755, 384, 384, 384, 384, 384, 384, 384, 0, 0, 384,
+        384, 384, 384, 386, 384, 1, 1, 384, 384, 0, 386, 384, 384, 386, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 756, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        384, 386, 384, 384, 386, 384, 384, 386, 386, 386, 384, 386, 386, 384, 386, 384,
+        384, 384, 386, 384, 386, 384, 386, 384, 386, 384, 384, 0, 0, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 384, 384, 384, 384, 384,
+        384, 384, 386, 384, 1, 1, 0, 0, 0, 0, 1, 0, 0, 386, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 384, 384, 384, 384, 1, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 1, 384, 384, 384, 1, 384, 384, 384, 384, 384, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 386, 386, 386, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 384, 386, 386, 386, 384, 384, 384, 384,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 384, 384, 384, 384, 384, 386,
+        386, 386, 386, 386, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 0, 386, 384, 384, 386, 384, 384, 386, 384, 384, 384, 386, 386, 386,
+        744, 745, 746, 384, 384, 384, 386, 384, 384, 386, 386, 384, 384, 384, 384, 384,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 757, 758, 1, 1, 1, 1, 1, 1,
+        759, 760, 1, 761, 762, 1, 1, 1, 1, 1, 1, 1, 763, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 764, 1, 1,
+        1, 384, 386, 384, 384, 1, 1, 1, 765, 766, 767, 768, 769, 770, 771, 772,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+        1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 763, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 0, 773, 1, 0, 0, 774, 775, 764, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 776, 777, 0, 778,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 384, 0,
+    },
+    {
+        0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+        1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 779, 0, 1, 780, 0, 1, 1, 0, 0, 763, 0, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 764, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 781, 782, 783, 1, 0, 784, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 763, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 764, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+        1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 763, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 0, 785, 786, 0, 0, 787, 788, 764, 0, 0,
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 789, 790, 0, 1,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1,
+        1, 0, 791, 1, 792, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1,
+        0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+        1, 1, 1, 0, 0, 0, 793, 794, 1, 0, 795, 796, 797, 764, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+        1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 763, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 798, 1, 799, 0, 1, 1, 1, 764, 0, 0,
+        0, 0, 0, 0, 0, 800, 801, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    },
+    {
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+        1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 763, 1, 1, 802,
+        803, 1, 1, 1, 1, 0, 804, 805, 806, 0, 807, 808, 1, 764, 0, 0,
+        0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+        1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 764, 764, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 809, 810, 1, 0, 811, 812, 813, 764, 1, 0,
+        0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 764, 0, 0, 0, 0, 1,
+        1, 1, 1, 1, 1, 0, 1, 0, 1, 814, 815, 1, 816, 817, 818, 1,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 819, 819, 764, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 820, 820, 820, 820, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 821, 821, 764, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 0, 1, 0, 822, 822, 822, 822, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 386, 386, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 386, 0, 386, 0, 387, 0, 0, 0, 0, 1, 1,
+        1, 1, 1, 823, 1, 1, 1, 1, 0, 1, 1, 1, 1, 824, 1, 1,
+        1, 1, 825, 1, 1, 1, 1, 826, 1, 1, 1, 1, 827, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 828, 1, 1, 1, 0, 0, 0,
+        0, 829, 830, 831, 832, 833, 834, 1, 835, 1, 830, 830, 830, 830, 1, 1,
+    },
+    {
+        830, 836, 384, 384, 764, 0, 384, 384, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 837, 1, 1, 1, 1, 0, 1, 1, 1, 1, 838, 1, 1,
+        1, 1, 839, 1, 1, 1, 1, 840, 1, 1, 1, 1, 841, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 842, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 386, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 843, 844, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 763, 1, 764, 764, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 386, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860,
+        861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876,
+        877, 878, 879, 880, 881, 882, 0, 883, 0, 0, 0, 0, 0, 884, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 384, 384, 384,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 0, 0, 886, 887, 888, 889, 890, 891, 0, 0,
+    },
+    {
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 764, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+        1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 764, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 384, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 716, 1, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 715, 384, 386, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 384, 386, 1, 1, 1, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        764, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 384, 384, 384, 384, 384, 384, 384, 384, 0, 0, 386,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        384, 384, 384, 384, 384, 386, 386, 386, 386, 386, 386, 384, 384, 386, 1, 386,
+        386, 384, 384, 386, 386, 384, 384, 384, 384, 384, 386, 384, 384, 384, 384, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 1,
+        1, 902, 903, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 763, 1, 1, 1, 1, 1, 904, 905, 906, 907, 908, 909,
+        910, 911, 912, 913, 764, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 386, 384, 384, 384,
+        384, 384, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 764, 764, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 763, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 764, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 763, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    },
+    {
+        914, 915, 916, 917, 918, 918, 919, 920, 921, 0, 0, 0, 0, 0, 0, 0,
+        922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937,
+        938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953,
+        954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 0, 0, 965, 966, 967,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        384, 384, 384, 0, 389, 386, 386, 386, 386, 386, 384, 384, 386, 386, 386, 386,
+        384, 1, 389, 389, 389, 389, 389, 389, 389, 1, 1, 1, 1, 386, 1, 1,
+        1, 1, 1, 1, 384, 1, 1, 1, 384, 384, 1, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        384, 384, 386, 384, 384, 384, 384, 384, 384, 384, 386, 384, 384, 396, 968, 386,
+        388, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 385, 716, 716, 386, 969, 384, 395, 386, 384, 386,
+    },
+    {
+        970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985,
+        986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001,
+        1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+        1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+        1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049,
+        1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065,
+        1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081,
+        1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
+    },
+    {
+        1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
+        1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1, 1067, 1, 1, 1124, 1,
+        1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140,
+        1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156,
+        1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172,
+        1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
+        1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
+        1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1, 1216, 1, 1217, 1,
+    },
+    {
+        1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+        1234, 1235, 1236, 1237, 1238, 1239, 0, 0, 1240, 1241, 1242, 1243, 1244, 1245, 0, 0,
+        1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261,
+        1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+        1278, 1279, 1280, 1281, 1282, 1283, 0, 0, 1284, 1285, 1286, 1287, 1288, 1289, 0, 0,
+        1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 0, 1298, 0, 1299, 0, 1300, 0, 1301,
+        1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
+        1318, 1319, 1320, 440, 1321, 1322, 1323, 442, 1324, 455, 1325, 456, 1326, 1327, 0, 0,
+    },
+    {
+        1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+        1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+        1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+        1376, 1377, 1378, 1379, 1380, 0, 1381, 1382, 1383, 1384, 1385, 404, 1386, 0, 1387, 1388,
+        0, 1389, 1390, 1391, 1392, 0, 1393, 1394, 1395, 406, 1396, 407, 1397, 1398, 1399, 1400,
+        1401, 1402, 1403, 412, 0, 0, 1404, 1405, 1406, 1407, 1408, 408, 0, 1409, 1410, 1411,
+        1412, 1413, 1414, 443, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 410, 1422, 1423, 403, 1424,
+        0, 0, 1425, 1426, 1427, 0, 1428, 1429, 1430, 409, 1431, 411, 1432, 1433, 1434, 0,
+    },
+    {
+        1435, 1436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        384, 384, 389, 389, 384, 384, 384, 384, 389, 389, 389, 384, 384, 1, 1, 1,
+        1, 384, 1, 1, 1, 389, 389, 384, 386, 384, 389, 389, 386, 386, 386, 386,
+        384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 885, 0, 0, 0, 0, 885, 0, 0, 1, 885, 885, 885, 1, 1,
+        885, 885, 885, 1, 0, 885, 0, 0, 0, 885, 885, 885, 885, 885, 0, 0,
+        0, 0, 0, 0, 885, 0, 1437, 0, 885, 0, 1438, 1439, 885, 885, 0, 1,
+        885, 885, 1440, 885, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 885, 885,
+        0, 0, 0, 0, 0, 885, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1457, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1458, 0, 1459, 0, 1460, 0, 0, 0, 0, 0, 1461, 1462, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1463, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1464, 1465, 1466,
+        1467, 0, 1468, 0, 1469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 1470, 1471, 0, 0, 0, 1472, 1473, 0, 1474, 1475, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1476, 1477, 1478, 1479, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1480, 0, 0, 0,
+        0, 1481, 0, 1482, 1483, 1484, 0, 1485, 1486, 1487, 0, 0, 0, 1488, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1489, 1490, 1491, 0, 1492, 1493, 0, 0, 0, 0, 0, 0, 0, 1494, 1495, 1496,
+        1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 0, 0,
+    },
+    {
+        1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 0, 0, 0, 0, 0, 0,
+        0, 1521, 1522, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1523, 0, 0, 0, 0, 0, 1524, 1525, 0, 1526, 1527, 1528, 1529, 1530,
+        0, 0, 1531, 1532, 1533, 1534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1535, 1536, 1537, 1538, 0, 0, 0, 0, 0, 0, 1539, 1540, 1541, 1542, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1543, 1544, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554,
+        1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1571, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+        1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603,
+        1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1620, 1, 1621, 1622, 1623, 1, 1, 1624, 1, 1625, 1, 1626, 1, 1627, 1628, 1629,
+        1630, 1, 1631, 1, 1, 1632, 1, 1, 1, 1, 1, 1, 1, 1, 1633, 1634,
+    },
+    {
+        1635, 1, 1636, 1, 1637, 1, 1638, 1, 1639, 1, 1640, 1, 1641, 1, 1642, 1,
+        1643, 1, 1644, 1, 1645, 1, 1646, 1, 1647, 1, 1648, 1, 1649, 1, 1650, 1,
+        1651, 1, 1652, 1, 1653, 1, 1654, 1, 1655, 1, 1656, 1, 1657, 1, 1658, 1,
+        1659, 1, 1660, 1, 1661, 1, 1662, 1, 1663, 1, 1664, 1, 1665, 1, 1666, 1,
+        1667, 1, 1668, 1, 1669, 1, 1670, 1, 1671, 1, 1672, 1, 1673, 1, 1674, 1,
+        1675, 1, 1676, 1, 1677, 1, 1678, 1, 1679, 1, 1680, 1, 1681, 1, 1682, 1,
+        1683, 1, 1684, 1, 1, 0, 0, 0, 0, 0, 0, 1685, 1, 1686, 1, 384,
+        384, 384, 1687, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+        384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 969, 716, 385, 715, 1688, 1688,
+        0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1689, 1, 1, 1, 1, 1690, 1691, 1692, 1693, 1694,
+        1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710,
+        1711, 1712, 1713, 1, 1714, 1715, 1716, 1717, 1718, 1719, 1, 1, 1, 1, 1, 1720,
+        1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1735, 1, 1, 0, 0, 1736, 1736, 0, 0, 1737, 1738, 1,
+        0, 1, 1, 1, 1, 1, 1739, 1, 1, 1, 1, 1740, 1741, 1742, 1743, 1744,
+        1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760,
+        1761, 1762, 1763, 1, 1764, 1765, 1766, 1767, 1768, 1769, 1, 1, 1, 1, 1, 1770,
+        1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1785,
+        1786, 1787, 1788, 1, 1789, 1, 1, 1790, 1791, 1792, 1793, 0, 1, 1794, 1795, 1,
+    },
+    {
+        0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1796, 1, 1797, 1, 1798, 1, 1799, 1, 1800, 1, 1801, 1, 1802, 1, 1803, 1,
+        1804, 1, 1805, 1, 1806, 1, 1807, 1, 1808, 1, 1809, 1, 1810, 1, 1811, 1,
+        1812, 1, 1813, 1, 1814, 1, 1815, 1, 1816, 1, 1817, 1, 1818, 1, 1, 384,
+        1, 1, 1, 0, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 0, 1,
+    },
+    {
+        1819, 1, 1820, 1, 1821, 1, 1822, 1, 1823, 1, 1824, 1, 1825, 1, 1826, 1,
+        1827, 1, 1828, 1, 1829, 1, 1830, 1, 1831, 1, 1832, 1, 1, 1, 384, 384,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 1833, 1, 1834, 1, 1835, 1, 1836, 1, 1837, 1, 1838, 1, 1839, 1,
+        1, 1, 1840, 1, 1841, 1, 1842, 1, 1843, 1, 1844, 1, 1845, 1, 1846, 1,
+        1847, 1, 1848, 1, 1849, 1, 1850, 1, 1851, 1, 1852, 1, 1853, 1, 1854, 1,
+        1855, 1, 1856, 1, 1857, 1, 1858, 1, 1859, 1, 1860, 1, 1861, 1, 1862, 1,
+        1863, 1, 1864, 1, 1865, 1, 1866, 1, 1867, 1, 1868, 1, 1869, 1, 1870, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1871, 1, 1872, 1, 1873, 1874, 1,
+    },
+    {
+        1875, 1, 1876, 1, 1877, 1, 1878, 1, 1, 0, 0, 1879, 1, 1880, 1, 1,
+        1881, 1, 1882, 1, 1, 1, 1883, 1, 1884, 1, 1885, 1, 1886, 1, 1887, 1,
+        1888, 1, 1889, 1, 1890, 1, 1891, 1, 1892, 1, 1893, 1894, 1895, 1896, 1897, 1,
+        1898, 1899, 1900, 1901, 1902, 1, 1903, 1, 1904, 1, 1905, 1, 1906, 1, 1907, 1,
+        1908, 1, 1909, 1, 1910, 1911, 1912, 1913, 1, 1914, 1, 0, 0, 0, 0, 0,
+        1915, 1, 0, 1, 0, 1, 1916, 1, 1917, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 1, 1918, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 764, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 764, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 764, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 386, 386, 386, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 763, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        384, 1, 384, 384, 386, 1, 1, 384, 384, 1, 1, 1, 1, 1, 384, 384,
+        1, 384, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 1, 1, 1, 1, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0,
+        0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+    },
+    {
+        1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950,
+        1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966,
+        1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982,
+        1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 764, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    },
+    {
+        1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+        2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029,
+        2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045,
+        2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061,
+        2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077,
+        2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2018, 2090, 2091, 2092,
+        2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108,
+        2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+    },
+    {
+        2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140,
+        2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+        2157, 2108, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2092, 2166, 2167, 2168, 2169, 2170,
+        2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2018,
+        2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201,
+        2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2094, 2213, 2214, 2215, 2216,
+        2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232,
+        2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248,
+    },
+    {
+        2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 1, 1,
+        2263, 1, 2264, 1, 1, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 1,
+        2275, 1, 2276, 1, 1, 2277, 2278, 1, 1, 1, 2279, 2280, 2281, 2282, 2283, 2284,
+        2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300,
+        2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316,
+        2317, 2318, 2319, 2320, 2321, 2322, 2323, 2147, 2324, 2325, 2326, 2327, 2328, 2329, 2329, 2330,
+        2331, 2332, 2333, 2334, 2335, 2336, 2337, 2277, 2338, 2339, 2340, 2341, 2342, 2343, 0, 0,
+        2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2291, 2352, 2353, 2354, 2263, 2355, 2356, 2357,
+    },
+    {
+        2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2300, 2367, 2301, 2368, 2369, 2370, 2371,
+        2372, 2264, 2039, 2373, 2374, 2375, 2109, 2196, 2376, 2377, 2308, 2378, 2309, 2379, 2380, 2381,
+        2266, 2382, 2383, 2384, 2385, 2386, 2267, 2387, 2388, 2389, 2390, 2391, 2392, 2323, 2393, 2394,
+        2147, 2395, 2327, 2396, 2397, 2398, 2399, 2400, 2332, 2401, 2276, 2402, 2333, 2090, 2403, 2334,
+        2404, 2336, 2405, 2406, 2407, 2408, 2409, 2338, 2272, 2410, 2339, 2411, 2340, 2412, 2006, 2413,
+        2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 2424, 2425, 2426,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2427, 2428, 2429, 2430, 2431, 2432,
+        2433, 2434, 2435, 2436, 2437, 2438, 2439, 0, 2440, 2441, 2442, 2443, 2444, 0, 2445, 0,
+        2446, 2447, 0, 2448, 2449, 0, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        384, 384, 384, 384, 384, 384, 384, 386, 386, 386, 386, 386, 386, 386, 384, 384,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473,
+        2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+        0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 386, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        386, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 384, 384, 384, 384, 384, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500,
+        2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516,
+        2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540,
+        2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556,
+        2557, 2558, 2559, 2560, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 0, 2572, 2573, 2574, 2575,
+    },
+    {
+        2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 0, 2587, 2588, 2589, 2590,
+        2591, 2592, 2593, 0, 2594, 2595, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 386, 1, 384,
+        1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 384, 389, 386, 0, 0, 0, 0, 764,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 384, 386, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611,
+        2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627,
+        2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643,
+        2644, 2645, 2646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 384, 384, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 384, 384, 0, 0, 0,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 386, 386, 384, 384, 384, 386, 384, 386, 386, 386,
+        386, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 384, 386, 384, 386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        764, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 2647, 2648, 2649, 2650, 1, 1, 1,
+        1, 1, 1, 1, 1, 2651, 1, 1, 1, 1, 1, 2652, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 764, 763, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        384, 384, 384, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2653, 2654,
+        1, 2655, 2656, 764, 764, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 763, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        764, 1, 1, 1, 1, 0, 0, 0, 0, 1, 763, 1, 1, 0, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 764, 763, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 763, 764, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+        1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 763, 763, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 0, 2657, 1, 0, 0, 2658, 2659, 764, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 384, 384, 384, 384, 384, 384, 384, 0, 0, 0,
+        384, 384, 384, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 764, 1, 1, 1, 763, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 384, 1,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 2660, 1, 2661, 2662, 1, 2663, 1,
+        1, 1, 764, 763, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 2664, 2665, 2666, 2667, 1, 1, 1, 764,
+        763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 764,
+        1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 764, 763, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 764, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 764, 763, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683,
+        2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 2700, 0, 1, 2701, 0, 0, 1, 1, 764, 764, 1,
+        1, 1, 1, 763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+        764, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 764, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 764, 0, 0, 0, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 764,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1,
+        1, 1, 763, 1, 764, 764, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 0, 1, 1, 1, 1, 764, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        389, 389, 389, 389, 389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        384, 384, 384, 384, 384, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+        1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717,
+        2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2734, 2734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 389, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2735, 2736,
+        2737, 2738, 2739, 2740, 2741, 387, 387, 389, 389, 389, 0, 0, 0, 2742, 387, 387,
+        387, 387, 387, 0, 0, 0, 0, 0, 0, 0, 0, 386, 386, 386, 386, 386,
+    },
+    {
+        386, 386, 386, 0, 0, 384, 384, 384, 384, 384, 386, 386, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 384, 384, 384, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2743, 2744, 2745, 2746, 2747,
+        2748, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 384, 384, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 1, 1,
+        1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+    },
+    {
+        885, 885, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 885, 0, 885, 885,
+        0, 0, 885, 0, 0, 885, 885, 0, 0, 885, 885, 885, 885, 0, 885, 885,
+        885, 885, 885, 885, 885, 885, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1,
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 885, 885, 0, 885, 885, 885, 885, 0, 0, 885, 885, 885,
+        885, 885, 885, 885, 885, 0, 885, 885, 885, 885, 885, 885, 885, 0, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 885, 885, 0, 885, 885, 885, 885, 0,
+        885, 885, 885, 885, 885, 0, 885, 0, 0, 0, 885, 885, 885, 885, 885, 885,
+        885, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+    },
+    {
+        885, 885, 885, 885, 885, 885, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+    },
+    {
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 0, 0, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+        1, 1, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 0, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+        885, 885, 885, 885, 885, 885, 885, 885, 885, 0, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 885, 1, 0, 0, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        384, 384, 384, 384, 384, 384, 384, 0, 384, 384, 384, 384, 384, 384, 384, 384,
+        384, 384, 384, 384, 384, 384, 384, 384, 384, 0, 0, 384, 384, 384, 384, 384,
+        384, 384, 0, 384, 384, 0, 384, 384, 384, 384, 384, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        384, 384, 384, 384, 384, 384, 384, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 384, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 384, 384, 384, 384,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        386, 386, 386, 386, 386, 386, 386, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764,
+        2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780,
+        2781, 2782, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 384, 384, 384, 384, 384, 384, 763, 1, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1,
+        0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+        0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+        0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+        1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2783, 2784, 2785, 2786, 2787, 2285, 2788, 2789, 2790, 2791, 2286, 2792, 2793, 2794, 2287, 2795,
+        2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2345, 2807, 2808, 2809, 2810,
+        2811, 2812, 2813, 2814, 2815, 2350, 2288, 2289, 2351, 2816, 2817, 2096, 2818, 2290, 2819, 2820,
+        2821, 2822, 2822, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834,
+        2835, 2836, 2837, 2838, 2839, 2840, 2840, 2353, 2841, 2842, 2843, 2844, 2292, 2845, 2846, 2847,
+        2249, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862,
+        2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2873, 2874, 2875, 2876, 2092,
+        2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2297, 2885, 2886, 2887, 2888, 2889, 2890, 2891,
+    },
+    {
+        2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2038, 2906,
+        2907, 2908, 2908, 2909, 2910, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920,
+        2921, 2922, 2923, 2298, 2924, 2925, 2926, 2927, 2365, 2927, 2928, 2300, 2929, 2930, 2931, 2932,
+        2301, 2011, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946,
+        2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2302, 2955, 2956, 2957, 2958, 2959, 2960, 2304,
+        2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2039, 2373, 2969, 2970, 2971, 2972, 2973, 2974,
+        2975, 2976, 2305, 2977, 2978, 2979, 2980, 2416, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988,
+        2989, 2990, 2991, 2992, 2993, 2109, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003,
+    },
+    {
+        3004, 2306, 2196, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 2377, 3013, 3014, 3015, 3016,
+        3017, 3018, 3019, 3020, 2378, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031,
+        3032, 2380, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3043, 3044, 3045,
+        2382, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 2095, 3053, 3054, 3055, 3056, 3057, 3058, 3059,
+        2388, 3060, 3061, 3062, 3063, 3064, 3065, 3065, 2389, 2418, 3066, 3067, 3068, 3069, 3070, 2057,
+        2391, 3071, 3072, 2317, 3073, 3074, 2271, 3075, 3076, 2321, 3077, 3078, 3079, 3080, 3080, 3081,
+        3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097,
+        3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 2327, 3108, 3109, 3110, 3111, 3112,
+    },
+    {
+        3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 2909, 3124, 3125, 3126, 3127,
+        3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 2113, 3136, 3137, 3138, 3139, 3140, 3141, 2330,
+        3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157,
+        3158, 3159, 3160, 3161, 2052, 3162, 3163, 3164, 3165, 3166, 3167, 2398, 3168, 3169, 3170, 3171,
+        3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187,
+        2403, 2404, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 2405,
+        3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216,
+        3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 2411, 2411,
+    },
+    {
+        3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 2412, 3241, 3242, 3243, 3244, 3245,
+        3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+const ProprieteUnicode proprietes_unicode[3260] = {
+    {0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1}, {0, 0, 0, 0, 1, 0}, {0, 0, 0, 1, 1, 0},
+    {0, 0, 0, 2, 1, 0}, {1, 1, 0, 3, 16, 3}, {2, 1, 0, 19, 3, 3}, {3, 1, 0, 22, 5, 3},
+    {4, 1, 0, 27, 6, 3}, {5, 1, 0, 33, 17, 3}, {6, 1, 0, 50, 1, 3}, {7, 1, 0, 51, 7, 3},
+    {8, 1, 0, 58, 7, 3}, {9, 1, 0, 65, 15, 3}, {10, 1, 0, 80, 1, 3}, {11, 1, 0, 81, 5, 3},
+    {12, 1, 0, 86, 6, 3}, {13, 1, 0, 92, 3, 3}, {14, 1, 0, 95, 9, 3}, {15, 1, 0, 104, 16, 3},
+    {16, 1, 0, 120, 2, 3}, {17, 1, 0, 0, 0, 3}, {18, 1, 0, 122, 8, 3}, {19, 1, 0, 130, 7, 3},
+    {20, 1, 0, 137, 7, 3}, {21, 1, 0, 144, 19, 3}, {22, 1, 0, 163, 2, 3}, {23, 1, 0, 165, 6, 3},
+    {24, 1, 0, 171, 2, 3}, {25, 1, 0, 173, 9, 3}, {26, 1, 0, 182, 6, 3}, {0, 0, 0, 188, 16, 1},
+    {0, 0, 0, 204, 3, 1}, {0, 0, 0, 207, 5, 1}, {0, 0, 0, 212, 6, 1}, {0, 0, 0, 218, 17, 1},
+    {0, 0, 0, 235, 1, 1}, {0, 0, 0, 236, 7, 1}, {0, 0, 0, 243, 8, 1}, {0, 0, 0, 251, 14, 1},
+    {0, 0, 0, 265, 2, 1}, {0, 0, 0, 267, 5, 1}, {0, 0, 0, 272, 6, 1}, {0, 0, 0, 278, 3, 1},
+    {0, 0, 0, 281, 9, 1}, {0, 0, 0, 290, 16, 1}, {0, 0, 0, 306, 2, 1}, {0, 0, 0, 308, 8, 1},
+    {0, 0, 0, 316, 7, 1}, {0, 0, 0, 323, 8, 1}, {0, 0, 0, 331, 19, 1}, {0, 0, 0, 350, 2, 1},
+    {0, 0, 0, 352, 7, 1}, {0, 0, 0, 359, 2, 1}, {0, 0, 0, 361, 10, 1}, {0, 0, 0, 371, 6, 1},
+    {0, 0, 0, 377, 3, 0}, {27, 1, 0, 0, 0, 1}, {28, 2, 0, 0, 0, 3}, {30, 2, 0, 0, 0, 3},
+    {32, 2, 0, 380, 4, 3}, {34, 2, 0, 0, 0, 3}, {36, 2, 0, 384, 1, 3}, {38, 2, 0, 385, 1, 3},
+    {40, 1, 0, 386, 2, 3}, {41, 2, 0, 388, 1, 3}, {43, 2, 0, 0, 0, 3}, {45, 2, 0, 0, 0, 3},
+    {47, 2, 0, 389, 4, 3}, {49, 2, 0, 0, 0, 3}, {51, 2, 0, 0, 0, 3}, {53, 2, 0, 0, 0, 3},
+    {55, 2, 0, 0, 0, 3}, {57, 2, 0, 393, 1, 3}, {59, 1, 0, 0, 0, 3}, {60, 2, 0, 0, 0, 3},
+    {62, 2, 0, 0, 0, 3}, {64, 2, 0, 0, 0, 3}, {66, 2, 0, 394, 4, 3}, {68, 2, 0, 398, 3, 3},
+    {70, 2, 0, 401, 1, 3}, {72, 1, 0, 402, 1, 3}, {73, 2, 0, 0, 0, 3}, {75, 2, 0, 0, 0, 3},
+    {77, 2, 0, 0, 0, 3}, {79, 2, 0, 403, 4, 3}, {81, 2, 0, 0, 0, 3}, {83, 1, 0, 0, 0, 3},
+    {28, 2, 0, 0, 0, 1}, {30, 2, 0, 0, 0, 1}, {32, 2, 0, 407, 4, 1}, {34, 2, 0, 0, 0, 1},
+    {36, 2, 0, 411, 1, 1}, {38, 2, 0, 412, 1, 1}, {0, 0, 0, 413, 2, 1}, {41, 2, 0, 415, 1, 1},
+    {43, 2, 0, 0, 0, 1}, {45, 2, 0, 0, 0, 1}, {47, 2, 0, 416, 4, 1}, {49, 2, 0, 0, 0, 1},
+    {51, 2, 0, 0, 0, 1}, {53, 2, 0, 0, 0, 1}, {55, 2, 0, 0, 0, 1}, {57, 2, 0, 420, 1, 1},
+    {60, 2, 0, 0, 0, 1}, {62, 2, 0, 0, 0, 1}, {64, 2, 0, 0, 0, 1}, {66, 2, 0, 421, 4, 1},
+    {68, 2, 0, 425, 3, 1}, {70, 2, 0, 428, 1, 1}, {0, 0, 0, 429, 1, 1}, {73, 2, 0, 0, 0, 1},
+    {75, 2, 0, 0, 0, 1}, {77, 2, 0, 0, 0, 1}, {79, 2, 0, 430, 4, 1}, {81, 2, 0, 0, 0, 1},
+    {84, 2, 0, 0, 0, 1}, {86, 2, 0, 0, 0, 3}, {86, 2, 0, 0, 0, 1}, {88, 2, 0, 434, 4, 3},
+    {88, 2, 0, 438, 4, 1}, {90, 2, 0, 0, 0, 3}, {90, 2, 0, 0, 0, 1}, {92, 2, 0, 0, 0, 3},
+    {92, 2, 0, 0, 0, 1}, {94, 2, 0, 0, 0, 3}, {94, 2, 0, 0, 0, 1}, {96, 2, 0, 0, 0, 3},
+    {96, 2, 0, 0, 0, 1}, {98, 2, 0, 0, 0, 3}, {98, 2, 0, 0, 0, 1}, {100, 2, 0, 0, 0, 3},
+    {100, 2, 0, 0, 0, 1}, {102, 1, 0, 0, 0, 3}, {103, 2, 0, 442, 2, 3}, {103, 2, 0, 444, 2, 1},
+    {105, 2, 0, 0, 0, 3}, {105, 2, 0, 0, 0, 1}, {107, 2, 0, 0, 0, 3}, {107, 2, 0, 0, 0, 1},
+    {109, 2, 0, 0, 0, 3}, {109, 2, 0, 0, 0, 1}, {111, 2, 0, 0, 0, 3}, {111, 2, 0, 0, 0, 1},
+    {113, 2, 0, 0, 0, 3}, {113, 2, 0, 0, 0, 1}, {115, 2, 0, 0, 0, 3}, {115, 2, 0, 0, 0, 1},
+    {117, 2, 0, 0, 0, 3}, {117, 2, 0, 0, 0, 1}, {119, 2, 0, 0, 0, 3}, {119, 2, 0, 0, 0, 1},
+    {121, 2, 0, 0, 0, 3}, {121, 2, 0, 0, 0, 1}, {123, 1, 0, 0, 0, 3}, {124, 2, 0, 0, 0, 3},
+    {124, 2, 0, 0, 0, 1}, {126, 2, 0, 0, 0, 3}, {126, 2, 0, 0, 0, 1}, {128, 2, 0, 0, 0, 3},
+    {128, 2, 0, 0, 0, 1}, {130, 2, 0, 0, 0, 3}, {130, 2, 0, 0, 0, 1}, {132, 2, 0, 0, 0, 3},
+    {134, 1, 0, 0, 0, 3}, {135, 2, 0, 0, 0, 3}, {135, 2, 0, 0, 0, 1}, {137, 2, 0, 0, 0, 3},
+    {137, 2, 0, 0, 0, 1}, {139, 2, 0, 0, 0, 3}, {139, 2, 0, 0, 0, 1}, {141, 2, 0, 0, 0, 3},
+    {141, 2, 0, 0, 0, 1}, {143, 2, 0, 0, 0, 3}, {143, 2, 0, 0, 0, 1}, {145, 1, 0, 0, 0, 3},
+    {146, 1, 0, 0, 0, 3}, {147, 2, 0, 0, 0, 3}, {147, 2, 0, 0, 0, 1}, {149, 2, 0, 0, 0, 3},
+    {149, 2, 0, 0, 0, 1}, {151, 2, 0, 0, 0, 3}, {151, 2, 0, 0, 0, 1}, {153, 1, 0, 0, 0, 3},
+    {154, 2, 0, 446, 2, 3}, {154, 2, 0, 448, 2, 1}, {156, 2, 0, 0, 0, 3}, {156, 2, 0, 0, 0, 1},
+    {158, 2, 0, 0, 0, 3}, {158, 2, 0, 0, 0, 1}, {160, 1, 0, 0, 0, 3}, {161, 2, 0, 0, 0, 3},
+    {161, 2, 0, 0, 0, 1}, {163, 2, 0, 0, 0, 3}, {163, 2, 0, 0, 0, 1}, {165, 2, 0, 0, 0, 3},
+    {165, 2, 0, 0, 0, 1}, {167, 2, 0, 450, 1, 3}, {167, 2, 0, 451, 1, 1}, {169, 2, 0, 0, 0, 3},
+    {169, 2, 0, 0, 0, 1}, {171, 2, 0, 0, 0, 3}, {171, 2, 0, 0, 0, 1}, {173, 2, 0, 452, 1, 3},
+    {173, 2, 0, 453, 1, 1}, {175, 2, 0, 0, 0, 3}, {175, 2, 0, 0, 0, 1}, {177, 2, 0, 0, 0, 3},
+    {177, 2, 0, 0, 0, 1}, {179, 1, 0, 0, 0, 3}, {180, 2, 0, 454, 1, 3}, {180, 2, 0, 455, 1, 1},
+    {182, 2, 0, 456, 1, 3}, {182, 2, 0, 457, 1, 1}, {184, 2, 0, 0, 0, 3}, {184, 2, 0, 0, 0, 1},
+    {186, 2, 0, 0, 0, 3}, {186, 2, 0, 0, 0, 1}, {188, 2, 0, 0, 0, 3}, {188, 2, 0, 0, 0, 1},
+    {190, 2, 0, 0, 0, 3}, {190, 2, 0, 0, 0, 1}, {192, 2, 0, 0, 0, 3}, {192, 2, 0, 0, 0, 1},
+    {194, 2, 0, 0, 0, 3}, {194, 2, 0, 0, 0, 1}, {84, 2, 0, 0, 0, 3}, {196, 2, 0, 0, 0, 3},
+    {196, 2, 0, 0, 0, 1}, {198, 2, 0, 0, 0, 3}, {198, 2, 0, 0, 0, 1}, {200, 2, 0, 0, 0, 3},
+    {200, 2, 0, 0, 0, 1}, {19, 1, 0, 458, 1, 1}, {202, 1, 0, 0, 0, 3}, {203, 1, 0, 0, 0, 3},
+    {204, 1, 0, 0, 0, 3}, {205, 1, 0, 0, 0, 3}, {206, 1, 0, 0, 0, 3}, {207, 1, 0, 0, 0, 3},
+    {208, 1, 0, 0, 0, 3}, {209, 1, 0, 0, 0, 3}, {210, 1, 0, 0, 0, 3}, {211, 1, 0, 0, 0, 3},
+    {212, 1, 0, 0, 0, 3}, {213, 1, 0, 0, 0, 3}, {214, 1, 0, 0, 0, 3}, {215, 1, 0, 0, 0, 3},
+    {216, 1, 0, 0, 0, 3}, {217, 1, 0, 0, 0, 3}, {218, 1, 0, 0, 0, 3}, {219, 1, 0, 0, 0, 3},
+    {220, 1, 0, 0, 0, 3}, {221, 1, 0, 0, 0, 3}, {222, 2, 0, 459, 5, 3}, {222, 2, 0, 464, 5, 1},
+    {224, 1, 0, 0, 0, 3}, {225, 1, 0, 0, 0, 3}, {226, 1, 0, 0, 0, 3}, {227, 1, 0, 0, 0, 3},
+    {228, 1, 0, 0, 0, 3}, {229, 1, 0, 0, 0, 3}, {230, 1, 0, 0, 0, 3}, {231, 2, 0, 469, 5, 3},
+    {231, 2, 0, 474, 5, 1}, {233, 1, 0, 0, 0, 3}, {234, 1, 0, 0, 0, 3}, {235, 1, 0, 0, 0, 3},
+    {236, 1, 0, 0, 0, 3}, {237, 1, 0, 479, 1, 3}, {238, 1, 0, 0, 0, 3}, {239, 1, 0, 0, 0, 3},
+    {240, 1, 0, 0, 0, 3}, {241, 1, 0, 0, 0, 3}, {242, 1, 0, 0, 0, 3}, {243, 2, 0, 0, 0, 3},
+    {243, 2, 0, 0, 0, 1}, {245, 2, 0, 0, 0, 3}, {245, 2, 0, 0, 0, 1}, {247, 2, 0, 0, 0, 3},
+    {247, 2, 0, 0, 0, 1}, {249, 2, 0, 0, 0, 3}, {249, 2, 0, 0, 0, 1}, {251, 3, 0, 0, 0, 3},
+    {251, 3, 0, 0, 0, 1}, {254, 3, 0, 0, 0, 3}, {254, 3, 0, 0, 0, 1}, {257, 3, 0, 0, 0, 3},
+    {257, 3, 0, 0, 0, 1}, {260, 3, 0, 0, 0, 3}, {260, 3, 0, 0, 0, 1}, {263, 3, 0, 0, 0, 3},
+    {263, 3, 0, 0, 0, 1}, {266, 3, 0, 0, 0, 3}, {266, 3, 0, 0, 0, 1}, {269, 2, 0, 0, 0, 3},
+    {269, 2, 0, 0, 0, 1}, {271, 1, 0, 0, 0, 3}, {272, 2, 0, 0, 0, 3}, {272, 2, 0, 0, 0, 1},
+    {274, 2, 0, 0, 0, 3}, {274, 2, 0, 0, 0, 1}, {276, 2, 0, 480, 1, 3}, {276, 2, 0, 481, 1, 1},
+    {278, 3, 0, 0, 0, 3}, {278, 3, 0, 0, 0, 1}, {281, 2, 0, 0, 0, 3}, {281, 2, 0, 0, 0, 1},
+    {283, 2, 0, 0, 0, 1}, {285, 1, 0, 0, 0, 3}, {286, 2, 0, 0, 0, 3}, {286, 2, 0, 0, 0, 1},
+    {288, 1, 0, 0, 0, 3}, {289, 1, 0, 0, 0, 3}, {290, 2, 0, 0, 0, 3}, {290, 2, 0, 0, 0, 1},
+    {292, 3, 0, 0, 0, 3}, {292, 3, 0, 0, 0, 1}, {295, 2, 0, 0, 0, 3}, {295, 2, 0, 0, 0, 1},
+    {297, 2, 0, 0, 0, 3}, {297, 2, 0, 0, 0, 1}, {299, 2, 0, 0, 0, 3}, {299, 2, 0, 0, 0, 1},
+    {301, 2, 0, 0, 0, 3}, {301, 2, 0, 0, 0, 1}, {303, 2, 0, 0, 0, 3}, {303, 2, 0, 0, 0, 1},
+    {305, 2, 0, 0, 0, 3}, {305, 2, 0, 0, 0, 1}, {307, 2, 0, 0, 0, 3}, {307, 2, 0, 0, 0, 1},
+    {309, 2, 0, 0, 0, 3}, {309, 2, 0, 0, 0, 1}, {311, 2, 0, 0, 0, 3}, {311, 2, 0, 0, 0, 1},
+    {313, 2, 0, 0, 0, 3}, {313, 2, 0, 0, 0, 1}, {315, 2, 0, 0, 0, 3}, {315, 2, 0, 0, 0, 1},
+    {317, 2, 0, 0, 0, 3}, {317, 2, 0, 0, 0, 1}, {319, 2, 0, 0, 0, 3}, {319, 2, 0, 0, 0, 1},
+    {321, 2, 0, 0, 0, 3}, {321, 2, 0, 0, 0, 1}, {323, 2, 0, 0, 0, 3}, {323, 2, 0, 0, 0, 1},
+    {325, 2, 0, 0, 0, 3}, {325, 2, 0, 0, 0, 1}, {327, 1, 0, 0, 0, 3}, {328, 2, 0, 0, 0, 3},
+    {328, 2, 0, 0, 0, 1}, {330, 1, 0, 0, 0, 3}, {331, 1, 0, 0, 0, 3}, {332, 1, 0, 0, 0, 3},
+    {333, 2, 0, 482, 1, 3}, {333, 2, 0, 483, 1, 1}, {335, 2, 0, 484, 1, 3}, {335, 2, 0, 485, 1, 1},
+    {337, 3, 0, 0, 0, 3}, {337, 3, 0, 0, 0, 1}, {340, 3, 0, 0, 0, 3}, {340, 3, 0, 0, 0, 1},
+    {343, 2, 0, 486, 1, 3}, {343, 2, 0, 487, 1, 1}, {345, 3, 0, 0, 0, 3}, {345, 3, 0, 0, 0, 1},
+    {348, 2, 0, 0, 0, 3}, {348, 2, 0, 0, 0, 1}, {350, 1, 0, 0, 0, 3}, {351, 1, 0, 0, 0, 3},
+    {352, 1, 0, 0, 0, 3}, {353, 1, 0, 0, 0, 3}, {354, 1, 0, 0, 0, 3}, {355, 1, 0, 0, 0, 3},
+    {356, 1, 0, 0, 0, 3}, {357, 1, 0, 0, 0, 3}, {358, 1, 0, 0, 0, 3}, {359, 1, 0, 0, 0, 3},
+    {360, 1, 0, 0, 0, 3}, {361, 1, 0, 0, 0, 3}, {362, 1, 0, 0, 0, 3}, {0, 0, 0, 488, 1, 1},
+    {0, 0, 230, 0, 0, 1}, {0, 0, 232, 0, 0, 1}, {0, 0, 220, 0, 0, 1}, {0, 0, 216, 0, 0, 1},
+    {0, 0, 202, 0, 0, 1}, {0, 0, 1, 0, 0, 1}, {363, 1, 230, 0, 0, 1}, {364, 1, 230, 0, 0, 1},
+    {365, 1, 230, 0, 0, 1}, {366, 2, 230, 0, 0, 1}, {0, 0, 240, 0, 0, 1}, {0, 0, 233, 0, 0, 1},
+    {0, 0, 234, 0, 0, 1}, {368, 1, 0, 0, 0, 3}, {369, 1, 0, 0, 0, 3}, {370, 1, 0, 0, 0, 1},
+    {371, 1, 0, 0, 0, 3}, {372, 1, 0, 0, 0, 0}, {373, 1, 0, 0, 0, 3}, {374, 2, 0, 0, 0, 0},
+    {376, 2, 0, 0, 0, 3}, {378, 1, 0, 0, 0, 0}, {379, 2, 0, 0, 0, 3}, {381, 2, 0, 0, 0, 3},
+    {383, 2, 0, 0, 0, 3}, {385, 2, 0, 0, 0, 3}, {387, 2, 0, 0, 0, 3}, {389, 2, 0, 0, 0, 3},
+    {391, 3, 0, 0, 0, 1}, {394, 1, 0, 489, 7, 3}, {395, 1, 0, 0, 0, 3}, {396, 1, 0, 0, 0, 3},
+    {397, 1, 0, 0, 0, 3}, {398, 1, 0, 496, 4, 3}, {399, 1, 0, 0, 0, 3}, {400, 1, 0, 500, 5, 3},
+    {401, 1, 0, 0, 0, 3}, {402, 1, 0, 505, 7, 3}, {403, 1, 0, 0, 0, 3}, {404, 1, 0, 0, 0, 3},
+    {27, 1, 0, 0, 0, 3}, {405, 1, 0, 0, 0, 3}, {406, 1, 0, 0, 0, 3}, {407, 1, 0, 512, 4, 3},
+    {408, 1, 0, 0, 0, 3}, {409, 1, 0, 516, 1, 3}, {410, 1, 0, 0, 0, 3}, {411, 1, 0, 0, 0, 3},
+    {412, 1, 0, 517, 6, 3}, {413, 1, 0, 0, 0, 3}, {414, 1, 0, 0, 0, 3}, {415, 1, 0, 0, 0, 3},
+    {416, 1, 0, 523, 5, 3}, {417, 2, 0, 0, 0, 3}, {419, 2, 0, 0, 0, 3}, {376, 2, 0, 528, 1, 1},
+    {379, 2, 0, 0, 0, 1}, {381, 2, 0, 529, 1, 1}, {383, 2, 0, 0, 0, 1}, {421, 3, 0, 0, 0, 1},
+    {0, 0, 0, 530, 8, 1}, {0, 0, 0, 538, 4, 1}, {0, 0, 0, 542, 6, 1}, {0, 0, 0, 548, 8, 1},
+    {0, 0, 0, 556, 4, 1}, {0, 0, 0, 560, 2, 1}, {410, 1, 0, 0, 0, 1}, {0, 0, 0, 562, 8, 1},
+    {0, 0, 0, 570, 6, 1}, {417, 2, 0, 576, 3, 1}, {419, 2, 0, 579, 3, 1}, {385, 2, 0, 0, 0, 1},
+    {387, 2, 0, 0, 0, 1}, {389, 2, 0, 582, 1, 1}, {424, 1, 0, 0, 0, 3}, {395, 1, 0, 0, 0, 1},
+    {401, 1, 0, 0, 0, 1}, {0, 0, 0, 583, 2, 3}, {425, 2, 0, 0, 0, 3}, {427, 2, 0, 0, 0, 3},
+    {413, 1, 0, 0, 0, 1}, {408, 1, 0, 0, 0, 1}, {429, 1, 0, 0, 0, 3}, {430, 1, 0, 0, 0, 3},
+    {431, 1, 0, 0, 0, 3}, {432, 1, 0, 0, 0, 3}, {433, 1, 0, 0, 0, 3}, {434, 1, 0, 0, 0, 3},
+    {435, 1, 0, 0, 0, 3}, {436, 1, 0, 0, 0, 3}, {437, 1, 0, 0, 0, 3}, {438, 1, 0, 0, 0, 3},
+    {439, 1, 0, 0, 0, 3}, {440, 1, 0, 0, 0, 3}, {403, 1, 0, 0, 0, 1}, {409, 1, 0, 0, 0, 1},
+    {398, 1, 0, 0, 0, 1}, {441, 1, 0, 0, 0, 3}, {442, 1, 0, 0, 0, 3}, {443, 1, 0, 0, 0, 3},
+    {444, 1, 0, 0, 0, 3}, {445, 1, 0, 0, 0, 3}, {446, 1, 0, 0, 0, 3}, {447, 2, 0, 0, 0, 3},
+    {449, 2, 0, 0, 0, 3}, {451, 1, 0, 0, 0, 3}, {452, 2, 0, 0, 0, 3}, {454, 1, 0, 0, 0, 3},
+    {455, 1, 0, 0, 0, 3}, {456, 1, 0, 585, 1, 3}, {457, 2, 0, 0, 0, 3}, {459, 1, 0, 0, 0, 3},
+    {460, 1, 0, 0, 0, 3}, {461, 1, 0, 0, 0, 3}, {462, 1, 0, 0, 0, 3}, {463, 2, 0, 0, 0, 3},
+    {465, 2, 0, 0, 0, 3}, {467, 2, 0, 0, 0, 3}, {469, 1, 0, 0, 0, 3}, {470, 1, 0, 586, 2, 3},
+    {471, 1, 0, 0, 0, 3}, {472, 1, 0, 0, 0, 3}, {473, 1, 0, 588, 1, 3}, {474, 1, 0, 0, 0, 3},
+    {475, 1, 0, 589, 3, 3}, {476, 1, 0, 592, 2, 3}, {477, 1, 0, 594, 1, 3}, {478, 1, 0, 595, 4, 3},
+    {479, 2, 0, 0, 0, 3}, {481, 1, 0, 599, 1, 3}, {482, 1, 0, 0, 0, 3}, {483, 1, 0, 0, 0, 3},
+    {484, 1, 0, 0, 0, 3}, {485, 1, 0, 600, 1, 3}, {486, 1, 0, 0, 0, 3}, {487, 1, 0, 0, 0, 3},
+    {488, 1, 0, 0, 0, 3}, {489, 1, 0, 0, 0, 3}, {490, 1, 0, 601, 4, 3}, {491, 1, 0, 0, 0, 3},
+    {492, 1, 0, 0, 0, 3}, {493, 1, 0, 0, 0, 3}, {494, 1, 0, 605, 1, 3}, {495, 1, 0, 0, 0, 3},
+    {496, 1, 0, 0, 0, 3}, {497, 1, 0, 0, 0, 3}, {498, 1, 0, 606, 1, 3}, {499, 1, 0, 0, 0, 3},
+    {500, 1, 0, 607, 1, 3}, {501, 1, 0, 0, 0, 3}, {502, 1, 0, 0, 0, 3}, {0, 0, 0, 608, 2, 1},
+    {0, 0, 0, 610, 1, 1}, {0, 0, 0, 611, 3, 1}, {0, 0, 0, 614, 2, 1}, {0, 0, 0, 616, 1, 1},
+    {0, 0, 0, 617, 4, 1}, {479, 2, 0, 0, 0, 1}, {0, 0, 0, 621, 1, 1}, {0, 0, 0, 622, 1, 1},
+    {0, 0, 0, 623, 4, 1}, {0, 0, 0, 627, 1, 1}, {0, 0, 0, 628, 1, 1}, {0, 0, 0, 629, 1, 1},
+    {447, 2, 0, 0, 0, 1}, {449, 2, 0, 0, 0, 1}, {452, 2, 0, 0, 0, 1}, {0, 0, 0, 630, 1, 1},
+    {457, 2, 0, 0, 0, 1}, {463, 2, 0, 0, 0, 1}, {465, 2, 0, 0, 0, 1}, {467, 2, 0, 0, 0, 1},
+    {503, 1, 0, 0, 0, 3}, {504, 1, 0, 0, 0, 3}, {505, 1, 0, 0, 0, 3}, {506, 1, 0, 0, 0, 3},
+    {507, 1, 0, 0, 0, 3}, {508, 1, 0, 0, 0, 3}, {509, 1, 0, 0, 0, 3}, {510, 1, 0, 0, 0, 3},
+    {511, 1, 0, 0, 0, 3}, {512, 1, 0, 0, 0, 3}, {513, 1, 0, 631, 1, 3}, {0, 0, 0, 632, 1, 1},
+    {514, 2, 0, 0, 0, 3}, {514, 2, 0, 0, 0, 1}, {516, 1, 0, 0, 0, 3}, {517, 1, 0, 0, 0, 3},
+    {518, 1, 0, 0, 0, 3}, {519, 1, 0, 0, 0, 3}, {520, 1, 0, 0, 0, 3}, {521, 1, 0, 0, 0, 3},
+    {522, 1, 0, 0, 0, 3}, {523, 1, 0, 0, 0, 3}, {524, 1, 0, 0, 0, 3}, {525, 1, 0, 0, 0, 3},
+    {526, 1, 0, 0, 0, 3}, {527, 1, 0, 0, 0, 3}, {528, 1, 0, 0, 0, 3}, {529, 1, 0, 0, 0, 3},
+    {530, 1, 0, 0, 0, 3}, {531, 1, 0, 0, 0, 3}, {532, 1, 0, 0, 0, 3}, {533, 1, 0, 0, 0, 3},
+    {534, 1, 0, 0, 0, 3}, {535, 1, 0, 0, 0, 3}, {536, 1, 0, 0, 0, 3}, {537, 1, 0, 0, 0, 3},
+    {538, 1, 0, 0, 0, 3}, {539, 1, 0, 0, 0, 3}, {540, 1, 0, 0, 0, 3}, {541, 1, 0, 0, 0, 3},
+    {542, 1, 0, 0, 0, 3}, {543, 1, 0, 0, 0, 3}, {544, 1, 0, 0, 0, 3}, {545, 1, 0, 0, 0, 3},
+    {546, 1, 0, 0, 0, 3}, {547, 1, 0, 0, 0, 3}, {548, 1, 0, 0, 0, 3}, {549, 2, 0, 0, 0, 3},
+    {549, 2, 0, 0, 0, 1}, {551, 1, 0, 0, 0, 3}, {552, 1, 0, 0, 0, 3}, {553, 1, 0, 0, 0, 3},
+    {554, 1, 0, 0, 0, 3}, {555, 1, 0, 0, 0, 3}, {556, 1, 0, 0, 0, 3}, {557, 2, 0, 0, 0, 3},
+    {557, 2, 0, 0, 0, 1}, {559, 2, 0, 0, 0, 3}, {559, 2, 0, 0, 0, 1}, {561, 1, 0, 0, 0, 3},
+    {562, 2, 0, 0, 0, 3}, {562, 2, 0, 0, 0, 1}, {564, 1, 0, 633, 1, 3}, {0, 0, 0, 634, 1, 1},
+    {565, 2, 0, 0, 0, 3}, {565, 2, 0, 0, 0, 1}, {567, 2, 0, 0, 0, 3}, {567, 2, 0, 0, 0, 1},
+    {569, 2, 0, 0, 0, 3}, {569, 2, 0, 0, 0, 1}, {571, 1, 0, 0, 0, 3}, {572, 2, 0, 0, 0, 3},
+    {572, 2, 0, 0, 0, 1}, {574, 2, 0, 0, 0, 3}, {574, 2, 0, 0, 0, 1}, {576, 2, 0, 0, 0, 3},
+    {576, 2, 0, 0, 0, 1}, {578, 1, 0, 635, 1, 3}, {0, 0, 0, 636, 1, 1}, {579, 2, 0, 0, 0, 3},
+    {579, 2, 0, 0, 0, 1}, {581, 2, 0, 0, 0, 3}, {581, 2, 0, 0, 0, 1}, {583, 2, 0, 0, 0, 3},
+    {583, 2, 0, 0, 0, 1}, {585, 2, 0, 0, 0, 3}, {585, 2, 0, 0, 0, 1}, {587, 2, 0, 0, 0, 3},
+    {587, 2, 0, 0, 0, 1}, {589, 2, 0, 0, 0, 3}, {589, 2, 0, 0, 0, 1}, {591, 1, 0, 0, 0, 3},
+    {592, 2, 0, 0, 0, 3}, {592, 2, 0, 0, 0, 1}, {594, 1, 0, 0, 0, 3}, {595, 1, 0, 0, 0, 3},
+    {596, 1, 0, 0, 0, 3}, {597, 1, 0, 0, 0, 3}, {598, 1, 0, 0, 0, 3}, {599, 1, 0, 0, 0, 3},
+    {600, 1, 0, 0, 0, 3}, {601, 1, 0, 0, 0, 3}, {602, 1, 0, 0, 0, 3}, {603, 1, 0, 0, 0, 3},
+    {604, 1, 0, 0, 0, 3}, {605, 1, 0, 0, 0, 3}, {606, 1, 0, 0, 0, 3}, {607, 1, 0, 0, 0, 3},
+    {608, 1, 0, 0, 0, 3}, {609, 1, 0, 0, 0, 3}, {610, 1, 0, 0, 0, 3}, {611, 1, 0, 0, 0, 3},
+    {612, 1, 0, 0, 0, 3}, {613, 1, 0, 0, 0, 3}, {614, 1, 0, 0, 0, 3}, {615, 1, 0, 0, 0, 3},
+    {616, 1, 0, 0, 0, 3}, {617, 1, 0, 0, 0, 3}, {618, 1, 0, 0, 0, 3}, {619, 1, 0, 0, 0, 3},
+    {620, 1, 0, 0, 0, 3}, {621, 1, 0, 0, 0, 3}, {622, 1, 0, 0, 0, 3}, {623, 1, 0, 0, 0, 3},
+    {624, 1, 0, 0, 0, 3}, {625, 1, 0, 0, 0, 3}, {626, 1, 0, 0, 0, 3}, {627, 1, 0, 0, 0, 3},
+    {628, 1, 0, 0, 0, 3}, {629, 1, 0, 0, 0, 3}, {630, 1, 0, 0, 0, 3}, {631, 1, 0, 0, 0, 3},
+    {632, 1, 0, 0, 0, 3}, {633, 1, 0, 0, 0, 3}, {634, 1, 0, 0, 0, 3}, {635, 1, 0, 0, 0, 3},
+    {636, 1, 0, 0, 0, 3}, {637, 1, 0, 0, 0, 3}, {638, 1, 0, 0, 0, 3}, {639, 1, 0, 0, 0, 3},
+    {640, 1, 0, 0, 0, 3}, {641, 1, 0, 0, 0, 3}, {642, 1, 0, 0, 0, 3}, {643, 1, 0, 0, 0, 3},
+    {644, 1, 0, 0, 0, 3}, {645, 1, 0, 0, 0, 3}, {646, 1, 0, 0, 0, 3}, {647, 1, 0, 0, 0, 3},
+    {648, 1, 0, 0, 0, 3}, {649, 1, 0, 0, 0, 3}, {650, 1, 0, 0, 0, 3}, {651, 1, 0, 0, 0, 3},
+    {652, 1, 0, 0, 0, 3}, {653, 1, 0, 0, 0, 3}, {654, 1, 0, 0, 0, 3}, {655, 1, 0, 0, 0, 3},
+    {656, 1, 0, 0, 0, 3}, {657, 1, 0, 0, 0, 3}, {658, 1, 0, 0, 0, 3}, {0, 0, 222, 0, 0, 1},
+    {0, 0, 228, 0, 0, 1}, {0, 0, 10, 0, 0, 1}, {0, 0, 11, 0, 0, 1}, {0, 0, 12, 0, 0, 1},
+    {0, 0, 13, 0, 0, 1}, {0, 0, 14, 0, 0, 1}, {0, 0, 15, 0, 0, 1}, {0, 0, 16, 0, 0, 1},
+    {0, 0, 17, 0, 0, 1}, {0, 0, 18, 0, 0, 1}, {0, 0, 19, 0, 0, 1}, {0, 0, 20, 0, 0, 1},
+    {0, 0, 21, 0, 0, 1}, {0, 0, 22, 0, 0, 1}, {0, 0, 23, 0, 0, 1}, {0, 0, 24, 0, 0, 1},
+    {0, 0, 25, 0, 0, 1}, {0, 0, 30, 0, 0, 1}, {0, 0, 31, 0, 0, 1}, {0, 0, 32, 0, 0, 1},
+    {659, 2, 0, 0, 0, 1}, {661, 2, 0, 0, 0, 1}, {663, 2, 0, 0, 0, 1}, {665, 2, 0, 0, 0, 1},
+    {667, 2, 0, 0, 0, 1}, {0, 0, 0, 637, 3, 1}, {0, 0, 0, 640, 1, 1}, {0, 0, 0, 641, 1, 1},
+    {0, 0, 27, 0, 0, 1}, {0, 0, 28, 0, 0, 1}, {0, 0, 29, 0, 0, 1}, {0, 0, 33, 0, 0, 1},
+    {0, 0, 34, 0, 0, 1}, {0, 0, 35, 0, 0, 1}, {669, 2, 0, 0, 0, 1}, {0, 0, 0, 642, 1, 1},
+    {671, 2, 0, 0, 0, 1}, {0, 0, 0, 643, 1, 1}, {673, 2, 0, 0, 0, 1}, {0, 0, 0, 644, 1, 1},
+    {0, 0, 36, 0, 0, 1}, {0, 0, 0, 645, 1, 1}, {675, 2, 0, 0, 0, 1}, {0, 0, 0, 646, 1, 1},
+    {677, 2, 0, 0, 0, 1}, {0, 0, 0, 647, 1, 1}, {679, 2, 0, 0, 0, 1}, {0, 0, 7, 0, 0, 1},
+    {0, 0, 9, 0, 0, 1}, {681, 2, 0, 0, 0, 1}, {683, 2, 0, 0, 0, 1}, {685, 2, 0, 0, 0, 1},
+    {687, 2, 0, 0, 0, 1}, {689, 2, 0, 0, 0, 1}, {691, 2, 0, 0, 0, 1}, {693, 2, 0, 0, 0, 1},
+    {695, 2, 0, 0, 0, 1}, {0, 0, 0, 648, 2, 1}, {697, 2, 0, 0, 0, 1}, {699, 2, 0, 0, 0, 1},
+    {701, 2, 0, 0, 0, 1}, {703, 2, 0, 0, 0, 1}, {705, 2, 0, 0, 0, 1}, {707, 2, 0, 0, 0, 1},
+    {709, 2, 0, 0, 0, 1}, {711, 2, 0, 0, 0, 1}, {713, 2, 0, 0, 0, 1}, {715, 2, 0, 0, 0, 1},
+    {717, 2, 0, 0, 0, 1}, {0, 0, 0, 650, 3, 1}, {719, 2, 0, 0, 0, 1}, {721, 2, 0, 0, 0, 1},
+    {723, 2, 0, 0, 0, 1}, {725, 2, 0, 0, 0, 1}, {727, 2, 0, 0, 0, 1}, {0, 0, 0, 653, 1, 1},
+    {729, 2, 0, 0, 0, 1}, {0, 0, 0, 654, 2, 1}, {0, 0, 0, 656, 1, 1}, {731, 2, 0, 0, 0, 1},
+    {733, 2, 0, 0, 0, 1}, {735, 2, 0, 0, 0, 1}, {0, 0, 0, 657, 1, 1}, {737, 2, 0, 0, 0, 1},
+    {0, 0, 84, 0, 0, 1}, {0, 0, 91, 0, 0, 1}, {0, 0, 0, 658, 1, 1}, {739, 2, 0, 0, 0, 1},
+    {0, 0, 0, 659, 3, 1}, {741, 2, 0, 0, 0, 1}, {743, 2, 0, 0, 0, 1}, {745, 2, 0, 662, 1, 1},
+    {747, 3, 0, 0, 0, 1}, {0, 0, 0, 663, 2, 1}, {0, 0, 0, 665, 1, 1}, {750, 2, 0, 0, 0, 1},
+    {752, 2, 0, 0, 0, 1}, {754, 2, 0, 0, 0, 1}, {0, 0, 0, 666, 3, 1}, {756, 2, 0, 0, 0, 1},
+    {758, 2, 0, 669, 1, 1}, {760, 3, 0, 0, 0, 1}, {763, 2, 0, 0, 0, 1}, {0, 0, 103, 0, 0, 1},
+    {0, 0, 107, 0, 0, 1}, {0, 0, 118, 0, 0, 1}, {0, 0, 122, 0, 0, 1}, {765, 2, 0, 0, 0, 1},
+    {767, 2, 0, 0, 0, 1}, {769, 2, 0, 0, 0, 1}, {771, 2, 0, 0, 0, 1}, {773, 2, 0, 0, 0, 1},
+    {775, 2, 0, 0, 0, 1}, {0, 0, 129, 0, 0, 1}, {0, 0, 130, 0, 0, 1}, {777, 2, 0, 0, 0, 1},
+    {0, 0, 132, 0, 0, 1}, {779, 2, 0, 0, 0, 1}, {781, 2, 0, 0, 0, 1}, {783, 2, 0, 0, 0, 1},
+    {785, 2, 0, 0, 0, 1}, {787, 2, 0, 0, 0, 1}, {789, 2, 0, 0, 0, 1}, {791, 2, 0, 0, 0, 1},
+    {793, 2, 0, 0, 0, 1}, {795, 2, 0, 0, 0, 1}, {797, 2, 0, 0, 0, 1}, {0, 0, 0, 670, 1, 1},
+    {799, 2, 0, 0, 0, 1}, {801, 1, 0, 0, 0, 3}, {802, 1, 0, 0, 0, 3}, {803, 1, 0, 0, 0, 3},
+    {804, 1, 0, 0, 0, 3}, {805, 1, 0, 0, 0, 3}, {806, 1, 0, 0, 0, 3}, {807, 1, 0, 0, 0, 3},
+    {808, 1, 0, 0, 0, 3}, {809, 1, 0, 0, 0, 3}, {810, 1, 0, 0, 0, 3}, {811, 1, 0, 0, 0, 3},
+    {812, 1, 0, 0, 0, 3}, {813, 1, 0, 0, 0, 3}, {814, 1, 0, 0, 0, 3}, {815, 1, 0, 0, 0, 3},
+    {816, 1, 0, 0, 0, 3}, {817, 1, 0, 0, 0, 3}, {818, 1, 0, 0, 0, 3}, {819, 1, 0, 0, 0, 3},
+    {820, 1, 0, 0, 0, 3}, {821, 1, 0, 0, 0, 3}, {822, 1, 0, 0, 0, 3}, {823, 1, 0, 0, 0, 3},
+    {824, 1, 0, 0, 0, 3}, {825, 1, 0, 0, 0, 3}, {826, 1, 0, 0, 0, 3}, {827, 1, 0, 0, 0, 3},
+    {828, 1, 0, 0, 0, 3}, {829, 1, 0, 0, 0, 3}, {830, 1, 0, 0, 0, 3}, {831, 1, 0, 0, 0, 3},
+    {832, 1, 0, 0, 0, 3}, {833, 1, 0, 0, 0, 3}, {834, 1, 0, 0, 0, 3}, {835, 1, 0, 0, 0, 3},
+    {836, 1, 0, 0, 0, 3}, {837, 1, 0, 0, 0, 3}, {838, 1, 0, 0, 0, 3}, {839, 1, 0, 0, 0, 3},
+    {840, 1, 0, 0, 0, 3}, {0, 0, 0, 0, 0, 3}, {841, 1, 0, 0, 0, 1}, {842, 1, 0, 0, 0, 1},
+    {843, 1, 0, 0, 0, 1}, {844, 1, 0, 0, 0, 1}, {845, 1, 0, 0, 0, 1}, {846, 1, 0, 0, 0, 1},
+    {0, 0, 0, 671, 1, 1}, {847, 2, 0, 0, 0, 1}, {0, 0, 0, 672, 1, 1}, {849, 2, 0, 0, 0, 1},
+    {0, 0, 0, 673, 1, 1}, {851, 2, 0, 0, 0, 1}, {0, 0, 0, 674, 1, 1}, {853, 2, 0, 0, 0, 1},
+    {0, 0, 0, 675, 1, 1}, {855, 2, 0, 0, 0, 1}, {0, 0, 0, 676, 1, 1}, {857, 2, 0, 0, 0, 1},
+    {0, 0, 0, 677, 1, 1}, {859, 2, 0, 0, 0, 1}, {0, 0, 0, 678, 1, 1}, {861, 2, 0, 0, 0, 1},
+    {0, 0, 0, 679, 1, 1}, {0, 0, 0, 680, 1, 1}, {863, 2, 0, 0, 0, 1}, {865, 2, 0, 0, 0, 1},
+    {0, 0, 0, 681, 1, 1}, {867, 2, 0, 0, 0, 1}, {472, 1, 0, 0, 0, 1}, {474, 1, 0, 0, 0, 1},
+    {485, 1, 0, 0, 0, 1}, {488, 1, 0, 0, 0, 1}, {489, 1, 0, 0, 0, 1}, {497, 1, 0, 0, 0, 1},
+    {504, 1, 0, 0, 0, 1}, {869, 1, 0, 0, 0, 1}, {870, 1, 0, 0, 0, 3}, {871, 1, 0, 0, 0, 3},
+    {872, 1, 0, 0, 0, 3}, {873, 1, 0, 0, 0, 3}, {874, 1, 0, 0, 0, 3}, {875, 1, 0, 0, 0, 3},
+    {876, 1, 0, 0, 0, 3}, {877, 1, 0, 0, 0, 3}, {878, 1, 0, 0, 0, 3}, {879, 1, 0, 0, 0, 3},
+    {880, 1, 0, 0, 0, 3}, {881, 1, 0, 0, 0, 3}, {882, 1, 0, 0, 0, 3}, {883, 1, 0, 0, 0, 3},
+    {884, 1, 0, 0, 0, 3}, {885, 1, 0, 0, 0, 3}, {886, 1, 0, 0, 0, 3}, {887, 1, 0, 0, 0, 3},
+    {888, 1, 0, 0, 0, 3}, {889, 1, 0, 0, 0, 3}, {890, 1, 0, 0, 0, 3}, {891, 1, 0, 0, 0, 3},
+    {892, 1, 0, 0, 0, 3}, {893, 1, 0, 0, 0, 3}, {894, 1, 0, 0, 0, 3}, {895, 1, 0, 0, 0, 3},
+    {896, 1, 0, 0, 0, 3}, {897, 1, 0, 0, 0, 3}, {898, 1, 0, 0, 0, 3}, {899, 1, 0, 0, 0, 3},
+    {900, 1, 0, 0, 0, 3}, {901, 1, 0, 0, 0, 3}, {902, 1, 0, 0, 0, 3}, {903, 1, 0, 0, 0, 3},
+    {904, 1, 0, 0, 0, 3}, {905, 1, 0, 0, 0, 3}, {906, 1, 0, 0, 0, 3}, {907, 1, 0, 0, 0, 3},
+    {908, 1, 0, 0, 0, 3}, {909, 1, 0, 0, 0, 3}, {910, 1, 0, 0, 0, 3}, {911, 1, 0, 0, 0, 3},
+    {912, 1, 0, 0, 0, 3}, {913, 1, 0, 0, 0, 3}, {914, 1, 0, 0, 0, 3}, {915, 1, 0, 0, 0, 3},
+    {0, 0, 214, 0, 0, 1}, {0, 0, 218, 0, 0, 1}, {916, 2, 0, 0, 0, 3}, {916, 2, 0, 0, 0, 1},
+    {918, 2, 0, 0, 0, 3}, {918, 2, 0, 0, 0, 1}, {920, 2, 0, 0, 0, 3}, {920, 2, 0, 0, 0, 1},
+    {922, 2, 0, 0, 0, 3}, {922, 2, 0, 0, 0, 1}, {924, 3, 0, 0, 0, 3}, {924, 3, 0, 0, 0, 1},
+    {927, 2, 0, 0, 0, 3}, {927, 2, 0, 0, 0, 1}, {929, 2, 0, 0, 0, 3}, {929, 2, 0, 0, 0, 1},
+    {931, 2, 0, 0, 0, 3}, {931, 2, 0, 0, 0, 1}, {933, 2, 0, 0, 0, 3}, {933, 2, 0, 0, 0, 1},
+    {935, 2, 0, 0, 0, 3}, {935, 2, 0, 0, 0, 1}, {937, 3, 0, 0, 0, 3}, {937, 3, 0, 0, 0, 1},
+    {940, 3, 0, 0, 0, 3}, {940, 3, 0, 0, 0, 1}, {943, 2, 0, 0, 0, 3}, {943, 2, 0, 0, 0, 1},
+    {945, 2, 0, 0, 0, 3}, {945, 2, 0, 0, 0, 1}, {947, 3, 0, 0, 0, 3}, {947, 3, 0, 0, 0, 1},
+    {950, 2, 0, 0, 0, 3}, {950, 2, 0, 0, 0, 1}, {952, 2, 0, 0, 0, 3}, {952, 2, 0, 0, 0, 1},
+    {954, 2, 0, 0, 0, 3}, {954, 2, 0, 0, 0, 1}, {956, 2, 0, 0, 0, 3}, {956, 2, 0, 0, 0, 1},
+    {958, 2, 0, 0, 0, 3}, {958, 2, 0, 0, 0, 1}, {960, 2, 0, 0, 0, 3}, {960, 2, 0, 0, 0, 1},
+    {962, 2, 0, 0, 0, 3}, {962, 2, 0, 0, 0, 1}, {964, 2, 0, 0, 0, 3}, {964, 2, 0, 0, 0, 1},
+    {966, 3, 0, 0, 0, 3}, {966, 3, 0, 0, 0, 1}, {969, 2, 0, 0, 0, 3}, {969, 2, 0, 0, 0, 1},
+    {971, 2, 0, 0, 0, 3}, {971, 2, 0, 0, 0, 1}, {973, 2, 0, 0, 0, 3}, {973, 2, 0, 0, 0, 1},
+    {975, 2, 0, 682, 1, 3}, {975, 2, 0, 683, 1, 1}, {977, 3, 0, 0, 0, 3}, {977, 3, 0, 0, 0, 1},
+    {980, 2, 0, 0, 0, 3}, {980, 2, 0, 0, 0, 1}, {982, 2, 0, 0, 0, 3}, {982, 2, 0, 0, 0, 1},
+    {984, 2, 0, 0, 0, 3}, {984, 2, 0, 0, 0, 1}, {986, 2, 0, 0, 0, 3}, {986, 2, 0, 0, 0, 1},
+    {988, 2, 0, 0, 0, 3}, {988, 2, 0, 0, 0, 1}, {990, 2, 0, 0, 0, 3}, {990, 2, 0, 0, 0, 1},
+    {992, 2, 0, 0, 0, 3}, {992, 2, 0, 0, 0, 1}, {994, 2, 0, 0, 0, 3}, {994, 2, 0, 0, 0, 1},
+    {996, 2, 0, 0, 0, 3}, {996, 2, 0, 0, 0, 1}, {998, 3, 0, 0, 0, 3}, {998, 3, 0, 0, 0, 1},
+    {1001, 3, 0, 0, 0, 3}, {1001, 3, 0, 0, 0, 1}, {1004, 3, 0, 0, 0, 3}, {1004, 3, 0, 0, 0, 1},
+    {1007, 3, 0, 0, 0, 3}, {1007, 3, 0, 0, 0, 1}, {1010, 2, 0, 0, 0, 3}, {1010, 2, 0, 0, 0, 1},
+    {1012, 2, 0, 0, 0, 3}, {1012, 2, 0, 0, 0, 1}, {1014, 2, 0, 0, 0, 3}, {1014, 2, 0, 0, 0, 1},
+    {1016, 2, 0, 684, 1, 3}, {1016, 2, 0, 685, 1, 1}, {1018, 3, 0, 0, 0, 3}, {1018, 3, 0, 0, 0, 1},
+    {1021, 2, 0, 0, 0, 3}, {1021, 2, 0, 0, 0, 1}, {1023, 2, 0, 0, 0, 3}, {1023, 2, 0, 0, 0, 1},
+    {1025, 2, 0, 686, 1, 3}, {1025, 2, 0, 687, 1, 1}, {1027, 3, 0, 0, 0, 3}, {1027, 3, 0, 0, 0, 1},
+    {1030, 3, 0, 0, 0, 3}, {1030, 3, 0, 0, 0, 1}, {1033, 3, 0, 0, 0, 3}, {1033, 3, 0, 0, 0, 1},
+    {1036, 2, 0, 0, 0, 3}, {1036, 2, 0, 0, 0, 1}, {1038, 2, 0, 0, 0, 3}, {1038, 2, 0, 0, 0, 1},
+    {1040, 2, 0, 0, 0, 3}, {1040, 2, 0, 0, 0, 1}, {1042, 2, 0, 0, 0, 3}, {1042, 2, 0, 0, 0, 1},
+    {1044, 2, 0, 0, 0, 3}, {1044, 2, 0, 0, 0, 1}, {1046, 2, 0, 0, 0, 3}, {1046, 2, 0, 0, 0, 1},
+    {1048, 2, 0, 0, 0, 3}, {1048, 2, 0, 0, 0, 1}, {1050, 3, 0, 0, 0, 3}, {1050, 3, 0, 0, 0, 1},
+    {1053, 3, 0, 0, 0, 3}, {1053, 3, 0, 0, 0, 1}, {1056, 2, 0, 0, 0, 3}, {1056, 2, 0, 0, 0, 1},
+    {1058, 2, 0, 0, 0, 3}, {1058, 2, 0, 0, 0, 1}, {1060, 2, 0, 0, 0, 3}, {1060, 2, 0, 0, 0, 1},
+    {1062, 2, 0, 0, 0, 3}, {1062, 2, 0, 0, 0, 1}, {1064, 2, 0, 0, 0, 3}, {1064, 2, 0, 0, 0, 1},
+    {1066, 2, 0, 0, 0, 3}, {1066, 2, 0, 0, 0, 1}, {1068, 2, 0, 0, 0, 3}, {1068, 2, 0, 0, 0, 1},
+    {1070, 2, 0, 0, 0, 3}, {1070, 2, 0, 0, 0, 1}, {1072, 2, 0, 0, 0, 3}, {1072, 2, 0, 0, 0, 1},
+    {1074, 2, 0, 0, 0, 3}, {1074, 2, 0, 0, 0, 1}, {1076, 2, 0, 0, 0, 3}, {1076, 2, 0, 0, 0, 1},
+    {1078, 2, 0, 0, 0, 3}, {1078, 2, 0, 0, 0, 1}, {1080, 2, 0, 0, 0, 3}, {1080, 2, 0, 0, 0, 1},
+    {1082, 2, 0, 0, 0, 1}, {1084, 2, 0, 0, 0, 1}, {1086, 2, 0, 0, 0, 1}, {1088, 2, 0, 0, 0, 1},
+    {1090, 1, 0, 0, 0, 3}, {1091, 2, 0, 688, 2, 3}, {1091, 2, 0, 690, 2, 1}, {1093, 2, 0, 0, 0, 3},
+    {1093, 2, 0, 0, 0, 1}, {1095, 3, 0, 0, 0, 3}, {1095, 3, 0, 0, 0, 1}, {1098, 3, 0, 0, 0, 3},
+    {1098, 3, 0, 0, 0, 1}, {1101, 3, 0, 0, 0, 3}, {1101, 3, 0, 0, 0, 1}, {1104, 3, 0, 0, 0, 3},
+    {1104, 3, 0, 0, 0, 1}, {1107, 3, 0, 0, 0, 3}, {1107, 3, 0, 0, 0, 1}, {1110, 3, 0, 0, 0, 3},
+    {1110, 3, 0, 0, 0, 1}, {1113, 3, 0, 0, 0, 3}, {1113, 3, 0, 0, 0, 1}, {1116, 3, 0, 0, 0, 3},
+    {1116, 3, 0, 0, 0, 1}, {1119, 3, 0, 0, 0, 3}, {1119, 3, 0, 0, 0, 1}, {1122, 3, 0, 0, 0, 3},
+    {1122, 3, 0, 0, 0, 1}, {1125, 2, 0, 692, 1, 3}, {1125, 2, 0, 693, 1, 1}, {1127, 2, 0, 0, 0, 3},
+    {1127, 2, 0, 0, 0, 1}, {1129, 2, 0, 0, 0, 3}, {1129, 2, 0, 0, 0, 1}, {1131, 3, 0, 0, 0, 3},
+    {1131, 3, 0, 0, 0, 1}, {1134, 3, 0, 0, 0, 3}, {1134, 3, 0, 0, 0, 1}, {1137, 3, 0, 0, 0, 3},
+    {1137, 3, 0, 0, 0, 1}, {1140, 3, 0, 0, 0, 3}, {1140, 3, 0, 0, 0, 1}, {1143, 3, 0, 0, 0, 3},
+    {1143, 3, 0, 0, 0, 1}, {1146, 2, 0, 0, 0, 3}, {1146, 2, 0, 0, 0, 1}, {1148, 2, 0, 0, 0, 3},
+    {1148, 2, 0, 0, 0, 1}, {1150, 2, 0, 694, 1, 3}, {1150, 2, 0, 695, 1, 1}, {1152, 2, 0, 0, 0, 3},
+    {1152, 2, 0, 0, 0, 1}, {1154, 3, 0, 0, 0, 3}, {1154, 3, 0, 0, 0, 1}, {1157, 3, 0, 0, 0, 3},
+    {1157, 3, 0, 0, 0, 1}, {1160, 3, 0, 0, 0, 3}, {1160, 3, 0, 0, 0, 1}, {1163, 3, 0, 0, 0, 3},
+    {1163, 3, 0, 0, 0, 1}, {1166, 3, 0, 0, 0, 3}, {1166, 3, 0, 0, 0, 1}, {1169, 3, 0, 0, 0, 3},
+    {1169, 3, 0, 0, 0, 1}, {1172, 3, 0, 0, 0, 3}, {1172, 3, 0, 0, 0, 1}, {1175, 3, 0, 0, 0, 3},
+    {1175, 3, 0, 0, 0, 1}, {1178, 3, 0, 0, 0, 3}, {1178, 3, 0, 0, 0, 1}, {1181, 3, 0, 0, 0, 3},
+    {1181, 3, 0, 0, 0, 1}, {1184, 2, 0, 0, 0, 3}, {1184, 2, 0, 0, 0, 1}, {1186, 2, 0, 0, 0, 3},
+    {1186, 2, 0, 0, 0, 1}, {1188, 3, 0, 0, 0, 3}, {1188, 3, 0, 0, 0, 1}, {1191, 3, 0, 0, 0, 3},
+    {1191, 3, 0, 0, 0, 1}, {1194, 3, 0, 0, 0, 3}, {1194, 3, 0, 0, 0, 1}, {1197, 3, 0, 0, 0, 3},
+    {1197, 3, 0, 0, 0, 1}, {1200, 3, 0, 0, 0, 3}, {1200, 3, 0, 0, 0, 1}, {1203, 2, 0, 0, 0, 3},
+    {1203, 2, 0, 0, 0, 1}, {1205, 2, 0, 0, 0, 3}, {1205, 2, 0, 0, 0, 1}, {1207, 2, 0, 0, 0, 3},
+    {1207, 2, 0, 0, 0, 1}, {1209, 2, 0, 0, 0, 3}, {1209, 2, 0, 0, 0, 1}, {1211, 1, 0, 0, 0, 3},
+    {1212, 1, 0, 0, 0, 3}, {1213, 1, 0, 0, 0, 3}, {1214, 2, 0, 696, 4, 1}, {1216, 2, 0, 700, 4, 1},
+    {1218, 3, 0, 704, 1, 1}, {1221, 3, 0, 705, 1, 1}, {1224, 3, 0, 706, 1, 1}, {1227, 3, 0, 707, 1, 1},
+    {1230, 3, 0, 708, 1, 1}, {1233, 3, 0, 709, 1, 1}, {1214, 2, 0, 710, 4, 3}, {1216, 2, 0, 714, 4, 3},
+    {1218, 3, 0, 718, 1, 3}, {1221, 3, 0, 719, 1, 3}, {1224, 3, 0, 720, 1, 3}, {1227, 3, 0, 721, 1, 3},
+    {1230, 3, 0, 722, 1, 3}, {1233, 3, 0, 723, 1, 3}, {1236, 2, 0, 724, 2, 1}, {1238, 2, 0, 726, 2, 1},
+    {1240, 3, 0, 0, 0, 1}, {1243, 3, 0, 0, 0, 1}, {1246, 3, 0, 0, 0, 1}, {1249, 3, 0, 0, 0, 1},
+    {1236, 2, 0, 728, 2, 3}, {1238, 2, 0, 730, 2, 3}, {1240, 3, 0, 0, 0, 3}, {1243, 3, 0, 0, 0, 3},
+    {1246, 3, 0, 0, 0, 3}, {1249, 3, 0, 0, 0, 3}, {1252, 2, 0, 732, 4, 1}, {1254, 2, 0, 736, 4, 1},
+    {1256, 3, 0, 740, 1, 1}, {1259, 3, 0, 741, 1, 1}, {1262, 3, 0, 742, 1, 1}, {1265, 3, 0, 743, 1, 1},
+    {1268, 3, 0, 744, 1, 1}, {1271, 3, 0, 745, 1, 1}, {1252, 2, 0, 746, 4, 3}, {1254, 2, 0, 750, 4, 3},
+    {1256, 3, 0, 754, 1, 3}, {1259, 3, 0, 755, 1, 3}, {1262, 3, 0, 756, 1, 3}, {1265, 3, 0, 757, 1, 3},
+    {1268, 3, 0, 758, 1, 3}, {1271, 3, 0, 759, 1, 3}, {1274, 2, 0, 760, 3, 1}, {1276, 2, 0, 763, 3, 1},
+    {1278, 3, 0, 0, 0, 1}, {1281, 3, 0, 0, 0, 1}, {1284, 3, 0, 0, 0, 1}, {1287, 3, 0, 0, 0, 1},
+    {1290, 3, 0, 0, 0, 1}, {1293, 3, 0, 0, 0, 1}, {1274, 2, 0, 766, 3, 3}, {1276, 2, 0, 769, 3, 3},
+    {1278, 3, 0, 0, 0, 3}, {1281, 3, 0, 0, 0, 3}, {1284, 3, 0, 0, 0, 3}, {1287, 3, 0, 0, 0, 3},
+    {1290, 3, 0, 0, 0, 3}, {1293, 3, 0, 0, 0, 3}, {1296, 2, 0, 772, 2, 1}, {1298, 2, 0, 774, 2, 1},
+    {1300, 3, 0, 0, 0, 1}, {1303, 3, 0, 0, 0, 1}, {1306, 3, 0, 0, 0, 1}, {1309, 3, 0, 0, 0, 1},
+    {1296, 2, 0, 776, 2, 3}, {1298, 2, 0, 778, 2, 3}, {1300, 3, 0, 0, 0, 3}, {1303, 3, 0, 0, 0, 3},
+    {1306, 3, 0, 0, 0, 3}, {1309, 3, 0, 0, 0, 3}, {1312, 2, 0, 780, 3, 1}, {1314, 2, 0, 783, 3, 1},
+    {1316, 3, 0, 0, 0, 1}, {1319, 3, 0, 0, 0, 1}, {1322, 3, 0, 0, 0, 1}, {1325, 3, 0, 0, 0, 1},
+    {1328, 3, 0, 0, 0, 1}, {1331, 3, 0, 0, 0, 1}, {1314, 2, 0, 786, 3, 3}, {1319, 3, 0, 0, 0, 3},
+    {1325, 3, 0, 0, 0, 3}, {1331, 3, 0, 0, 0, 3}, {1334, 2, 0, 789, 4, 1}, {1336, 2, 0, 793, 4, 1},
+    {1338, 3, 0, 797, 1, 1}, {1341, 3, 0, 798, 1, 1}, {1344, 3, 0, 799, 1, 1}, {1347, 3, 0, 800, 1, 1},
+    {1350, 3, 0, 801, 1, 1}, {1353, 3, 0, 802, 1, 1}, {1334, 2, 0, 803, 4, 3}, {1336, 2, 0, 807, 4, 3},
+    {1338, 3, 0, 811, 1, 3}, {1341, 3, 0, 812, 1, 3}, {1344, 3, 0, 813, 1, 3}, {1347, 3, 0, 814, 1, 3},
+    {1350, 3, 0, 815, 1, 3}, {1353, 3, 0, 816, 1, 3}, {1356, 2, 0, 817, 1, 1}, {376, 2, 0, 0, 0, 1},
+    {1358, 2, 0, 0, 0, 1}, {1360, 2, 0, 818, 1, 1}, {381, 2, 0, 0, 0, 1}, {1362, 2, 0, 0, 0, 1},
+    {1364, 2, 0, 0, 0, 1}, {1366, 2, 0, 0, 0, 1}, {1368, 2, 0, 819, 1, 1}, {389, 2, 0, 0, 0, 1},
+    {1370, 3, 0, 0, 0, 1}, {1373, 3, 0, 0, 0, 1}, {1376, 4, 0, 0, 0, 1}, {1380, 4, 0, 0, 0, 1},
+    {1384, 4, 0, 0, 0, 1}, {1388, 4, 0, 0, 0, 1}, {1392, 4, 0, 0, 0, 1}, {1396, 4, 0, 0, 0, 1},
+    {1370, 3, 0, 0, 0, 3}, {1373, 3, 0, 0, 0, 3}, {1376, 4, 0, 0, 0, 3}, {1380, 4, 0, 0, 0, 3},
+    {1384, 4, 0, 0, 0, 3}, {1388, 4, 0, 0, 0, 3}, {1392, 4, 0, 0, 0, 3}, {1396, 4, 0, 0, 0, 3},
+    {1400, 3, 0, 0, 0, 1}, {1403, 3, 0, 0, 0, 1}, {1406, 4, 0, 0, 0, 1}, {1410, 4, 0, 0, 0, 1},
+    {1414, 4, 0, 0, 0, 1}, {1418, 4, 0, 0, 0, 1}, {1422, 4, 0, 0, 0, 1}, {1426, 4, 0, 0, 0, 1},
+    {1400, 3, 0, 0, 0, 3}, {1403, 3, 0, 0, 0, 3}, {1406, 4, 0, 0, 0, 3}, {1410, 4, 0, 0, 0, 3},
+    {1414, 4, 0, 0, 0, 3}, {1418, 4, 0, 0, 0, 3}, {1422, 4, 0, 0, 0, 3}, {1426, 4, 0, 0, 0, 3},
+    {1430, 3, 0, 0, 0, 1}, {1433, 3, 0, 0, 0, 1}, {1436, 4, 0, 0, 0, 1}, {1440, 4, 0, 0, 0, 1},
+    {1444, 4, 0, 0, 0, 1}, {1448, 4, 0, 0, 0, 1}, {1452, 4, 0, 0, 0, 1}, {1456, 4, 0, 0, 0, 1},
+    {1430, 3, 0, 0, 0, 3}, {1433, 3, 0, 0, 0, 3}, {1436, 4, 0, 0, 0, 3}, {1440, 4, 0, 0, 0, 3},
+    {1444, 4, 0, 0, 0, 3}, {1448, 4, 0, 0, 0, 3}, {1452, 4, 0, 0, 0, 3}, {1456, 4, 0, 0, 0, 3},
+    {1460, 2, 0, 0, 0, 1}, {1462, 2, 0, 0, 0, 1}, {1464, 3, 0, 0, 0, 1}, {1467, 2, 0, 0, 0, 1},
+    {1469, 3, 0, 0, 0, 1}, {1472, 2, 0, 820, 1, 1}, {1474, 3, 0, 0, 0, 1}, {1460, 2, 0, 0, 0, 3},
+    {1462, 2, 0, 0, 0, 3}, {1356, 2, 0, 0, 0, 3}, {1467, 2, 0, 0, 0, 3}, {402, 1, 0, 0, 0, 1},
+    {0, 0, 0, 821, 3, 0}, {1477, 2, 0, 0, 0, 0}, {1479, 3, 0, 0, 0, 1}, {1482, 2, 0, 0, 0, 1},
+    {1484, 3, 0, 0, 0, 1}, {1487, 2, 0, 824, 1, 1}, {1489, 3, 0, 0, 0, 1}, {1358, 2, 0, 0, 0, 3},
+    {1360, 2, 0, 0, 0, 3}, {1482, 2, 0, 0, 0, 3}, {1492, 2, 0, 0, 0, 0}, {1494, 2, 0, 0, 0, 0},
+    {1496, 2, 0, 0, 0, 0}, {1498, 2, 0, 0, 0, 1}, {1500, 2, 0, 0, 0, 1}, {1502, 3, 0, 0, 0, 1},
+    {1505, 2, 0, 0, 0, 1}, {1507, 3, 0, 0, 0, 1}, {1498, 2, 0, 0, 0, 3}, {1500, 2, 0, 0, 0, 3},
+    {1362, 2, 0, 0, 0, 3}, {1510, 2, 0, 0, 0, 0}, {1512, 2, 0, 0, 0, 0}, {1514, 2, 0, 0, 0, 0},
+    {1516, 2, 0, 0, 0, 1}, {1518, 2, 0, 0, 0, 1}, {1520, 3, 0, 0, 0, 1}, {1523, 2, 0, 0, 0, 1},
+    {1525, 2, 0, 0, 0, 1}, {1527, 2, 0, 0, 0, 1}, {1529, 3, 0, 0, 0, 1}, {1516, 2, 0, 0, 0, 3},
+    {1518, 2, 0, 0, 0, 3}, {1366, 2, 0, 0, 0, 3}, {1525, 2, 0, 0, 0, 3}, {1532, 2, 0, 0, 0, 0},
+    {1534, 1, 0, 0, 0, 0}, {1535, 3, 0, 0, 0, 1}, {1538, 2, 0, 0, 0, 1}, {1540, 3, 0, 0, 0, 1},
+    {1543, 2, 0, 825, 1, 1}, {1545, 3, 0, 0, 0, 1}, {1364, 2, 0, 0, 0, 3}, {1368, 2, 0, 0, 0, 3},
+    {1538, 2, 0, 0, 0, 3}, {1548, 1, 0, 0, 0, 0}, {0, 0, 0, 826, 3, 0}, {1549, 1, 0, 0, 0, 0},
+    {1550, 1, 0, 0, 0, 0}, {416, 1, 0, 0, 0, 3}, {11, 1, 0, 0, 0, 3}, {38, 2, 0, 0, 0, 3},
+    {1551, 1, 0, 0, 0, 3}, {1552, 1, 0, 0, 0, 1}, {1553, 1, 0, 0, 0, 1}, {1554, 1, 0, 0, 0, 1},
+    {1555, 1, 0, 0, 0, 1}, {1556, 1, 0, 0, 0, 1}, {1557, 1, 0, 0, 0, 1}, {1558, 1, 0, 0, 0, 1},
+    {1559, 1, 0, 0, 0, 1}, {1560, 1, 0, 0, 0, 1}, {1561, 1, 0, 0, 0, 1}, {1562, 1, 0, 0, 0, 1},
+    {1563, 1, 0, 0, 0, 1}, {1564, 1, 0, 0, 0, 1}, {1565, 1, 0, 0, 0, 1}, {1566, 1, 0, 0, 0, 1},
+    {1567, 1, 0, 0, 0, 1}, {1568, 1, 0, 0, 0, 3}, {0, 0, 0, 829, 1, 0}, {0, 0, 0, 830, 1, 0},
+    {0, 0, 0, 831, 1, 0}, {1569, 2, 0, 0, 0, 0}, {1571, 2, 0, 0, 0, 0}, {1573, 2, 0, 0, 0, 0},
+    {1575, 2, 0, 0, 0, 0}, {1577, 2, 0, 0, 0, 0}, {1579, 2, 0, 0, 0, 0}, {0, 0, 0, 832, 1, 0},
+    {0, 0, 0, 833, 1, 0}, {0, 0, 0, 834, 1, 0}, {0, 0, 0, 835, 1, 0}, {1581, 2, 0, 0, 0, 0},
+    {0, 0, 0, 836, 1, 0}, {1583, 2, 0, 0, 0, 0}, {0, 0, 0, 837, 1, 0}, {1585, 2, 0, 0, 0, 0},
+    {0, 0, 0, 838, 1, 0}, {1587, 2, 0, 0, 0, 0}, {0, 0, 0, 839, 1, 0}, {1589, 2, 0, 0, 0, 0},
+    {0, 0, 0, 840, 1, 0}, {1591, 2, 0, 0, 0, 0}, {0, 0, 0, 841, 1, 0}, {1593, 2, 0, 0, 0, 0},
+    {0, 0, 0, 842, 1, 0}, {1595, 2, 0, 0, 0, 0}, {0, 0, 0, 843, 1, 0}, {1597, 2, 0, 0, 0, 0},
+    {0, 0, 0, 844, 1, 0}, {1599, 2, 0, 0, 0, 0}, {0, 0, 0, 845, 1, 0}, {1601, 2, 0, 0, 0, 0},
+    {0, 0, 0, 846, 1, 0}, {0, 0, 0, 847, 1, 0}, {1603, 2, 0, 0, 0, 0}, {1605, 2, 0, 0, 0, 0},
+    {1607, 2, 0, 0, 0, 0}, {1609, 2, 0, 0, 0, 0}, {1611, 2, 0, 0, 0, 0}, {0, 0, 0, 848, 1, 0},
+    {0, 0, 0, 849, 1, 0}, {1613, 2, 0, 0, 0, 0}, {1615, 2, 0, 0, 0, 0}, {0, 0, 0, 850, 1, 0},
+    {0, 0, 0, 851, 1, 0}, {1617, 2, 0, 0, 0, 0}, {1619, 2, 0, 0, 0, 0}, {0, 0, 0, 852, 1, 0},
+    {0, 0, 0, 853, 1, 0}, {0, 0, 0, 854, 1, 0}, {0, 0, 0, 855, 1, 0}, {1621, 2, 0, 0, 0, 0},
+    {1623, 2, 0, 0, 0, 0}, {0, 0, 0, 856, 1, 0}, {0, 0, 0, 857, 1, 0}, {1625, 2, 0, 0, 0, 0},
+    {1627, 2, 0, 0, 0, 0}, {0, 0, 0, 858, 1, 0}, {0, 0, 0, 859, 1, 0}, {1629, 2, 0, 0, 0, 0},
+    {1631, 2, 0, 0, 0, 0}, {0, 0, 0, 860, 1, 0}, {0, 0, 0, 861, 1, 0}, {0, 0, 0, 862, 1, 0},
+    {0, 0, 0, 863, 1, 0}, {0, 0, 0, 864, 1, 0}, {0, 0, 0, 865, 1, 0}, {1633, 2, 0, 0, 0, 0},
+    {1635, 2, 0, 0, 0, 0}, {1637, 2, 0, 0, 0, 0}, {1639, 2, 0, 0, 0, 0}, {0, 0, 0, 866, 1, 0},
+    {0, 0, 0, 867, 1, 0}, {0, 0, 0, 868, 1, 0}, {0, 0, 0, 869, 1, 0}, {1641, 2, 0, 0, 0, 0},
+    {1643, 2, 0, 0, 0, 0}, {1645, 2, 0, 0, 0, 0}, {1647, 2, 0, 0, 0, 0}, {1649, 2, 0, 0, 0, 0},
+    {1651, 2, 0, 0, 0, 0}, {1653, 2, 0, 0, 0, 0}, {1655, 2, 0, 0, 0, 0}, {1657, 1, 0, 0, 0, 0},
+    {1658, 1, 0, 0, 0, 0}, {1659, 1, 0, 0, 0, 0}, {1660, 1, 0, 0, 0, 0}, {1661, 1, 0, 0, 0, 0},
+    {1662, 1, 0, 0, 0, 0}, {1663, 1, 0, 0, 0, 0}, {1664, 1, 0, 0, 0, 0}, {1665, 1, 0, 0, 0, 0},
+    {1666, 1, 0, 0, 0, 0}, {1667, 1, 0, 0, 0, 0}, {1668, 1, 0, 0, 0, 0}, {1669, 1, 0, 0, 0, 0},
+    {1670, 1, 0, 0, 0, 0}, {1671, 1, 0, 0, 0, 0}, {1672, 1, 0, 0, 0, 0}, {1673, 1, 0, 0, 0, 0},
+    {1674, 1, 0, 0, 0, 0}, {1675, 1, 0, 0, 0, 0}, {1676, 1, 0, 0, 0, 0}, {1677, 1, 0, 0, 0, 0},
+    {1678, 1, 0, 0, 0, 0}, {1679, 1, 0, 0, 0, 0}, {1680, 1, 0, 0, 0, 0}, {1681, 1, 0, 0, 0, 0},
+    {1682, 1, 0, 0, 0, 0}, {1683, 1, 0, 0, 0, 0}, {1684, 1, 0, 0, 0, 0}, {1685, 2, 0, 0, 0, 0},
+    {1687, 1, 0, 0, 0, 3}, {1688, 1, 0, 0, 0, 3}, {1689, 1, 0, 0, 0, 3}, {1690, 1, 0, 0, 0, 3},
+    {1691, 1, 0, 0, 0, 3}, {1692, 1, 0, 0, 0, 3}, {1693, 1, 0, 0, 0, 3}, {1694, 1, 0, 0, 0, 3},
+    {1695, 1, 0, 0, 0, 3}, {1696, 1, 0, 0, 0, 3}, {1697, 1, 0, 0, 0, 3}, {1698, 1, 0, 0, 0, 3},
+    {1699, 1, 0, 0, 0, 3}, {1700, 1, 0, 0, 0, 3}, {1701, 1, 0, 0, 0, 3}, {1702, 1, 0, 0, 0, 3},
+    {1703, 1, 0, 0, 0, 3}, {1704, 1, 0, 0, 0, 3}, {1705, 1, 0, 0, 0, 3}, {1706, 1, 0, 0, 0, 3},
+    {1707, 1, 0, 0, 0, 3}, {1708, 1, 0, 0, 0, 3}, {1709, 1, 0, 0, 0, 3}, {1710, 1, 0, 0, 0, 3},
+    {1711, 1, 0, 0, 0, 3}, {1712, 1, 0, 0, 0, 3}, {1713, 1, 0, 0, 0, 3}, {1714, 1, 0, 0, 0, 3},
+    {1715, 1, 0, 0, 0, 3}, {1716, 1, 0, 0, 0, 3}, {1717, 1, 0, 0, 0, 3}, {1718, 1, 0, 0, 0, 3},
+    {1719, 1, 0, 0, 0, 3}, {1720, 1, 0, 0, 0, 3}, {1721, 1, 0, 0, 0, 3}, {1722, 1, 0, 0, 0, 3},
+    {1723, 1, 0, 0, 0, 3}, {1724, 1, 0, 0, 0, 3}, {1725, 1, 0, 0, 0, 3}, {1726, 1, 0, 0, 0, 3},
+    {1727, 1, 0, 0, 0, 3}, {1728, 1, 0, 0, 0, 3}, {1729, 1, 0, 0, 0, 3}, {1730, 1, 0, 0, 0, 3},
+    {1731, 1, 0, 0, 0, 3}, {1732, 1, 0, 0, 0, 3}, {1733, 1, 0, 0, 0, 3}, {1734, 1, 0, 0, 0, 3},
+    {1735, 1, 0, 0, 0, 3}, {1736, 1, 0, 0, 0, 3}, {1737, 1, 0, 0, 0, 3}, {1738, 1, 0, 0, 0, 3},
+    {1739, 1, 0, 0, 0, 3}, {1740, 1, 0, 0, 0, 3}, {1741, 1, 0, 0, 0, 3}, {1742, 1, 0, 0, 0, 3},
+    {1743, 1, 0, 0, 0, 3}, {1744, 1, 0, 0, 0, 3}, {1745, 1, 0, 0, 0, 3}, {1746, 1, 0, 0, 0, 3},
+    {1747, 1, 0, 0, 0, 3}, {1748, 1, 0, 0, 0, 3}, {1749, 1, 0, 0, 0, 3}, {1750, 1, 0, 0, 0, 3},
+    {1751, 1, 0, 0, 0, 3}, {1752, 1, 0, 0, 0, 3}, {1753, 1, 0, 0, 0, 3}, {1754, 1, 0, 0, 0, 3},
+    {1755, 1, 0, 0, 0, 3}, {1756, 1, 0, 0, 0, 3}, {1757, 1, 0, 0, 0, 3}, {1758, 1, 0, 0, 0, 3},
+    {1759, 1, 0, 0, 0, 3}, {1760, 1, 0, 0, 0, 3}, {1761, 1, 0, 0, 0, 3}, {1762, 1, 0, 0, 0, 3},
+    {1763, 1, 0, 0, 0, 3}, {1764, 1, 0, 0, 0, 3}, {1765, 1, 0, 0, 0, 3}, {1766, 1, 0, 0, 0, 3},
+    {1767, 1, 0, 0, 0, 3}, {1768, 1, 0, 0, 0, 3}, {1769, 1, 0, 0, 0, 3}, {1770, 1, 0, 0, 0, 3},
+    {1771, 1, 0, 0, 0, 3}, {1772, 1, 0, 0, 0, 3}, {1773, 1, 0, 0, 0, 3}, {1774, 1, 0, 0, 0, 3},
+    {1775, 1, 0, 0, 0, 3}, {1776, 1, 0, 0, 0, 3}, {1777, 1, 0, 0, 0, 3}, {1778, 1, 0, 0, 0, 3},
+    {1779, 1, 0, 0, 0, 3}, {1780, 1, 0, 0, 0, 3}, {1781, 1, 0, 0, 0, 3}, {1782, 1, 0, 0, 0, 3},
+    {1783, 1, 0, 0, 0, 3}, {1784, 1, 0, 0, 0, 3}, {1785, 1, 0, 0, 0, 3}, {1786, 1, 0, 0, 0, 3},
+    {1787, 1, 0, 0, 0, 3}, {1788, 1, 0, 0, 0, 3}, {1789, 1, 0, 0, 0, 3}, {1790, 1, 0, 0, 0, 3},
+    {1791, 1, 0, 0, 0, 3}, {1792, 1, 0, 0, 0, 3}, {1793, 1, 0, 0, 0, 3}, {1794, 1, 0, 0, 0, 3},
+    {1795, 1, 0, 0, 0, 3}, {1796, 1, 0, 0, 0, 3}, {1797, 1, 0, 0, 0, 3}, {1798, 1, 0, 0, 0, 3},
+    {1799, 1, 0, 0, 0, 3}, {1800, 1, 0, 0, 0, 3}, {1801, 1, 0, 0, 0, 3}, {1802, 1, 0, 0, 0, 3},
+    {0, 0, 224, 0, 0, 1}, {0, 0, 0, 870, 1, 1}, {0, 0, 0, 871, 1, 1}, {1803, 2, 0, 0, 0, 1},
+    {0, 0, 0, 872, 1, 1}, {1805, 2, 0, 0, 0, 1}, {0, 0, 0, 873, 1, 1}, {1807, 2, 0, 0, 0, 1},
+    {0, 0, 0, 874, 1, 1}, {1809, 2, 0, 0, 0, 1}, {0, 0, 0, 875, 1, 1}, {1811, 2, 0, 0, 0, 1},
+    {0, 0, 0, 876, 1, 1}, {1813, 2, 0, 0, 0, 1}, {0, 0, 0, 877, 1, 1}, {1815, 2, 0, 0, 0, 1},
+    {0, 0, 0, 878, 1, 1}, {1817, 2, 0, 0, 0, 1}, {0, 0, 0, 879, 1, 1}, {1819, 2, 0, 0, 0, 1},
+    {0, 0, 0, 880, 1, 1}, {1821, 2, 0, 0, 0, 1}, {0, 0, 0, 881, 1, 1}, {1823, 2, 0, 0, 0, 1},
+    {0, 0, 0, 882, 1, 1}, {1825, 2, 0, 0, 0, 1}, {0, 0, 0, 883, 1, 1}, {1827, 2, 0, 0, 0, 1},
+    {0, 0, 0, 884, 1, 1}, {1829, 2, 0, 0, 0, 1}, {0, 0, 0, 885, 1, 1}, {1831, 2, 0, 0, 0, 1},
+    {0, 0, 0, 886, 2, 1}, {1833, 2, 0, 0, 0, 1}, {1835, 2, 0, 0, 0, 1}, {0, 0, 0, 888, 2, 1},
+    {1837, 2, 0, 0, 0, 1}, {1839, 2, 0, 0, 0, 1}, {0, 0, 0, 890, 2, 1}, {1841, 2, 0, 0, 0, 1},
+    {1843, 2, 0, 0, 0, 1}, {0, 0, 0, 892, 2, 1}, {1845, 2, 0, 0, 0, 1}, {1847, 2, 0, 0, 0, 1},
+    {0, 0, 0, 894, 2, 1}, {1849, 2, 0, 0, 0, 1}, {1851, 2, 0, 0, 0, 1}, {1853, 2, 0, 0, 0, 1},
+    {0, 0, 8, 0, 0, 1}, {0, 0, 0, 896, 1, 1}, {1855, 2, 0, 0, 0, 1}, {0, 0, 0, 897, 1, 1},
+    {0, 0, 0, 898, 1, 1}, {1857, 2, 0, 0, 0, 1}, {0, 0, 0, 899, 1, 1}, {1859, 2, 0, 0, 0, 1},
+    {0, 0, 0, 900, 1, 1}, {1861, 2, 0, 0, 0, 1}, {0, 0, 0, 901, 1, 1}, {1863, 2, 0, 0, 0, 1},
+    {0, 0, 0, 902, 1, 1}, {1865, 2, 0, 0, 0, 1}, {0, 0, 0, 903, 1, 1}, {1867, 2, 0, 0, 0, 1},
+    {0, 0, 0, 904, 1, 1}, {1869, 2, 0, 0, 0, 1}, {0, 0, 0, 905, 1, 1}, {1871, 2, 0, 0, 0, 1},
+    {0, 0, 0, 906, 1, 1}, {1873, 2, 0, 0, 0, 1}, {0, 0, 0, 907, 1, 1}, {1875, 2, 0, 0, 0, 1},
+    {0, 0, 0, 908, 1, 1}, {1877, 2, 0, 0, 0, 1}, {0, 0, 0, 909, 1, 1}, {1879, 2, 0, 0, 0, 1},
+    {0, 0, 0, 910, 1, 1}, {1881, 2, 0, 0, 0, 1}, {0, 0, 0, 911, 1, 1}, {1883, 2, 0, 0, 0, 1},
+    {0, 0, 0, 912, 1, 1}, {1885, 2, 0, 0, 0, 1}, {0, 0, 0, 913, 2, 1}, {1887, 2, 0, 0, 0, 1},
+    {1889, 2, 0, 0, 0, 1}, {0, 0, 0, 915, 2, 1}, {1891, 2, 0, 0, 0, 1}, {1893, 2, 0, 0, 0, 1},
+    {0, 0, 0, 917, 2, 1}, {1895, 2, 0, 0, 0, 1}, {1897, 2, 0, 0, 0, 1}, {0, 0, 0, 919, 2, 1},
+    {1899, 2, 0, 0, 0, 1}, {1901, 2, 0, 0, 0, 1}, {0, 0, 0, 921, 2, 1}, {1903, 2, 0, 0, 0, 1},
+    {1905, 2, 0, 0, 0, 1}, {0, 0, 0, 923, 1, 1}, {0, 0, 0, 924, 1, 1}, {0, 0, 0, 925, 1, 1},
+    {0, 0, 0, 926, 1, 1}, {1907, 2, 0, 0, 0, 1}, {1909, 2, 0, 0, 0, 1}, {1911, 2, 0, 0, 0, 1},
+    {1913, 2, 0, 0, 0, 1}, {1915, 2, 0, 0, 0, 1}, {0, 0, 0, 927, 1, 1}, {1917, 2, 0, 0, 0, 1},
+    {1919, 1, 0, 0, 0, 3}, {1920, 1, 0, 0, 0, 3}, {1921, 1, 0, 0, 0, 3}, {1922, 1, 0, 0, 0, 3},
+    {1923, 1, 0, 0, 0, 3}, {869, 1, 0, 0, 0, 3}, {1924, 1, 0, 0, 0, 3}, {1925, 1, 0, 0, 0, 3},
+    {1926, 1, 0, 0, 0, 3}, {1927, 1, 0, 0, 0, 3}, {1928, 1, 0, 0, 0, 3}, {1929, 1, 0, 0, 0, 3},
+    {1930, 1, 0, 0, 0, 3}, {1931, 1, 0, 0, 0, 3}, {1932, 1, 0, 0, 0, 3}, {1933, 1, 0, 0, 0, 3},
+    {1934, 1, 0, 0, 0, 3}, {1935, 1, 0, 0, 0, 3}, {1936, 1, 0, 0, 0, 3}, {1937, 1, 0, 0, 0, 3},
+    {1938, 1, 0, 0, 0, 3}, {1939, 1, 0, 0, 0, 3}, {1940, 1, 0, 0, 0, 3}, {1941, 1, 0, 0, 0, 3},
+    {1942, 1, 0, 0, 0, 3}, {1943, 1, 0, 0, 0, 3}, {1944, 1, 0, 0, 0, 3}, {1945, 1, 0, 0, 0, 3},
+    {1946, 1, 0, 0, 0, 3}, {1947, 1, 0, 0, 0, 3}, {1948, 1, 0, 0, 0, 3}, {1949, 1, 0, 0, 0, 3},
+    {1950, 1, 0, 0, 0, 3}, {1951, 1, 0, 0, 0, 3}, {1952, 1, 0, 0, 0, 3}, {1953, 1, 0, 0, 0, 3},
+    {1954, 1, 0, 0, 0, 3}, {1955, 1, 0, 0, 0, 3}, {1956, 1, 0, 0, 0, 3}, {1957, 1, 0, 0, 0, 3},
+    {1958, 1, 0, 0, 0, 3}, {1959, 1, 0, 0, 0, 3}, {1960, 1, 0, 0, 0, 3}, {1961, 1, 0, 0, 0, 3},
+    {1962, 1, 0, 0, 0, 3}, {1963, 1, 0, 0, 0, 3}, {1964, 1, 0, 0, 0, 3}, {1965, 1, 0, 0, 0, 3},
+    {1966, 1, 0, 0, 0, 3}, {1967, 1, 0, 0, 0, 3}, {1968, 1, 0, 0, 0, 3}, {1969, 1, 0, 0, 0, 3},
+    {1970, 1, 0, 0, 0, 3}, {1971, 1, 0, 0, 0, 3}, {1972, 1, 0, 0, 0, 3}, {1973, 1, 0, 0, 0, 3},
+    {1974, 1, 0, 0, 0, 3}, {1975, 1, 0, 0, 0, 3}, {1976, 1, 0, 0, 0, 3}, {1977, 1, 0, 0, 0, 3},
+    {1978, 1, 0, 0, 0, 3}, {1979, 1, 0, 0, 0, 3}, {1980, 1, 0, 0, 0, 3}, {1981, 1, 0, 0, 0, 3},
+    {1982, 1, 0, 0, 0, 3}, {1983, 1, 0, 0, 0, 3}, {1984, 1, 0, 0, 0, 3}, {1985, 1, 0, 0, 0, 3},
+    {1986, 1, 0, 0, 0, 3}, {1987, 1, 0, 0, 0, 3}, {1988, 1, 0, 0, 0, 3}, {1989, 1, 0, 0, 0, 3},
+    {1990, 1, 0, 0, 0, 3}, {1991, 1, 0, 0, 0, 3}, {1992, 1, 0, 0, 0, 3}, {1993, 1, 0, 0, 0, 3},
+    {1994, 1, 0, 0, 0, 3}, {1995, 1, 0, 0, 0, 3}, {1996, 1, 0, 0, 0, 3}, {1997, 1, 0, 0, 0, 3},
+    {1998, 1, 0, 0, 0, 3}, {1999, 1, 0, 0, 0, 3}, {2000, 1, 0, 0, 0, 3}, {2001, 1, 0, 0, 0, 3},
+    {2002, 1, 0, 0, 0, 3}, {2003, 1, 0, 0, 0, 3}, {2004, 1, 0, 0, 0, 3}, {2005, 1, 0, 0, 0, 3},
+    {2006, 1, 0, 0, 0, 3}, {2007, 1, 0, 0, 0, 3}, {2008, 1, 0, 0, 0, 3}, {2009, 1, 0, 0, 0, 3},
+    {2010, 1, 0, 0, 0, 3}, {2011, 1, 0, 0, 0, 3}, {2012, 1, 0, 0, 0, 3}, {2013, 1, 0, 0, 0, 3},
+    {2014, 1, 0, 0, 0, 3}, {2015, 1, 0, 0, 0, 3}, {2016, 1, 0, 0, 0, 3}, {2017, 1, 0, 0, 0, 3},
+    {2018, 1, 0, 0, 0, 3}, {2019, 1, 0, 0, 0, 3}, {2020, 1, 0, 0, 0, 3}, {2021, 1, 0, 0, 0, 3},
+    {2022, 1, 0, 0, 0, 3}, {2023, 1, 0, 0, 0, 3}, {2024, 1, 0, 0, 0, 3}, {2025, 1, 0, 0, 0, 3},
+    {2026, 1, 0, 0, 0, 3}, {2027, 1, 0, 0, 0, 3}, {2028, 1, 0, 0, 0, 3}, {2029, 1, 0, 0, 0, 3},
+    {2030, 1, 0, 0, 0, 3}, {2031, 1, 0, 0, 0, 3}, {2032, 1, 0, 0, 0, 3}, {2033, 1, 0, 0, 0, 3},
+    {2034, 1, 0, 0, 0, 3}, {2035, 1, 0, 0, 0, 3}, {2036, 1, 0, 0, 0, 3}, {2037, 1, 0, 0, 0, 3},
+    {2038, 1, 0, 0, 0, 3}, {2039, 1, 0, 0, 0, 3}, {2040, 1, 0, 0, 0, 3}, {2041, 1, 0, 0, 0, 1},
+    {2042, 1, 0, 0, 0, 1}, {2043, 1, 0, 0, 0, 1}, {2044, 1, 0, 0, 0, 1}, {2045, 1, 0, 0, 0, 1},
+    {2046, 1, 0, 0, 0, 1}, {2047, 1, 0, 0, 0, 1}, {2048, 1, 0, 0, 0, 1}, {2049, 1, 0, 0, 0, 1},
+    {2050, 1, 0, 0, 0, 1}, {2051, 1, 0, 0, 0, 1}, {2052, 1, 0, 0, 0, 1}, {2053, 1, 0, 0, 0, 1},
+    {2054, 1, 0, 0, 0, 1}, {2055, 1, 0, 0, 0, 1}, {2056, 1, 0, 0, 0, 1}, {2057, 1, 0, 0, 0, 1},
+    {2058, 1, 0, 0, 0, 1}, {2059, 1, 0, 0, 0, 1}, {2060, 1, 0, 0, 0, 1}, {2061, 1, 0, 0, 0, 1},
+    {2062, 1, 0, 0, 0, 1}, {2063, 1, 0, 0, 0, 1}, {2064, 1, 0, 0, 0, 1}, {2065, 1, 0, 0, 0, 1},
+    {2066, 1, 0, 0, 0, 1}, {2067, 1, 0, 0, 0, 1}, {2068, 1, 0, 0, 0, 1}, {2069, 1, 0, 0, 0, 1},
+    {2070, 1, 0, 0, 0, 1}, {2071, 1, 0, 0, 0, 1}, {2072, 1, 0, 0, 0, 1}, {2073, 1, 0, 0, 0, 1},
+    {2074, 1, 0, 0, 0, 1}, {2075, 1, 0, 0, 0, 1}, {2076, 1, 0, 0, 0, 1}, {2077, 1, 0, 0, 0, 1},
+    {2078, 1, 0, 0, 0, 1}, {2079, 1, 0, 0, 0, 1}, {2080, 1, 0, 0, 0, 1}, {2081, 1, 0, 0, 0, 1},
+    {2082, 1, 0, 0, 0, 1}, {2083, 1, 0, 0, 0, 1}, {2084, 1, 0, 0, 0, 1}, {2085, 1, 0, 0, 0, 1},
+    {2086, 1, 0, 0, 0, 1}, {2087, 1, 0, 0, 0, 1}, {2088, 1, 0, 0, 0, 1}, {2089, 1, 0, 0, 0, 1},
+    {2090, 1, 0, 0, 0, 1}, {2091, 1, 0, 0, 0, 1}, {2092, 1, 0, 0, 0, 1}, {2093, 1, 0, 0, 0, 1},
+    {2094, 1, 0, 0, 0, 1}, {2095, 1, 0, 0, 0, 1}, {2096, 1, 0, 0, 0, 1}, {2097, 1, 0, 0, 0, 1},
+    {2098, 1, 0, 0, 0, 1}, {2099, 1, 0, 0, 0, 1}, {2100, 1, 0, 0, 0, 1}, {2101, 1, 0, 0, 0, 1},
+    {2102, 1, 0, 0, 0, 1}, {2103, 1, 0, 0, 0, 1}, {2104, 1, 0, 0, 0, 1}, {2105, 1, 0, 0, 0, 1},
+    {2106, 1, 0, 0, 0, 1}, {2107, 1, 0, 0, 0, 1}, {2108, 1, 0, 0, 0, 1}, {2109, 1, 0, 0, 0, 1},
+    {2110, 1, 0, 0, 0, 1}, {2111, 1, 0, 0, 0, 1}, {2112, 1, 0, 0, 0, 1}, {2113, 1, 0, 0, 0, 1},
+    {2114, 1, 0, 0, 0, 1}, {2115, 1, 0, 0, 0, 1}, {2116, 1, 0, 0, 0, 1}, {2117, 1, 0, 0, 0, 1},
+    {2118, 1, 0, 0, 0, 1}, {2119, 1, 0, 0, 0, 1}, {2120, 1, 0, 0, 0, 1}, {2121, 1, 0, 0, 0, 1},
+    {2122, 1, 0, 0, 0, 1}, {2123, 1, 0, 0, 0, 1}, {2124, 1, 0, 0, 0, 1}, {2125, 1, 0, 0, 0, 1},
+    {2126, 1, 0, 0, 0, 1}, {2127, 1, 0, 0, 0, 1}, {2128, 1, 0, 0, 0, 1}, {2129, 1, 0, 0, 0, 1},
+    {2130, 1, 0, 0, 0, 1}, {2131, 1, 0, 0, 0, 1}, {2132, 1, 0, 0, 0, 1}, {2133, 1, 0, 0, 0, 1},
+    {2134, 1, 0, 0, 0, 1}, {2135, 1, 0, 0, 0, 1}, {2136, 1, 0, 0, 0, 1}, {2137, 1, 0, 0, 0, 1},
+    {2138, 1, 0, 0, 0, 1}, {2139, 1, 0, 0, 0, 1}, {2140, 1, 0, 0, 0, 1}, {2141, 1, 0, 0, 0, 1},
+    {2142, 1, 0, 0, 0, 1}, {2143, 1, 0, 0, 0, 1}, {2144, 1, 0, 0, 0, 1}, {2145, 1, 0, 0, 0, 1},
+    {2146, 1, 0, 0, 0, 1}, {2147, 1, 0, 0, 0, 1}, {2148, 1, 0, 0, 0, 1}, {2149, 1, 0, 0, 0, 1},
+    {2150, 1, 0, 0, 0, 1}, {2151, 1, 0, 0, 0, 1}, {2152, 1, 0, 0, 0, 1}, {2153, 1, 0, 0, 0, 1},
+    {2154, 1, 0, 0, 0, 1}, {2155, 1, 0, 0, 0, 1}, {2156, 1, 0, 0, 0, 1}, {2157, 1, 0, 0, 0, 1},
+    {2158, 1, 0, 0, 0, 1}, {2159, 1, 0, 0, 0, 1}, {2160, 1, 0, 0, 0, 1}, {2161, 1, 0, 0, 0, 1},
+    {2162, 1, 0, 0, 0, 1}, {2163, 1, 0, 0, 0, 1}, {2164, 1, 0, 0, 0, 1}, {2165, 1, 0, 0, 0, 1},
+    {2166, 1, 0, 0, 0, 1}, {2167, 1, 0, 0, 0, 1}, {2168, 1, 0, 0, 0, 1}, {2169, 1, 0, 0, 0, 1},
+    {2170, 1, 0, 0, 0, 1}, {2171, 1, 0, 0, 0, 1}, {2172, 1, 0, 0, 0, 1}, {2173, 1, 0, 0, 0, 1},
+    {2174, 1, 0, 0, 0, 1}, {2175, 1, 0, 0, 0, 1}, {2176, 1, 0, 0, 0, 1}, {2177, 1, 0, 0, 0, 1},
+    {2178, 1, 0, 0, 0, 1}, {2179, 1, 0, 0, 0, 1}, {2180, 1, 0, 0, 0, 1}, {2181, 1, 0, 0, 0, 1},
+    {2182, 1, 0, 0, 0, 1}, {2183, 1, 0, 0, 0, 1}, {2184, 1, 0, 0, 0, 1}, {2185, 1, 0, 0, 0, 1},
+    {2186, 1, 0, 0, 0, 1}, {2187, 1, 0, 0, 0, 1}, {2188, 1, 0, 0, 0, 1}, {2189, 1, 0, 0, 0, 1},
+    {2190, 1, 0, 0, 0, 1}, {2191, 1, 0, 0, 0, 1}, {2192, 1, 0, 0, 0, 1}, {2193, 1, 0, 0, 0, 1},
+    {2194, 1, 0, 0, 0, 1}, {2195, 1, 0, 0, 0, 1}, {2196, 1, 0, 0, 0, 1}, {2197, 1, 0, 0, 0, 1},
+    {2198, 1, 0, 0, 0, 1}, {2199, 1, 0, 0, 0, 1}, {2200, 1, 0, 0, 0, 1}, {2201, 1, 0, 0, 0, 1},
+    {2202, 1, 0, 0, 0, 1}, {2203, 1, 0, 0, 0, 1}, {2204, 1, 0, 0, 0, 1}, {2205, 1, 0, 0, 0, 1},
+    {2206, 1, 0, 0, 0, 1}, {2207, 1, 0, 0, 0, 1}, {2208, 1, 0, 0, 0, 1}, {2209, 1, 0, 0, 0, 1},
+    {2210, 1, 0, 0, 0, 1}, {2211, 1, 0, 0, 0, 1}, {2212, 1, 0, 0, 0, 1}, {2213, 1, 0, 0, 0, 1},
+    {2214, 1, 0, 0, 0, 1}, {2215, 1, 0, 0, 0, 1}, {2216, 1, 0, 0, 0, 1}, {2217, 1, 0, 0, 0, 1},
+    {2218, 1, 0, 0, 0, 1}, {2219, 1, 0, 0, 0, 1}, {2220, 1, 0, 0, 0, 1}, {2221, 1, 0, 0, 0, 1},
+    {2222, 1, 0, 0, 0, 1}, {2223, 1, 0, 0, 0, 1}, {2224, 1, 0, 0, 0, 1}, {2225, 1, 0, 0, 0, 1},
+    {2226, 1, 0, 0, 0, 1}, {2227, 1, 0, 0, 0, 1}, {2228, 1, 0, 0, 0, 1}, {2229, 1, 0, 0, 0, 1},
+    {2230, 1, 0, 0, 0, 1}, {2231, 1, 0, 0, 0, 1}, {2232, 1, 0, 0, 0, 1}, {2233, 1, 0, 0, 0, 1},
+    {2234, 1, 0, 0, 0, 1}, {2235, 1, 0, 0, 0, 1}, {2236, 1, 0, 0, 0, 1}, {2237, 1, 0, 0, 0, 1},
+    {2238, 1, 0, 0, 0, 1}, {2239, 1, 0, 0, 0, 1}, {2240, 1, 0, 0, 0, 1}, {2241, 1, 0, 0, 0, 1},
+    {2242, 1, 0, 0, 0, 1}, {2243, 1, 0, 0, 0, 1}, {2244, 1, 0, 0, 0, 1}, {2245, 1, 0, 0, 0, 1},
+    {2246, 1, 0, 0, 0, 1}, {2247, 1, 0, 0, 0, 1}, {2248, 1, 0, 0, 0, 1}, {2249, 1, 0, 0, 0, 1},
+    {2250, 1, 0, 0, 0, 1}, {2251, 1, 0, 0, 0, 1}, {2252, 1, 0, 0, 0, 1}, {2253, 1, 0, 0, 0, 1},
+    {2254, 1, 0, 0, 0, 1}, {2255, 1, 0, 0, 0, 1}, {2256, 1, 0, 0, 0, 1}, {2257, 1, 0, 0, 0, 1},
+    {2258, 1, 0, 0, 0, 1}, {2259, 1, 0, 0, 0, 1}, {2260, 1, 0, 0, 0, 1}, {2261, 1, 0, 0, 0, 1},
+    {2262, 1, 0, 0, 0, 1}, {2263, 1, 0, 0, 0, 1}, {2264, 1, 0, 0, 0, 1}, {2265, 1, 0, 0, 0, 1},
+    {2266, 1, 0, 0, 0, 1}, {2267, 1, 0, 0, 0, 1}, {2268, 1, 0, 0, 0, 1}, {2269, 1, 0, 0, 0, 1},
+    {2270, 1, 0, 0, 0, 1}, {2271, 1, 0, 0, 0, 1}, {2272, 1, 0, 0, 0, 1}, {2273, 1, 0, 0, 0, 1},
+    {2274, 1, 0, 0, 0, 1}, {2275, 1, 0, 0, 0, 1}, {2276, 1, 0, 0, 0, 1}, {2277, 1, 0, 0, 0, 1},
+    {2278, 1, 0, 0, 0, 1}, {2279, 1, 0, 0, 0, 1}, {2280, 1, 0, 0, 0, 1}, {2281, 1, 0, 0, 0, 1},
+    {2282, 1, 0, 0, 0, 1}, {2283, 1, 0, 0, 0, 1}, {2284, 1, 0, 0, 0, 1}, {2285, 1, 0, 0, 0, 1},
+    {2286, 1, 0, 0, 0, 1}, {2287, 1, 0, 0, 0, 1}, {2288, 1, 0, 0, 0, 1}, {2289, 1, 0, 0, 0, 1},
+    {2290, 1, 0, 0, 0, 1}, {2291, 1, 0, 0, 0, 1}, {2292, 1, 0, 0, 0, 1}, {2293, 1, 0, 0, 0, 1},
+    {2294, 1, 0, 0, 0, 1}, {2295, 1, 0, 0, 0, 1}, {2296, 1, 0, 0, 0, 1}, {2297, 1, 0, 0, 0, 1},
+    {2298, 1, 0, 0, 0, 1}, {2299, 1, 0, 0, 0, 1}, {2300, 1, 0, 0, 0, 1}, {2301, 1, 0, 0, 0, 1},
+    {2302, 1, 0, 0, 0, 1}, {2303, 1, 0, 0, 0, 1}, {2304, 1, 0, 0, 0, 1}, {2305, 1, 0, 0, 0, 1},
+    {2306, 1, 0, 0, 0, 1}, {2307, 1, 0, 0, 0, 1}, {2308, 1, 0, 0, 0, 1}, {2309, 1, 0, 0, 0, 1},
+    {2310, 1, 0, 0, 0, 1}, {2311, 1, 0, 0, 0, 1}, {2312, 1, 0, 0, 0, 1}, {2313, 1, 0, 0, 0, 1},
+    {2314, 1, 0, 0, 0, 1}, {2315, 1, 0, 0, 0, 1}, {2316, 1, 0, 0, 0, 1}, {2317, 1, 0, 0, 0, 1},
+    {2318, 1, 0, 0, 0, 1}, {2319, 1, 0, 0, 0, 1}, {2320, 1, 0, 0, 0, 1}, {2321, 1, 0, 0, 0, 1},
+    {2322, 1, 0, 0, 0, 1}, {2323, 1, 0, 0, 0, 1}, {2324, 1, 0, 0, 0, 1}, {2325, 1, 0, 0, 0, 1},
+    {2326, 1, 0, 0, 0, 1}, {2327, 1, 0, 0, 0, 1}, {2328, 1, 0, 0, 0, 1}, {2329, 1, 0, 0, 0, 1},
+    {2330, 1, 0, 0, 0, 1}, {2331, 1, 0, 0, 0, 1}, {2332, 1, 0, 0, 0, 1}, {2333, 1, 0, 0, 0, 1},
+    {2334, 1, 0, 0, 0, 1}, {2335, 1, 0, 0, 0, 1}, {2336, 1, 0, 0, 0, 1}, {2337, 1, 0, 0, 0, 1},
+    {2338, 1, 0, 0, 0, 1}, {2339, 1, 0, 0, 0, 1}, {2340, 1, 0, 0, 0, 1}, {2341, 1, 0, 0, 0, 1},
+    {2342, 1, 0, 0, 0, 1}, {2343, 1, 0, 0, 0, 1}, {2344, 1, 0, 0, 0, 1}, {2345, 1, 0, 0, 0, 1},
+    {2346, 1, 0, 0, 0, 1}, {2347, 1, 0, 0, 0, 1}, {2348, 1, 0, 0, 0, 1}, {2349, 1, 0, 0, 0, 1},
+    {2350, 1, 0, 0, 0, 1}, {2351, 1, 0, 0, 0, 1}, {2352, 1, 0, 0, 0, 1}, {2353, 1, 0, 0, 0, 1},
+    {2354, 1, 0, 0, 0, 1}, {2355, 1, 0, 0, 0, 1}, {2356, 1, 0, 0, 0, 1}, {2357, 1, 0, 0, 0, 1},
+    {2358, 1, 0, 0, 0, 1}, {2359, 1, 0, 0, 0, 1}, {2360, 1, 0, 0, 0, 1}, {2361, 1, 0, 0, 0, 1},
+    {2362, 1, 0, 0, 0, 1}, {2363, 1, 0, 0, 0, 1}, {2364, 1, 0, 0, 0, 1}, {2365, 1, 0, 0, 0, 1},
+    {2366, 1, 0, 0, 0, 1}, {2367, 1, 0, 0, 0, 1}, {2368, 1, 0, 0, 0, 1}, {2369, 1, 0, 0, 0, 1},
+    {2370, 1, 0, 0, 0, 1}, {2371, 1, 0, 0, 0, 1}, {2372, 1, 0, 0, 0, 1}, {2373, 1, 0, 0, 0, 1},
+    {2374, 1, 0, 0, 0, 1}, {2375, 1, 0, 0, 0, 1}, {2376, 1, 0, 0, 0, 1}, {2377, 1, 0, 0, 0, 1},
+    {2378, 1, 0, 0, 0, 1}, {2379, 1, 0, 0, 0, 1}, {2380, 1, 0, 0, 0, 1}, {2381, 1, 0, 0, 0, 1},
+    {2382, 1, 0, 0, 0, 1}, {2383, 1, 0, 0, 0, 1}, {2384, 1, 0, 0, 0, 1}, {2385, 1, 0, 0, 0, 1},
+    {2386, 1, 0, 0, 0, 1}, {2387, 1, 0, 0, 0, 1}, {2388, 1, 0, 0, 0, 1}, {2389, 1, 0, 0, 0, 1},
+    {2390, 1, 0, 0, 0, 1}, {2391, 1, 0, 0, 0, 1}, {2392, 1, 0, 0, 0, 1}, {2393, 1, 0, 0, 0, 1},
+    {2394, 1, 0, 0, 0, 1}, {2395, 1, 0, 0, 0, 1}, {2396, 1, 0, 0, 0, 1}, {2397, 1, 0, 0, 0, 1},
+    {2398, 1, 0, 0, 0, 1}, {2399, 1, 0, 0, 0, 1}, {2400, 1, 0, 0, 0, 1}, {2401, 1, 0, 0, 0, 1},
+    {2402, 1, 0, 0, 0, 1}, {2403, 1, 0, 0, 0, 1}, {2404, 1, 0, 0, 0, 1}, {2405, 1, 0, 0, 0, 1},
+    {2406, 1, 0, 0, 0, 1}, {2407, 1, 0, 0, 0, 1}, {2408, 1, 0, 0, 0, 1}, {2409, 1, 0, 0, 0, 1},
+    {2410, 1, 0, 0, 0, 1}, {2411, 1, 0, 0, 0, 1}, {2412, 1, 0, 0, 0, 1}, {2413, 1, 0, 0, 0, 1},
+    {2414, 1, 0, 0, 0, 1}, {2415, 1, 0, 0, 0, 1}, {2416, 1, 0, 0, 0, 1}, {2417, 1, 0, 0, 0, 1},
+    {2418, 1, 0, 0, 0, 1}, {2419, 1, 0, 0, 0, 1}, {2420, 1, 0, 0, 0, 1}, {2421, 1, 0, 0, 0, 1},
+    {2422, 1, 0, 0, 0, 1}, {2423, 1, 0, 0, 0, 1}, {2424, 1, 0, 0, 0, 1}, {2425, 1, 0, 0, 0, 1},
+    {2426, 1, 0, 0, 0, 1}, {2427, 1, 0, 0, 0, 1}, {2428, 1, 0, 0, 0, 1}, {2429, 1, 0, 0, 0, 1},
+    {2430, 1, 0, 0, 0, 1}, {2431, 1, 0, 0, 0, 1}, {2432, 1, 0, 0, 0, 1}, {2433, 1, 0, 0, 0, 1},
+    {2434, 1, 0, 0, 0, 1}, {2435, 1, 0, 0, 0, 1}, {2436, 1, 0, 0, 0, 1}, {2437, 1, 0, 0, 0, 1},
+    {2438, 1, 0, 0, 0, 1}, {2439, 1, 0, 0, 0, 1}, {2440, 1, 0, 0, 0, 1}, {2441, 1, 0, 0, 0, 1},
+    {2442, 1, 0, 0, 0, 1}, {2443, 1, 0, 0, 0, 1}, {2444, 1, 0, 0, 0, 1}, {2445, 1, 0, 0, 0, 1},
+    {2446, 1, 0, 0, 0, 1}, {2447, 1, 0, 0, 0, 1}, {2448, 1, 0, 0, 0, 1}, {2449, 1, 0, 0, 0, 1},
+    {2450, 1, 0, 0, 0, 1}, {2451, 1, 0, 0, 0, 1}, {2452, 1, 0, 0, 0, 1}, {2453, 1, 0, 0, 0, 1},
+    {2454, 1, 0, 0, 0, 1}, {2455, 1, 0, 0, 0, 1}, {2456, 1, 0, 0, 0, 1}, {2457, 1, 0, 0, 0, 1},
+    {2458, 1, 0, 0, 0, 1}, {2459, 1, 0, 0, 0, 1}, {2460, 1, 0, 0, 0, 1}, {2461, 1, 0, 0, 0, 1},
+    {2462, 1, 0, 0, 0, 1}, {2463, 1, 0, 0, 0, 1}, {2464, 1, 0, 0, 0, 1}, {2465, 1, 0, 0, 0, 1},
+    {2466, 1, 0, 0, 0, 1}, {2467, 1, 0, 0, 0, 1}, {2468, 1, 0, 0, 0, 1}, {2469, 1, 0, 0, 0, 1},
+    {2470, 1, 0, 0, 0, 1}, {2471, 1, 0, 0, 0, 1}, {2472, 1, 0, 0, 0, 1}, {2473, 1, 0, 0, 0, 1},
+    {2474, 1, 0, 0, 0, 1}, {2475, 1, 0, 0, 0, 1}, {2476, 1, 0, 0, 0, 1}, {2477, 1, 0, 0, 0, 1},
+    {2478, 1, 0, 0, 0, 1}, {2479, 1, 0, 0, 0, 1}, {2480, 1, 0, 0, 0, 1}, {2481, 1, 0, 0, 0, 1},
+    {2482, 1, 0, 0, 0, 1}, {2483, 1, 0, 0, 0, 1}, {2484, 1, 0, 0, 0, 1}, {2485, 1, 0, 0, 0, 1},
+    {2486, 1, 0, 0, 0, 1}, {2487, 1, 0, 0, 0, 1}, {2488, 1, 0, 0, 0, 1}, {2489, 1, 0, 0, 0, 1},
+    {2490, 1, 0, 0, 0, 1}, {2491, 1, 0, 0, 0, 1}, {2492, 1, 0, 0, 0, 1}, {2493, 1, 0, 0, 0, 1},
+    {2494, 1, 0, 0, 0, 1}, {2495, 1, 0, 0, 0, 1}, {2496, 1, 0, 0, 0, 1}, {2497, 1, 0, 0, 0, 1},
+    {2498, 1, 0, 0, 0, 1}, {2499, 1, 0, 0, 0, 1}, {2500, 1, 0, 0, 0, 1}, {2501, 1, 0, 0, 0, 1},
+    {2502, 1, 0, 0, 0, 1}, {2503, 1, 0, 0, 0, 1}, {2504, 1, 0, 0, 0, 1}, {2505, 1, 0, 0, 0, 1},
+    {2506, 1, 0, 0, 0, 1}, {2507, 1, 0, 0, 0, 1}, {2508, 1, 0, 0, 0, 1}, {2509, 1, 0, 0, 0, 1},
+    {2510, 1, 0, 0, 0, 1}, {2511, 1, 0, 0, 0, 1}, {2512, 1, 0, 0, 0, 1}, {2513, 1, 0, 0, 0, 1},
+    {2514, 1, 0, 0, 0, 1}, {2515, 1, 0, 0, 0, 1}, {2516, 1, 0, 0, 0, 1}, {2517, 1, 0, 0, 0, 1},
+    {2518, 1, 0, 0, 0, 1}, {2519, 1, 0, 0, 0, 1}, {2520, 1, 0, 0, 0, 1}, {2521, 1, 0, 0, 0, 1},
+    {2522, 1, 0, 0, 0, 1}, {2523, 1, 0, 0, 0, 1}, {2524, 1, 0, 0, 0, 1}, {2525, 1, 0, 0, 0, 1},
+    {2526, 1, 0, 0, 0, 1}, {2527, 1, 0, 0, 0, 1}, {2528, 1, 0, 0, 0, 1}, {2529, 1, 0, 0, 0, 1},
+    {2530, 1, 0, 0, 0, 1}, {2531, 1, 0, 0, 0, 1}, {2532, 1, 0, 0, 0, 1}, {2533, 1, 0, 0, 0, 1},
+    {2534, 1, 0, 0, 0, 1}, {2535, 1, 0, 0, 0, 1}, {2536, 1, 0, 0, 0, 1}, {2537, 1, 0, 0, 0, 1},
+    {2538, 1, 0, 0, 0, 1}, {2539, 1, 0, 0, 0, 1}, {2540, 1, 0, 0, 0, 1}, {2541, 1, 0, 0, 0, 1},
+    {2542, 1, 0, 0, 0, 1}, {2543, 1, 0, 0, 0, 1}, {2544, 1, 0, 0, 0, 1}, {2545, 1, 0, 0, 0, 1},
+    {2546, 2, 0, 0, 0, 1}, {0, 0, 26, 0, 0, 1}, {2548, 2, 0, 0, 0, 1}, {2550, 2, 0, 0, 0, 1},
+    {2552, 2, 0, 0, 0, 1}, {2554, 3, 0, 0, 0, 1}, {2557, 3, 0, 0, 0, 1}, {2560, 2, 0, 0, 0, 1},
+    {2562, 2, 0, 0, 0, 1}, {2564, 2, 0, 0, 0, 1}, {2566, 2, 0, 0, 0, 1}, {2568, 2, 0, 0, 0, 1},
+    {2570, 2, 0, 0, 0, 1}, {2572, 2, 0, 0, 0, 1}, {2574, 2, 0, 0, 0, 1}, {2576, 2, 0, 0, 0, 1},
+    {2578, 2, 0, 0, 0, 1}, {2580, 2, 0, 0, 0, 1}, {2582, 2, 0, 0, 0, 1}, {2584, 2, 0, 0, 0, 1},
+    {2586, 2, 0, 0, 0, 1}, {2588, 2, 0, 0, 0, 1}, {2590, 2, 0, 0, 0, 1}, {2592, 2, 0, 0, 0, 1},
+    {2594, 2, 0, 0, 0, 1}, {2596, 2, 0, 0, 0, 1}, {2598, 2, 0, 0, 0, 1}, {2600, 2, 0, 0, 0, 1},
+    {2602, 2, 0, 0, 0, 1}, {2604, 2, 0, 0, 0, 1}, {2606, 2, 0, 0, 0, 1}, {2608, 2, 0, 0, 0, 1},
+    {2610, 2, 0, 0, 0, 1}, {2612, 2, 0, 0, 0, 1}, {2614, 2, 0, 0, 0, 1}, {2616, 1, 0, 0, 0, 3},
+    {2617, 1, 0, 0, 0, 3}, {2618, 1, 0, 0, 0, 3}, {2619, 1, 0, 0, 0, 3}, {2620, 1, 0, 0, 0, 3},
+    {2621, 1, 0, 0, 0, 3}, {2622, 1, 0, 0, 0, 3}, {2623, 1, 0, 0, 0, 3}, {2624, 1, 0, 0, 0, 3},
+    {2625, 1, 0, 0, 0, 3}, {2626, 1, 0, 0, 0, 3}, {2627, 1, 0, 0, 0, 3}, {2628, 1, 0, 0, 0, 3},
+    {2629, 1, 0, 0, 0, 3}, {2630, 1, 0, 0, 0, 3}, {2631, 1, 0, 0, 0, 3}, {2632, 1, 0, 0, 0, 3},
+    {2633, 1, 0, 0, 0, 3}, {2634, 1, 0, 0, 0, 3}, {2635, 1, 0, 0, 0, 3}, {2636, 1, 0, 0, 0, 3},
+    {2637, 1, 0, 0, 0, 3}, {2638, 1, 0, 0, 0, 3}, {2639, 1, 0, 0, 0, 3}, {2640, 1, 0, 0, 0, 3},
+    {2641, 1, 0, 0, 0, 3}, {2642, 1, 0, 0, 0, 3}, {2643, 1, 0, 0, 0, 3}, {2644, 1, 0, 0, 0, 3},
+    {2645, 1, 0, 0, 0, 3}, {2646, 1, 0, 0, 0, 3}, {2647, 1, 0, 0, 0, 3}, {2648, 1, 0, 0, 0, 3},
+    {2649, 1, 0, 0, 0, 3}, {2650, 1, 0, 0, 0, 3}, {2651, 1, 0, 0, 0, 3}, {2652, 1, 0, 0, 0, 3},
+    {2653, 1, 0, 0, 0, 3}, {2654, 1, 0, 0, 0, 3}, {2655, 1, 0, 0, 0, 3}, {2656, 1, 0, 0, 0, 3},
+    {2657, 1, 0, 0, 0, 3}, {2658, 1, 0, 0, 0, 3}, {2659, 1, 0, 0, 0, 3}, {2660, 1, 0, 0, 0, 3},
+    {2661, 1, 0, 0, 0, 3}, {2662, 1, 0, 0, 0, 3}, {2663, 1, 0, 0, 0, 3}, {2664, 1, 0, 0, 0, 3},
+    {2665, 1, 0, 0, 0, 3}, {2666, 1, 0, 0, 0, 3}, {2667, 1, 0, 0, 0, 3}, {2668, 1, 0, 0, 0, 3},
+    {2669, 1, 0, 0, 0, 3}, {2670, 1, 0, 0, 0, 3}, {2671, 1, 0, 0, 0, 3}, {2672, 1, 0, 0, 0, 3},
+    {2673, 1, 0, 0, 0, 3}, {2674, 1, 0, 0, 0, 3}, {2675, 1, 0, 0, 0, 3}, {2676, 1, 0, 0, 0, 3},
+    {2677, 1, 0, 0, 0, 3}, {2678, 1, 0, 0, 0, 3}, {2679, 1, 0, 0, 0, 3}, {2680, 1, 0, 0, 0, 3},
+    {2681, 1, 0, 0, 0, 3}, {2682, 1, 0, 0, 0, 3}, {2683, 1, 0, 0, 0, 3}, {2684, 1, 0, 0, 0, 3},
+    {2685, 1, 0, 0, 0, 3}, {2686, 1, 0, 0, 0, 3}, {2687, 1, 0, 0, 0, 3}, {2688, 1, 0, 0, 0, 3},
+    {2689, 1, 0, 0, 0, 3}, {2690, 1, 0, 0, 0, 3}, {2691, 1, 0, 0, 0, 3}, {2692, 1, 0, 0, 0, 3},
+    {2693, 1, 0, 0, 0, 3}, {2694, 1, 0, 0, 0, 3}, {2695, 1, 0, 0, 0, 3}, {2696, 1, 0, 0, 0, 3},
+    {2697, 1, 0, 0, 0, 3}, {2698, 1, 0, 0, 0, 3}, {2699, 1, 0, 0, 0, 3}, {2700, 1, 0, 0, 0, 3},
+    {2701, 1, 0, 0, 0, 3}, {2702, 1, 0, 0, 0, 3}, {2703, 1, 0, 0, 0, 3}, {2704, 1, 0, 0, 0, 3},
+    {2705, 1, 0, 0, 0, 3}, {2706, 1, 0, 0, 0, 3}, {2707, 1, 0, 0, 0, 3}, {2708, 1, 0, 0, 0, 3},
+    {2709, 1, 0, 0, 0, 3}, {2710, 1, 0, 0, 0, 3}, {2711, 1, 0, 0, 0, 3}, {2712, 1, 0, 0, 0, 3},
+    {2713, 1, 0, 0, 0, 3}, {2714, 1, 0, 0, 0, 3}, {2715, 1, 0, 0, 0, 3}, {2716, 1, 0, 0, 0, 3},
+    {2717, 1, 0, 0, 0, 3}, {2718, 1, 0, 0, 0, 3}, {2719, 1, 0, 0, 0, 3}, {2720, 1, 0, 0, 0, 3},
+    {2721, 1, 0, 0, 0, 3}, {2722, 1, 0, 0, 0, 3}, {2723, 1, 0, 0, 0, 3}, {2724, 1, 0, 0, 0, 3},
+    {2725, 1, 0, 0, 0, 3}, {2726, 1, 0, 0, 0, 3}, {2727, 1, 0, 0, 0, 3}, {2728, 1, 0, 0, 0, 3},
+    {2729, 1, 0, 0, 0, 3}, {2730, 1, 0, 0, 0, 3}, {2731, 1, 0, 0, 0, 3}, {2732, 1, 0, 0, 0, 3},
+    {2733, 1, 0, 0, 0, 3}, {2734, 1, 0, 0, 0, 3}, {2735, 1, 0, 0, 0, 3}, {2736, 1, 0, 0, 0, 3},
+    {2737, 1, 0, 0, 0, 3}, {2738, 1, 0, 0, 0, 3}, {2739, 1, 0, 0, 0, 3}, {2740, 1, 0, 0, 0, 3},
+    {2741, 1, 0, 0, 0, 3}, {2742, 1, 0, 0, 0, 3}, {2743, 1, 0, 0, 0, 3}, {2744, 1, 0, 0, 0, 3},
+    {2745, 1, 0, 0, 0, 3}, {2746, 1, 0, 0, 0, 3}, {2747, 1, 0, 0, 0, 3}, {2748, 1, 0, 0, 0, 3},
+    {2749, 1, 0, 0, 0, 3}, {2750, 1, 0, 0, 0, 3}, {2751, 1, 0, 0, 0, 3}, {2752, 1, 0, 0, 0, 3},
+    {2753, 1, 0, 0, 0, 3}, {2754, 1, 0, 0, 0, 3}, {2755, 1, 0, 0, 0, 3}, {2756, 1, 0, 0, 0, 3},
+    {2757, 1, 0, 0, 0, 3}, {2758, 1, 0, 0, 0, 3}, {2759, 1, 0, 0, 0, 3}, {2760, 1, 0, 0, 0, 3},
+    {2761, 1, 0, 0, 0, 3}, {2762, 1, 0, 0, 0, 3}, {2763, 1, 0, 0, 0, 3}, {2764, 1, 0, 0, 0, 3},
+    {2765, 1, 0, 0, 0, 3}, {2766, 1, 0, 0, 0, 3}, {2767, 1, 0, 0, 0, 3}, {2768, 1, 0, 0, 0, 3},
+    {2769, 1, 0, 0, 0, 3}, {2770, 1, 0, 0, 0, 3}, {2771, 1, 0, 0, 0, 3}, {2772, 1, 0, 0, 0, 3},
+    {2773, 1, 0, 0, 0, 3}, {2774, 1, 0, 0, 0, 3}, {2775, 1, 0, 0, 0, 3}, {2776, 1, 0, 0, 0, 3},
+    {2777, 1, 0, 0, 0, 3}, {2778, 1, 0, 0, 0, 3}, {2779, 1, 0, 0, 0, 3}, {2780, 1, 0, 0, 0, 3},
+    {2781, 1, 0, 0, 0, 3}, {2782, 1, 0, 0, 0, 3}, {2783, 1, 0, 0, 0, 3}, {2784, 1, 0, 0, 0, 3},
+    {2785, 1, 0, 0, 0, 3}, {2786, 1, 0, 0, 0, 3}, {2787, 1, 0, 0, 0, 3}, {2788, 1, 0, 0, 0, 3},
+    {2789, 1, 0, 0, 0, 3}, {2790, 1, 0, 0, 0, 3}, {2791, 1, 0, 0, 0, 3}, {2792, 1, 0, 0, 0, 3},
+    {2793, 1, 0, 0, 0, 3}, {2794, 1, 0, 0, 0, 3}, {2795, 1, 0, 0, 0, 3}, {2796, 1, 0, 0, 0, 3},
+    {2797, 1, 0, 0, 0, 3}, {2798, 1, 0, 0, 0, 3}, {2799, 1, 0, 0, 0, 3}, {2800, 1, 0, 0, 0, 3},
+    {2801, 1, 0, 0, 0, 3}, {2802, 1, 0, 0, 0, 3}, {2803, 1, 0, 0, 0, 3}, {0, 0, 0, 928, 1, 1},
+    {2804, 2, 0, 0, 0, 1}, {0, 0, 0, 929, 1, 1}, {2806, 2, 0, 0, 0, 1}, {0, 0, 0, 930, 1, 1},
+    {2808, 2, 0, 0, 0, 1}, {2810, 2, 0, 0, 0, 1}, {2812, 2, 0, 0, 0, 1}, {0, 0, 0, 931, 1, 1},
+    {0, 0, 0, 932, 1, 1}, {0, 0, 0, 933, 2, 1}, {2814, 2, 0, 0, 0, 1}, {2816, 2, 0, 0, 0, 1},
+    {0, 0, 0, 935, 3, 1}, {2818, 2, 0, 0, 0, 1}, {2820, 2, 0, 0, 0, 1}, {2822, 2, 0, 0, 0, 1},
+    {0, 0, 0, 938, 1, 1}, {0, 0, 0, 939, 1, 1}, {2824, 2, 0, 0, 0, 1}, {2826, 2, 0, 0, 0, 1},
+    {2828, 1, 0, 0, 0, 3}, {2829, 1, 0, 0, 0, 3}, {2830, 1, 0, 0, 0, 3}, {2831, 1, 0, 0, 0, 3},
+    {2832, 1, 0, 0, 0, 3}, {2833, 1, 0, 0, 0, 3}, {2834, 1, 0, 0, 0, 3}, {2835, 1, 0, 0, 0, 3},
+    {2836, 1, 0, 0, 0, 3}, {2837, 1, 0, 0, 0, 3}, {2838, 1, 0, 0, 0, 3}, {2839, 1, 0, 0, 0, 3},
+    {2840, 1, 0, 0, 0, 3}, {2841, 1, 0, 0, 0, 3}, {2842, 1, 0, 0, 0, 3}, {2843, 1, 0, 0, 0, 3},
+    {2844, 1, 0, 0, 0, 3}, {2845, 1, 0, 0, 0, 3}, {2846, 1, 0, 0, 0, 3}, {2847, 1, 0, 0, 0, 3},
+    {2848, 1, 0, 0, 0, 3}, {2849, 1, 0, 0, 0, 3}, {2850, 1, 0, 0, 0, 3}, {2851, 1, 0, 0, 0, 3},
+    {2852, 1, 0, 0, 0, 3}, {2853, 1, 0, 0, 0, 3}, {2854, 1, 0, 0, 0, 3}, {2855, 1, 0, 0, 0, 3},
+    {2856, 1, 0, 0, 0, 3}, {2857, 1, 0, 0, 0, 3}, {2858, 1, 0, 0, 0, 3}, {2859, 1, 0, 0, 0, 3},
+    {0, 0, 0, 940, 1, 1}, {2860, 2, 0, 0, 0, 1}, {2862, 1, 0, 0, 0, 3}, {2863, 1, 0, 0, 0, 3},
+    {2864, 1, 0, 0, 0, 3}, {2865, 1, 0, 0, 0, 3}, {2866, 1, 0, 0, 0, 3}, {2867, 1, 0, 0, 0, 3},
+    {2868, 1, 0, 0, 0, 3}, {2869, 1, 0, 0, 0, 3}, {2870, 1, 0, 0, 0, 3}, {2871, 1, 0, 0, 0, 3},
+    {2872, 1, 0, 0, 0, 3}, {2873, 1, 0, 0, 0, 3}, {2874, 1, 0, 0, 0, 3}, {2875, 1, 0, 0, 0, 3},
+    {2876, 1, 0, 0, 0, 3}, {2877, 1, 0, 0, 0, 3}, {2878, 1, 0, 0, 0, 3}, {2879, 1, 0, 0, 0, 3},
+    {2880, 1, 0, 0, 0, 3}, {2881, 1, 0, 0, 0, 3}, {2882, 1, 0, 0, 0, 3}, {2883, 1, 0, 0, 0, 3},
+    {2884, 1, 0, 0, 0, 3}, {2885, 1, 0, 0, 0, 3}, {2886, 1, 0, 0, 0, 3}, {2887, 1, 0, 0, 0, 3},
+    {2888, 1, 0, 0, 0, 3}, {2889, 1, 0, 0, 0, 3}, {2890, 1, 0, 0, 0, 3}, {2891, 1, 0, 0, 0, 3},
+    {2892, 1, 0, 0, 0, 3}, {2893, 1, 0, 0, 0, 3}, {0, 0, 6, 0, 0, 1}, {2894, 2, 0, 0, 0, 0},
+    {2896, 2, 0, 0, 0, 0}, {2898, 3, 0, 0, 0, 0}, {2901, 3, 0, 0, 0, 0}, {2904, 3, 0, 0, 0, 0},
+    {2907, 3, 0, 0, 0, 0}, {2910, 3, 0, 0, 0, 0}, {0, 0, 226, 0, 0, 1}, {2913, 2, 0, 0, 0, 0},
+    {2915, 2, 0, 0, 0, 0}, {2917, 3, 0, 0, 0, 0}, {2920, 3, 0, 0, 0, 0}, {2923, 3, 0, 0, 0, 0},
+    {2926, 3, 0, 0, 0, 0}, {2929, 1, 0, 0, 0, 3}, {2930, 1, 0, 0, 0, 3}, {2931, 1, 0, 0, 0, 3},
+    {2932, 1, 0, 0, 0, 3}, {2933, 1, 0, 0, 0, 3}, {2934, 1, 0, 0, 0, 3}, {2935, 1, 0, 0, 0, 3},
+    {2936, 1, 0, 0, 0, 3}, {2937, 1, 0, 0, 0, 3}, {2938, 1, 0, 0, 0, 3}, {2939, 1, 0, 0, 0, 3},
+    {2940, 1, 0, 0, 0, 3}, {2941, 1, 0, 0, 0, 3}, {2942, 1, 0, 0, 0, 3}, {2943, 1, 0, 0, 0, 3},
+    {2944, 1, 0, 0, 0, 3}, {2945, 1, 0, 0, 0, 3}, {2946, 1, 0, 0, 0, 3}, {2947, 1, 0, 0, 0, 3},
+    {2948, 1, 0, 0, 0, 3}, {2949, 1, 0, 0, 0, 3}, {2950, 1, 0, 0, 0, 3}, {2951, 1, 0, 0, 0, 3},
+    {2952, 1, 0, 0, 0, 3}, {2953, 1, 0, 0, 0, 3}, {2954, 1, 0, 0, 0, 3}, {2955, 1, 0, 0, 0, 3},
+    {2956, 1, 0, 0, 0, 3}, {2957, 1, 0, 0, 0, 3}, {2958, 1, 0, 0, 0, 3}, {2959, 1, 0, 0, 0, 3},
+    {2960, 1, 0, 0, 0, 3}, {2961, 1, 0, 0, 0, 3}, {2962, 1, 0, 0, 0, 3}, {2963, 1, 0, 0, 0, 1},
+    {2964, 1, 0, 0, 0, 1}, {2965, 1, 0, 0, 0, 1}, {2966, 1, 0, 0, 0, 1}, {2967, 1, 0, 0, 0, 1},
+    {2968, 1, 0, 0, 0, 1}, {2969, 1, 0, 0, 0, 1}, {2970, 1, 0, 0, 0, 1}, {2971, 1, 0, 0, 0, 1},
+    {2972, 1, 0, 0, 0, 1}, {2973, 1, 0, 0, 0, 1}, {2974, 1, 0, 0, 0, 1}, {2975, 1, 0, 0, 0, 1},
+    {2976, 1, 0, 0, 0, 1}, {2977, 1, 0, 0, 0, 1}, {2978, 1, 0, 0, 0, 1}, {2979, 1, 0, 0, 0, 1},
+    {2980, 1, 0, 0, 0, 1}, {2981, 1, 0, 0, 0, 1}, {2982, 1, 0, 0, 0, 1}, {2983, 1, 0, 0, 0, 1},
+    {2984, 1, 0, 0, 0, 1}, {2985, 1, 0, 0, 0, 1}, {2986, 1, 0, 0, 0, 1}, {2987, 1, 0, 0, 0, 1},
+    {2988, 1, 0, 0, 0, 1}, {2989, 1, 0, 0, 0, 1}, {2990, 1, 0, 0, 0, 1}, {2991, 1, 0, 0, 0, 1},
+    {2992, 1, 0, 0, 0, 1}, {2993, 1, 0, 0, 0, 1}, {2994, 1, 0, 0, 0, 1}, {2995, 1, 0, 0, 0, 1},
+    {2996, 1, 0, 0, 0, 1}, {2997, 1, 0, 0, 0, 1}, {2998, 1, 0, 0, 0, 1}, {2999, 1, 0, 0, 0, 1},
+    {3000, 1, 0, 0, 0, 1}, {3001, 1, 0, 0, 0, 1}, {3002, 1, 0, 0, 0, 1}, {3003, 1, 0, 0, 0, 1},
+    {3004, 1, 0, 0, 0, 1}, {3005, 1, 0, 0, 0, 1}, {3006, 1, 0, 0, 0, 1}, {3007, 1, 0, 0, 0, 1},
+    {3008, 1, 0, 0, 0, 1}, {3009, 1, 0, 0, 0, 1}, {3010, 1, 0, 0, 0, 1}, {3011, 1, 0, 0, 0, 1},
+    {3012, 1, 0, 0, 0, 1}, {3013, 1, 0, 0, 0, 1}, {3014, 1, 0, 0, 0, 1}, {3015, 1, 0, 0, 0, 1},
+    {3016, 1, 0, 0, 0, 1}, {3017, 1, 0, 0, 0, 1}, {3018, 1, 0, 0, 0, 1}, {3019, 1, 0, 0, 0, 1},
+    {3020, 1, 0, 0, 0, 1}, {3021, 1, 0, 0, 0, 1}, {3022, 1, 0, 0, 0, 1}, {3023, 1, 0, 0, 0, 1},
+    {3024, 1, 0, 0, 0, 1}, {3025, 1, 0, 0, 0, 1}, {3026, 1, 0, 0, 0, 1}, {3027, 1, 0, 0, 0, 1},
+    {3028, 1, 0, 0, 0, 1}, {3029, 1, 0, 0, 0, 1}, {3030, 1, 0, 0, 0, 1}, {3031, 1, 0, 0, 0, 1},
+    {3032, 1, 0, 0, 0, 1}, {3033, 1, 0, 0, 0, 1}, {3034, 1, 0, 0, 0, 1}, {3035, 1, 0, 0, 0, 1},
+    {3036, 1, 0, 0, 0, 1}, {3037, 1, 0, 0, 0, 1}, {3038, 1, 0, 0, 0, 1}, {3039, 1, 0, 0, 0, 1},
+    {3040, 1, 0, 0, 0, 1}, {3041, 1, 0, 0, 0, 1}, {3042, 1, 0, 0, 0, 1}, {3043, 1, 0, 0, 0, 1},
+    {3044, 1, 0, 0, 0, 1}, {3045, 1, 0, 0, 0, 1}, {3046, 1, 0, 0, 0, 1}, {3047, 1, 0, 0, 0, 1},
+    {3048, 1, 0, 0, 0, 1}, {3049, 1, 0, 0, 0, 1}, {3050, 1, 0, 0, 0, 1}, {3051, 1, 0, 0, 0, 1},
+    {3052, 1, 0, 0, 0, 1}, {3053, 1, 0, 0, 0, 1}, {3054, 1, 0, 0, 0, 1}, {3055, 1, 0, 0, 0, 1},
+    {3056, 1, 0, 0, 0, 1}, {3057, 1, 0, 0, 0, 1}, {3058, 1, 0, 0, 0, 1}, {3059, 1, 0, 0, 0, 1},
+    {3060, 1, 0, 0, 0, 1}, {3061, 1, 0, 0, 0, 1}, {3062, 1, 0, 0, 0, 1}, {3063, 1, 0, 0, 0, 1},
+    {3064, 1, 0, 0, 0, 1}, {3065, 1, 0, 0, 0, 1}, {3066, 1, 0, 0, 0, 1}, {3067, 1, 0, 0, 0, 1},
+    {3068, 1, 0, 0, 0, 1}, {3069, 1, 0, 0, 0, 1}, {3070, 1, 0, 0, 0, 1}, {3071, 1, 0, 0, 0, 1},
+    {3072, 1, 0, 0, 0, 1}, {3073, 1, 0, 0, 0, 1}, {3074, 1, 0, 0, 0, 1}, {3075, 1, 0, 0, 0, 1},
+    {3076, 1, 0, 0, 0, 1}, {3077, 1, 0, 0, 0, 1}, {3078, 1, 0, 0, 0, 1}, {3079, 1, 0, 0, 0, 1},
+    {3080, 1, 0, 0, 0, 1}, {3081, 1, 0, 0, 0, 1}, {3082, 1, 0, 0, 0, 1}, {3083, 1, 0, 0, 0, 1},
+    {3084, 1, 0, 0, 0, 1}, {3085, 1, 0, 0, 0, 1}, {3086, 1, 0, 0, 0, 1}, {3087, 1, 0, 0, 0, 1},
+    {3088, 1, 0, 0, 0, 1}, {3089, 1, 0, 0, 0, 1}, {3090, 1, 0, 0, 0, 1}, {3091, 1, 0, 0, 0, 1},
+    {3092, 1, 0, 0, 0, 1}, {3093, 1, 0, 0, 0, 1}, {3094, 1, 0, 0, 0, 1}, {3095, 1, 0, 0, 0, 1},
+    {3096, 1, 0, 0, 0, 1}, {3097, 1, 0, 0, 0, 1}, {3098, 1, 0, 0, 0, 1}, {3099, 1, 0, 0, 0, 1},
+    {3100, 1, 0, 0, 0, 1}, {3101, 1, 0, 0, 0, 1}, {3102, 1, 0, 0, 0, 1}, {3103, 1, 0, 0, 0, 1},
+    {3104, 1, 0, 0, 0, 1}, {3105, 1, 0, 0, 0, 1}, {3106, 1, 0, 0, 0, 1}, {3107, 1, 0, 0, 0, 1},
+    {3108, 1, 0, 0, 0, 1}, {3109, 1, 0, 0, 0, 1}, {3110, 1, 0, 0, 0, 1}, {3111, 1, 0, 0, 0, 1},
+    {3112, 1, 0, 0, 0, 1}, {3113, 1, 0, 0, 0, 1}, {3114, 1, 0, 0, 0, 1}, {3115, 1, 0, 0, 0, 1},
+    {3116, 1, 0, 0, 0, 1}, {3117, 1, 0, 0, 0, 1}, {3118, 1, 0, 0, 0, 1}, {3119, 1, 0, 0, 0, 1},
+    {3120, 1, 0, 0, 0, 1}, {3121, 1, 0, 0, 0, 1}, {3122, 1, 0, 0, 0, 1}, {3123, 1, 0, 0, 0, 1},
+    {3124, 1, 0, 0, 0, 1}, {3125, 1, 0, 0, 0, 1}, {3126, 1, 0, 0, 0, 1}, {3127, 1, 0, 0, 0, 1},
+    {3128, 1, 0, 0, 0, 1}, {3129, 1, 0, 0, 0, 1}, {3130, 1, 0, 0, 0, 1}, {3131, 1, 0, 0, 0, 1},
+    {3132, 1, 0, 0, 0, 1}, {3133, 1, 0, 0, 0, 1}, {3134, 1, 0, 0, 0, 1}, {3135, 1, 0, 0, 0, 1},
+    {3136, 1, 0, 0, 0, 1}, {3137, 1, 0, 0, 0, 1}, {3138, 1, 0, 0, 0, 1}, {3139, 1, 0, 0, 0, 1},
+    {3140, 1, 0, 0, 0, 1}, {3141, 1, 0, 0, 0, 1}, {3142, 1, 0, 0, 0, 1}, {3143, 1, 0, 0, 0, 1},
+    {3144, 1, 0, 0, 0, 1}, {3145, 1, 0, 0, 0, 1}, {3146, 1, 0, 0, 0, 1}, {3147, 1, 0, 0, 0, 1},
+    {3148, 1, 0, 0, 0, 1}, {3149, 1, 0, 0, 0, 1}, {3150, 1, 0, 0, 0, 1}, {3151, 1, 0, 0, 0, 1},
+    {3152, 1, 0, 0, 0, 1}, {3153, 1, 0, 0, 0, 1}, {3154, 1, 0, 0, 0, 1}, {3155, 1, 0, 0, 0, 1},
+    {3156, 1, 0, 0, 0, 1}, {3157, 1, 0, 0, 0, 1}, {3158, 1, 0, 0, 0, 1}, {3159, 1, 0, 0, 0, 1},
+    {3160, 1, 0, 0, 0, 1}, {3161, 1, 0, 0, 0, 1}, {3162, 1, 0, 0, 0, 1}, {3163, 1, 0, 0, 0, 1},
+    {3164, 1, 0, 0, 0, 1}, {3165, 1, 0, 0, 0, 1}, {3166, 1, 0, 0, 0, 1}, {3167, 1, 0, 0, 0, 1},
+    {3168, 1, 0, 0, 0, 1}, {3169, 1, 0, 0, 0, 1}, {3170, 1, 0, 0, 0, 1}, {3171, 1, 0, 0, 0, 1},
+    {3172, 1, 0, 0, 0, 1}, {3173, 1, 0, 0, 0, 1}, {3174, 1, 0, 0, 0, 1}, {3175, 1, 0, 0, 0, 1},
+    {3176, 1, 0, 0, 0, 1}, {3177, 1, 0, 0, 0, 1}, {3178, 1, 0, 0, 0, 1}, {3179, 1, 0, 0, 0, 1},
+    {3180, 1, 0, 0, 0, 1}, {3181, 1, 0, 0, 0, 1}, {3182, 1, 0, 0, 0, 1}, {3183, 1, 0, 0, 0, 1},
+    {3184, 1, 0, 0, 0, 1}, {3185, 1, 0, 0, 0, 1}, {3186, 1, 0, 0, 0, 1}, {3187, 1, 0, 0, 0, 1},
+    {3188, 1, 0, 0, 0, 1}, {3189, 1, 0, 0, 0, 1}, {3190, 1, 0, 0, 0, 1}, {3191, 1, 0, 0, 0, 1},
+    {3192, 1, 0, 0, 0, 1}, {3193, 1, 0, 0, 0, 1}, {3194, 1, 0, 0, 0, 1}, {3195, 1, 0, 0, 0, 1},
+    {3196, 1, 0, 0, 0, 1}, {3197, 1, 0, 0, 0, 1}, {3198, 1, 0, 0, 0, 1}, {3199, 1, 0, 0, 0, 1},
+    {3200, 1, 0, 0, 0, 1}, {3201, 1, 0, 0, 0, 1}, {3202, 1, 0, 0, 0, 1}, {3203, 1, 0, 0, 0, 1},
+    {3204, 1, 0, 0, 0, 1}, {3205, 1, 0, 0, 0, 1}, {3206, 1, 0, 0, 0, 1}, {3207, 1, 0, 0, 0, 1},
+    {3208, 1, 0, 0, 0, 1}, {3209, 1, 0, 0, 0, 1}, {3210, 1, 0, 0, 0, 1}, {3211, 1, 0, 0, 0, 1},
+    {3212, 1, 0, 0, 0, 1}, {3213, 1, 0, 0, 0, 1}, {3214, 1, 0, 0, 0, 1}, {3215, 1, 0, 0, 0, 1},
+    {3216, 1, 0, 0, 0, 1}, {3217, 1, 0, 0, 0, 1}, {3218, 1, 0, 0, 0, 1}, {3219, 1, 0, 0, 0, 1},
+    {3220, 1, 0, 0, 0, 1}, {3221, 1, 0, 0, 0, 1}, {3222, 1, 0, 0, 0, 1}, {3223, 1, 0, 0, 0, 1},
+    {3224, 1, 0, 0, 0, 1}, {3225, 1, 0, 0, 0, 1}, {3226, 1, 0, 0, 0, 1}, {3227, 1, 0, 0, 0, 1},
+    {3228, 1, 0, 0, 0, 1}, {3229, 1, 0, 0, 0, 1}, {3230, 1, 0, 0, 0, 1}, {3231, 1, 0, 0, 0, 1},
+    {3232, 1, 0, 0, 0, 1}, {3233, 1, 0, 0, 0, 1}, {3234, 1, 0, 0, 0, 1}, {3235, 1, 0, 0, 0, 1},
+    {3236, 1, 0, 0, 0, 1}, {3237, 1, 0, 0, 0, 1}, {3238, 1, 0, 0, 0, 1}, {3239, 1, 0, 0, 0, 1},
+    {3240, 1, 0, 0, 0, 1}, {3241, 1, 0, 0, 0, 1}, {3242, 1, 0, 0, 0, 1}, {3243, 1, 0, 0, 0, 1},
+    {3244, 1, 0, 0, 0, 1}, {3245, 1, 0, 0, 0, 1}, {3246, 1, 0, 0, 0, 1}, {3247, 1, 0, 0, 0, 1},
+    {3248, 1, 0, 0, 0, 1}, {3249, 1, 0, 0, 0, 1}, {3250, 1, 0, 0, 0, 1}, {3251, 1, 0, 0, 0, 1},
+    {3252, 1, 0, 0, 0, 1}, {3253, 1, 0, 0, 0, 1}, {3254, 1, 0, 0, 0, 1}, {3255, 1, 0, 0, 0, 1},
+    {3256, 1, 0, 0, 0, 1}, {3257, 1, 0, 0, 0, 1}, {3258, 1, 0, 0, 0, 1}, {3259, 1, 0, 0, 0, 1},
+    {3260, 1, 0, 0, 0, 1}, {3261, 1, 0, 0, 0, 1}, {3262, 1, 0, 0, 0, 1}, {3263, 1, 0, 0, 0, 1},
+    {3264, 1, 0, 0, 0, 1}, {3265, 1, 0, 0, 0, 1}, {3266, 1, 0, 0, 0, 1}, {3267, 1, 0, 0, 0, 1},
+    {3268, 1, 0, 0, 0, 1}, {3269, 1, 0, 0, 0, 1}, {3270, 1, 0, 0, 0, 1}, {3271, 1, 0, 0, 0, 1},
+    {3272, 1, 0, 0, 0, 1}, {3273, 1, 0, 0, 0, 1}, {3274, 1, 0, 0, 0, 1}, {3275, 1, 0, 0, 0, 1},
+    {3276, 1, 0, 0, 0, 1}, {3277, 1, 0, 0, 0, 1}, {3278, 1, 0, 0, 0, 1}, {3279, 1, 0, 0, 0, 1},
+    {3280, 1, 0, 0, 0, 1}, {3281, 1, 0, 0, 0, 1}, {3282, 1, 0, 0, 0, 1}, {3283, 1, 0, 0, 0, 1},
+    {3284, 1, 0, 0, 0, 1}, {3285, 1, 0, 0, 0, 1}, {3286, 1, 0, 0, 0, 1}, {3287, 1, 0, 0, 0, 1},
+    {3288, 1, 0, 0, 0, 1}, {3289, 1, 0, 0, 0, 1}, {3290, 1, 0, 0, 0, 1}, {3291, 1, 0, 0, 0, 1},
+    {3292, 1, 0, 0, 0, 1}, {3293, 1, 0, 0, 0, 1}, {3294, 1, 0, 0, 0, 1}, {3295, 1, 0, 0, 0, 1},
+    {3296, 1, 0, 0, 0, 1}, {3297, 1, 0, 0, 0, 1}, {3298, 1, 0, 0, 0, 1}, {3299, 1, 0, 0, 0, 1},
+    {3300, 1, 0, 0, 0, 1}, {3301, 1, 0, 0, 0, 1}, {3302, 1, 0, 0, 0, 1}, {3303, 1, 0, 0, 0, 1},
+    {3304, 1, 0, 0, 0, 1}, {3305, 1, 0, 0, 0, 1}, {3306, 1, 0, 0, 0, 1}, {3307, 1, 0, 0, 0, 1},
+    {3308, 1, 0, 0, 0, 1}, {3309, 1, 0, 0, 0, 1}, {3310, 1, 0, 0, 0, 1}, {3311, 1, 0, 0, 0, 1},
+    {3312, 1, 0, 0, 0, 1}, {3313, 1, 0, 0, 0, 1}, {3314, 1, 0, 0, 0, 1}, {3315, 1, 0, 0, 0, 1},
+    {3316, 1, 0, 0, 0, 1}, {3317, 1, 0, 0, 0, 1}, {3318, 1, 0, 0, 0, 1}, {3319, 1, 0, 0, 0, 1},
+    {3320, 1, 0, 0, 0, 1}, {3321, 1, 0, 0, 0, 1}, {3322, 1, 0, 0, 0, 1}, {3323, 1, 0, 0, 0, 1},
+    {3324, 1, 0, 0, 0, 1}, {3325, 1, 0, 0, 0, 1}, {3326, 1, 0, 0, 0, 1}, {3327, 1, 0, 0, 0, 1},
+    {3328, 1, 0, 0, 0, 1}, {3329, 1, 0, 0, 0, 1}, {3330, 1, 0, 0, 0, 1}, {3331, 1, 0, 0, 0, 1},
+    {3332, 1, 0, 0, 0, 1}, {3333, 1, 0, 0, 0, 1}, {3334, 1, 0, 0, 0, 1}, {3335, 1, 0, 0, 0, 1},
+    {3336, 1, 0, 0, 0, 1}, {3337, 1, 0, 0, 0, 1}, {3338, 1, 0, 0, 0, 1}, {3339, 1, 0, 0, 0, 1},
+    {3340, 1, 0, 0, 0, 1}, {3341, 1, 0, 0, 0, 1}, {3342, 1, 0, 0, 0, 1}, {3343, 1, 0, 0, 0, 1},
+    {3344, 1, 0, 0, 0, 1}, {3345, 1, 0, 0, 0, 1}, {3346, 1, 0, 0, 0, 1}, {3347, 1, 0, 0, 0, 1},
+    {3348, 1, 0, 0, 0, 1}, {3349, 1, 0, 0, 0, 1}, {3350, 1, 0, 0, 0, 1}, {3351, 1, 0, 0, 0, 1},
+    {3352, 1, 0, 0, 0, 1}, {3353, 1, 0, 0, 0, 1}, {3354, 1, 0, 0, 0, 1}, {3355, 1, 0, 0, 0, 1},
+    {3356, 1, 0, 0, 0, 1}, {3357, 1, 0, 0, 0, 1}, {3358, 1, 0, 0, 0, 1}, {3359, 1, 0, 0, 0, 1},
+    {3360, 1, 0, 0, 0, 1}, {3361, 1, 0, 0, 0, 1}, {3362, 1, 0, 0, 0, 1}, {3363, 1, 0, 0, 0, 1},
+    {3364, 1, 0, 0, 0, 1}, {3365, 1, 0, 0, 0, 1}, {3366, 1, 0, 0, 0, 1}, {3367, 1, 0, 0, 0, 1},
+    {3368, 1, 0, 0, 0, 1}, {3369, 1, 0, 0, 0, 1}, {3370, 1, 0, 0, 0, 1}, {3371, 1, 0, 0, 0, 1},
+    {3372, 1, 0, 0, 0, 1}, {3373, 1, 0, 0, 0, 1}, {3374, 1, 0, 0, 0, 1}, {3375, 1, 0, 0, 0, 1},
+    {3376, 1, 0, 0, 0, 1}, {3377, 1, 0, 0, 0, 1}, {3378, 1, 0, 0, 0, 1}, {3379, 1, 0, 0, 0, 1},
+    {3380, 1, 0, 0, 0, 1}, {3381, 1, 0, 0, 0, 1}, {3382, 1, 0, 0, 0, 1}, {3383, 1, 0, 0, 0, 1},
+    {3384, 1, 0, 0, 0, 1}, {3385, 1, 0, 0, 0, 1}, {3386, 1, 0, 0, 0, 1}, {3387, 1, 0, 0, 0, 1},
+    {3388, 1, 0, 0, 0, 1}, {3389, 1, 0, 0, 0, 1}, {3390, 1, 0, 0, 0, 1}, {3391, 1, 0, 0, 0, 1},
+    {3392, 1, 0, 0, 0, 1}, {3393, 1, 0, 0, 0, 1}, {3394, 1, 0, 0, 0, 1}, {3395, 1, 0, 0, 0, 1},
+    {3396, 1, 0, 0, 0, 1}, {3397, 1, 0, 0, 0, 1}, {3398, 1, 0, 0, 0, 1}, {3399, 1, 0, 0, 0, 1},
+    {3400, 1, 0, 0, 0, 1}, {3401, 1, 0, 0, 0, 1}, {3402, 1, 0, 0, 0, 1}, {3403, 1, 0, 0, 0, 1},
+    {3404, 1, 0, 0, 0, 1}, {3405, 1, 0, 0, 0, 1}, {3406, 1, 0, 0, 0, 1}, {3407, 1, 0, 0, 0, 1},
+    {3408, 1, 0, 0, 0, 1}, {3409, 1, 0, 0, 0, 1}, {3410, 1, 0, 0, 0, 1}, {3411, 1, 0, 0, 0, 1},
+    {3412, 1, 0, 0, 0, 1}, {3413, 1, 0, 0, 0, 1}, {3414, 1, 0, 0, 0, 1}, {3415, 1, 0, 0, 0, 1},
+    {3416, 1, 0, 0, 0, 1}, {3417, 1, 0, 0, 0, 1}, {3418, 1, 0, 0, 0, 1}, {3419, 1, 0, 0, 0, 1},
+    {3420, 1, 0, 0, 0, 1}, {3421, 1, 0, 0, 0, 1}, {3422, 1, 0, 0, 0, 1}, {3423, 1, 0, 0, 0, 1},
+    {3424, 1, 0, 0, 0, 1}, {3425, 1, 0, 0, 0, 1}, {3426, 1, 0, 0, 0, 1}, {3427, 1, 0, 0, 0, 1},
+    {3428, 1, 0, 0, 0, 1}, {3429, 1, 0, 0, 0, 1}, {3430, 1, 0, 0, 0, 1}, {3431, 1, 0, 0, 0, 1},
+    {3432, 1, 0, 0, 0, 1}, {3433, 1, 0, 0, 0, 1}, {3434, 1, 0, 0, 0, 1}, {3435, 1, 0, 0, 0, 1},
+    {3436, 1, 0, 0, 0, 1}, {3437, 1, 0, 0, 0, 1}, {3438, 1, 0, 0, 0, 1}, {3439, 1, 0, 0, 0, 1},
+};
+
+const uint32_t expansions_unicode[3440] = {
+    0x0, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x3BC, 0x61, 0x300,
+    0x61, 0x301, 0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30A,
+    0xE6, 0x63, 0x327, 0x65, 0x300, 0x65, 0x301, 0x65, 0x302, 0x65,
+    0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302, 0x69, 0x308, 0xF0,
+    0x6E, 0x303, 0x6F, 0x300, 0x6F, 0x301, 0x6F, 0x302, 0x6F, 0x303,
+    0x6F, 0x308, 0xF8, 0x75, 0x300, 0x75, 0x301, 0x75, 0x302, 0x75,
+    0x308, 0x79, 0x301, 0xFE, 0x79, 0x308, 0x61, 0x304, 0x61, 0x306,
+    0x61, 0x328, 0x63, 0x301, 0x63, 0x302, 0x63, 0x307, 0x63, 0x30C,
+    0x64, 0x30C, 0x111, 0x65, 0x304, 0x65, 0x306, 0x65, 0x307, 0x65,
+    0x328, 0x65, 0x30C, 0x67, 0x302, 0x67, 0x306, 0x67, 0x307, 0x67,
+    0x327, 0x68, 0x302, 0x127, 0x69, 0x303, 0x69, 0x304, 0x69, 0x306,
+    0x69, 0x328, 0x69, 0x307, 0x133, 0x6A, 0x302, 0x6B, 0x327, 0x6C,
+    0x301, 0x6C, 0x327, 0x6C, 0x30C, 0x140, 0x142, 0x6E, 0x301, 0x6E,
+    0x327, 0x6E, 0x30C, 0x14B, 0x6F, 0x304, 0x6F, 0x306, 0x6F, 0x30B,
+    0x153, 0x72, 0x301, 0x72, 0x327, 0x72, 0x30C, 0x73, 0x301, 0x73,
+    0x302, 0x73, 0x327, 0x73, 0x30C, 0x74, 0x327, 0x74, 0x30C, 0x167,
+    0x75, 0x303, 0x75, 0x304, 0x75, 0x306, 0x75, 0x30A, 0x75, 0x30B,
+    0x75, 0x328, 0x77, 0x302, 0x79, 0x302, 0x7A, 0x301, 0x7A, 0x307,
+    0x7A, 0x30C, 0x253, 0x183, 0x185, 0x254, 0x188, 0x256, 0x257, 0x18C,
+    0x1DD, 0x259, 0x25B, 0x192, 0x260, 0x263, 0x269, 0x268, 0x199, 0x26F,
+    0x272, 0x275, 0x6F, 0x31B, 0x1A3, 0x1A5, 0x280, 0x1A8, 0x283, 0x1AD,
+    0x288, 0x75, 0x31B, 0x28A, 0x28B, 0x1B4, 0x1B6, 0x292, 0x1B9, 0x1BD,
+    0x1C6, 0x1C9, 0x1CC, 0x61, 0x30C, 0x69, 0x30C, 0x6F, 0x30C, 0x75,
+    0x30C, 0x75, 0x308, 0x304, 0x75, 0x308, 0x301, 0x75, 0x308, 0x30C,
+    0x75, 0x308, 0x300, 0x61, 0x308, 0x304, 0x61, 0x307, 0x304, 0xE6,
+    0x304, 0x1E5, 0x67, 0x30C, 0x6B, 0x30C, 0x6F, 0x328, 0x6F, 0x328,
+    0x304, 0x292, 0x30C, 0x6A, 0x30C, 0x1F3, 0x67, 0x301, 0x195, 0x1BF,
+    0x6E, 0x300, 0x61, 0x30A, 0x301, 0xE6, 0x301, 0xF8, 0x301, 0x61,
+    0x30F, 0x61, 0x311, 0x65, 0x30F, 0x65, 0x311, 0x69, 0x30F, 0x69,
+    0x311, 0x6F, 0x30F, 0x6F, 0x311, 0x72, 0x30F, 0x72, 0x311, 0x75,
+    0x30F, 0x75, 0x311, 0x73, 0x326, 0x74, 0x326, 0x21D, 0x68, 0x30C,
+    0x19E, 0x223, 0x225, 0x61, 0x307, 0x65, 0x327, 0x6F, 0x308, 0x304,
+    0x6F, 0x303, 0x304, 0x6F, 0x307, 0x6F, 0x307, 0x304, 0x79, 0x304,
+    0x2C65, 0x23C, 0x19A, 0x2C66, 0x242, 0x180, 0x289, 0x28C, 0x247, 0x249,
+    0x24B, 0x24D, 0x24F, 0x300, 0x301, 0x313, 0x308, 0x301, 0x371, 0x373,
+    0x2B9, 0x377, 0x3B, 0x3F3, 0xA8, 0x301, 0x3B1, 0x301, 0xB7, 0x3B5,
+    0x301, 0x3B7, 0x301, 0x3B9, 0x301, 0x3BF, 0x301, 0x3C5, 0x301, 0x3C9,
+    0x301, 0x3B9, 0x308, 0x301, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6,
+    0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1,
+    0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3B9, 0x308, 0x3C5,
+    0x308, 0x3C5, 0x308, 0x301, 0x3D7, 0x3D2, 0x301, 0x3D2, 0x308, 0x3D9,
+    0x3DB, 0x3DD, 0x3DF, 0x3E1, 0x3E3, 0x3E5, 0x3E7, 0x3E9, 0x3EB, 0x3ED,
+    0x3EF, 0x3F8, 0x3F2, 0x3FB, 0x37B, 0x37C, 0x37D, 0x435, 0x300, 0x435,
+    0x308, 0x452, 0x433, 0x301, 0x454, 0x455, 0x456, 0x456, 0x308, 0x458,
+    0x459, 0x45A, 0x45B, 0x43A, 0x301, 0x438, 0x300, 0x443, 0x306, 0x45F,
+    0x430, 0x431, 0x432, 0x433, 0x434, 0x435, 0x436, 0x437, 0x438, 0x438,
+    0x306, 0x43A, 0x43B, 0x43C, 0x43D, 0x43E, 0x43F, 0x440, 0x441, 0x442,
+    0x443, 0x444, 0x445, 0x446, 0x447, 0x448, 0x449, 0x44A, 0x44B, 0x44C,
+    0x44D, 0x44E, 0x44F, 0x461, 0x463, 0x465, 0x467, 0x469, 0x46B, 0x46D,
+    0x46F, 0x471, 0x473, 0x475, 0x475, 0x30F, 0x479, 0x47B, 0x47D, 0x47F,
+    0x481, 0x48B, 0x48D, 0x48F, 0x491, 0x493, 0x495, 0x497, 0x499, 0x49B,
+    0x49D, 0x49F, 0x4A1, 0x4A3, 0x4A5, 0x4A7, 0x4A9, 0x4AB, 0x4AD, 0x4AF,
+    0x4B1, 0x4B3, 0x4B5, 0x4B7, 0x4B9, 0x4BB, 0x4BD, 0x4BF, 0x4CF, 0x436,
+    0x306, 0x4C4, 0x4C6, 0x4C8, 0x4CA, 0x4CC, 0x4CE, 0x430, 0x306, 0x430,
+    0x308, 0x4D5, 0x435, 0x306, 0x4D9, 0x4D9, 0x308, 0x436, 0x308, 0x437,
+    0x308, 0x4E1, 0x438, 0x304, 0x438, 0x308, 0x43E, 0x308, 0x4E9, 0x4E9,
+    0x308, 0x44D, 0x308, 0x443, 0x304, 0x443, 0x308, 0x443, 0x30B, 0x447,
+    0x308, 0x4F7, 0x44B, 0x308, 0x4FB, 0x4FD, 0x4FF, 0x501, 0x503, 0x505,
+    0x507, 0x509, 0x50B, 0x50D, 0x50F, 0x511, 0x513, 0x515, 0x517, 0x519,
+    0x51B, 0x51D, 0x51F, 0x521, 0x523, 0x525, 0x527, 0x529, 0x52B, 0x52D,
+    0x52F, 0x561, 0x562, 0x563, 0x564, 0x565, 0x566, 0x567, 0x568, 0x569,
+    0x56A, 0x56B, 0x56C, 0x56D, 0x56E, 0x56F, 0x570, 0x571, 0x572, 0x573,
+    0x574, 0x575, 0x576, 0x577, 0x578, 0x579, 0x57A, 0x57B, 0x57C, 0x57D,
+    0x57E, 0x57F, 0x580, 0x581, 0x582, 0x583, 0x584, 0x585, 0x586, 0x627,
+    0x653, 0x627, 0x654, 0x648, 0x654, 0x627, 0x655, 0x64A, 0x654, 0x6D5,
+    0x654, 0x6C1, 0x654, 0x6D2, 0x654, 0x928, 0x93C, 0x930, 0x93C, 0x933,
+    0x93C, 0x915, 0x93C, 0x916, 0x93C, 0x917, 0x93C, 0x91C, 0x93C, 0x921,
+    0x93C, 0x922, 0x93C, 0x92B, 0x93C, 0x92F, 0x93C, 0x9C7, 0x9BE, 0x9C7,
+    0x9D7, 0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38,
+    0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C, 0xA1C, 0xA3C, 0xA2B, 0xA3C, 0xB47,
+    0xB56, 0xB47, 0xB3E, 0xB47, 0xB57, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xB92,
+    0xBD7, 0xBC6, 0xBBE, 0xBC7, 0xBBE, 0xBC6, 0xBD7, 0xC46, 0xC56, 0xCBF,
+    0xCD5, 0xCC6, 0xCD5, 0xCC6, 0xCD6, 0xCC6, 0xCC2, 0xCC6, 0xCC2, 0xCD5,
+    0xD46, 0xD3E, 0xD47, 0xD3E, 0xD46, 0xD57, 0xDD9, 0xDCA, 0xDD9, 0xDCF,
+    0xDD9, 0xDCF, 0xDCA, 0xDD9, 0xDDF, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51,
+    0xFB7, 0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71,
+    0xF74, 0xFB2, 0xF80, 0xFB3, 0xF80, 0xF71, 0xF80, 0xF92, 0xFB7, 0xF9C,
+    0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7, 0xF90, 0xFB5, 0x1025,
+    0x102E, 0x2D00, 0x2D01, 0x2D02, 0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08,
+    0x2D09, 0x2D0A, 0x2D0B, 0x2D0C, 0x2D0D, 0x2D0E, 0x2D0F, 0x2D10, 0x2D11, 0x2D12,
+    0x2D13, 0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19, 0x2D1A, 0x2D1B, 0x2D1C,
+    0x2D1D, 0x2D1E, 0x2D1F, 0x2D20, 0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25, 0x2D27,
+    0x2D2D, 0x13F0, 0x13F1, 0x13F2, 0x13F3, 0x13F4, 0x13F5, 0x1B05, 0x1B35, 0x1B07,
+    0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35, 0x1B3A,
+    0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0xA64B,
+    0x10D0, 0x10D1, 0x10D2, 0x10D3, 0x10D4, 0x10D5, 0x10D6, 0x10D7, 0x10D8, 0x10D9,
+    0x10DA, 0x10DB, 0x10DC, 0x10DD, 0x10DE, 0x10DF, 0x10E0, 0x10E1, 0x10E2, 0x10E3,
+    0x10E4, 0x10E5, 0x10E6, 0x10E7, 0x10E8, 0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED,
+    0x10EE, 0x10EF, 0x10F0, 0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6, 0x10F7,
+    0x10F8, 0x10F9, 0x10FA, 0x10FD, 0x10FE, 0x10FF, 0x61, 0x325, 0x62, 0x307,
+    0x62, 0x323, 0x62, 0x331, 0x63, 0x327, 0x301, 0x64, 0x307, 0x64,
+    0x323, 0x64, 0x331, 0x64, 0x327, 0x64, 0x32D, 0x65, 0x304, 0x300,
+    0x65, 0x304, 0x301, 0x65, 0x32D, 0x65, 0x330, 0x65, 0x327, 0x306,
+    0x66, 0x307, 0x67, 0x304, 0x68, 0x307, 0x68, 0x323, 0x68, 0x308,
+    0x68, 0x327, 0x68, 0x32E, 0x69, 0x330, 0x69, 0x308, 0x301, 0x6B,
+    0x301, 0x6B, 0x323, 0x6B, 0x331, 0x6C, 0x323, 0x6C, 0x323, 0x304,
+    0x6C, 0x331, 0x6C, 0x32D, 0x6D, 0x301, 0x6D, 0x307, 0x6D, 0x323,
+    0x6E, 0x307, 0x6E, 0x323, 0x6E, 0x331, 0x6E, 0x32D, 0x6F, 0x303,
+    0x301, 0x6F, 0x303, 0x308, 0x6F, 0x304, 0x300, 0x6F, 0x304, 0x301,
+    0x70, 0x301, 0x70, 0x307, 0x72, 0x307, 0x72, 0x323, 0x72, 0x323,
+    0x304, 0x72, 0x331, 0x73, 0x307, 0x73, 0x323, 0x73, 0x301, 0x307,
+    0x73, 0x30C, 0x307, 0x73, 0x323, 0x307, 0x74, 0x307, 0x74, 0x323,
+    0x74, 0x331, 0x74, 0x32D, 0x75, 0x324, 0x75, 0x330, 0x75, 0x32D,
+    0x75, 0x303, 0x301, 0x75, 0x304, 0x308, 0x76, 0x303, 0x76, 0x323,
+    0x77, 0x300, 0x77, 0x301, 0x77, 0x308, 0x77, 0x307, 0x77, 0x323,
+    0x78, 0x307, 0x78, 0x308, 0x79, 0x307, 0x7A, 0x302, 0x7A, 0x323,
+    0x7A, 0x331, 0x68, 0x331, 0x74, 0x308, 0x77, 0x30A, 0x79, 0x30A,
+    0xDF, 0x61, 0x323, 0x61, 0x309, 0x61, 0x302, 0x301, 0x61, 0x302,
+    0x300, 0x61, 0x302, 0x309, 0x61, 0x302, 0x303, 0x61, 0x323, 0x302,
+    0x61, 0x306, 0x301, 0x61, 0x306, 0x300, 0x61, 0x306, 0x309, 0x61,
+    0x306, 0x303, 0x61, 0x323, 0x306, 0x65, 0x323, 0x65, 0x309, 0x65,
+    0x303, 0x65, 0x302, 0x301, 0x65, 0x302, 0x300, 0x65, 0x302, 0x309,
+    0x65, 0x302, 0x303, 0x65, 0x323, 0x302, 0x69, 0x309, 0x69, 0x323,
+    0x6F, 0x323, 0x6F, 0x309, 0x6F, 0x302, 0x301, 0x6F, 0x302, 0x300,
+    0x6F, 0x302, 0x309, 0x6F, 0x302, 0x303, 0x6F, 0x323, 0x302, 0x6F,
+    0x31B, 0x301, 0x6F, 0x31B, 0x300, 0x6F, 0x31B, 0x309, 0x6F, 0x31B,
+    0x303, 0x6F, 0x31B, 0x323, 0x75, 0x323, 0x75, 0x309, 0x75, 0x31B,
+    0x301, 0x75, 0x31B, 0x300, 0x75, 0x31B, 0x309, 0x75, 0x31B, 0x303,
+    0x75, 0x31B, 0x323, 0x79, 0x300, 0x79, 0x323, 0x79, 0x309, 0x79,
+    0x303, 0x1EFB, 0x1EFD, 0x1EFF, 0x3B1, 0x313, 0x3B1, 0x314, 0x3B1, 0x313,
+    0x300, 0x3B1, 0x314, 0x300, 0x3B1, 0x313, 0x301, 0x3B1, 0x314, 0x301,
+    0x3B1, 0x313, 0x342, 0x3B1, 0x314, 0x342, 0x3B5, 0x313, 0x3B5, 0x314,
+    0x3B5, 0x313, 0x300, 0x3B5, 0x314, 0x300, 0x3B5, 0x313, 0x301, 0x3B5,
+    0x314, 0x301, 0x3B7, 0x313, 0x3B7, 0x314, 0x3B7, 0x313, 0x300, 0x3B7,
+    0x314, 0x300, 0x3B7, 0x313, 0x301, 0x3B7, 0x314, 0x301, 0x3B7, 0x313,
+    0x342, 0x3B7, 0x314, 0x342, 0x3B9, 0x313, 0x3B9, 0x314, 0x3B9, 0x313,
+    0x300, 0x3B9, 0x314, 0x300, 0x3B9, 0x313, 0x301, 0x3B9, 0x314, 0x301,
+    0x3B9, 0x313, 0x342, 0x3B9, 0x314, 0x342, 0x3BF, 0x313, 0x3BF, 0x314,
+    0x3BF, 0x313, 0x300, 0x3BF, 0x314, 0x300, 0x3BF, 0x313, 0x301, 0x3BF,
+    0x314, 0x301, 0x3C5, 0x313, 0x3C5, 0x314, 0x3C5, 0x313, 0x300, 0x3C5,
+    0x314, 0x300, 0x3C5, 0x313, 0x301, 0x3C5, 0x314, 0x301, 0x3C5, 0x313,
+    0x342, 0x3C5, 0x314, 0x342, 0x3C9, 0x313, 0x3C9, 0x314, 0x3C9, 0x313,
+    0x300, 0x3C9, 0x314, 0x300, 0x3C9, 0x313, 0x301, 0x3C9, 0x314, 0x301,
+    0x3C9, 0x313, 0x342, 0x3C9, 0x314, 0x342, 0x3B1, 0x300, 0x3B5, 0x300,
+    0x3B7, 0x300, 0x3B9, 0x300, 0x3BF, 0x300, 0x3C5, 0x300, 0x3C9, 0x300,
+    0x3B1, 0x313, 0x345, 0x3B1, 0x314, 0x345, 0x3B1, 0x313, 0x300, 0x345,
+    0x3B1, 0x314, 0x300, 0x345, 0x3B1, 0x313, 0x301, 0x345, 0x3B1, 0x314,
+    0x301, 0x345, 0x3B1, 0x313, 0x342, 0x345, 0x3B1, 0x314, 0x342, 0x345,
+    0x3B7, 0x313, 0x345, 0x3B7, 0x314, 0x345, 0x3B7, 0x313, 0x300, 0x345,
+    0x3B7, 0x314, 0x300, 0x345, 0x3B7, 0x313, 0x301, 0x345, 0x3B7, 0x314,
+    0x301, 0x345, 0x3B7, 0x313, 0x342, 0x345, 0x3B7, 0x314, 0x342, 0x345,
+    0x3C9, 0x313, 0x345, 0x3C9, 0x314, 0x345, 0x3C9, 0x313, 0x300, 0x345,
+    0x3C9, 0x314, 0x300, 0x345, 0x3C9, 0x313, 0x301, 0x345, 0x3C9, 0x314,
+    0x301, 0x345, 0x3C9, 0x313, 0x342, 0x345, 0x3C9, 0x314, 0x342, 0x345,
+    0x3B1, 0x306, 0x3B1, 0x304, 0x3B1, 0x300, 0x345, 0x3B1, 0x345, 0x3B1,
+    0x301, 0x345, 0x3B1, 0x342, 0x3B1, 0x342, 0x345, 0xA8, 0x342, 0x3B7,
+    0x300, 0x345, 0x3B7, 0x345, 0x3B7, 0x301, 0x345, 0x3B7, 0x342, 0x3B7,
+    0x342, 0x345, 0x1FBF, 0x300, 0x1FBF, 0x301, 0x1FBF, 0x342, 0x3B9, 0x306,
+    0x3B9, 0x304, 0x3B9, 0x308, 0x300, 0x3B9, 0x342, 0x3B9, 0x308, 0x342,
+    0x1FFE, 0x300, 0x1FFE, 0x301, 0x1FFE, 0x342, 0x3C5, 0x306, 0x3C5, 0x304,
+    0x3C5, 0x308, 0x300, 0x3C1, 0x313, 0x3C1, 0x314, 0x3C5, 0x342, 0x3C5,
+    0x308, 0x342, 0xA8, 0x300, 0x60, 0x3C9, 0x300, 0x345, 0x3C9, 0x345,
+    0x3C9, 0x301, 0x345, 0x3C9, 0x342, 0x3C9, 0x342, 0x345, 0xB4, 0x2002,
+    0x2003, 0x214E, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177,
+    0x2178, 0x2179, 0x217A, 0x217B, 0x217C, 0x217D, 0x217E, 0x217F, 0x2184, 0x2190,
+    0x338, 0x2192, 0x338, 0x2194, 0x338, 0x21D0, 0x338, 0x21D4, 0x338, 0x21D2,
+    0x338, 0x2203, 0x338, 0x2208, 0x338, 0x220B, 0x338, 0x2223, 0x338, 0x2225,
+    0x338, 0x223C, 0x338, 0x2243, 0x338, 0x2245, 0x338, 0x2248, 0x338, 0x3D,
+    0x338, 0x2261, 0x338, 0x224D, 0x338, 0x3C, 0x338, 0x3E, 0x338, 0x2264,
+    0x338, 0x2265, 0x338, 0x2272, 0x338, 0x2273, 0x338, 0x2276, 0x338, 0x2277,
+    0x338, 0x227A, 0x338, 0x227B, 0x338, 0x2282, 0x338, 0x2283, 0x338, 0x2286,
+    0x338, 0x2287, 0x338, 0x22A2, 0x338, 0x22A8, 0x338, 0x22A9, 0x338, 0x22AB,
+    0x338, 0x227C, 0x338, 0x227D, 0x338, 0x2291, 0x338, 0x2292, 0x338, 0x22B2,
+    0x338, 0x22B3, 0x338, 0x22B4, 0x338, 0x22B5, 0x338, 0x3008, 0x3009, 0x24D0,
+    0x24D1, 0x24D2, 0x24D3, 0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9, 0x24DA,
+    0x24DB, 0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4,
+    0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9, 0x2ADD, 0x338, 0x2C30, 0x2C31, 0x2C32,
+    0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37, 0x2C38, 0x2C39, 0x2C3A, 0x2C3B, 0x2C3C,
+    0x2C3D, 0x2C3E, 0x2C3F, 0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46,
+    0x2C47, 0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F, 0x2C50,
+    0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57, 0x2C58, 0x2C59, 0x2C5A,
+    0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x2C5F, 0x2C61, 0x26B, 0x1D7D, 0x27D, 0x2C68,
+    0x2C6A, 0x2C6C, 0x251, 0x271, 0x250, 0x252, 0x2C73, 0x2C76, 0x23F, 0x240,
+    0x2C81, 0x2C83, 0x2C85, 0x2C87, 0x2C89, 0x2C8B, 0x2C8D, 0x2C8F, 0x2C91, 0x2C93,
+    0x2C95, 0x2C97, 0x2C99, 0x2C9B, 0x2C9D, 0x2C9F, 0x2CA1, 0x2CA3, 0x2CA5, 0x2CA7,
+    0x2CA9, 0x2CAB, 0x2CAD, 0x2CAF, 0x2CB1, 0x2CB3, 0x2CB5, 0x2CB7, 0x2CB9, 0x2CBB,
+    0x2CBD, 0x2CBF, 0x2CC1, 0x2CC3, 0x2CC5, 0x2CC7, 0x2CC9, 0x2CCB, 0x2CCD, 0x2CCF,
+    0x2CD1, 0x2CD3, 0x2CD5, 0x2CD7, 0x2CD9, 0x2CDB, 0x2CDD, 0x2CDF, 0x2CE1, 0x2CE3,
+    0x2CEC, 0x2CEE, 0x2CF3, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099, 0x3051,
+    0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B,
+    0x3099, 0x305D, 0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+    0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072,
+    0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A, 0x307B,
+    0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD,
+    0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7,
+    0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1,
+    0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF,
+    0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8,
+    0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF,
+    0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0xA641,
+    0xA643, 0xA645, 0xA647, 0xA649, 0xA64D, 0xA64F, 0xA651, 0xA653, 0xA655, 0xA657,
+    0xA659, 0xA65B, 0xA65D, 0xA65F, 0xA661, 0xA663, 0xA665, 0xA667, 0xA669, 0xA66B,
+    0xA66D, 0xA681, 0xA683, 0xA685, 0xA687, 0xA689, 0xA68B, 0xA68D, 0xA68F, 0xA691,
+    0xA693, 0xA695, 0xA697, 0xA699, 0xA69B, 0xA723, 0xA725, 0xA727, 0xA729, 0xA72B,
+    0xA72D, 0xA72F, 0xA733, 0xA735, 0xA737, 0xA739, 0xA73B, 0xA73D, 0xA73F, 0xA741,
+    0xA743, 0xA745, 0xA747, 0xA749, 0xA74B, 0xA74D, 0xA74F, 0xA751, 0xA753, 0xA755,
+    0xA757, 0xA759, 0xA75B, 0xA75D, 0xA75F, 0xA761, 0xA763, 0xA765, 0xA767, 0xA769,
+    0xA76B, 0xA76D, 0xA76F, 0xA77A, 0xA77C, 0x1D79, 0xA77F, 0xA781, 0xA783, 0xA785,
+    0xA787, 0xA78C, 0x265, 0xA791, 0xA793, 0xA797, 0xA799, 0xA79B, 0xA79D, 0xA79F,
+    0xA7A1, 0xA7A3, 0xA7A5, 0xA7A7, 0xA7A9, 0x266, 0x25C, 0x261, 0x26C, 0x26A,
+    0x29E, 0x287, 0x29D, 0xAB53, 0xA7B5, 0xA7B7, 0xA7B9, 0xA7BB, 0xA7BD, 0xA7BF,
+    0xA7C1, 0xA7C3, 0xA794, 0x282, 0x1D8E, 0xA7C8, 0xA7CA, 0xA7D1, 0xA7D7, 0xA7D9,
+    0xA7F6, 0x13A0, 0x13A1, 0x13A2, 0x13A3, 0x13A4, 0x13A5, 0x13A6, 0x13A7, 0x13A8,
+    0x13A9, 0x13AA, 0x13AB, 0x13AC, 0x13AD, 0x13AE, 0x13AF, 0x13B0, 0x13B1, 0x13B2,
+    0x13B3, 0x13B4, 0x13B5, 0x13B6, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB, 0x13BC,
+    0x13BD, 0x13BE, 0x13BF, 0x13C0, 0x13C1, 0x13C2, 0x13C3, 0x13C4, 0x13C5, 0x13C6,
+    0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB, 0x13CC, 0x13CD, 0x13CE, 0x13CF, 0x13D0,
+    0x13D1, 0x13D2, 0x13D3, 0x13D4, 0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9, 0x13DA,
+    0x13DB, 0x13DC, 0x13DD, 0x13DE, 0x13DF, 0x13E0, 0x13E1, 0x13E2, 0x13E3, 0x13E4,
+    0x13E5, 0x13E6, 0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC, 0x13ED, 0x13EE,
+    0x13EF, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x9F9C, 0x5951,
+    0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F,
+    0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04,
+    0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F,
+    0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3,
+    0x7210, 0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C,
+    0x797F, 0x7DA0, 0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E,
+    0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F,
+    0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675,
+    0x8B80, 0x62CF, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB,
+    0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+    0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169,
+    0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC,
+    0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77,
+    0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+    0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2,
+    0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5DBA, 0x601C,
+    0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE,
+    0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x71CE, 0x7642,
+    0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C,
+    0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19,
+    0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613,
+    0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2,
+    0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797,
+    0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336,
+    0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C,
+    0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA,
+    0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038,
+    0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+    0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E,
+    0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A,
+    0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956,
+    0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7E09, 0x7E41, 0x7F72, 0x8005,
+    0x81ED, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6,
+    0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80,
+    0x5145, 0x5180, 0x52C7, 0x52FA, 0x5555, 0x5599, 0x55E2, 0x58B3, 0x5944, 0x5954,
+    0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x6160,
+    0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x671B, 0x6756, 0x6B79, 0x6EDB, 0x6ECB,
+    0x701E, 0x77A7, 0x7235, 0x72AF, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76DB,
+    0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7C7B, 0x7D5B, 0x7F3E, 0x8352, 0x83EF,
+    0x8779, 0x8941, 0x8986, 0x8ABF, 0x8ACB, 0x8AED, 0x8B8A, 0x8F38, 0x9072, 0x9199,
+    0x9276, 0x967C, 0x97DB, 0x980B, 0x9B12, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018,
+    0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x5D9, 0x5B4, 0x5F2, 0x5B7,
+    0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5E9, 0x5BC, 0x5C1, 0x5E9, 0x5BC, 0x5C2,
+    0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC,
+    0x5D3, 0x5BC, 0x5D4, 0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC,
+    0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE, 0x5BC,
+    0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x5E4, 0x5BC, 0x5E6, 0x5BC,
+    0x5E7, 0x5BC, 0x5E8, 0x5BC, 0x5E9, 0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9,
+    0x5D1, 0x5BF, 0x5DB, 0x5BF, 0x5E4, 0x5BF, 0xFF41, 0xFF42, 0xFF43, 0xFF44,
+    0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E,
+    0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58,
+    0xFF59, 0xFF5A, 0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D, 0x1042E, 0x1042F,
+    0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436, 0x10437, 0x10438, 0x10439,
+    0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E, 0x1043F, 0x10440, 0x10441, 0x10442, 0x10443,
+    0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D,
+    0x1044E, 0x1044F, 0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE, 0x104DF,
+    0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5, 0x104E6, 0x104E7, 0x104E8, 0x104E9,
+    0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE, 0x104EF, 0x104F0, 0x104F1, 0x104F2, 0x104F3,
+    0x104F4, 0x104F5, 0x104F6, 0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x10597, 0x10598,
+    0x10599, 0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0, 0x105A1, 0x105A3,
+    0x105A4, 0x105A5, 0x105A6, 0x105A7, 0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD,
+    0x105AE, 0x105AF, 0x105B0, 0x105B1, 0x105B3, 0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8,
+    0x105B9, 0x105BB, 0x105BC, 0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6,
+    0x10CC7, 0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF, 0x10CD0,
+    0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7, 0x10CD8, 0x10CD9, 0x10CDA,
+    0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF, 0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4,
+    0x10CE5, 0x10CE6, 0x10CE7, 0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE,
+    0x10CEF, 0x10CF0, 0x10CF1, 0x10CF2, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA,
+    0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA,
+    0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x118C0, 0x118C1,
+    0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9, 0x118CA, 0x118CB,
+    0x118CC, 0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4, 0x118D5,
+    0x118D6, 0x118D7, 0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF,
+    0x11935, 0x11930, 0x16E60, 0x16E61, 0x16E62, 0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67,
+    0x16E68, 0x16E69, 0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70, 0x16E71,
+    0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78, 0x16E79, 0x16E7A, 0x16E7B,
+    0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165,
+    0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171,
+    0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E,
+    0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x1E922,
+    0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929, 0x1E92A, 0x1E92B, 0x1E92C,
+    0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931, 0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936,
+    0x1E937, 0x1E938, 0x1E939, 0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940,
+    0x1E941, 0x1E942, 0x1E943, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FBB, 0x5002,
+    0x507A, 0x5099, 0x50CF, 0x349E, 0x2063A, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9,
+    0x5167, 0x518D, 0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x291DF, 0x51F5, 0x5203,
+    0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x5305, 0x5306, 0x5349, 0x535A,
+    0x5373, 0x537D, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1,
+    0x5406, 0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563,
+    0x5584, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5717, 0x5651, 0x5674, 0x58EE, 0x57CE,
+    0x57F4, 0x580D, 0x578B, 0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906,
+    0x591A, 0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66,
+    0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BF3, 0x21B18, 0x5BFF,
+    0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6,
+    0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69,
+    0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x2A392, 0x5EFE, 0x22331, 0x8201,
+    0x5F22, 0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7,
+    0x5FF9, 0x6081, 0x393A, 0x391C, 0x226D4, 0x60C7, 0x6148, 0x614C, 0x617A, 0x61B2,
+    0x61A4, 0x61AF, 0x61DE, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C,
+    0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E,
+    0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649,
+    0x3B19, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9, 0x6721,
+    0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x2346D, 0x688E, 0x681F,
+    0x6914, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21, 0x238A7,
+    0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC,
+    0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34,
+    0x6E2F, 0x6E6E, 0x3D33, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6,
+    0x7039, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263,
+    0x719C, 0x243AB, 0x7228, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814, 0x737A,
+    0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x7447, 0x745C, 0x7485, 0x74CA, 0x3F1B, 0x7524,
+    0x24C36, 0x753E, 0x24C92, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008,
+    0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x778B, 0x4046, 0x4096, 0x2541D,
+    0x784E, 0x40E3, 0x25626, 0x2569A, 0x256C5, 0x79EB, 0x412F, 0x7A4A, 0x7A4F, 0x2597C,
+    0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0,
+    0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334,
+    0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x264DA, 0x26523,
+    0x8060, 0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5,
+    0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D,
+    0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C, 0x831D, 0x8363, 0x83AD, 0x8323,
+    0x83BD, 0x83E7, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B,
+    0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561, 0x26FB1, 0x270D2,
+    0x456B, 0x8650, 0x8667, 0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8728, 0x876B,
+    0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE,
+    0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8C55, 0x27CA8,
+    0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE,
+    0x8ED4, 0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7,
+    0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6,
+    0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2,
+    0x29496, 0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE,
+    0x29B30, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E,
+    0x2A291, 0x9EBB, 0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+};
+
+const CompositionUnicode compositions_unicode[941] = {
+    {0x338, 0x226E}, {0x338, 0x2260}, {0x338, 0x226F}, {0x300, 0xC0}, {0x301, 0xC1},
+    {0x302, 0xC2}, {0x303, 0xC3}, {0x304, 0x100}, {0x306, 0x102}, {0x307, 0x226},
+    {0x308, 0xC4}, {0x309, 0x1EA2}, {0x30A, 0xC5}, {0x30C, 0x1CD}, {0x30F, 0x200},
+    {0x311, 0x202}, {0x323, 0x1EA0}, {0x325, 0x1E00}, {0x328, 0x104}, {0x307, 0x1E02},
+    {0x323, 0x1E04}, {0x331, 0x1E06}, {0x301, 0x106}, {0x302, 0x108}, {0x307, 0x10A},
+    {0x30C, 0x10C}, {0x327, 0xC7}, {0x307, 0x1E0A}, {0x30C, 0x10E}, {0x323, 0x1E0C},
+    {0x327, 0x1E10}, {0x32D, 0x1E12}, {0x331, 0x1E0E}, {0x300, 0xC8}, {0x301, 0xC9},
+    {0x302, 0xCA}, {0x303, 0x1EBC}, {0x304, 0x112}, {0x306, 0x114}, {0x307, 0x116},
+    {0x308, 0xCB}, {0x309, 0x1EBA}, {0x30C, 0x11A}, {0x30F, 0x204}, {0x311, 0x206},
+    {0x323, 0x1EB8}, {0x327, 0x228}, {0x328, 0x118}, {0x32D, 0x1E18}, {0x330, 0x1E1A},
+    {0x307, 0x1E1E}, {0x301, 0x1F4}, {0x302, 0x11C}, {0x304, 0x1E20}, {0x306, 0x11E},
+    {0x307, 0x120}, {0x30C, 0x1E6}, {0x327, 0x122}, {0x302, 0x124}, {0x307, 0x1E22},
+    {0x308, 0x1E26}, {0x30C, 0x21E}, {0x323, 0x1E24}, {0x327, 0x1E28}, {0x32E, 0x1E2A},
+    {0x300, 0xCC}, {0x301, 0xCD}, {0x302, 0xCE}, {0x303, 0x128}, {0x304, 0x12A},
+    {0x306, 0x12C}, {0x307, 0x130}, {0x308, 0xCF}, {0x309, 0x1EC8}, {0x30C, 0x1CF},
+    {0x30F, 0x208}, {0x311, 0x20A}, {0x323, 0x1ECA}, {0x328, 0x12E}, {0x330, 0x1E2C},
+    {0x302, 0x134}, {0x301, 0x1E30}, {0x30C, 0x1E8}, {0x323, 0x1E32}, {0x327, 0x136},
+    {0x331, 0x1E34}, {0x301, 0x139}, {0x30C, 0x13D}, {0x323, 0x1E36}, {0x327, 0x13B},
+    {0x32D, 0x1E3C}, {0x331, 0x1E3A}, {0x301, 0x1E3E}, {0x307, 0x1E40}, {0x323, 0x1E42},
+    {0x300, 0x1F8}, {0x301, 0x143}, {0x303, 0xD1}, {0x307, 0x1E44}, {0x30C, 0x147},
+    {0x323, 0x1E46}, {0x327, 0x145}, {0x32D, 0x1E4A}, {0x331, 0x1E48}, {0x300, 0xD2},
+    {0x301, 0xD3}, {0x302, 0xD4}, {0x303, 0xD5}, {0x304, 0x14C}, {0x306, 0x14E},
+    {0x307, 0x22E}, {0x308, 0xD6}, {0x309, 0x1ECE}, {0x30B, 0x150}, {0x30C, 0x1D1},
+    {0x30F, 0x20C}, {0x311, 0x20E}, {0x31B, 0x1A0}, {0x323, 0x1ECC}, {0x328, 0x1EA},
+    {0x301, 0x1E54}, {0x307, 0x1E56}, {0x301, 0x154}, {0x307, 0x1E58}, {0x30C, 0x158},
+    {0x30F, 0x210}, {0x311, 0x212}, {0x323, 0x1E5A}, {0x327, 0x156}, {0x331, 0x1E5E},
+    {0x301, 0x15A}, {0x302, 0x15C}, {0x307, 0x1E60}, {0x30C, 0x160}, {0x323, 0x1E62},
+    {0x326, 0x218}, {0x327, 0x15E}, {0x307, 0x1E6A}, {0x30C, 0x164}, {0x323, 0x1E6C},
+    {0x326, 0x21A}, {0x327, 0x162}, {0x32D, 0x1E70}, {0x331, 0x1E6E}, {0x300, 0xD9},
+    {0x301, 0xDA}, {0x302, 0xDB}, {0x303, 0x168}, {0x304, 0x16A}, {0x306, 0x16C},
+    {0x308, 0xDC}, {0x309, 0x1EE6}, {0x30A, 0x16E}, {0x30B, 0x170}, {0x30C, 0x1D3},
+    {0x30F, 0x214}, {0x311, 0x216}, {0x31B, 0x1AF}, {0x323, 0x1EE4}, {0x324, 0x1E72},
+    {0x328, 0x172}, {0x32D, 0x1E76}, {0x330, 0x1E74}, {0x303, 0x1E7C}, {0x323, 0x1E7E},
+    {0x300, 0x1E80}, {0x301, 0x1E82}, {0x302, 0x174}, {0x307, 0x1E86}, {0x308, 0x1E84},
+    {0x323, 0x1E88}, {0x307, 0x1E8A}, {0x308, 0x1E8C}, {0x300, 0x1EF2}, {0x301, 0xDD},
+    {0x302, 0x176}, {0x303, 0x1EF8}, {0x304, 0x232}, {0x307, 0x1E8E}, {0x308, 0x178},
+    {0x309, 0x1EF6}, {0x323, 0x1EF4}, {0x301, 0x179}, {0x302, 0x1E90}, {0x307, 0x17B},
+    {0x30C, 0x17D}, {0x323, 0x1E92}, {0x331, 0x1E94}, {0x300, 0xE0}, {0x301, 0xE1},
+    {0x302, 0xE2}, {0x303, 0xE3}, {0x304, 0x101}, {0x306, 0x103}, {0x307, 0x227},
+    {0x308, 0xE4}, {0x309, 0x1EA3}, {0x30A, 0xE5}, {0x30C, 0x1CE}, {0x30F, 0x201},
+    {0x311, 0x203}, {0x323, 0x1EA1}, {0x325, 0x1E01}, {0x328, 0x105}, {0x307, 0x1E03},
+    {0x323, 0x1E05}, {0x331, 0x1E07}, {0x301, 0x107}, {0x302, 0x109}, {0x307, 0x10B},
+    {0x30C, 0x10D}, {0x327, 0xE7}, {0x307, 0x1E0B}, {0x30C, 0x10F}, {0x323, 0x1E0D},
+    {0x327, 0x1E11}, {0x32D, 0x1E13}, {0x331, 0x1E0F}, {0x300, 0xE8}, {0x301, 0xE9},
+    {0x302, 0xEA}, {0x303, 0x1EBD}, {0x304, 0x113}, {0x306, 0x115}, {0x307, 0x117},
+    {0x308, 0xEB}, {0x309, 0x1EBB}, {0x30C, 0x11B}, {0x30F, 0x205}, {0x311, 0x207},
+    {0x323, 0x1EB9}, {0x327, 0x229}, {0x328, 0x119}, {0x32D, 0x1E19}, {0x330, 0x1E1B},
+    {0x307, 0x1E1F}, {0x301, 0x1F5}, {0x302, 0x11D}, {0x304, 0x1E21}, {0x306, 0x11F},
+    {0x307, 0x121}, {0x30C, 0x1E7}, {0x327, 0x123}, {0x302, 0x125}, {0x307, 0x1E23},
+    {0x308, 0x1E27}, {0x30C, 0x21F}, {0x323, 0x1E25}, {0x327, 0x1E29}, {0x32E, 0x1E2B},
+    {0x331, 0x1E96}, {0x300, 0xEC}, {0x301, 0xED}, {0x302, 0xEE}, {0x303, 0x129},
+    {0x304, 0x12B}, {0x306, 0x12D}, {0x308, 0xEF}, {0x309, 0x1EC9}, {0x30C, 0x1D0},
+    {0x30F, 0x209}, {0x311, 0x20B}, {0x323, 0x1ECB}, {0x328, 0x12F}, {0x330, 0x1E2D},
+    {0x302, 0x135}, {0x30C, 0x1F0}, {0x301, 0x1E31}, {0x30C, 0x1E9}, {0x323, 0x1E33},
+    {0x327, 0x137}, {0x331, 0x1E35}, {0x301, 0x13A}, {0x30C, 0x13E}, {0x323, 0x1E37},
+    {0x327, 0x13C}, {0x32D, 0x1E3D}, {0x331, 0x1E3B}, {0x301, 0x1E3F}, {0x307, 0x1E41},
+    {0x323, 0x1E43}, {0x300, 0x1F9}, {0x301, 0x144}, {0x303, 0xF1}, {0x307, 0x1E45},
+    {0x30C, 0x148}, {0x323, 0x1E47}, {0x327, 0x146}, {0x32D, 0x1E4B}, {0x331, 0x1E49},
+    {0x300, 0xF2}, {0x301, 0xF3}, {0x302, 0xF4}, {0x303, 0xF5}, {0x304, 0x14D},
+    {0x306, 0x14F}, {0x307, 0x22F}, {0x308, 0xF6}, {0x309, 0x1ECF}, {0x30B, 0x151},
+    {0x30C, 0x1D2}, {0x30F, 0x20D}, {0x311, 0x20F}, {0x31B, 0x1A1}, {0x323, 0x1ECD},
+    {0x328, 0x1EB}, {0x301, 0x1E55}, {0x307, 0x1E57}, {0x301, 0x155}, {0x307, 0x1E59},
+    {0x30C, 0x159}, {0x30F, 0x211}, {0x311, 0x213}, {0x323, 0x1E5B}, {0x327, 0x157},
+    {0x331, 0x1E5F}, {0x301, 0x15B}, {0x302, 0x15D}, {0x307, 0x1E61}, {0x30C, 0x161},
+    {0x323, 0x1E63}, {0x326, 0x219}, {0x327, 0x15F}, {0x307, 0x1E6B}, {0x308, 0x1E97},
+    {0x30C, 0x165}, {0x323, 0x1E6D}, {0x326, 0x21B}, {0x327, 0x163}, {0x32D, 0x1E71},
+    {0x331, 0x1E6F}, {0x300, 0xF9}, {0x301, 0xFA}, {0x302, 0xFB}, {0x303, 0x169},
+    {0x304, 0x16B}, {0x306, 0x16D}, {0x308, 0xFC}, {0x309, 0x1EE7}, {0x30A, 0x16F},
+    {0x30B, 0x171}, {0x30C, 0x1D4}, {0x30F, 0x215}, {0x311, 0x217}, {0x31B, 0x1B0},
+    {0x323, 0x1EE5}, {0x324, 0x1E73}, {0x328, 0x173}, {0x32D, 0x1E77}, {0x330, 0x1E75},
+    {0x303, 0x1E7D}, {0x323, 0x1E7F}, {0x300, 0x1E81}, {0x301, 0x1E83}, {0x302, 0x175},
+    {0x307, 0x1E87}, {0x308, 0x1E85}, {0x30A, 0x1E98}, {0x323, 0x1E89}, {0x307, 0x1E8B},
+    {0x308, 0x1E8D}, {0x300, 0x1EF3}, {0x301, 0xFD}, {0x302, 0x177}, {0x303, 0x1EF9},
+    {0x304, 0x233}, {0x307, 0x1E8F}, {0x308, 0xFF}, {0x309, 0x1EF7}, {0x30A, 0x1E99},
+    {0x323, 0x1EF5}, {0x301, 0x17A}, {0x302, 0x1E91}, {0x307, 0x17C}, {0x30C, 0x17E},
+    {0x323, 0x1E93}, {0x331, 0x1E95}, {0x300, 0x1FED}, {0x301, 0x385}, {0x342, 0x1FC1},
+    {0x300, 0x1EA6}, {0x301, 0x1EA4}, {0x303, 0x1EAA}, {0x309, 0x1EA8}, {0x304, 0x1DE},
+    {0x301, 0x1FA}, {0x301, 0x1FC}, {0x304, 0x1E2}, {0x301, 0x1E08}, {0x300, 0x1EC0},
+    {0x301, 0x1EBE}, {0x303, 0x1EC4}, {0x309, 0x1EC2}, {0x301, 0x1E2E}, {0x300, 0x1ED2},
+    {0x301, 0x1ED0}, {0x303, 0x1ED6}, {0x309, 0x1ED4}, {0x301, 0x1E4C}, {0x304, 0x22C},
+    {0x308, 0x1E4E}, {0x304, 0x22A}, {0x301, 0x1FE}, {0x300, 0x1DB}, {0x301, 0x1D7},
+    {0x304, 0x1D5}, {0x30C, 0x1D9}, {0x300, 0x1EA7}, {0x301, 0x1EA5}, {0x303, 0x1EAB},
+    {0x309, 0x1EA9}, {0x304, 0x1DF}, {0x301, 0x1FB}, {0x301, 0x1FD}, {0x304, 0x1E3},
+    {0x301, 0x1E09}, {0x300, 0x1EC1}, {0x301, 0x1EBF}, {0x303, 0x1EC5}, {0x309, 0x1EC3},
+    {0x301, 0x1E2F}, {0x300, 0x1ED3}, {0x301, 0x1ED1}, {0x303, 0x1ED7}, {0x309, 0x1ED5},
+    {0x301, 0x1E4D}, {0x304, 0x22D}, {0x308, 0x1E4F}, {0x304, 0x22B}, {0x301, 0x1FF},
+    {0x300, 0x1DC}, {0x301, 0x1D8}, {0x304, 0x1D6}, {0x30C, 0x1DA}, {0x300, 0x1EB0},
+    {0x301, 0x1EAE}, {0x303, 0x1EB4}, {0x309, 0x1EB2}, {0x300, 0x1EB1}, {0x301, 0x1EAF},
+    {0x303, 0x1EB5}, {0x309, 0x1EB3}, {0x300, 0x1E14}, {0x301, 0x1E16}, {0x300, 0x1E15},
+    {0x301, 0x1E17}, {0x300, 0x1E50}, {0x301, 0x1E52}, {0x300, 0x1E51}, {0x301, 0x1E53},
+    {0x307, 0x1E64}, {0x307, 0x1E65}, {0x307, 0x1E66}, {0x307, 0x1E67}, {0x301, 0x1E78},
+    {0x301, 0x1E79}, {0x308, 0x1E7A}, {0x308, 0x1E7B}, {0x307, 0x1E9B}, {0x300, 0x1EDC},
+    {0x301, 0x1EDA}, {0x303, 0x1EE0}, {0x309, 0x1EDE}, {0x323, 0x1EE2}, {0x300, 0x1EDD},
+    {0x301, 0x1EDB}, {0x303, 0x1EE1}, {0x309, 0x1EDF}, {0x323, 0x1EE3}, {0x300, 0x1EEA},
+    {0x301, 0x1EE8}, {0x303, 0x1EEE}, {0x309, 0x1EEC}, {0x323, 0x1EF0}, {0x300, 0x1EEB},
+    {0x301, 0x1EE9}, {0x303, 0x1EEF}, {0x309, 0x1EED}, {0x323, 0x1EF1}, {0x30C, 0x1EE},
+    {0x304, 0x1EC}, {0x304, 0x1ED}, {0x304, 0x1E0}, {0x304, 0x1E1}, {0x306, 0x1E1C},
+    {0x306, 0x1E1D}, {0x304, 0x230}, {0x304, 0x231}, {0x30C, 0x1EF}, {0x300, 0x1FBA},
+    {0x301, 0x386}, {0x304, 0x1FB9}, {0x306, 0x1FB8}, {0x313, 0x1F08}, {0x314, 0x1F09},
+    {0x345, 0x1FBC}, {0x300, 0x1FC8}, {0x301, 0x388}, {0x313, 0x1F18}, {0x314, 0x1F19},
+    {0x300, 0x1FCA}, {0x301, 0x389}, {0x313, 0x1F28}, {0x314, 0x1F29}, {0x345, 0x1FCC},
+    {0x300, 0x1FDA}, {0x301, 0x38A}, {0x304, 0x1FD9}, {0x306, 0x1FD8}, {0x308, 0x3AA},
+    {0x313, 0x1F38}, {0x314, 0x1F39}, {0x300, 0x1FF8}, {0x301, 0x38C}, {0x313, 0x1F48},
+    {0x314, 0x1F49}, {0x314, 0x1FEC}, {0x300, 0x1FEA}, {0x301, 0x38E}, {0x304, 0x1FE9},
+    {0x306, 0x1FE8}, {0x308, 0x3AB}, {0x314, 0x1F59}, {0x300, 0x1FFA}, {0x301, 0x38F},
+    {0x313, 0x1F68}, {0x314, 0x1F69}, {0x345, 0x1FFC}, {0x345, 0x1FB4}, {0x345, 0x1FC4},
+    {0x300, 0x1F70}, {0x301, 0x3AC}, {0x304, 0x1FB1}, {0x306, 0x1FB0}, {0x313, 0x1F00},
+    {0x314, 0x1F01}, {0x342, 0x1FB6}, {0x345, 0x1FB3}, {0x300, 0x1F72}, {0x301, 0x3AD},
+    {0x313, 0x1F10}, {0x314, 0x1F11}, {0x300, 0x1F74}, {0x301, 0x3AE}, {0x313, 0x1F20},
+    {0x314, 0x1F21}, {0x342, 0x1FC6}, {0x345, 0x1FC3}, {0x300, 0x1F76}, {0x301, 0x3AF},
+    {0x304, 0x1FD1}, {0x306, 0x1FD0}, {0x308, 0x3CA}, {0x313, 0x1F30}, {0x314, 0x1F31},
+    {0x342, 0x1FD6}, {0x300, 0x1F78}, {0x301, 0x3CC}, {0x313, 0x1F40}, {0x314, 0x1F41},
+    {0x313, 0x1FE4}, {0x314, 0x1FE5}, {0x300, 0x1F7A}, {0x301, 0x3CD}, {0x304, 0x1FE1},
+    {0x306, 0x1FE0}, {0x308, 0x3CB}, {0x313, 0x1F50}, {0x314, 0x1F51}, {0x342, 0x1FE6},
+    {0x300, 0x1F7C}, {0x301, 0x3CE}, {0x313, 0x1F60}, {0x314, 0x1F61}, {0x342, 0x1FF6},
+    {0x345, 0x1FF3}, {0x300, 0x1FD2}, {0x301, 0x390}, {0x342, 0x1FD7}, {0x300, 0x1FE2},
+    {0x301, 0x3B0}, {0x342, 0x1FE7}, {0x345, 0x1FF4}, {0x301, 0x3D3}, {0x308, 0x3D4},
+    {0x308, 0x407}, {0x306, 0x4D0}, {0x308, 0x4D2}, {0x301, 0x403}, {0x300, 0x400},
+    {0x306, 0x4D6}, {0x308, 0x401}, {0x306, 0x4C1}, {0x308, 0x4DC}, {0x308, 0x4DE},
+    {0x300, 0x40D}, {0x304, 0x4E2}, {0x306, 0x419}, {0x308, 0x4E4}, {0x301, 0x40C},
+    {0x308, 0x4E6}, {0x304, 0x4EE}, {0x306, 0x40E}, {0x308, 0x4F0}, {0x30B, 0x4F2},
+    {0x308, 0x4F4}, {0x308, 0x4F8}, {0x308, 0x4EC}, {0x306, 0x4D1}, {0x308, 0x4D3},
+    {0x301, 0x453}, {0x300, 0x450}, {0x306, 0x4D7}, {0x308, 0x451}, {0x306, 0x4C2},
+    {0x308, 0x4DD}, {0x308, 0x4DF}, {0x300, 0x45D}, {0x304, 0x4E3}, {0x306, 0x439},
+    {0x308, 0x4E5}, {0x301, 0x45C}, {0x308, 0x4E7}, {0x304, 0x4EF}, {0x306, 0x45E},
+    {0x308, 0x4F1}, {0x30B, 0x4F3}, {0x308, 0x4F5}, {0x308, 0x4F9}, {0x308, 0x4ED},
+    {0x308, 0x457}, {0x30F, 0x476}, {0x30F, 0x477}, {0x308, 0x4DA}, {0x308, 0x4DB},
+    {0x308, 0x4EA}, {0x308, 0x4EB}, {0x653, 0x622}, {0x654, 0x623}, {0x655, 0x625},
+    {0x654, 0x624}, {0x654, 0x626}, {0x654, 0x6C2}, {0x654, 0x6D3}, {0x654, 0x6C0},
+    {0x93C, 0x929}, {0x93C, 0x931}, {0x93C, 0x934}, {0x9BE, 0x9CB}, {0x9D7, 0x9CC},
+    {0xB3E, 0xB4B}, {0xB56, 0xB48}, {0xB57, 0xB4C}, {0xBD7, 0xB94}, {0xBBE, 0xBCA},
+    {0xBD7, 0xBCC}, {0xBBE, 0xBCB}, {0xC56, 0xC48}, {0xCD5, 0xCC0}, {0xCC2, 0xCCA},
+    {0xCD5, 0xCC7}, {0xCD6, 0xCC8}, {0xCD5, 0xCCB}, {0xD3E, 0xD4A}, {0xD57, 0xD4C},
+    {0xD3E, 0xD4B}, {0xDCA, 0xDDA}, {0xDCF, 0xDDC}, {0xDDF, 0xDDE}, {0xDCA, 0xDDD},
+    {0x102E, 0x1026}, {0x1B35, 0x1B06}, {0x1B35, 0x1B08}, {0x1B35, 0x1B0A}, {0x1B35, 0x1B0C},
+    {0x1B35, 0x1B0E}, {0x1B35, 0x1B12}, {0x1B35, 0x1B3B}, {0x1B35, 0x1B3D}, {0x1B35, 0x1B40},
+    {0x1B35, 0x1B41}, {0x1B35, 0x1B43}, {0x304, 0x1E38}, {0x304, 0x1E39}, {0x304, 0x1E5C},
+    {0x304, 0x1E5D}, {0x307, 0x1E68}, {0x307, 0x1E69}, {0x302, 0x1EAC}, {0x306, 0x1EB6},
+    {0x302, 0x1EAD}, {0x306, 0x1EB7}, {0x302, 0x1EC6}, {0x302, 0x1EC7}, {0x302, 0x1ED8},
+    {0x302, 0x1ED9}, {0x300, 0x1F02}, {0x301, 0x1F04}, {0x342, 0x1F06}, {0x345, 0x1F80},
+    {0x300, 0x1F03}, {0x301, 0x1F05}, {0x342, 0x1F07}, {0x345, 0x1F81}, {0x345, 0x1F82},
+    {0x345, 0x1F83}, {0x345, 0x1F84}, {0x345, 0x1F85}, {0x345, 0x1F86}, {0x345, 0x1F87},
+    {0x300, 0x1F0A}, {0x301, 0x1F0C}, {0x342, 0x1F0E}, {0x345, 0x1F88}, {0x300, 0x1F0B},
+    {0x301, 0x1F0D}, {0x342, 0x1F0F}, {0x345, 0x1F89}, {0x345, 0x1F8A}, {0x345, 0x1F8B},
+    {0x345, 0x1F8C}, {0x345, 0x1F8D}, {0x345, 0x1F8E}, {0x345, 0x1F8F}, {0x300, 0x1F12},
+    {0x301, 0x1F14}, {0x300, 0x1F13}, {0x301, 0x1F15}, {0x300, 0x1F1A}, {0x301, 0x1F1C},
+    {0x300, 0x1F1B}, {0x301, 0x1F1D}, {0x300, 0x1F22}, {0x301, 0x1F24}, {0x342, 0x1F26},
+    {0x345, 0x1F90}, {0x300, 0x1F23}, {0x301, 0x1F25}, {0x342, 0x1F27}, {0x345, 0x1F91},
+    {0x345, 0x1F92}, {0x345, 0x1F93}, {0x345, 0x1F94}, {0x345, 0x1F95}, {0x345, 0x1F96},
+    {0x345, 0x1F97}, {0x300, 0x1F2A}, {0x301, 0x1F2C}, {0x342, 0x1F2E}, {0x345, 0x1F98},
+    {0x300, 0x1F2B}, {0x301, 0x1F2D}, {0x342, 0x1F2F}, {0x345, 0x1F99}, {0x345, 0x1F9A},
+    {0x345, 0x1F9B}, {0x345, 0x1F9C}, {0x345, 0x1F9D}, {0x345, 0x1F9E}, {0x345, 0x1F9F},
+    {0x300, 0x1F32}, {0x301, 0x1F34}, {0x342, 0x1F36}, {0x300, 0x1F33}, {0x301, 0x1F35},
+    {0x342, 0x1F37}, {0x300, 0x1F3A}, {0x301, 0x1F3C}, {0x342, 0x1F3E}, {0x300, 0x1F3B},
+    {0x301, 0x1F3D}, {0x342, 0x1F3F}, {0x300, 0x1F42}, {0x301, 0x1F44}, {0x300, 0x1F43},
+    {0x301, 0x1F45}, {0x300, 0x1F4A}, {0x301, 0x1F4C}, {0x300, 0x1F4B}, {0x301, 0x1F4D},
+    {0x300, 0x1F52}, {0x301, 0x1F54}, {0x342, 0x1F56}, {0x300, 0x1F53}, {0x301, 0x1F55},
+    {0x342, 0x1F57}, {0x300, 0x1F5B}, {0x301, 0x1F5D}, {0x342, 0x1F5F}, {0x300, 0x1F62},
+    {0x301, 0x1F64}, {0x342, 0x1F66}, {0x345, 0x1FA0}, {0x300, 0x1F63}, {0x301, 0x1F65},
+    {0x342, 0x1F67}, {0x345, 0x1FA1}, {0x345, 0x1FA2}, {0x345, 0x1FA3}, {0x345, 0x1FA4},
+    {0x345, 0x1FA5}, {0x345, 0x1FA6}, {0x345, 0x1FA7}, {0x300, 0x1F6A}, {0x301, 0x1F6C},
+    {0x342, 0x1F6E}, {0x345, 0x1FA8}, {0x300, 0x1F6B}, {0x301, 0x1F6D}, {0x342, 0x1F6F},
+    {0x345, 0x1FA9}, {0x345, 0x1FAA}, {0x345, 0x1FAB}, {0x345, 0x1FAC}, {0x345, 0x1FAD},
+    {0x345, 0x1FAE}, {0x345, 0x1FAF}, {0x345, 0x1FB2}, {0x345, 0x1FC2}, {0x345, 0x1FF2},
+    {0x345, 0x1FB7}, {0x300, 0x1FCD}, {0x301, 0x1FCE}, {0x342, 0x1FCF}, {0x345, 0x1FC7},
+    {0x345, 0x1FF7}, {0x300, 0x1FDD}, {0x301, 0x1FDE}, {0x342, 0x1FDF}, {0x338, 0x219A},
+    {0x338, 0x219B}, {0x338, 0x21AE}, {0x338, 0x21CD}, {0x338, 0x21CF}, {0x338, 0x21CE},
+    {0x338, 0x2204}, {0x338, 0x2209}, {0x338, 0x220C}, {0x338, 0x2224}, {0x338, 0x2226},
+    {0x338, 0x2241}, {0x338, 0x2244}, {0x338, 0x2247}, {0x338, 0x2249}, {0x338, 0x226D},
+    {0x338, 0x2262}, {0x338, 0x2270}, {0x338, 0x2271}, {0x338, 0x2274}, {0x338, 0x2275},
+    {0x338, 0x2278}, {0x338, 0x2279}, {0x338, 0x2280}, {0x338, 0x2281}, {0x338, 0x22E0},
+    {0x338, 0x22E1}, {0x338, 0x2284}, {0x338, 0x2285}, {0x338, 0x2288}, {0x338, 0x2289},
+    {0x338, 0x22E2}, {0x338, 0x22E3}, {0x338, 0x22AC}, {0x338, 0x22AD}, {0x338, 0x22AE},
+    {0x338, 0x22AF}, {0x338, 0x22EA}, {0x338, 0x22EB}, {0x338, 0x22EC}, {0x338, 0x22ED},
+    {0x3099, 0x3094}, {0x3099, 0x304C}, {0x3099, 0x304E}, {0x3099, 0x3050}, {0x3099, 0x3052},
+    {0x3099, 0x3054}, {0x3099, 0x3056}, {0x3099, 0x3058}, {0x3099, 0x305A}, {0x3099, 0x305C},
+    {0x3099, 0x305E}, {0x3099, 0x3060}, {0x3099, 0x3062}, {0x3099, 0x3065}, {0x3099, 0x3067},
+    {0x3099, 0x3069}, {0x3099, 0x3070}, {0x309A, 0x3071}, {0x3099, 0x3073}, {0x309A, 0x3074},
+    {0x3099, 0x3076}, {0x309A, 0x3077}, {0x3099, 0x3079}, {0x309A, 0x307A}, {0x3099, 0x307C},
+    {0x309A, 0x307D}, {0x3099, 0x309E}, {0x3099, 0x30F4}, {0x3099, 0x30AC}, {0x3099, 0x30AE},
+    {0x3099, 0x30B0}, {0x3099, 0x30B2}, {0x3099, 0x30B4}, {0x3099, 0x30B6}, {0x3099, 0x30B8},
+    {0x3099, 0x30BA}, {0x3099, 0x30BC}, {0x3099, 0x30BE}, {0x3099, 0x30C0}, {0x3099, 0x30C2},
+    {0x3099, 0x30C5}, {0x3099, 0x30C7}, {0x3099, 0x30C9}, {0x3099, 0x30D0}, {0x309A, 0x30D1},
+    {0x3099, 0x30D3}, {0x309A, 0x30D4}, {0x3099, 0x30D6}, {0x309A, 0x30D7}, {0x3099, 0x30D9},
+    {0x309A, 0x30DA}, {0x3099, 0x30DC}, {0x309A, 0x30DD}, {0x3099, 0x30F7}, {0x3099, 0x30F8},
+    {0x3099, 0x30F9}, {0x3099, 0x30FA}, {0x3099, 0x30FE}, {0x110BA, 0x1109A}, {0x110BA, 0x1109C},
+    {0x110BA, 0x110AB}, {0x11127, 0x1112E}, {0x11127, 0x1112F}, {0x1133E, 0x1134B}, {0x11357, 0x1134C},
+    {0x114B0, 0x114BC}, {0x114BA, 0x114BB}, {0x114BD, 0x114BE}, {0x115AF, 0x115BA}, {0x115AF, 0x115BB},
+    {0x11930, 0x11938},
+};
+
@@ -6,301 +6,218 @@
 #include <locale.h>
 #include <math.h>
 #include <limits.h>
+#include <errno.h>
+#include <dirent.h>
+#include <glob.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "analyse_texte.h"
+#include "corpus.h"
+#include "esquisses.h"
+#include "ngrammes.h"
+#include "ordonnanceur.h"
+#include "sortie_texte.h"
+#include "table_mots.h"
 
-#define LONGUEUR_MOT_MAX 50 // Définit la longueur maximale d'un mot à analyser
-#define NB_MOTS_MAX 20000   // Définit le nombre maximal de mots pouvant être analysés
 #define LONGUEUR_CHEMIN_MAX 256  // Définit la longueur maximale pour un chemin de fichier
-#define TAILLE_HASHTABLE 10007   // Définit la taille de la table de hachage utilisée pour stocker les mots
+#define MOTS_FREQUENTS_LOT 10    // Mots les plus fréquents écrits par fichier en analyse par lots approchée
 
-// Structure représentant un mot analysé
-typedef struct {
-    wchar_t mot[LONGUEUR_MOT_MAX]; // Tableau pour stocker le mot (en caractères larges, compatible Unicode)
-    int frequence;   // Fréquence d'apparition du mot dans le texte
-    int longueur;    // Longueur du mot (nombre de caractères)
-    int est_verbe;   // Indicateur si le mot est un verbe (1 si vrai, 0 sinon)
-    int est_nom_propre;  // Indicateur si le mot est un nom propre (1 si vrai, 0 sinon)
-} Mot;
-// Structure représentant un nœud dans la table de hachage
-typedef struct NoeudHash {
-    Mot mot;                     // Le mot stocké dans ce nœud
-    struct NoeudHash* suivant;   // Pointeur vers le prochain nœud en cas de collision (chaînage)
-} NoeudHash;
-
-// Structure principale pour analyser le texte
-typedef struct {
-    int nb_espaces;
-    int nb_chars_sans_espaces;      //a
-    int nb_lignes;                  // Nombre total de lignes
-    int nb_caracteres;              // Nombre total de caractères
-    wchar_t phrase_plus_longue[1000];  // Pour stocker la phrase la plus longue
-    wchar_t phrase_plus_courte[1000];  // Pour stocker la phrase la plus courte
-    int longueur_plus_longue;       // Longueur de la plus longue phrase
-    int longueur_plus_courte;       // Longueur de la plus courte phrase
-    int nb_mots_total;          // Nombre total de mots analysés dans le texte
-    int nb_mots_uniques;        // Nombre de mots uniques trouvés (sans répétition)
-    int nb_phrases;             // Nombre total de phrases dans le texte
-    int nb_paragraphes;         // Nombre total de paragraphes dans le texte
-    double longueur_mot_moyenne;    // Longueur moyenne des mots dans le texte
-    double longueur_phrase_moyenne; // Longueur moyenne des phrases dans le texte
-    double diversite_lexicale;      // Rapport entre les mots uniques et le nombre total de mots
-    double complexite_texte;        // Indicateur global de la complexité du texte (combinaison de métriques)
-    int nb_verbes;              // Nombre total de verbes identifiés dans le texte
-    int nb_noms_propres;        // Nombre total de noms propres identifiés dans le texte
-    NoeudHash* table_hash[TAILLE_HASHTABLE];  // Table de hachage pour stocker et retrouver les mots rapidement
-} AnalyseTexte;
-
-// Initialise la structure AnalyseTexte à des valeurs par défaut
-void initialiserAnalyse(AnalyseTexte* analyse) {
-    // Remplit toute la structure AnalyseTexte avec des zéros (initialisation complète)
-    memset(analyse, 0, sizeof(AnalyseTexte));
-    // Initialise chaque élément de la table de hachage à NULL (aucun mot n'est encore stocké)
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        analyse->table_hash[i] = NULL;
-    }
-    // Initialisation pour la phrase la plus courte
-    analyse->longueur_plus_courte = INT_MAX;
-    wcscpy(analyse->phrase_plus_courte, L"");
-    wcscpy(analyse->phrase_plus_longue, L"");
-}
-// Nouvelle fonction pour gérer l'extraction des phrases
-void gererPhrase(AnalyseTexte* analyse, const wchar_t* phrase, int longueur) {
-    if (longueur > 0) {
-        // Mise à jour de la phrase la plus longue
-        if (longueur > analyse->longueur_plus_longue) {
-            analyse->longueur_plus_longue = longueur;
-            wcsncpy(analyse->phrase_plus_longue, phrase, 999);
-            analyse->phrase_plus_longue[999] = L'\0';
-        }
-        // Mise à jour de la phrase la plus courte
-        if (longueur < analyse->longueur_plus_courte) {
-            analyse->longueur_plus_courte = longueur;
-            wcsncpy(analyse->phrase_plus_courte, phrase, 999);
-            analyse->phrase_plus_courte[999] = L'\0';
-        }
-    }
+// Secondes écoulées depuis un instant de CLOCK_MONOTONIC
+static double secondesDepuis(const struct timespec* debut) {
+    struct timespec fin;
+    clock_gettime(CLOCK_MONOTONIC, &fin);
+    return (double)(fin.tv_sec - debut->tv_sec) + (fin.tv_nsec - debut->tv_nsec) / 1e9;
 }
 
-// Libère la mémoire allouée dynamiquement pour la structure AnalyseTexte
-void libererAnalyse(AnalyseTexte* analyse) {
-    // Parcourt chaque entrée de la table de hachage
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i]; // Pointe vers le premier nœud de la liste chaînée
-        // Parcourt la liste chaînée pour libérer chaque nœud
-        while (courant != NULL) {
-            NoeudHash* temp = courant; // Stocke l'adresse actuelle avant de passer au suivant
-            courant = courant->suivant; // Passe au nœud suivant dans la liste
-            free(temp); // Libère la mémoire du nœud actuel
-        }
-        // Réinitialise la table de hachage à NULL après avoir libéré tous les nœuds
-        analyse->table_hash[i] = NULL;
-    }
-}
-
-// Vérifie si un caractère fait partie d'un mot valide
-int estCaractereMot(wchar_t c) {
-    // Retourne vrai si le caractère est alphanumérique (lettre ou chiffre),
-    // ou s'il s'agit d'un tiret, d'une apostrophe ou d'un underscore
-    return iswalnum(c) || c == L'-' || c == L'\'' || c == L'_';
-}
+// Noms des catégories de mots, dans l'ordre de CategorieMots
+static const char* noms_categories[] = {"mots", "verbes", "noms propres", "mots de longueur"};
 
-// Normalise un mot en le convertissant en minuscules et en retirant les caractères non valides
-void normaliserMot(wchar_t* mot) {
-    int i, j = 0; // `i` parcourt le mot d'origine, `j` construit le mot normalisé
-    for (i = 0; mot[i]; i++) {
-        // Si le caractère actuel est valide (fait partie d'un mot)
-        if (estCaractereMot(mot[i])) {
-            mot[j] = towlower(mot[i]); // Convertit le caractère en minuscule
-            j++; // Avance l'indice pour le mot normalisé
-        }
+// Mode approché : affiche les k mots suivis les plus fréquents d'une catégorie, avec l'intervalle de leur fréquence
+void afficherTopKApproche(const AnalyseTexte* analyse, int k, CategorieMots categorie, int longueur) {
+    const ResumeFrequents* resume = &analyse->esquisses->frequents;
+    size_t capacite = (size_t)k < resume->nb_mots ? (size_t)k : resume->nb_mots;
+    if (capacite == 0) {
+        printf("Aucun mot à afficher.\n");
+        return;
     }
-    mot[j] = L'\0'; // Termine la chaîne de caractères normalisée avec un caractère nul
-}
-
-// Calcule la valeur de hachage d'un mot pour la table de hachage
-unsigned int calculerHash(const wchar_t* mot) {
-    unsigned int hash = 5381; // Initialisation de la valeur de hachage avec une constante
-    int c; // Variable pour stocker chaque caractère du mot
-    // Parcourt chaque caractère du mot jusqu'à la fin de la chaîne
-    while ((c = *mot++)) {
-        // Applique l'algorithme de hachage de type DJB2 : hash = hash * 33 + c
-        hash = ((hash << 5) + hash) + c;
-    }
-    // Retourne la valeur de hachage modulo la taille de la table pour rester dans les limites
-    return hash % TAILLE_HASHTABLE;
-}
-
-// Détecte les types grammaticaux d'un mot (nom propre ou verbe)
-void detecterTypeMot(Mot* mot) {
-    int len = wcslen(mot->mot); // Calcule la longueur du mot
-    // Vérifie si le mot commence par une lettre majuscule, indiquant un nom propre
-    mot->est_nom_propre = iswupper(mot->mot[0]);
-    mot->est_verbe = 0; // Initialise à 0, supposant que le mot n'est pas un verbe
-    // Si le mot a plus de 2 caractères, vérifie les terminaisons possibles d'un verbe
-    if (len > 2) {
-        wchar_t* fin = mot->mot + len - 2; // Pointe vers les deux derniers caractères
-        // Vérifie si le mot se termine par "er", "ir", ou "re" (indicateurs de verbes)
-        if (wcscmp(fin, L"er") == 0 || wcscmp(fin, L"ir") == 0 ||
-            (len > 3 && wcscmp(fin-1, L"re") == 0)) {
-            mot->est_verbe = 1; // Marque le mot comme un verbe
-        }
+    const MotSuivi** meilleurs = (const MotSuivi**)malloc(capacite * sizeof(MotSuivi*));
+    if (meilleurs == NULL) {
+        printf("Erreur d'allocation mémoire\n");
+        return;
+    }
+    int nb_mots = (int)meilleursMotsSuivis(resume, capacite, categorie, longueur, meilleurs);
+    if (nb_mots == 0) {
+        printf("Aucun mot de cette catégorie.\n");
+        free(meilleurs);
+        return;
     }
-}
 
-// Calcule la complexité textuelle en fonction de plusieurs métriques
-double calculerComplexiteTexte(const AnalyseTexte* analyse) {
-    return (
-        0.3 * analyse->longueur_phrase_moyenne + // Pondère la longueur moyenne des phrases
-        0.2 * analyse->diversite_lexicale * 100 + // Pondère la diversité lexicale (en pourcentage)
-        0.2 * ((double)analyse->nb_verbes / analyse->nb_mots_total) * 100 + // Pondère le ratio de verbes
-        0.15 * ((double)analyse->nb_mots_uniques / analyse->nb_mots_total) * 100 + // Pondère la diversité des mots uniques
-        0.15 * analyse->longueur_mot_moyenne // Pondère la longueur moyenne des mots
-    );
-}
-// Ajoute un mot à la table de hachage dans l'analyse
-void ajouterMot(AnalyseTexte* analyse, const wchar_t* mot) {
-    // Calcule l'index de hachage pour le mot
-    unsigned int index = calculerHash(mot);
-    // Récupère le premier noeud dans la liste chaînée à cet index
-    NoeudHash* courant = analyse->table_hash[index];
-
-    // Parcourt la liste chaînée pour vérifier si le mot existe déjà
-    while (courant != NULL) {
-        if (wcscmp(courant->mot.mot, mot) == 0) { // Si le mot est trouvé
-            courant->mot.frequence++; // Incrémente sa fréquence
-            return; // Fin de la fonction
+    if (categorie == CATEGORIE_LONGUEUR) {
+        printf("\nTop %d des %s %d les plus fréquents (estimation):\n", nb_mots, noms_categories[categorie], longueur);
+    } else {
+        printf("\nTop %d des %s les plus fréquents (estimation):\n", nb_mots, noms_categories[categorie]);
+    }
+    printf("-----------------------------------\n");
+    for (int i = 0; i < nb_mots; i++) {
+        const MotSuivi* mot = meilleurs[i];
+        if (mot->erreur > 0) {
+            printf("%d. %ls : entre %lld et %lld occurrences", i + 1, mot->texte, mot->frequence - mot->erreur,
+                   mot->frequence);
+        } else {
+            printf("%d. %ls : %lld occurrence%s", i + 1, mot->texte, mot->frequence, mot->frequence > 1 ? "s" : "");
         }
-        courant = courant->suivant; // Passe au noeud suivant
+        if ((mot->attributs >> ATTRIBUT_VERBE) & 1) printf(" (verbe)");
+        if ((mot->attributs >> ATTRIBUT_NOM_PROPRE) & 1) printf(" (nom propre)");
+        printf("\n");
     }
-
-    // Si le mot n'est pas trouvé, on l'ajoute comme un nouveau noeud
-    NoeudHash* nouveau = (NoeudHash*)malloc(sizeof(NoeudHash));
-    if (!nouveau) { // Vérifie si l'allocation mémoire a échoué
-        perror("Erreur d'allocation mémoire");
-        exit(EXIT_FAILURE); // Termine le programme avec une erreur
+    printf("-----------------------------------\n");
+    long long plafond = frequenceMaximaleNonSuivie(resume);
+    if (plafond > 0) {
+        printf("Les mots absents de cette liste apparaissent au plus %lld fois\n", plafond);
     }
-
-    // Copie le mot dans la structure du noeud
-    wcscpy(nouveau->mot.mot, mot);
-    nouveau->mot.frequence = 1; // Initialise la fréquence à 1
-    nouveau->mot.longueur = wcslen(mot); // Calcule la longueur du mot
-    detecterTypeMot(&nouveau->mot); // Détecte les propriétés grammaticales du mot
-    nouveau->suivant = analyse->table_hash[index]; // Pointe vers l'ancien premier noeud
-    analyse->table_hash[index] = nouveau; // Met à jour la tête de la liste
-    analyse->nb_mots_uniques++; // Incrémente le compteur de mots uniques
-
-    // Met à jour les statistiques si le mot est un verbe ou un nom propre
-    if (nouveau->mot.est_verbe) analyse->nb_verbes++;
-    if (nouveau->mot.est_nom_propre) analyse->nb_noms_propres++;
+    free(meilleurs);
 }
 
-void afficherTop10(const AnalyseTexte* analyse) {
-    if (analyse->nb_mots_uniques == 0) {
+// Affiche les k mots les plus fréquents d'une catégorie (tas borné, sans copie du vocabulaire)
+void afficherTopK(const AnalyseTexte* analyse, int k, CategorieMots categorie, int longueur) {
+    if (analyse->esquisses) {
+        afficherTopKApproche(analyse, k, categorie, longueur);
+        return;
+    }
+    if (analyse->nb_mots_uniques == 0 || k <= 0) {
         printf("Aucun mot à afficher.\n");
         return;
     }
 
-    // Allocation dynamique du tableau de mots
-    Mot* mots = (Mot*)malloc(analyse->nb_mots_uniques * sizeof(Mot));
-    if (mots == NULL) {
+    // Le tas ne dépasse jamais le nombre de mots de la table
+    size_t capacite = (size_t)k < analyse->vocabulaire.nb_mots ? (size_t)k : analyse->vocabulaire.nb_mots;
+    uint32_t* indices = (uint32_t*)malloc(capacite * sizeof(uint32_t));
+    if (indices == NULL) {
         printf("Erreur d'allocation mémoire\n");
         return;
     }
-
-    int nb_mots = 0;
-
-    // Collecte des mots depuis la table de hachage
-    for (int i = 0; i < TAILLE_HASHTABLE && nb_mots < analyse->nb_mots_uniques; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL && nb_mots < analyse->nb_mots_uniques) {
-            mots[nb_mots] = courant->mot;
-            nb_mots++;
-            courant = courant->suivant;
-        }
-    }
-
-    // Tri des 10 premiers mots par fréquence
-    for (int i = 0; i < 10 && i < nb_mots; i++) {
-        int max_idx = i;
-        for (int j = i + 1; j < nb_mots; j++) {
-            if (mots[j].frequence > mots[max_idx].frequence) {
-                max_idx = j;
-            }
-        }
-        if (max_idx != i) {
-            Mot temp = mots[i];
-            mots[i] = mots[max_idx];
-            mots[max_idx] = temp;
-        }
+    int nb_mots = (int)meilleursMots(&analyse->vocabulaire, capacite, categorie, longueur, indices);
+    if (nb_mots == 0) {
+        printf("Aucun mot de cette catégorie.\n");
+        free(indices);
+        return;
     }
 
     // Affichage des résultats
-    printf("\nTop %d des mots les plus fréquents:\n", (nb_mots < 10) ? nb_mots : 10);
+    if (categorie == CATEGORIE_LONGUEUR) {
+        printf("\nTop %d des %s %d les plus fréquents:\n", nb_mots, noms_categories[categorie], longueur);
+    } else {
+        printf("\nTop %d des %s les plus fréquents:\n", nb_mots, noms_categories[categorie]);
+    }
     printf("-----------------------------------\n");
-    for (int i = 0; i < 10 && i < nb_mots; i++) {
-        printf("%d. %ls : %d occurrence%s",
+    for (int i = 0; i < nb_mots; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[indices[i]];
+        printf("%d. %ls : %lld occurrence%s",
             i + 1,
-            mots[i].mot,
-            mots[i].frequence,
-            mots[i].frequence > 1 ? "s" : "");
+            texteMot(&analyse->vocabulaire, mot),
+            mot->frequence,
+            mot->frequence > 1 ? "s" : "");
 
-        if (mots[i].est_verbe) printf(" (verbe)");
-        if (mots[i].est_nom_propre) printf(" (nom propre)");
+        if (aAttribut(mot, ATTRIBUT_VERBE)) printf(" (verbe)");
+        if (aAttribut(mot, ATTRIBUT_NOM_PROPRE)) printf(" (nom propre)");
         printf("\n");
     }
     printf("-----------------------------------\n");
 
-    // Libération de la mémoire
-    free(mots);
+    free(indices);
 }
-/* Vérifie si une chaîne est un palindrome */
-int estPalindrome(const wchar_t* texte) {
-    if (!texte || !*texte) return 0;
-
-    size_t len = wcslen(texte);
-    wchar_t* texte_normalise = (wchar_t*)malloc((len + 1) * sizeof(wchar_t));
-    if (!texte_normalise) return 0;
-
-    size_t j = 0;
-    for (size_t i = 0; i < len; i++) {
-        if (iswalnum(texte[i])) {
-            texte_normalise[j++] = towlower(texte[i]);
-        }
-    }
-    texte_normalise[j] = L'\0';
 
-    size_t debut = 0;
-    size_t fin = j - 1;
-    int est_palindrome = 1;
+// Demande K et la catégorie, puis affiche le top K correspondant
+void menuTopK(const AnalyseTexte* analyse) {
+    int k, categorie, longueur = 0;
+    printf("Nombre de mots à afficher (K): ");
+    scanf("%d", &k);
+    getchar();
+    printf("Catégorie (0: tous les mots, 1: verbes, 2: noms propres, 3: mots d'une longueur donnée): ");
+    scanf("%d", &categorie);
+    getchar();
+    if (categorie < CATEGORIE_TOUS || categorie > CATEGORIE_LONGUEUR) {
+        printf("Choix invalide\n");
+        return;
+    }
+    if (categorie == CATEGORIE_LONGUEUR) {
+        printf("Longueur des mots: ");
+        scanf("%d", &longueur);
+        getchar();
+    }
+    afficherTopK(analyse, k, (CategorieMots)categorie, longueur);
+}
+// Noms des n-grammes, par ordre (bigrammes, puis trigrammes)
+static const char* noms_ngrammes[] = {"bigrammes", "trigrammes"};
+
+// Affiche les k bigrammes et trigrammes les plus fréquents (les indices des mots sont traduits par le vocabulaire)
+void afficherTopNgrammes(const AnalyseTexte* analyse, int k) {
+    // Le tas ne dépasse jamais le nombre de n-grammes de la plus grande table
+    size_t capacite = 0;
+    for (int ordre = 2; ordre <= ORDRE_NGRAMME_MAX; ordre++) {
+        size_t nb = tableNgrammes(&analyse->ngrammes, ordre)->nb_ngrammes;
+        if (nb > capacite) capacite = nb;
+    }
+    if (k <= 0 || capacite == 0) {
+        printf("Aucun n-gramme à afficher.\n");
+        return;
+    }
+    if ((size_t)k < capacite) capacite = (size_t)k;
+    Ngramme* meilleurs = (Ngramme*)malloc(capacite * sizeof(Ngramme));
+    if (meilleurs == NULL) {
+        printf("Erreur d'allocation mémoire\n");
+        return;
+    }
 
-    while (debut < fin) {
-        if (texte_normalise[debut] != texte_normalise[fin]) {
-            est_palindrome = 0;
-            break;
+    const TableMots* vocabulaire = &analyse->vocabulaire;
+    for (int ordre = 2; ordre <= ORDRE_NGRAMME_MAX; ordre++) {
+        const TableNgrammes* table = tableNgrammes(&analyse->ngrammes, ordre);
+        size_t nb = meilleursNgrammes(table, capacite, meilleurs);
+        printf("\nTop %zu des %s les plus fréquents:\n", nb, noms_ngrammes[ordre - 2]);
+        printf("-----------------------------------\n");
+        for (size_t i = 0; i < nb; i++) {
+            printf("%zu.", i + 1);
+            for (int j = 0; j < ordre; j++) {
+                printf(" %ls", texteMot(vocabulaire, &vocabulaire->mots[meilleurs[i].mots[j]]));
+            }
+            printf(" : %lld occurrence%s\n", meilleurs[i].frequence, meilleurs[i].frequence > 1 ? "s" : "");
+        }
+        printf("-----------------------------------\n");
+        // Table élaguée pour tenir dans son budget mémoire : les fréquences sont approchées
+        long long erreur = erreurNgrammes(table);
+        if (erreur > 0) {
+            printf("Fréquences approchées (budget mémoire atteint) : écart maximal de %lld occurrences\n", erreur);
         }
-        debut++;
-        fin--;
     }
-
-    free(texte_normalise);
-    return est_palindrome;
+    free(meilleurs);
 }
 
+// Demande K, puis affiche les K bigrammes et trigrammes les plus fréquents
+void menuTopNgrammes(const AnalyseTexte* analyse) {
+    int k;
+    printf("Nombre de n-grammes à afficher (K): ");
+    scanf("%d", &k);
+    getchar();
+    afficherTopNgrammes(analyse, k);
+}
 /* Trouve et affiche les palindromes */
 void trouverPalindromes(const AnalyseTexte* analyse) {
     printf("\nRecherche des palindromes dans le texte:\n");
     int palindromes_trouves = 0;
 
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL) {
-            if (wcslen(courant->mot.mot) > 2 && estPalindrome(courant->mot.mot)) {
-                printf("%ls (fréquence: %d)\n",
-                       courant->mot.mot,
-                       courant->mot.frequence);
-                palindromes_trouves++;
-            }
-            courant = courant->suivant; // a
-        }
+    // Liste des palindromes tenue par la table (attribut calculé à l'insertion de chaque mot)
+    size_t nb_palindromes;
+    const uint32_t* palindromes = membresAttribut(&analyse->vocabulaire, ATTRIBUT_PALINDROME, &nb_palindromes);
+    for (size_t i = 0; i < nb_palindromes; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[palindromes[i]];
+        printf("%ls (fréquence: %lld)\n",
+               texteMot(&analyse->vocabulaire, mot),
+               mot->frequence);
+        palindromes_trouves++;
     }
 
     if (palindromes_trouves == 0) {
@@ -310,17 +227,27 @@ void trouverPalindromes(const AnalyseTexte* analyse) {
     }
 }
 
+// Affiche un rapport rédigé par la bibliothèque d'analyse dans un tampon alloué à sa taille
+static void afficherRapport(size_t (*formater)(const AnalyseTexte*, char*, size_t), const AnalyseTexte* analyse) {
+    size_t taille = formater(analyse, NULL, 0) + 1;
+    char* rapport = (char*)malloc(taille);
+    if (rapport == NULL) {
+        printf("Erreur d'allocation mémoire\n");
+        return;
+    }
+    formater(analyse, rapport, taille);
+    fputs(rapport, stdout);
+    free(rapport);
+}
+
 void afficherFrequenceComplete(const AnalyseTexte* analyse) {
     printf("\nFréquence complète des mots:\n");
-    for (int i = 0; i < TAILLE_HASHTABLE; i++) {
-        NoeudHash* courant = analyse->table_hash[i];
-        while (courant != NULL) {
-            printf("%ls: %d occurrences", courant->mot.mot, courant->mot.frequence);
-            if (courant->mot.est_verbe) printf(" (verbe)");
-            if (courant->mot.est_nom_propre) printf(" (nom propre)");
-            printf("\n");
-            courant = courant->suivant;
-        }
+    for (size_t i = 0; i < analyse->vocabulaire.nb_mots; i++) {
+        const Mot* mot = &analyse->vocabulaire.mots[i];
+        printf("%ls: %lld occurrences", texteMot(&analyse->vocabulaire, mot), mot->frequence);
+        if (aAttribut(mot, ATTRIBUT_VERBE)) printf(" (verbe)");
+        if (aAttribut(mot, ATTRIBUT_NOM_PROPRE)) printf(" (nom propre)");
+        printf("\n");
     }
 }
 
@@ -335,10 +262,11 @@ void afficherMenuMetriques(void) {
     printf("7. Complexité du texte\n");
     printf("8. Nombre de verbes\n");
     printf("9. Nombre de noms propres\n");
-    printf("10. Top 10 des mots\n");
+    printf("10. Top K des mots (par catégorie)\n");
     printf("11. Fréquence complète des mots\n");
     printf("12. Rechercher les palindromes\n");
-    printf("13. Statistiques détaillées (lignes, caractères, phrases extrêmes)\n");
+    printf("13. Statistiques détaillées (lignes, caractères, phrases extrêmes, performances)\n");
+    printf("14. Top K des bigrammes et trigrammes\n");
     printf("0. Retour au menu précédent\n");
 }
 
@@ -347,36 +275,42 @@ void afficherMenuMetriques(void) {
 
 
 void afficherMetriqueSpecifique(const AnalyseTexte* analyse, int choix) {
+    // Mode approché : les métriques tirées du vocabulaire sont des estimations, et les listes complètes n'existent pas
+    const char* estimation = analyse->esquisses ? " (estimation)" : "";
+    if (analyse->esquisses && (choix == 11 || choix == 12 || choix == 14)) {
+        printf("Indisponible en mode approché (le vocabulaire exact n'est pas conservé)\n");
+        return;
+    }
     switch (choix) {
         case 1:
-            printf("Nombre total de mots: %d\n", analyse->nb_mots_total);
+            printf("Nombre total de mots: %lld\n", analyse->nb_mots_total);
             break;
         case 2:
-            printf("Mots uniques: %d\n", analyse->nb_mots_uniques);
+            printf("Mots uniques: %lld%s\n", analyse->nb_mots_uniques, estimation);
             break;
         case 3:
-            printf("Nombre de phrases: %d\n", analyse->nb_phrases);
+            printf("Nombre de phrases: %lld\n", analyse->nb_phrases);
             break;
         case 4:
-            printf("Nombre de paragraphes: %d\n", analyse->nb_paragraphes);
+            printf("Nombre de paragraphes: %lld\n", analyse->nb_paragraphes);
             break;
         case 5:
             printf("Longueur moyenne des phrases: %.2f mots\n", analyse->longueur_phrase_moyenne);
             break;
         case 6:
-            printf("Diversité lexicale: %.2f%%\n", analyse->diversite_lexicale * 100);
+            printf("Diversité lexicale: %.2f%%%s\n", analyse->diversite_lexicale * 100, estimation);
             break;
         case 7:
-            printf("Complexité du texte: %.2f\n", analyse->complexite_texte);
+            printf("Complexité du texte: %.2f%s\n", analyse->complexite_texte, estimation);
             break;
         case 8:
-            printf("Nombre de verbes: %d\n", analyse->nb_verbes);
+            printf("Nombre de verbes: %lld%s\n", analyse->nb_verbes, estimation);
             break;
         case 9:
-            printf("Nombre de noms propres: %d\n", analyse->nb_noms_propres);
+            printf("Nombre de noms propres: %lld%s\n", analyse->nb_noms_propres, estimation);
             break;
         case 10:
-            afficherTop10(analyse);
+            menuTopK(analyse);
             break;
         case 11:
             afficherFrequenceComplete(analyse);
@@ -385,24 +319,12 @@ void afficherMetriqueSpecifique(const AnalyseTexte* analyse, int choix) {
             trouverPalindromes(analyse);
         break;
         case 13:
-            printf("\nStatistiques détaillées du texte:\n");
-        printf("-----------------------------------\n");
-        printf("Caractères:\n");
-        printf("  - Total avec espaces: %d\n", analyse->nb_caracteres);
-        printf("  - Total sans espaces: %d\n", analyse->nb_chars_sans_espaces);
-        printf("  - Nombre d'espaces: %d\n", analyse->nb_espaces);
-        printf("\nStructure:\n");
-        printf("  - Nombre de mots: %d\n", analyse->nb_mots_total);
-        printf("  - Nombre de phrases: %d\n", analyse->nb_phrases);
-        printf("  - Nombre de paragraphes: %d\n", analyse->nb_paragraphes);
-        printf("\nPhrases extrêmes:\n");
-        printf("Plus longue phrase (%d caractères):\n%ls\n",
-               analyse->longueur_plus_longue,
-               analyse->phrase_plus_longue);
-        printf("\nPlus courte phrase (%d caractères):\n%ls\n",
-               analyse->longueur_plus_courte,
-               analyse->phrase_plus_courte);
-        break;
+            afficherRapport(formaterStatistiquesDetaillees, analyse);
+            afficherRapport(formaterPerformances, analyse);
+            break;
+        case 14:
+            menuTopNgrammes(analyse);
+            break;
     }
     }
 
@@ -416,145 +338,19 @@ void menuAnalyseFichierUnique(AnalyseTexte* analyse) {
         scanf("%d", &choix);
         getchar();
 
-        if (choix >= 1 && choix <= 13) {
+        if (choix >= 1 && choix <= 14) {
             afficherMetriqueSpecifique(analyse, choix);
         } else if (choix != 0) {
             printf("Choix invalide\n");
         }
     } while (choix != 0);
 }
-void analyserFichier(const char* chemin, AnalyseTexte* analyse) {
-    FILE* fichier = fopen(chemin, "r");
-    if (fichier == NULL) {
-        perror("Erreur à l'ouverture du fichier");
+// Analyse un fichier pour les menus ; le programme s'arrête si le fichier ne peut pas être analysé
+static void analyserFichierMenu(const char* chemin, AnalyseTexte* analyse) {
+    if (analyserFichier(chemin, analyse, NULL) != 0) {
+        perror("Erreur à l'analyse du fichier");
         exit(EXIT_FAILURE);
     }
-
-    // Initialisation des variables
-    wchar_t mot_courant[LONGUEUR_MOT_MAX];
-    wchar_t phrase_courante[1000] = {0};
-    wint_t c;
-    int pos_mot = 0;
-    int pos_phrase = 0;
-    int en_mot = 0;
-    int mots_dans_phrase = 0;
-    int en_paragraphe = 0;
-
-    // Initialisation des compteurs
-    analyse->nb_lignes = 1;
-    analyse->nb_caracteres = 0;
-    analyse->nb_espaces = 0;
-    analyse->nb_chars_sans_espaces = 0;
-    analyse->longueur_plus_longue = 0;
-    analyse->longueur_plus_courte = INT_MAX;
-
-    while ((c = fgetwc(fichier)) != WEOF) {
-        // Gestion du comptage des caractères
-        if (c == L' ') {
-            analyse->nb_espaces++;
-            analyse->nb_caracteres++;
-        } else if (c != L'\n' && c != L'\r') {
-            analyse->nb_chars_sans_espaces++;
-            analyse->nb_caracteres++;
-        }
-
-        if (estCaractereMot(c)) {
-            if (!en_mot) {
-                en_mot = 1;
-                analyse->nb_mots_total++;
-                mots_dans_phrase++;
-            }
-            if (pos_mot < LONGUEUR_MOT_MAX - 1) {
-                mot_courant[pos_mot++] = c;
-            }
-            if (pos_phrase < 999) {
-                phrase_courante[pos_phrase++] = c;
-                phrase_courante[pos_phrase] = L'\0';
-            }
-        } else {
-            if (en_mot) {
-                mot_courant[pos_mot] = L'\0';
-                normaliserMot(mot_courant);
-                ajouterMot(analyse, mot_courant);
-                pos_mot = 0;
-                en_mot = 0;
-            }
-
-            if (c == L'\n') {
-                analyse->nb_lignes++;
-                if (!en_paragraphe) {
-                    analyse->nb_paragraphes++;
-                    en_paragraphe = 1;
-                }
-            } else {
-                en_paragraphe = 0;
-            }
-
-            if (c != L'\n' && c != L'\r') {
-                if (pos_phrase < 999) {
-                    phrase_courante[pos_phrase++] = c;
-                    phrase_courante[pos_phrase] = L'\0';
-                }
-            }
-
-            if (c == L'.' || c == L'!' || c == L'?') {
-                analyse->nb_phrases++;
-                analyse->longueur_phrase_moyenne += mots_dans_phrase;
-
-                // Gérer la phrase complète
-                if (pos_phrase > 0) {
-                    if (pos_phrase > analyse->longueur_plus_longue) {
-                        analyse->longueur_plus_longue = pos_phrase;
-                        wcsncpy(analyse->phrase_plus_longue, phrase_courante, 999);
-                        analyse->phrase_plus_longue[999] = L'\0';
-                    }
-                    if (pos_phrase < analyse->longueur_plus_courte && mots_dans_phrase > 0) {
-                        analyse->longueur_plus_courte = pos_phrase;
-                        wcsncpy(analyse->phrase_plus_courte, phrase_courante, 999);
-                        analyse->phrase_plus_courte[999] = L'\0';
-                    }
-                }
-
-                pos_phrase = 0;
-                phrase_courante[0] = L'\0';
-                mots_dans_phrase = 0;
-            }
-        }
-    }
-
-    // Traiter le dernier mot s'il y en a un
-    if (en_mot) {
-        mot_courant[pos_mot] = L'\0';
-        normaliserMot(mot_courant);
-        ajouterMot(analyse, mot_courant);
-    }
-
-    // Traiter la dernière phrase si elle ne se termine pas par un point
-    if (mots_dans_phrase > 0) {
-        analyse->nb_phrases++;
-        analyse->longueur_phrase_moyenne += mots_dans_phrase;
-
-        if (pos_phrase > analyse->longueur_plus_longue) {
-            analyse->longueur_plus_longue = pos_phrase;
-            wcsncpy(analyse->phrase_plus_longue, phrase_courante, 999);
-            analyse->phrase_plus_longue[999] = L'\0';
-        }
-        if (pos_phrase < analyse->longueur_plus_courte) {
-            analyse->longueur_plus_courte = pos_phrase;
-            wcsncpy(analyse->phrase_plus_courte, phrase_courante, 999);
-            analyse->phrase_plus_courte[999] = L'\0';
-        }
-    }
-
-    // Calcul des moyennes et métriques finales
-    if (analyse->nb_phrases > 0) {
-        analyse->longueur_phrase_moyenne /= analyse->nb_phrases;
-    }
-
-    analyse->diversite_lexicale = (double)analyse->nb_mots_uniques / analyse->nb_mots_total;
-    analyse->complexite_texte = calculerComplexiteTexte(analyse);
-
-    fclose(fichier);
 }
 void menuComparaisonFichiers(const char* chemin1, const char* chemin2) {
     AnalyseTexte analyse1, analyse2;
@@ -563,8 +359,11 @@ void menuComparaisonFichiers(const char* chemin1, const char* chemin2) {
     initialiserAnalyse(&analyse1);
     initialiserAnalyse(&analyse2);
 
-    analyserFichier(chemin1, &analyse1);
-    analyserFichier(chemin2, &analyse2);
+    analyserFichierMenu(chemin1, &analyse1);
+    analyserFichierMenu(chemin2, &analyse2);
+
+    SimilariteVocabulaires similarite;
+    comparerVocabulaires(&analyse1.vocabulaire, &analyse2.vocabulaire, &similarite);
 
     do {
         printf("\nMenu de comparaison:\n");
@@ -598,30 +397,37 @@ void menuComparaisonFichiers(const char* chemin1, const char* chemin2) {
 
             case 3:
                 printf("\nComparaison des métriques:\n");
-                printf("Différence de mots totaux: %d\n",
-                    abs(analyse1.nb_mots_total - analyse2.nb_mots_total));
-                printf("Différence de mots uniques: %d\n",
-                    abs(analyse1.nb_mots_uniques - analyse2.nb_mots_uniques));
-                printf("Différence de phrases: %d\n",
-                    abs(analyse1.nb_phrases - analyse2.nb_phrases));
+                printf("Différence de mots totaux: %lld\n",
+                    llabs(analyse1.nb_mots_total - analyse2.nb_mots_total));
+                printf("Différence de mots uniques: %lld\n",
+                    llabs(analyse1.nb_mots_uniques - analyse2.nb_mots_uniques));
+                printf("Différence de phrases: %lld\n",
+                    llabs(analyse1.nb_phrases - analyse2.nb_phrases));
                 printf("Différence de longueur moyenne des phrases: %.2f\n",
                     fabs(analyse1.longueur_phrase_moyenne - analyse2.longueur_phrase_moyenne));
                 printf("Différence de diversité lexicale: %.2f%%\n",
                     fabs(analyse1.diversite_lexicale - analyse2.diversite_lexicale) * 100);
                 printf("Différence de complexité: %.2f\n",
                     fabs(analyse1.complexite_texte - analyse2.complexite_texte));
-                printf("Différence de verbes: %d\n",
-                    abs(analyse1.nb_verbes - analyse2.nb_verbes));
-                printf("Différence de noms propres: %d\n",
-                    abs(analyse1.nb_noms_propres - analyse2.nb_noms_propres));
+                printf("Différence de verbes: %lld\n",
+                    llabs(analyse1.nb_verbes - analyse2.nb_verbes));
+                printf("Différence de noms propres: %lld\n",
+                    llabs(analyse1.nb_noms_propres - analyse2.nb_noms_propres));
+                printf("\nSimilarité des vocabulaires:\n");
+                printf("Mots communs: %zu\n", similarite.mots_communs);
+                printf("Mots propres au premier fichier: %zu\n", similarite.mots_propres_a);
+                printf("Mots propres au deuxième fichier: %zu\n", similarite.mots_propres_b);
+                printf("Indice de Jaccard: %.4f\n", similarite.jaccard);
+                printf("Coefficient de recouvrement: %.4f\n", similarite.recouvrement);
+                printf("Similarité cosinus des fréquences: %.4f\n", similarite.cosinus);
                 break;
             case 4:
                 printf("\nTop 10 des mots du premier fichier:\n");
-            afficherTop10(&analyse1);
+            afficherTopK(&analyse1, 10, CATEGORIE_TOUS, 0);
             break;
             case 5:
                 printf("\nTop 10 des mots du deuxième fichier:\n");
-            afficherTop10(&analyse2);
+            afficherTopK(&analyse2, 10, CATEGORIE_TOUS, 0);
             break;
             case 6:
                 printf("\nFréquence complète des mots du premier fichier:\n");
@@ -651,16 +457,485 @@ void menuComparaisonFichiers(const char* chemin1, const char* chemin2) {
 }
 
 
-int main() {
+// Analyse par lots (mode sans menu) : fichiers, motifs et répertoires analysés sur un ordonnanceur à vol de tâches,
+// un enregistrement JSON Lines par fichier puis un résumé
+// En mode corpus, chaque thread ajoute les fichiers qu'il termine à son propre corpus partiel ; les partiels sont
+// ensuite réduits en parallèle, puis une seconde passe (servie par le cache) donne les termes TF-IDF de chaque fichier
+typedef struct {
+    Ordonnanceur* ordonnanceur;
+    SortieTexte sortie;
+    pthread_mutex_t verrou_sortie;      // Un seul enregistrement écrit à la fois
+    atomic_ullong nb_fichiers;
+    atomic_ullong nb_erreurs;
+    atomic_ullong octets;
+    atomic_ullong mots;
+    int termes_tfidf;                   // Termes TF-IDF écrits par fichier (0 : mode corpus désactivé)
+    int approche;                       // Fichiers analysés en mode approché (esquisses de taille fixe)
+    int sans_cache;                     // Fichiers toujours relus, sans instantané chargé ni enregistré
+    Corpus* partiels;                   // Un corpus par thread, plus un pour le thread principal
+    const Corpus* corpus;               // Corpus réduit, pendant la seconde passe
+    struct CheminLot** documents;       // Fichiers analysés, relus pendant la seconde passe
+    size_t nb_documents;
+    size_t capacite_documents;
+    pthread_mutex_t verrou_documents;
+} Lot;
+
+// Chemin à traiter par une tâche du lot (fichier ou répertoire)
+typedef struct CheminLot {
+    Lot* lot;
+    char chemin[];
+} CheminLot;
+
+// Analyse d'un fichier du lot ; un gros fichier est coupé en tranches qui deviennent autant de tâches,
+// la dernière tranche terminée assemble le résultat
+typedef struct {
+    Lot* lot;
+    CheminLot* chemin;
+    AnalyseTexte analyse;
+    LectureFichier lecture;
+    DecoupageSource* decoupage;
+    atomic_int tranches_restantes;
+    struct timespec debut;
+} FichierLot;
+
+// Tranche d'un gros fichier du lot
+typedef struct {
+    FichierLot* fichier;
+    int numero;
+} TrancheLot;
+
+// Écrit un nombre JSON (null s'il n'est pas fini, par exemple la diversité d'un fichier sans mots)
+static void ecrireNombreJson(SortieTexte* sortie, double valeur) {
+    if (isfinite(valeur)) {
+        ecrireFormat(sortie, "%.6g", valeur);
+    } else {
+        ecrireChaine(sortie, "null");
+    }
+}
+
+// Crée le chemin d'une tâche du lot (dossier/nom, ou chemin seul si nom est NULL)
+static CheminLot* creerCheminLot(Lot* lot, const char* dossier, const char* nom) {
+    size_t longueur = strlen(dossier) + (nom != NULL ? strlen(nom) + 1 : 0);
+    CheminLot* chemin = malloc(sizeof(CheminLot) + longueur + 1);
+    if (chemin == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    chemin->lot = lot;
+    if (nom != NULL) {
+        snprintf(chemin->chemin, longueur + 1, "%s/%s", dossier, nom);
+    } else {
+        memcpy(chemin->chemin, dossier, longueur + 1);
+    }
+    return chemin;
+}
+
+// Soumet une tâche du lot, ou l'exécute tout de suite si la mémoire manque pour la mettre en file
+static void soumettreLot(Lot* lot, FonctionTache fonction, void* argument) {
+    if (soumettreTache(lot->ordonnanceur, fonction, argument) != 0) {
+        fonction(argument);
+    }
+}
+
+// Écrit l'enregistrement d'un chemin qui n'a pas pu être analysé
+static void signalerErreurLot(Lot* lot, const char* chemin, int erreur) {
+    atomic_fetch_add(&lot->nb_erreurs, 1);
+    pthread_mutex_lock(&lot->verrou_sortie);
+    ecrireChaine(&lot->sortie, "{\"type\":\"error\",\"path\":");
+    ecrireTexteJson(&lot->sortie, chemin);
+    ecrireChaine(&lot->sortie, ",\"error\":");
+    ecrireTexteJson(&lot->sortie, strerror(erreur));
+    ecrireChaine(&lot->sortie, "}\n");
+    pthread_mutex_unlock(&lot->verrou_sortie);
+}
+
+// Écrit l'enregistrement des termes TF-IDF d'un fichier (seconde passe du mode corpus)
+static void ecrireTfIdfLot(Lot* lot, const char* chemin, const AnalyseTexte* analyse) {
+    size_t k = (size_t)lot->termes_tfidf;
+    uint32_t* indices = malloc(k * sizeof(uint32_t));
+    double* scores = malloc(k * sizeof(double));
+    if (indices == NULL || scores == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    const TableMots* vocabulaire = &analyse->vocabulaire;
+    size_t n = meilleursTfIdf(lot->corpus, vocabulaire, (uint64_t)analyse->nb_mots_total, k, indices, scores);
+
+    pthread_mutex_lock(&lot->verrou_sortie);
+    SortieTexte* sortie = &lot->sortie;
+    ecrireChaine(sortie, "{\"type\":\"tfidf\",\"path\":");
+    ecrireTexteJson(sortie, chemin);
+    ecrireChaine(sortie, ",\"terms\":[");
+    for (size_t i = 0; i < n; i++) {
+        const Mot* mot = &vocabulaire->mots[indices[i]];
+        const wchar_t* texte = texteMot(vocabulaire, mot);
+        ecrireChaine(sortie, i > 0 ? ",{\"word\":" : "{\"word\":");
+        ecrireChaineJson(sortie, texte, (size_t)mot->longueur);
+        ecrireFormat(sortie, ",\"frequency\":%lld,\"documents\":%u,\"tf_idf\":", mot->frequence,
+                     frequenceDocumentaire(lot->corpus, texte));
+        ecrireNombreJson(sortie, scores[i]);
+        ecrireOctet(sortie, '}');
+    }
+    ecrireChaine(sortie, "]}\n");
+    pthread_mutex_unlock(&lot->verrou_sortie);
+    free(indices);
+    free(scores);
+}
+
+// Mode approché : marque l'enregistrement d'un fichier comme estimé et y ajoute ses mots les plus fréquents,
+// avec l'erreur maximale de chaque fréquence
+static void ecrireMotsFrequentsLot(SortieTexte* sortie, const AnalyseTexte* analyse) {
+    const MotSuivi* meilleurs[MOTS_FREQUENTS_LOT];
+    size_t n = meilleursMotsSuivis(&analyse->esquisses->frequents, MOTS_FREQUENTS_LOT, CATEGORIE_TOUS, 0, meilleurs);
+    ecrireChaine(sortie, ",\"approximate\":true,\"top_words\":[");
+    for (size_t i = 0; i < n; i++) {
+        ecrireChaine(sortie, i > 0 ? ",{\"word\":" : "{\"word\":");
+        ecrireChaineJson(sortie, meilleurs[i]->texte, (size_t)meilleurs[i]->longueur);
+        ecrireFormat(sortie, ",\"frequency\":%lld,\"error\":%lld}", meilleurs[i]->frequence, meilleurs[i]->erreur);
+    }
+    ecrireFormat(sortie, "],\"untracked_max_frequency\":%lld",
+                 frequenceMaximaleNonSuivie(&analyse->esquisses->frequents));
+}
+
+// Ajoute un fichier analysé au corpus partiel du thread courant et le garde pour la seconde passe
+static void ajouterDocumentLot(Lot* lot, CheminLot* chemin, const AnalyseTexte* analyse) {
+    int numero = numeroTravailleur(lot->ordonnanceur);
+    Corpus* partiel = &lot->partiels[numero >= 0 ? numero : nombreTravailleurs(lot->ordonnanceur)];
+    if (ajouterDocumentCorpus(partiel, &analyse->vocabulaire, (uint64_t)analyse->nb_mots_total) != 0) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    pthread_mutex_lock(&lot->verrou_documents);
+    if (lot->nb_documents == lot->capacite_documents) {
+        lot->capacite_documents = lot->capacite_documents ? lot->capacite_documents * 2 : 256;
+        lot->documents = realloc(lot->documents, lot->capacite_documents * sizeof(CheminLot*));
+        if (lot->documents == NULL) {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+    }
+    lot->documents[lot->nb_documents++] = chemin;
+    pthread_mutex_unlock(&lot->verrou_documents);
+}
+
+// Termine l'analyse d'un fichier du lot, écrit son enregistrement et libère tout ce qui le concerne
+static void terminerFichierLot(FichierLot* fichier) {
+    Lot* lot = fichier->lot;
+    AnalyseTexte* analyse = &fichier->analyse;
+    if (terminerLecture(analyse, &fichier->lecture) != 0) {
+        signalerErreurLot(lot, fichier->chemin->chemin, errno);
+        libererAnalyse(analyse);
+        free(fichier->chemin);
+        free(fichier);
+        return;
+    }
+    if (lot->corpus != NULL) {
+        ecrireTfIdfLot(lot, fichier->chemin->chemin, analyse);
+        libererAnalyse(analyse);
+        free(fichier->chemin);
+        free(fichier);
+        return;
+    }
+    double secondes = secondesDepuis(&fichier->debut);
+    atomic_fetch_add(&lot->nb_fichiers, 1);
+    atomic_fetch_add(&lot->octets, fichier->lecture.taille);
+    atomic_fetch_add(&lot->mots, (unsigned long long)analyse->nb_mots_total);
+
+    pthread_mutex_lock(&lot->verrou_sortie);
+    SortieTexte* sortie = &lot->sortie;
+    ecrireChaine(sortie, "{\"type\":\"file\",\"path\":");
+    ecrireTexteJson(sortie, fichier->chemin->chemin);
+    ecrireFormat(sortie, ",\"bytes\":%zu,\"total_words\":%lld,\"unique_words\":%lld,\"sentences\":%lld,"
+                         "\"paragraphs\":%lld,\"lines\":%lld,\"characters\":%lld,\"characters_without_spaces\":%lld,"
+                         "\"spaces\":%lld,\"verbs\":%lld,\"proper_nouns\":%lld,",
+                 fichier->lecture.taille, analyse->nb_mots_total, analyse->nb_mots_uniques, analyse->nb_phrases,
+                 analyse->nb_paragraphes, analyse->nb_lignes, analyse->nb_caracteres, analyse->nb_chars_sans_espaces,
+                 analyse->nb_espaces, analyse->nb_verbes, analyse->nb_noms_propres);
+    ecrireChaine(sortie, "\"average_sentence_length\":");
+    ecrireNombreJson(sortie, analyse->longueur_phrase_moyenne);
+    ecrireChaine(sortie, ",\"lexical_diversity\":");
+    ecrireNombreJson(sortie, analyse->diversite_lexicale);
+    ecrireChaine(sortie, ",\"text_complexity\":");
+    ecrireNombreJson(sortie, analyse->complexite_texte);
+    if (analyse->esquisses) {
+        ecrireMotsFrequentsLot(sortie, analyse);
+    }
+    ecrireFormat(sortie, ",\"seconds\":%.6f}\n", secondes);
+    pthread_mutex_unlock(&lot->verrou_sortie);
+
+    if (lot->termes_tfidf > 0) {
+        ajouterDocumentLot(lot, fichier->chemin, analyse);
+    } else {
+        free(fichier->chemin);
+    }
+    libererAnalyse(analyse);
+    free(fichier);
+}
+
+// Compte une tranche terminée ; la dernière assemble les tranches et termine le fichier
+static void terminerTrancheLot(FichierLot* fichier) {
+    if (atomic_fetch_sub(&fichier->tranches_restantes, 1) == 1) {
+        assemblerTranches(fichier->decoupage, 1);
+        terminerFichierLot(fichier);
+    }
+}
+
+// Tâche : lit une tranche d'un gros fichier
+static void tacheTrancheLot(void* argument) {
+    TrancheLot* tranche = argument;
+    FichierLot* fichier = tranche->fichier;
+    tokeniserTranche(fichier->decoupage, tranche->numero);
+    free(tranche);
+    terminerTrancheLot(fichier);
+}
+
+// Tâche : analyse un fichier ordinaire (en tranches confiées à d'autres tâches s'il est gros)
+static void tacheFichierLot(void* argument) {
+    CheminLot* chemin = argument;
+    Lot* lot = chemin->lot;
+    FichierLot* fichier = malloc(sizeof(FichierLot));
+    if (fichier == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    fichier->lot = lot;
+    fichier->chemin = chemin;
+    clock_gettime(CLOCK_MONOTONIC, &fichier->debut);
+    initialiserAnalyse(&fichier->analyse);
+    int mode = choisirModeAnalyse(&fichier->analyse, lot->approche);
+    fichier->analyse.compter_ngrammes = 0; // Les enregistrements JSON ne donnent pas les n-grammes
+    fichier->analyse.sans_cache = lot->sans_cache;
+    if (mode != 0 || commencerLecture(chemin->chemin, &fichier->analyse, &fichier->lecture, NULL) != 0) {
+        signalerErreurLot(lot, chemin->chemin, errno);
+        libererAnalyse(&fichier->analyse);
+        free(fichier);
+        free(chemin);
+        return;
+    }
+    if (fichier->lecture.cache == CACHE_A_JOUR) {
+        terminerFichierLot(fichier);
+        return;
+    }
+
+    fichier->decoupage = decouperLecture(&fichier->lecture, nombreTravailleurs(lot->ordonnanceur));
+    if (fichier->decoupage == NULL) {
+        tokeniserSource(&fichier->lecture.tokeniseur, &fichier->lecture.source);
+        terminerFichierLot(fichier);
+        return;
+    }
+
+    // Les tranches suivantes sont proposées aux autres threads, la première est lue ici
+    int nb = nombreTranches(fichier->decoupage);
+    atomic_init(&fichier->tranches_restantes, nb);
+    for (int k = 1; k < nb; k++) {
+        TrancheLot* tranche = malloc(sizeof(TrancheLot));
+        if (tranche == NULL) {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+        tranche->fichier = fichier;
+        tranche->numero = k;
+        soumettreLot(lot, tacheTrancheLot, tranche);
+    }
+    tokeniserTranche(fichier->decoupage, 0);
+    terminerTrancheLot(fichier);
+}
+
+// Tâche : parcourt un répertoire ; chaque fichier ordinaire et chaque sous-répertoire devient une tâche
+// (les liens symboliques vers des répertoires ne sont pas suivis, pour ne pas boucler)
+static void tacheRepertoireLot(void* argument) {
+    CheminLot* chemin = argument;
+    Lot* lot = chemin->lot;
+    DIR* repertoire = opendir(chemin->chemin);
+    if (repertoire == NULL) {
+        signalerErreurLot(lot, chemin->chemin, errno);
+        free(chemin);
+        return;
+    }
+    struct dirent* entree;
+    while ((entree = readdir(repertoire)) != NULL) {
+        if (strcmp(entree->d_name, ".") == 0 || strcmp(entree->d_name, "..") == 0) {
+            continue;
+        }
+        CheminLot* enfant = creerCheminLot(lot, chemin->chemin, entree->d_name);
+        int type = entree->d_type;
+        if (type == DT_LNK || type == DT_UNKNOWN) {
+            struct stat infos;
+            if (stat(enfant->chemin, &infos) != 0) {
+                type = DT_UNKNOWN;
+            } else if (S_ISREG(infos.st_mode)) {
+                type = DT_REG;
+            } else if (S_ISDIR(infos.st_mode) && type == DT_UNKNOWN) {
+                type = DT_DIR;
+            }
+        }
+        if (type == DT_REG) {
+            soumettreLot(lot, tacheFichierLot, enfant);
+        } else if (type == DT_DIR) {
+            soumettreLot(lot, tacheRepertoireLot, enfant);
+        } else {
+            free(enfant);
+        }
+    }
+    closedir(repertoire);
+    free(chemin);
+}
+
+// Ajoute au lot un chemin de la ligne de commande : fichier, répertoire, ou motif (*, ? et [...]) s'il n'existe pas
+static void ajouterArgumentLot(Lot* lot, const char* argument) {
+    struct stat infos;
+    if (stat(argument, &infos) != 0) {
+        glob_t motifs;
+        if (strpbrk(argument, "*?[") == NULL || glob(argument, 0, NULL, &motifs) != 0) {
+            signalerErreurLot(lot, argument, ENOENT);
+            return;
+        }
+        for (size_t i = 0; i < motifs.gl_pathc; i++) {
+            if (stat(motifs.gl_pathv[i], &infos) == 0) {
+                ajouterArgumentLot(lot, motifs.gl_pathv[i]);
+            }
+        }
+        globfree(&motifs);
+        return;
+    }
+    if (S_ISDIR(infos.st_mode)) {
+        soumettreLot(lot, tacheRepertoireLot, creerCheminLot(lot, argument, NULL));
+    } else {
+        soumettreLot(lot, tacheFichierLot, creerCheminLot(lot, argument, NULL));
+    }
+}
+
+// Mode corpus, après la première passe : réduit les corpus partiels, écrit le résumé du corpus,
+// puis relit chaque fichier pour écrire ses termes TF-IDF
+static void analyserCorpusLot(Lot* lot) {
+    struct timespec debut;
+    clock_gettime(CLOCK_MONOTONIC, &debut);
+    int nb_partiels = nombreTravailleurs(lot->ordonnanceur) + 1;
+    if (reduireCorpus(lot->partiels, (size_t)nb_partiels, lot->ordonnanceur) != 0) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    const Corpus* corpus = &lot->partiels[0];
+    ecrireFormat(&lot->sortie, "{\"type\":\"corpus\",\"documents\":%llu,\"unique_words\":%zu,"
+                               "\"total_words\":%llu,\"merge_seconds\":%.6f}\n",
+                 (unsigned long long)corpus->nb_documents, corpus->vocabulaire.nb_mots,
+                 (unsigned long long)corpus->nb_mots, secondesDepuis(&debut));
+
+    lot->corpus = corpus;
+    for (size_t i = 0; i < lot->nb_documents; i++) {
+        soumettreLot(lot, tacheFichierLot, lot->documents[i]);
+    }
+    attendreTaches(lot->ordonnanceur);
+    lot->corpus = NULL;
+}
+
+// Mode sans menu : test [-a] [-n] [-j threads] [-o sortie.jsonl] [-t termes] chemin...
+// Retourne EXIT_FAILURE si un chemin n'a pas pu être analysé
+int analyserLot(int argc, char* argv[]) {
+    int nb_threads = 0;
+    int termes_tfidf = 0;
+    int approche = 0;
+    int sans_cache = 0;
+    const char* chemin_sortie = NULL;
+    int option;
+    while ((option = getopt(argc, argv, "anj:o:t:")) != -1) {
+        if (option == 'a') {
+            approche = 1;
+        } else if (option == 'n') {
+            sans_cache = 1;
+        } else if (option == 'j') {
+            nb_threads = atoi(optarg);
+        } else if (option == 'o') {
+            chemin_sortie = optarg;
+        } else if (option == 't' && atoi(optarg) > 0) {
+            termes_tfidf = atoi(optarg);
+        } else {
+            fprintf(stderr, "Usage: %s [-a] [-n] [-j threads] [-o sortie.jsonl] [-t termes] "
+                            "fichier|répertoire|motif...\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (approche && termes_tfidf > 0) {
+        fprintf(stderr, "Le mode corpus (-t) a besoin des vocabulaires exacts : il n'est pas disponible avec -a\n");
+        return EXIT_FAILURE;
+    }
+
+    Lot lot;
+    memset(&lot, 0, sizeof(Lot));
+    int ouverte = chemin_sortie != NULL ? ouvrirSortie(&lot.sortie, chemin_sortie)
+                                        : ouvrirSortieDescripteur(&lot.sortie, STDOUT_FILENO);
+    if (ouverte != 0) {
+        perror("Erreur à l'ouverture de la sortie");
+        return EXIT_FAILURE;
+    }
+    lot.ordonnanceur = creerOrdonnanceur(nb_threads);
+    if (lot.ordonnanceur == NULL) {
+        perror("Erreur à la création des threads");
+        return EXIT_FAILURE;
+    }
+    pthread_mutex_init(&lot.verrou_sortie, NULL);
+    pthread_mutex_init(&lot.verrou_documents, NULL);
+    lot.approche = approche;
+    lot.sans_cache = sans_cache;
+    int nb_partiels = nombreTravailleurs(lot.ordonnanceur) + 1;
+    if (termes_tfidf > 0) {
+        lot.termes_tfidf = termes_tfidf;
+        lot.partiels = malloc(nb_partiels * sizeof(Corpus));
+        if (lot.partiels == NULL) {
+            perror("Erreur d'allocation mémoire");
+            return EXIT_FAILURE;
+        }
+        for (int i = 0; i < nb_partiels; i++) {
+            initialiserCorpus(&lot.partiels[i]);
+        }
+    }
+
+    struct timespec debut;
+    clock_gettime(CLOCK_MONOTONIC, &debut);
+    for (int i = optind; i < argc; i++) {
+        ajouterArgumentLot(&lot, argv[i]);
+    }
+    attendreTaches(lot.ordonnanceur);
+    if (termes_tfidf > 0) {
+        analyserCorpusLot(&lot);
+        for (int i = 0; i < nb_partiels; i++) {
+            libererCorpus(&lot.partiels[i]);
+        }
+        free(lot.partiels);
+        free(lot.documents);
+    }
+    double secondes = secondesDepuis(&debut);
+
+    ecrireFormat(&lot.sortie, "{\"type\":\"summary\",\"files\":%llu,\"errors\":%llu,\"bytes\":%llu,"
+                              "\"total_words\":%llu,\"threads\":%d,\"seconds\":%.6f}\n",
+                 atomic_load(&lot.nb_fichiers), atomic_load(&lot.nb_erreurs), atomic_load(&lot.octets),
+                 atomic_load(&lot.mots), nombreTravailleurs(lot.ordonnanceur), secondes);
+    detruireOrdonnanceur(lot.ordonnanceur);
+    pthread_mutex_destroy(&lot.verrou_sortie);
+    pthread_mutex_destroy(&lot.verrou_documents);
+    if (fermerSortie(&lot.sortie) != 0) {
+        perror("Erreur à l'écriture de la sortie");
+        return EXIT_FAILURE;
+    }
+    return atomic_load(&lot.nb_erreurs) > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[]) {
     setlocale(LC_ALL, "");  // Support des caractères Unicode
+    if (argc > 1) {
+        return analyserLot(argc, argv);
+    }
     char chemin1[LONGUEUR_CHEMIN_MAX];
     char chemin2[LONGUEUR_CHEMIN_MAX];
     int choix;
+    AnalyseTexte analyse;  // Réutilisée d'un fichier à l'autre
+    initialiserAnalyse(&analyse);
 
     while (1) {
         printf("\nMenu principal:\n");
         printf("1. Analyser un fichier\n");
         printf("2. Comparer deux fichiers\n");
+        printf("3. Analyser un fichier en mode approché (mémoire constante, métriques estimées)\n");
         printf("0. Quitter\n");
         printf("Choix: ");
         scanf("%d", &choix);
@@ -668,18 +943,22 @@ int main() {
 
         switch (choix) {
             case 0:
+                libererAnalyse(&analyse);
                 return EXIT_SUCCESS;
 
-            case 1: {
+            case 1:
+            case 3: {
                 printf("Entrez le chemin du fichier à analyser: ");
                 fgets(chemin1, LONGUEUR_CHEMIN_MAX, stdin);
                 chemin1[strcspn(chemin1, "\n")] = 0;
 
-                AnalyseTexte analyse;
-                initialiserAnalyse(&analyse);
-                analyserFichier(chemin1, &analyse);
+                reinitialiserAnalyse(&analyse);
+                if (choisirModeAnalyse(&analyse, choix == 3) != 0) {
+                    perror("Erreur d'allocation mémoire");
+                    exit(EXIT_FAILURE);
+                }
+                analyserFichierMenu(chemin1, &analyse);
                 menuAnalyseFichierUnique(&analyse);
-                libererAnalyse(&analyse);
                 break;
             }
 
@@ -0,0 +1,1036 @@
+#include "tokeniseur.h"
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "normalisation.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && !defined(TOKENISEUR_SANS_SIMD)
+#define TOKENISEUR_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Masques de classification d'un bloc d'octets ASCII (un bit par octet)
+typedef struct {
+    unsigned int mot;          // Caractères de mot : lettres et chiffres ASCII, '-', '\'' et '_'
+    unsigned int espace;       // ' '
+    unsigned int saut;         // '\n'
+    unsigned int retour;       // '\r'
+    unsigned int fin_phrase;   // '.', '!' et '?'
+    unsigned int non_ascii;    // Octets >= 0x80 (début ou suite d'une séquence UTF-8)
+} MasquesBloc;
+
+/**
+ * Vérifie si un caractère peut faire partie d'un mot
+ * Retourne vrai pour les lettres, chiffres et marques combinantes d'Unicode (quelle que soit la locale), tirets,
+ * apostrophes et underscores
+ *
+ * @param c Caractère à vérifier
+ * @return 1 si le caractère est valide, 0 sinon
+ */
+int estCaractereMot(wchar_t c) {
+    if ((uint32_t)c < 0x80) {
+        return (c >= L'a' && c <= L'z') || (c >= L'A' && c <= L'Z') || (c >= L'0' && c <= L'9') ||
+               c == L'-' || c == L'\'' || c == L'_';
+    }
+    return estLettreUnicode(c);
+}
+
+/**
+ * Initialise un tokeniseur avant la lecture d'un texte
+ * Choisit la largeur des blocs SIMD selon le processeur (AVX2 si disponible, sinon SSE2)
+ *
+ * @param tokeniseur Pointeur vers la structure à initialiser
+ * @param traiter_mot Fonction appelée pour chaque mot terminé
+ * @param contexte Pointeur transmis à traiter_mot
+ */
+void initialiserTokeniseur(Tokeniseur* tokeniseur, RappelMot traiter_mot, void* contexte) {
+    memset(tokeniseur, 0, sizeof(Tokeniseur));
+    tokeniseur->nb_lignes = 1;
+    tokeniseur->mot_courant = tokeniseur->mot_initial;
+    tokeniseur->capacite_mot = LONGUEUR_MOT_MAX;
+    tokeniseur->phrase_plus_courte.longueur = LLONG_MAX;
+    tokeniseur->traiter_mot = traiter_mot;
+    tokeniseur->contexte = contexte;
+#ifdef TOKENISEUR_SIMD
+    tokeniseur->largeur_bloc = __builtin_cpu_supports("avx2") ? 32 : 16;
+#endif
+}
+
+// Agrandit le tampon d'une phrase pour qu'il reçoive n caractères conservés (n <= LONGUEUR_PHRASE_CONSERVEE)
+// et le zéro final ; le tampon ne dépasse jamais LONGUEUR_PHRASE_CONSERVEE + 1 caractères
+// Retourne 0 si la mémoire manque (les caractères en trop ne sont alors pas conservés)
+static int reserverPhrase(Phrase* phrase, size_t n) {
+    if (n < phrase->capacite) {
+        return 1;
+    }
+    size_t capacite = phrase->capacite ? phrase->capacite * 2 : LONGUEUR_PHRASE_INITIALE;
+    while (capacite <= n) {
+        capacite *= 2;
+    }
+    if (capacite > (size_t)LONGUEUR_PHRASE_CONSERVEE + 1) {
+        capacite = (size_t)LONGUEUR_PHRASE_CONSERVEE + 1;
+    }
+    wchar_t* texte = realloc(phrase->texte, capacite * sizeof(wchar_t));
+    if (texte == NULL) {
+        return 0;
+    }
+    phrase->texte = texte;
+    phrase->capacite = capacite;
+    return 1;
+}
+
+// Prolonge une phrase de longueur caractères, dont les n premiers sont fournis (et conservés s'il reste de la place)
+static void prolongerTextePhrase(Phrase* phrase, const wchar_t* caracteres, size_t n, long long longueur) {
+    size_t place = (size_t)LONGUEUR_PHRASE_CONSERVEE - phrase->conserves;
+    if (n > place) n = place;
+    if (n > 0 && reserverPhrase(phrase, phrase->conserves + n)) {
+        wmemcpy(phrase->texte + phrase->conserves, caracteres, n);
+        phrase->conserves += n;
+    }
+    phrase->longueur += longueur;
+}
+
+// Remplace le contenu d'une phrase par celui d'une autre (texte terminé par un zéro)
+static void copierPhrase(Phrase* destination, const Phrase* source) {
+    destination->conserves = 0;
+    if (reserverPhrase(destination, source->conserves)) {
+        if (source->conserves > 0) {
+            wmemcpy(destination->texte, source->texte, source->conserves);
+        }
+        destination->conserves = source->conserves;
+        destination->texte[destination->conserves] = L'\0';
+    }
+    destination->longueur = source->longueur;
+}
+
+// Libère le tampon d'une phrase (sa longueur est gardée)
+static void libererPhrase(Phrase* phrase) {
+    free(phrase->texte);
+    phrase->texte = NULL;
+    phrase->conserves = 0;
+    phrase->capacite = 0;
+}
+
+// Ajoute un caractère à la phrase courante
+static inline void ajouterPhrase(Tokeniseur* t, wint_t c) {
+    Phrase* phrase = &t->phrase_courante;
+    if (phrase->conserves + 1 < phrase->capacite ||
+        (phrase->conserves < LONGUEUR_PHRASE_CONSERVEE && reserverPhrase(phrase, phrase->conserves + 1))) {
+        phrase->texte[phrase->conserves++] = c;
+    }
+    phrase->longueur++;
+}
+
+// Agrandit le tampon du mot courant pour qu'il reçoive n caractères de plus et le zéro final
+// Retourne 0 si la mémoire manque ou si le mot dépasserait INT_MAX / 2 caractères (les caractères en trop
+// sont alors ignorés)
+static int reserverMot(Tokeniseur* t, int n) {
+    if (t->pos_mot + n < t->capacite_mot) {
+        return 1;
+    }
+    if (n > INT_MAX / 2 - t->pos_mot) {
+        return 0;
+    }
+    int capacite = t->capacite_mot * 2;
+    while (capacite <= t->pos_mot + n) {
+        capacite *= 2;
+    }
+    wchar_t* tampon = malloc(capacite * sizeof(wchar_t));
+    if (tampon == NULL) {
+        return 0;
+    }
+    wmemcpy(tampon, t->mot_courant, t->pos_mot);
+    if (t->mot_courant != t->mot_initial) {
+        free(t->mot_courant);
+    }
+    t->mot_courant = tampon;
+    t->capacite_mot = capacite;
+    return 1;
+}
+
+// Libère le tampon d'un mot long et revient au tampon intégré
+static void libererTamponMot(Tokeniseur* t) {
+    if (t->mot_courant != t->mot_initial) {
+        free(t->mot_courant);
+        t->mot_courant = t->mot_initial;
+        t->capacite_mot = LONGUEUR_MOT_MAX;
+    }
+}
+
+// Transmet le mot courant au rappel et réinitialise le tampon de mot
+static void terminerMot(Tokeniseur* t) {
+    t->mot_courant[t->pos_mot] = L'\0';
+    t->traiter_mot(t->contexte, t->mot_courant);
+    t->pos_mot = 0;
+    t->en_mot = 0;
+}
+
+// Compare la phrase courante aux phrases extrêmes déjà trouvées
+static void mettreAJourExtremes(Tokeniseur* t) {
+    if (t->phrase_courante.longueur > t->phrase_plus_longue.longueur) {
+        copierPhrase(&t->phrase_plus_longue, &t->phrase_courante);
+    }
+    if (t->phrase_courante.longueur < t->phrase_plus_courte.longueur && t->mots_dans_phrase > 0) {
+        copierPhrase(&t->phrase_plus_courte, &t->phrase_courante);
+    }
+}
+
+// Clôt la phrase courante sur un '.', '!' ou '?'
+static void terminerPhrase(Tokeniseur* t) {
+    if (t->attente_debut_phrase) {
+        // Première fin de phrase d'une tranche : le début de la phrase est dans la tranche précédente,
+        // elle ne sera comptée qu'au moment du raccord
+        t->attente_debut_phrase = 0;
+        t->prefixe_ferme = 1;
+        t->prefixe_mots = t->mots_dans_phrase;
+        copierPhrase(&t->prefixe_phrase, &t->phrase_courante);
+    } else {
+        t->nb_phrases++;
+        t->somme_mots_phrases += t->mots_dans_phrase;
+        if (t->phrase_courante.longueur > 0) {
+            mettreAJourExtremes(t);
+        }
+    }
+    t->phrase_courante.conserves = 0;
+    t->phrase_courante.longueur = 0;
+    t->mots_dans_phrase = 0;
+}
+
+// Traite un caractère qui ne fait pas partie d'un mot (le mot éventuel a déjà été terminé)
+static inline void traiterSeparateur(Tokeniseur* t, wint_t c) {
+    if (c == L'\n') {
+        t->nb_lignes++;
+        if (!t->en_paragraphe) {
+            t->nb_paragraphes++;
+            t->en_paragraphe = 1;
+        }
+    } else {
+        t->en_paragraphe = 0;
+    }
+    if (c != L'\n' && c != L'\r') {
+        ajouterPhrase(t, c);
+    }
+    if (c == L'.' || c == L'!' || c == L'?') {
+        terminerPhrase(t);
+    }
+}
+
+/**
+ * Traite un caractère du texte (chemin scalaire, valable pour tout caractère Unicode)
+ * Met à jour les compteurs de caractères, le mot courant, la phrase courante et les paragraphes
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur
+ * @param c Caractère à traiter
+ */
+void tokeniserCaractere(Tokeniseur* tokeniseur, wint_t c) {
+    Tokeniseur* t = tokeniseur;
+
+    // Gestion du comptage des caractères
+    if (c == L' ') {
+        t->nb_espaces++;
+        t->nb_caracteres++;
+    } else if (c != L'\n' && c != L'\r') {
+        t->nb_chars_sans_espaces++;
+        t->nb_caracteres++;
+    }
+
+    if (estCaractereMot(c)) {
+        if (!t->en_mot) {
+            t->en_mot = 1;
+            t->nb_mots_total++;
+            t->mots_dans_phrase++;
+        }
+        if (t->pos_mot < t->capacite_mot - 1 || reserverMot(t, 1)) {
+            t->mot_courant[t->pos_mot++] = c;
+        }
+        ajouterPhrase(t, c);
+    } else {
+        if (t->en_mot) {
+            terminerMot(t);
+        }
+        traiterSeparateur(t, c);
+    }
+}
+
+#ifdef TOKENISEUR_SIMD
+
+// Retourne un masque dont les n bits de poids faible sont à 1 (0 <= n <= 32)
+static inline unsigned int masqueBas(int n) {
+    return n >= 32 ? 0xFFFFFFFFu : ((1u << n) - 1);
+}
+
+// Élargit un bloc de 16 octets ASCII en 16 caractères larges
+static inline void elargirBloc16(wchar_t* destination, const unsigned char* octets) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_loadu_si128((const __m128i*)octets);
+    __m128i bas = _mm_unpacklo_epi8(v, zero);
+    __m128i haut = _mm_unpackhi_epi8(v, zero);
+    _mm_storeu_si128((__m128i*)destination, _mm_unpacklo_epi16(bas, zero));
+    _mm_storeu_si128((__m128i*)(destination + 4), _mm_unpackhi_epi16(bas, zero));
+    _mm_storeu_si128((__m128i*)(destination + 8), _mm_unpacklo_epi16(haut, zero));
+    _mm_storeu_si128((__m128i*)(destination + 12), _mm_unpackhi_epi16(haut, zero));
+}
+
+// Ajoute des caractères ASCII déjà élargis (sans '\n' ni '\r') à la phrase courante
+static inline void ajouterPhraseLarge(Tokeniseur* t, const wchar_t* caracteres, int n) {
+    Phrase* phrase = &t->phrase_courante;
+    if (phrase->conserves + n < phrase->capacite) {
+        memcpy(phrase->texte + phrase->conserves, caracteres, n * sizeof(wchar_t));
+        phrase->conserves += n;
+        phrase->longueur += n;
+    } else {
+        prolongerTextePhrase(phrase, caracteres, (size_t)n, n);
+    }
+}
+
+// Ajoute des caractères ASCII déjà élargis au mot courant
+// Les mots courts sont copiés par 16 caractères sans boucle ; la source doit être lisible 16 caractères plus loin
+static inline void ajouterMotLarge(Tokeniseur* t, const wchar_t* caracteres, int n) {
+    if (n <= 16 && t->pos_mot + 16 <= t->capacite_mot - 1) {
+        memcpy(t->mot_courant + t->pos_mot, caracteres, 16 * sizeof(wchar_t));
+        t->pos_mot += n;
+        return;
+    }
+    if (!reserverMot(t, n)) {
+        n = t->capacite_mot - 1 - t->pos_mot;
+    }
+    memcpy(t->mot_courant + t->pos_mot, caracteres, n * sizeof(wchar_t));
+    t->pos_mot += n;
+}
+
+/**
+ * Classe 16 octets à la fois avec SSE2
+ * Les octets >= 0x80 sont négatifs en comparaison signée et ne sont donc jamais classés comme caractères de mot
+ */
+static inline void classifierBloc16(const unsigned char* p, MasquesBloc* m) {
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    __m128i minuscule = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i lettre = _mm_and_si128(_mm_cmpgt_epi8(minuscule, _mm_set1_epi8('a' - 1)),
+                                   _mm_cmplt_epi8(minuscule, _mm_set1_epi8('z' + 1)));
+    __m128i chiffre = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                    _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+    __m128i symbole = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('-')),
+                                                _mm_cmpeq_epi8(v, _mm_set1_epi8('\''))),
+                                   _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    __m128i fin = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('.')),
+                                            _mm_cmpeq_epi8(v, _mm_set1_epi8('!'))),
+                               _mm_cmpeq_epi8(v, _mm_set1_epi8('?')));
+    m->mot = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(lettre, chiffre), symbole));
+    m->espace = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+    m->saut = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+    m->retour = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+    m->fin_phrase = (unsigned int)_mm_movemask_epi8(fin);
+    m->non_ascii = (unsigned int)_mm_movemask_epi8(v);
+}
+
+// Même classification que classifierBloc16, 32 octets à la fois avec AVX2
+__attribute__((target("avx2"), always_inline))
+static inline void classifierBloc32(const unsigned char* p, MasquesBloc* m) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i minuscule = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i lettre = _mm256_and_si256(_mm256_cmpgt_epi8(minuscule, _mm256_set1_epi8('a' - 1)),
+                                      _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), minuscule));
+    __m256i chiffre = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+                                       _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+    __m256i symbole = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('-')),
+                                                      _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\''))),
+                                      _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')));
+    __m256i fin = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('.')),
+                                                  _mm256_cmpeq_epi8(v, _mm256_set1_epi8('!'))),
+                                  _mm256_cmpeq_epi8(v, _mm256_set1_epi8('?')));
+    m->mot = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(lettre, chiffre), symbole));
+    m->espace = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+    m->saut = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+    m->retour = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')));
+    m->fin_phrase = (unsigned int)_mm256_movemask_epi8(fin);
+    m->non_ascii = (unsigned int)_mm256_movemask_epi8(v);
+}
+
+/**
+ * Traite un bloc d'octets ASCII déjà classés
+ * Les compteurs de caractères sont mis à jour en une fois. Les mots sont ensuite extraits à partir des bits
+ * de début et de fin de mot, puis le bloc est parcouru par segments séparés par les caractères particuliers
+ * ('\n', '\r', fins de phrase) pour les phrases et les paragraphes
+ *
+ * @param t Pointeur vers le tokeniseur
+ * @param p Début du bloc
+ * @param n Nombre d'octets du bloc à traiter (entre 1 et 32)
+ * @param m Masques de classification du bloc
+ * @param largeur Largeur du bloc lu (16 ou 32)
+ */
+__attribute__((always_inline))
+static inline void tokeniserBloc(Tokeniseur* t, const unsigned char* p, int n, const MasquesBloc* m, int largeur) {
+    // Bloc élargi en caractères, avec 16 caractères de marge pour les copies de mots sans boucle
+    wchar_t large[32 + 16];
+    for (int k = 0; k < largeur; k += 16) {
+        elargirBloc16(large + k, p + k);
+    }
+
+    unsigned int garde = masqueBas(n);
+    unsigned int mot = m->mot & garde;
+    unsigned int espace = m->espace & garde;
+    unsigned int invisibles = (m->saut | m->retour) & garde;
+    unsigned int particuliers = (m->saut | m->retour | m->fin_phrase) & garde;
+    unsigned int precedent = (mot << 1) | (unsigned int)t->en_mot; // Bit i : le caractère i - 1 est un caractère de mot
+    unsigned int debuts = mot & ~precedent;
+    unsigned int fins = ~mot & garde & precedent;
+
+    t->nb_espaces += __builtin_popcount(espace);
+    t->nb_caracteres += n - __builtin_popcount(invisibles);
+    t->nb_chars_sans_espaces += n - __builtin_popcount(invisibles | espace);
+    t->nb_mots_total += __builtin_popcount(debuts);
+
+    // Mots : le mot commencé dans le bloc précédent, puis chaque début de mot du bloc
+    int debut = 0;
+    unsigned int a_traiter = debuts;
+    if (!t->en_mot) {
+        debut = a_traiter ? __builtin_ctz(a_traiter) : n;
+    }
+    while (debut < n) {
+        unsigned int suivantes = fins & ~masqueBas(debut);
+        int fin = suivantes ? __builtin_ctz(suivantes) : n;
+        ajouterMotLarge(t, large + debut, fin - debut);
+        t->en_mot = 1;
+        if (fin < n) {
+            terminerMot(t);
+        }
+        a_traiter &= ~masqueBas(fin);
+        debut = a_traiter ? __builtin_ctz(a_traiter) : n;
+    }
+
+    // Phrases et paragraphes : segments ordinaires puis caractère particulier
+    int i = 0;
+    while (i < n) {
+        unsigned int speciaux = particuliers & ~masqueBas(i);
+        int s = speciaux ? __builtin_ctz(speciaux) : n;
+        if (s > i) {
+            unsigned int segment = masqueBas(s) & ~masqueBas(i);
+            t->mots_dans_phrase += __builtin_popcount(debuts & segment);
+            if (segment & ~mot) {
+                t->en_paragraphe = 0;
+            }
+            ajouterPhraseLarge(t, large + i, s - i);
+        }
+        if (s < n) {
+            traiterSeparateur(t, p[s]);
+        }
+        i = s + 1;
+    }
+}
+
+/**
+ * Traite les blocs ASCII consécutifs à la position courante de la source
+ * S'arrête avant le premier octet non ASCII ou quand il reste moins d'un bloc d'octets
+ *
+ * @param t Pointeur vers le tokeniseur
+ * @param source Source en cours de lecture
+ * @param largeur Largeur des blocs (16 ou 32), constante dans chaque version compilée
+ * @param classifier Fonction de classification correspondant à la largeur
+ */
+__attribute__((always_inline))
+static inline void avancerBlocs(Tokeniseur* t, SourceTexte* source, int largeur,
+                                void (*classifier)(const unsigned char*, MasquesBloc*)) {
+    while (source->fin - source->courant >= largeur && *source->courant < 0x80) {
+        MasquesBloc masques;
+        classifier(source->courant, &masques);
+        // Le bloc est coupé avant le premier octet non ASCII, décodé ensuite par le chemin scalaire
+        int n = masques.non_ascii ? __builtin_ctz(masques.non_ascii) : largeur;
+        tokeniserBloc(t, source->courant, n, &masques, largeur);
+        source->courant += n;
+        if (n < largeur) {
+            break;
+        }
+    }
+}
+
+// Version AVX2 : les comptages de bits utilisent aussi l'instruction popcnt
+__attribute__((target("avx2,popcnt,bmi")))
+static void avancerBlocsAvx2(Tokeniseur* t, SourceTexte* source) {
+    avancerBlocs(t, source, 32, classifierBloc32);
+}
+
+static void avancerBlocsSse2(Tokeniseur* t, SourceTexte* source) {
+    avancerBlocs(t, source, 16, classifierBloc16);
+}
+
+#endif
+
+/**
+ * Découpe le contenu d'une source jusqu'à sa fin ou jusqu'à la première séquence UTF-8 invalide
+ * Les blocs entièrement ASCII sont classés avec SIMD ; dès qu'un octet non ASCII est rencontré,
+ * le caractère est décodé et traité par le chemin scalaire Unicode
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur
+ * @param source Source ouverte
+ */
+static void lireSource(Tokeniseur* tokeniseur, SourceTexte* source) {
+    for (;;) {
+#ifdef TOKENISEUR_SIMD
+        if (tokeniseur->largeur_bloc == 32) {
+            avancerBlocsAvx2(tokeniseur, source);
+        } else if (tokeniseur->largeur_bloc == 16) {
+            avancerBlocsSse2(tokeniseur, source);
+        }
+#endif
+        wint_t c = lireCaractere(source);
+        if (c == WEOF) {
+            break;
+        }
+        tokeniserCaractere(tokeniseur, c);
+    }
+}
+
+/**
+ * Découpe une source par fenêtres de TAILLE_FENETRE_SUIVI octets, en publiant la progression
+ * et en s'arrêtant dès qu'une annulation est demandée
+ * Chaque fenêtre se termine devant un octet de tête UTF-8 : un caractère valide n'est jamais coupé,
+ * et une séquence invalide arrête la lecture au même endroit que sans fenêtre
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur (suivi non NULL)
+ * @param source Source ouverte
+ */
+static void lireSourceSuivie(Tokeniseur* tokeniseur, SourceTexte* source) {
+    SuiviLecture* suivi = tokeniseur->suivi;
+    while (!atomic_load_explicit(&suivi->annulation, memory_order_relaxed)) {
+        // En lecture par blocs, le tampon est complété avant de choisir la fenêtre
+        if (!source->fin_fichier && (size_t)(source->fin - source->courant) < TAILLE_FENETRE_SUIVI + 4) {
+            rechargerSource(source);
+        }
+        const unsigned char* debut = source->courant;
+        const unsigned char* fin = source->fin;
+        int fin_fichier = source->fin_fichier;
+        if (debut >= fin) {
+            break;
+        }
+
+        // Sans fin de fichier, les 3 derniers octets du tampon sont gardés : ils peuvent commencer un caractère incomplet
+        size_t taille = (size_t)(fin - debut);
+        if (!fin_fichier) {
+            taille = taille > 3 ? taille - 3 : 0;
+        }
+        if (taille > TAILLE_FENETRE_SUIVI) {
+            taille = TAILLE_FENETRE_SUIVI;
+        }
+        if (taille == 0) {
+            continue; // Lecture d'un nouveau bloc
+        }
+        const unsigned char* limite = debut + taille;
+        const unsigned char* coupure = limite;
+        while (coupure > debut && coupure < fin && (*coupure & 0xC0) == 0x80) {
+            coupure--;
+        }
+        if (coupure == debut) {
+            // Fenêtre plus courte qu'un caractère : la coupure est cherchée après la limite
+            // (en lecture par blocs, au moins 4 octets sont disponibles : un caractère valide y tient en entier)
+            coupure = limite;
+            while (coupure < fin && (*coupure & 0xC0) == 0x80) {
+                coupure++;
+            }
+        }
+
+        source->fin = coupure;
+        source->fin_fichier = 1;
+        lireSource(tokeniseur, source);
+        source->fin = fin;
+        source->fin_fichier = fin_fichier;
+        atomic_fetch_add_explicit(&suivi->octets_traites, (size_t)(source->courant - debut), memory_order_relaxed);
+        if (source->courant < coupure) {
+            break; // Séquence UTF-8 invalide
+        }
+    }
+}
+
+/**
+ * Découpe tout le contenu d'une source
+ * Avec un suivi, la progression est publiée régulièrement et la lecture peut être annulée
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur
+ * @param source Source ouverte, lue jusqu'à la fin ou jusqu'à la première séquence UTF-8 invalide
+ */
+void tokeniserSource(Tokeniseur* tokeniseur, SourceTexte* source) {
+    if (tokeniseur->suivi != NULL) {
+        lireSourceSuivie(tokeniseur, source);
+    } else {
+        lireSource(tokeniseur, source);
+    }
+}
+
+// Portion de la projection analysée par un thread
+typedef struct {
+    Tokeniseur* tokeniseur;
+    SourceTexte vue;            // Octets de la tranche (la vue ne possède ni projection ni tampon)
+    int interrompue;            // Séquence UTF-8 invalide rencontrée : la lecture s'arrête là, comme en série
+    int thread_lance;
+    pthread_t thread;
+} Tranche;
+
+// Fusion de deux contextes de mots exécutée dans un thread
+typedef struct {
+    const OperationsTranches* operations;
+    void* destination;
+    void* contexte;
+    int thread_lance;
+    pthread_t thread;
+} Fusion;
+
+static void* executerTranche(void* argument) {
+    Tranche* tranche = argument;
+    tokeniserSource(tranche->tokeniseur, &tranche->vue);
+    tranche->interrompue = tranche->vue.courant < tranche->vue.fin;
+    return NULL;
+}
+
+static void* fusionnerContextes(void* argument) {
+    Fusion* fusion = argument;
+    fusion->operations->fusionner_contexte(fusion->destination, fusion->contexte);
+    return NULL;
+}
+
+// Prolonge la phrase courante avec la suite trouvée au début ou à la fin d'une tranche
+static void prolongerPhrase(Tokeniseur* t, const Phrase* suite, long long mots) {
+    prolongerTextePhrase(&t->phrase_courante, suite->texte, suite->conserves, suite->longueur);
+    t->mots_dans_phrase += mots;
+}
+
+// Libère tous les tampons d'un tokeniseur (mot long et phrases)
+static void libererTampons(Tokeniseur* t) {
+    libererTamponMot(t);
+    libererPhrase(&t->phrase_courante);
+    libererPhrase(&t->prefixe_phrase);
+    libererPhrase(&t->phrase_plus_longue);
+    libererPhrase(&t->phrase_plus_courte);
+}
+
+/**
+ * Ajoute les résultats d'une tranche à ceux des tranches précédentes, dans l'ordre du texte
+ * La phrase à cheval sur la coupure est reconstituée et comptée avant les phrases internes de la tranche,
+ * ce qui donne les mêmes phrases extrêmes qu'une lecture en série
+ *
+ * @param t Tokeniseur principal (contient les tranches précédentes)
+ * @param tranche Tokeniseur de la tranche suivante
+ */
+static void raccorderTranche(Tokeniseur* t, const Tokeniseur* tranche) {
+    t->nb_espaces += tranche->nb_espaces;
+    t->nb_chars_sans_espaces += tranche->nb_chars_sans_espaces;
+    t->nb_caracteres += tranche->nb_caracteres;
+    t->nb_lignes += tranche->nb_lignes - 1;
+    t->nb_mots_total += tranche->nb_mots_total;
+    t->nb_phrases += tranche->nb_phrases;
+    t->nb_paragraphes += tranche->nb_paragraphes;
+    t->somme_mots_phrases += tranche->somme_mots_phrases;
+
+    if (tranche->prefixe_ferme) {
+        prolongerPhrase(t, &tranche->prefixe_phrase, tranche->prefixe_mots);
+        terminerPhrase(t);
+        if (tranche->phrase_plus_longue.longueur > t->phrase_plus_longue.longueur) {
+            copierPhrase(&t->phrase_plus_longue, &tranche->phrase_plus_longue);
+        }
+        if (tranche->phrase_plus_courte.longueur < t->phrase_plus_courte.longueur) {
+            copierPhrase(&t->phrase_plus_courte, &tranche->phrase_plus_courte);
+        }
+    }
+    // Sans fin de phrase, toute la tranche prolonge la phrase courante
+    prolongerPhrase(t, &tranche->phrase_courante, tranche->mots_dans_phrase);
+
+    t->en_paragraphe = tranche->en_paragraphe;
+    t->en_mot = tranche->en_mot;
+    t->pos_mot = 0;
+    if (reserverMot(t, tranche->pos_mot)) {
+        t->pos_mot = tranche->pos_mot;
+        wmemcpy(t->mot_courant, tranche->mot_courant, tranche->pos_mot);
+    }
+}
+
+// Source projetée coupée en tranches, chacune lue par son propre tokeniseur (voir decouperSource)
+struct DecoupageSource {
+    Tokeniseur* tokeniseur;                 // Tokeniseur principal (lit la première tranche)
+    SourceTexte* source;
+    const OperationsTranches* operations;
+    Tranche* tranches;
+    int nb;
+};
+
+/**
+ * Coupe une source projetée en mémoire en tranches à lire indépendamment, par exemple sur plusieurs threads
+ * Chaque coupure est placée juste après un espace ou un saut de ligne (donc entre deux caractères UTF-8 et hors
+ * d'un mot). La première tranche est lue par le tokeniseur principal, les suivantes par leur propre tokeniseur,
+ * avec leur propre contexte de mots. Une fois toutes les tranches lues (tokeniserTranche, dans n'importe quel ordre),
+ * assemblerTranches donne le même résultat que tokeniserSource.
+ *
+ * @param tokeniseur Tokeniseur principal, dont le contexte reçoit tous les mots
+ * @param source Source ouverte
+ * @param nb_tranches Nombre de tranches souhaité (réduit pour qu'une tranche fasse au moins TAILLE_TRANCHE_MIN octets)
+ * @param operations Création, fusion et libération des contextes de mots des tranches
+ * @return Découpage à lire puis assembler, ou NULL si la source doit être lue en série (lecture par blocs,
+ *         source trop petite ou mémoire insuffisante)
+ */
+DecoupageSource* decouperSource(Tokeniseur* tokeniseur, SourceTexte* source, int nb_tranches,
+                                const OperationsTranches* operations) {
+    size_t taille = (size_t)(source->fin - source->courant);
+    if ((size_t)nb_tranches > taille / TAILLE_TRANCHE_MIN) {
+        nb_tranches = (int)(taille / TAILLE_TRANCHE_MIN);
+    }
+    if (source->projection == NULL || nb_tranches < 2) {
+        return NULL;
+    }
+    DecoupageSource* decoupage = calloc(1, sizeof(DecoupageSource));
+    Tranche* tranches = calloc(nb_tranches, sizeof(Tranche));
+    if (decoupage == NULL || tranches == NULL) {
+        free(decoupage);
+        free(tranches);
+        return NULL;
+    }
+
+    // Découpage : chaque coupure est repoussée juste après un espace ou un saut de ligne
+    int nb = 0;
+    const unsigned char* debut = source->courant;
+    for (int k = 0; k < nb_tranches && debut < source->fin; k++) {
+        const unsigned char* fin = source->fin;
+        if (k < nb_tranches - 1) {
+            fin = source->courant + taille / nb_tranches * (k + 1);
+            if (fin <= debut) {
+                continue;
+            }
+            while (fin < source->fin && fin[-1] != ' ' && fin[-1] != '\n') {
+                fin++;
+            }
+        }
+        Tranche* tranche = &tranches[nb];
+        tranche->vue.courant = debut;
+        tranche->vue.fin = fin;
+        tranche->vue.fin_fichier = 1;
+        tranche->vue.descripteur = -1;
+        if (nb == 0) {
+            tranche->tokeniseur = tokeniseur;
+        } else {
+            tranche->tokeniseur = malloc(sizeof(Tokeniseur));
+            void* contexte = tranche->tokeniseur != NULL ? operations->creer_contexte(tokeniseur->contexte) : NULL;
+            if (contexte == NULL) {
+                free(tranche->tokeniseur);
+                tranche->tokeniseur = NULL;
+                break;
+            }
+            initialiserTokeniseur(tranche->tokeniseur, tokeniseur->traiter_mot, contexte);
+            tranche->tokeniseur->largeur_bloc = tokeniseur->largeur_bloc;
+            tranche->tokeniseur->suivi = tokeniseur->suivi;
+            tranche->tokeniseur->attente_debut_phrase = 1;
+            tranche->tokeniseur->en_paragraphe = debut[-1] == '\n';
+        }
+        nb++;
+        debut = fin;
+    }
+    if (debut < source->fin) {
+        // Allocation impossible d'un tokeniseur ou d'un contexte : la dernière tranche va jusqu'à la fin du fichier
+        tranches[nb - 1].vue.fin = source->fin;
+    }
+
+    decoupage->tokeniseur = tokeniseur;
+    decoupage->source = source;
+    decoupage->operations = operations;
+    decoupage->tranches = tranches;
+    decoupage->nb = nb;
+    return decoupage;
+}
+
+/**
+ * Retourne le nombre de tranches d'un découpage (les tranches sont numérotées à partir de 0)
+ *
+ * @param decoupage Découpage créé par decouperSource
+ * @return Nombre de tranches
+ */
+int nombreTranches(const DecoupageSource* decoupage) {
+    return decoupage->nb;
+}
+
+/**
+ * Lit une tranche d'un découpage ; les tranches peuvent être lues en même temps par des threads différents
+ *
+ * @param decoupage Découpage créé par decouperSource
+ * @param numero Numéro de la tranche (de 0 à nombreTranches - 1)
+ */
+void tokeniserTranche(DecoupageSource* decoupage, int numero) {
+    executerTranche(&decoupage->tranches[numero]);
+}
+
+/**
+ * Assemble les tranches lues, dans l'ordre du texte, puis libère le découpage
+ * La source est laissée là où une lecture en série se serait arrêtée
+ *
+ * @param decoupage Découpage dont toutes les tranches ont été lues
+ * @param nb_threads Nombre de threads utilisables pour fusionner les contextes de mots (1 : fusion en série)
+ */
+void assemblerTranches(DecoupageSource* decoupage, int nb_threads) {
+    Tokeniseur* tokeniseur = decoupage->tokeniseur;
+    const OperationsTranches* operations = decoupage->operations;
+    Tranche* tranches = decoupage->tranches;
+    int nb = decoupage->nb;
+
+    // Comme en série, la lecture s'arrête à la première séquence UTF-8 invalide
+    // (après une annulation, le résultat est abandonné : les tranches suivantes ne sont pas fusionnées)
+    int utilisees = nb;
+    if (tokeniseur->suivi != NULL && atomic_load(&tokeniseur->suivi->annulation)) {
+        utilisees = 1;
+    }
+    for (int k = 0; k < utilisees; k++) {
+        if (tranches[k].interrompue) {
+            utilisees = k + 1;
+            break;
+        }
+    }
+    for (int k = 1; k < utilisees; k++) {
+        raccorderTranche(tokeniseur, tranches[k].tokeniseur);
+    }
+    decoupage->source->courant = tranches[utilisees - 1].vue.courant;
+
+    // Fusion des contextes de mots en arbre : (0,1) (2,3)... puis (0,2) (4,6)... jusqu'au contexte principal
+    Fusion* fusions = nb_threads > 1 ? calloc(nb, sizeof(Fusion)) : NULL;
+    for (int pas = 1; pas < utilisees; pas *= 2) {
+        int nb_fusions = 0;
+        for (int i = 0; i + pas < utilisees; i += 2 * pas) {
+            void* destination = i == 0 ? tokeniseur->contexte : tranches[i].tokeniseur->contexte;
+            void* contexte = tranches[i + pas].tokeniseur->contexte;
+            if (fusions == NULL) {
+                operations->fusionner_contexte(destination, contexte);
+                continue;
+            }
+            Fusion* fusion = &fusions[nb_fusions++];
+            fusion->operations = operations;
+            fusion->destination = destination;
+            fusion->contexte = contexte;
+            fusion->thread_lance = pthread_create(&fusion->thread, NULL, fusionnerContextes, fusion) == 0;
+            if (!fusion->thread_lance) {
+                fusionnerContextes(fusion);
+            }
+        }
+        for (int i = 0; i < nb_fusions; i++) {
+            if (fusions[i].thread_lance) {
+                pthread_join(fusions[i].thread, NULL);
+            }
+        }
+    }
+    free(fusions);
+
+    for (int k = 1; k < nb; k++) {
+        if (k >= utilisees) {
+            operations->liberer_contexte(tranches[k].tokeniseur->contexte);
+        }
+        libererTampons(tranches[k].tokeniseur);
+        free(tranches[k].tokeniseur);
+    }
+    free(tranches);
+    free(decoupage);
+}
+
+/**
+ * Découpe une source projetée en mémoire avec plusieurs threads
+ * Le fichier est coupé en tranches (voir decouperSource), chaque tranche est lue par un thread, puis les tranches
+ * sont raccordées dans l'ordre et les contextes fusionnés deux à deux en parallèle.
+ * Le résultat est identique à celui de tokeniserSource. Une source lue par blocs, ou trop petite, est lue en série.
+ *
+ * @param tokeniseur Tokeniseur principal, dont le contexte reçoit tous les mots
+ * @param source Source ouverte
+ * @param nb_threads Nombre de threads à utiliser (0 pour un thread par processeur)
+ * @param operations Création, fusion et libération des contextes de mots des tranches
+ */
+void tokeniserSourceParallele(Tokeniseur* tokeniseur, SourceTexte* source, int nb_threads,
+                              const OperationsTranches* operations) {
+    if (nb_threads <= 0) {
+        long processeurs = sysconf(_SC_NPROCESSORS_ONLN);
+        nb_threads = processeurs > 0 ? (int)processeurs : 1;
+    }
+    DecoupageSource* decoupage = decouperSource(tokeniseur, source, nb_threads, operations);
+    if (decoupage == NULL) {
+        tokeniserSource(tokeniseur, source);
+        return;
+    }
+
+    Tranche* tranches = decoupage->tranches;
+    for (int k = 0; k < decoupage->nb; k++) {
+        tranches[k].thread_lance = pthread_create(&tranches[k].thread, NULL, executerTranche, &tranches[k]) == 0;
+        if (!tranches[k].thread_lance) {
+            executerTranche(&tranches[k]);
+        }
+    }
+    for (int k = 0; k < decoupage->nb; k++) {
+        if (tranches[k].thread_lance) {
+            pthread_join(tranches[k].thread, NULL);
+        }
+    }
+    assemblerTranches(decoupage, nb_threads);
+}
+
+/**
+ * Termine la lecture : transmet le dernier mot (et libère son tampon s'il était long), puis compte la dernière phrase
+ * si elle ne se termine pas par un point
+ * Seules les phrases extrêmes restent allouées : elles sont à détacher (detacherPhrase) ou à libérer
+ * avec libererTokeniseur
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur
+ * @param inclure_derniere_phrase Si non nul, la dernière phrase participe aussi aux phrases extrêmes
+ */
+void terminerTokeniseur(Tokeniseur* tokeniseur, int inclure_derniere_phrase) {
+    if (tokeniseur->en_mot) {
+        terminerMot(tokeniseur);
+    }
+    libererTamponMot(tokeniseur);
+    if (tokeniseur->mots_dans_phrase > 0) {
+        tokeniseur->nb_phrases++;
+        tokeniseur->somme_mots_phrases += tokeniseur->mots_dans_phrase;
+        if (inclure_derniere_phrase) {
+            mettreAJourExtremes(tokeniseur);
+        }
+    }
+    libererPhrase(&tokeniseur->phrase_courante);
+    libererPhrase(&tokeniseur->prefixe_phrase);
+}
+
+/**
+ * Libère les tampons du tokeniseur (mot long, phrases) sans transmettre le mot en cours : après terminerTokeniseur,
+ * ou pour abandonner une lecture
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur
+ */
+void libererTokeniseur(Tokeniseur* tokeniseur) {
+    libererTampons(tokeniseur);
+    tokeniseur->pos_mot = 0;
+    tokeniseur->en_mot = 0;
+}
+
+/**
+ * Retire le texte d'une phrase extrême du tokeniseur (phrase_plus_longue ou phrase_plus_courte), pour le garder
+ * après libererTokeniseur ; la longueur de la phrase reste dans le tokeniseur
+ *
+ * @param phrase Phrase extrême du tokeniseur
+ * @return Texte terminé par un zéro, à libérer avec free (NULL si aucune phrase n'a été retenue)
+ */
+wchar_t* detacherPhrase(Phrase* phrase) {
+    wchar_t* texte = phrase->texte;
+    phrase->texte = NULL;
+    phrase->conserves = 0;
+    phrase->capacite = 0;
+    return texte;
+}
+
+/**
+ * Relève l'état d'un tokeniseur arrêté à la fin des octets disponibles, avant terminerTokeniseur
+ * Les textes (mot inachevé, phrases extrêmes, phrase courante) restent dans le tokeniseur : ils sont à enregistrer
+ * avec l'état, dans l'ordre décrit par EtatTokeniseur
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur
+ * @param etat Reçoit les compteurs, les longueurs des phrases et des textes, et les indicateurs de lecture
+ */
+void sauvegarderTokeniseur(const Tokeniseur* tokeniseur, EtatTokeniseur* etat) {
+    const Tokeniseur* t = tokeniseur;
+    memset(etat, 0, sizeof(EtatTokeniseur));
+    etat->nb_espaces = t->nb_espaces;
+    etat->nb_chars_sans_espaces = t->nb_chars_sans_espaces;
+    etat->nb_lignes = t->nb_lignes;
+    etat->nb_caracteres = t->nb_caracteres;
+    etat->nb_mots_total = t->nb_mots_total;
+    etat->nb_phrases = t->nb_phrases;
+    etat->nb_paragraphes = t->nb_paragraphes;
+    etat->somme_mots_phrases = t->somme_mots_phrases;
+    etat->longueur_plus_longue = t->phrase_plus_longue.longueur;
+    etat->longueur_plus_courte = t->phrase_plus_courte.longueur;
+    etat->longueur_phrase = t->phrase_courante.longueur;
+    etat->conserves_plus_longue = t->phrase_plus_longue.conserves;
+    etat->conserves_plus_courte = t->phrase_plus_courte.conserves;
+    etat->conserves_phrase = t->phrase_courante.conserves;
+    etat->mots_dans_phrase = t->mots_dans_phrase;
+    etat->pos_mot = t->pos_mot;
+    etat->en_mot = t->en_mot;
+    etat->en_paragraphe = t->en_paragraphe;
+}
+
+/**
+ * Calcule le nombre de caractères des textes enregistrés avec un état (mot inachevé et phrases)
+ *
+ * @param etat État relevé par sauvegarderTokeniseur (éventuellement lu dans un fichier)
+ * @param nb_caracteres Reçoit le nombre de caractères
+ * @return 0 en cas de succès, -1 si les longueurs sont incohérentes
+ */
+int textesTokeniseur(const EtatTokeniseur* etat, size_t* nb_caracteres) {
+    if (etat->pos_mot < 0 || etat->pos_mot > INT_MAX / 4 ||
+        etat->conserves_plus_longue > LONGUEUR_PHRASE_CONSERVEE ||
+        etat->conserves_plus_courte > LONGUEUR_PHRASE_CONSERVEE ||
+        etat->conserves_phrase > LONGUEUR_PHRASE_CONSERVEE) {
+        return -1;
+    }
+    *nb_caracteres = (size_t)etat->pos_mot + etat->conserves_plus_longue + etat->conserves_plus_courte +
+                     etat->conserves_phrase;
+    return 0;
+}
+
+// Replace une phrase à partir de son texte enregistré (terminé par un zéro si terminer est non nul)
+static int restaurerPhrase(Phrase* phrase, const wchar_t* texte, size_t conserves, long long longueur,
+                           int terminer) {
+    phrase->longueur = longueur;
+    if (conserves == 0 && !terminer) {
+        return 0;
+    }
+    if (!reserverPhrase(phrase, conserves)) {
+        return -1;
+    }
+    wmemcpy(phrase->texte, texte, conserves);
+    phrase->texte[conserves] = L'\0';
+    phrase->conserves = conserves;
+    return 0;
+}
+
+/**
+ * Replace un tokeniseur (initialisé, sans lecture en cours) dans l'état relevé par sauvegarderTokeniseur
+ * L'état est vérifié avant d'être appliqué : il peut provenir d'un fichier
+ *
+ * @param tokeniseur Pointeur vers le tokeniseur
+ * @param etat État à restaurer
+ * @param textes Textes enregistrés avec l'état, bout à bout (voir textesTokeniseur)
+ * @return 0 en cas de succès, -1 si l'état est incohérent ou si la mémoire manque (le tokeniseur est alors inchangé)
+ */
+int restaurerTokeniseur(Tokeniseur* tokeniseur, const EtatTokeniseur* etat, const wchar_t* textes) {
+    Tokeniseur* t = tokeniseur;
+    size_t nb_caracteres;
+    if (textesTokeniseur(etat, &nb_caracteres) != 0 ||
+        (etat->en_mot != 0 && etat->en_mot != 1) || (!etat->en_mot && etat->pos_mot > 0) ||
+        etat->nb_lignes < 1 || etat->longueur_plus_longue < 0 || etat->longueur_plus_courte < 0 ||
+        etat->longueur_phrase < 0 || etat->mots_dans_phrase < 0 ||
+        etat->conserves_plus_longue > (uint64_t)etat->longueur_plus_longue ||
+        etat->conserves_plus_courte > (uint64_t)etat->longueur_plus_courte ||
+        etat->conserves_phrase > (uint64_t)etat->longueur_phrase) {
+        return -1;
+    }
+    const wchar_t* plus_longue = textes + etat->pos_mot;
+    const wchar_t* plus_courte = plus_longue + etat->conserves_plus_longue;
+    const wchar_t* phrase = plus_courte + etat->conserves_plus_courte;
+    t->pos_mot = 0;
+    if (!reserverMot(t, etat->pos_mot) ||
+        restaurerPhrase(&t->phrase_plus_longue, plus_longue, etat->conserves_plus_longue,
+                        etat->longueur_plus_longue, etat->longueur_plus_longue > 0) != 0 ||
+        restaurerPhrase(&t->phrase_plus_courte, plus_courte, etat->conserves_plus_courte,
+                        etat->longueur_plus_courte, etat->longueur_plus_courte != LLONG_MAX) != 0 ||
+        restaurerPhrase(&t->phrase_courante, phrase, etat->conserves_phrase, etat->longueur_phrase, 0) != 0) {
+        libererTampons(t);
+        t->phrase_plus_longue.longueur = 0;
+        t->phrase_plus_courte.longueur = LLONG_MAX;
+        t->phrase_courante.longueur = 0;
+        return -1;
+    }
+    wmemcpy(t->mot_courant, textes, etat->pos_mot);
+    t->pos_mot = etat->pos_mot;
+
+    t->nb_espaces = etat->nb_espaces;
+    t->nb_chars_sans_espaces = etat->nb_chars_sans_espaces;
+    t->nb_lignes = etat->nb_lignes;
+    t->nb_caracteres = etat->nb_caracteres;
+    t->nb_mots_total = etat->nb_mots_total;
+    t->nb_phrases = etat->nb_phrases;
+    t->nb_paragraphes = etat->nb_paragraphes;
+    t->somme_mots_phrases = etat->somme_mots_phrases;
+    t->en_mot = etat->en_mot;
+    t->mots_dans_phrase = etat->mots_dans_phrase;
+    t->en_paragraphe = etat->en_paragraphe;
+    return 0;
+}
@@ -0,0 +1,134 @@
+#ifndef TOKENISEUR_H
+#define TOKENISEUR_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#include "source_texte.h"
+
+#define LONGUEUR_MOT_MAX 50        // Taille du tampon de mot intégré au tokeniseur (agrandi sur le tas pour les mots plus longs)
+#define LONGUEUR_PHRASE_INITIALE 256 // Caractères alloués à la première extension d'un tampon de phrase
+#ifndef LONGUEUR_PHRASE_CONSERVEE
+#define LONGUEUR_PHRASE_CONSERVEE (1 << 16) // Caractères conservés d'une phrase (au-delà, seule sa longueur est comptée)
+#endif
+#ifndef TAILLE_TRANCHE_MIN
+#define TAILLE_TRANCHE_MIN (4 << 20) // Taille minimale (en octets) d'une tranche traitée par un thread
+#endif
+#ifndef TAILLE_FENETRE_SUIVI
+#define TAILLE_FENETRE_SUIVI (256 << 10) // Nombre d'octets lus entre deux mises à jour de la progression (lecture suivie)
+#endif
+
+// Fonction appelée pour chaque mot complet rencontré (le mot peut être modifié sur place)
+typedef void (*RappelMot)(void* contexte, wchar_t* mot);
+
+// Suivi d'une lecture depuis un autre thread : progression et demande d'annulation
+typedef struct {
+    atomic_size_t octets_traites;   // Octets déjà découpés, toutes tranches confondues
+    atomic_size_t octets_total;     // Taille du fichier (0 si inconnue)
+    atomic_int annulation;          // Mis à 1 par un autre thread pour interrompre la lecture
+} SuiviLecture;
+
+// Phrase dont la longueur est comptée exactement, et dont le début est conservé dans un tampon agrandi à la demande
+// (la mémoire d'une phrase dépend de sa longueur, dans la limite de LONGUEUR_PHRASE_CONSERVEE caractères)
+typedef struct {
+    wchar_t* texte;                 // Début de la phrase (NULL tant qu'aucun caractère n'est conservé)
+    size_t conserves;               // Nombre de caractères conservés dans texte
+    size_t capacite;
+    long long longueur;             // Longueur exacte de la phrase (nombre de caractères)
+} Phrase;
+
+// Structure contenant l'état du découpage d'un texte en mots, phrases et paragraphes
+typedef struct {
+    // Compteurs
+    long long nb_espaces;
+    long long nb_chars_sans_espaces;
+    long long nb_lignes;
+    long long nb_caracteres;
+    long long nb_mots_total;
+    long long nb_phrases;
+    long long nb_paragraphes;
+    double somme_mots_phrases;      // Somme des nombres de mots par phrase (pour la longueur moyenne)
+
+    // Phrases extrêmes (texte terminé par un zéro ; longueur LLONG_MAX pour la plus courte tant qu'aucune n'est lue)
+    Phrase phrase_plus_longue;
+    Phrase phrase_plus_courte;
+
+    // État courant de la lecture
+    wchar_t* mot_courant;           // Mot en cours de lecture (mot_initial, ou tampon alloué pour un mot plus long)
+    int capacite_mot;
+    wchar_t mot_initial[LONGUEUR_MOT_MAX];
+    Phrase phrase_courante;         // Texte non terminé par un zéro pendant la lecture
+    int pos_mot;
+    int en_mot;
+    long long mots_dans_phrase;
+    int en_paragraphe;
+
+    // Raccord entre tranches (analyse parallèle) : début de la première phrase d'une tranche
+    int attente_debut_phrase;       // La phrase en cours a commencé dans la tranche précédente
+    int prefixe_ferme;              // Une fin de phrase a été rencontrée dans la tranche
+    long long prefixe_mots;         // Nombre de mots avant cette première fin de phrase
+    Phrase prefixe_phrase;          // Caractères avant cette première fin de phrase
+
+    RappelMot traiter_mot;          // Reçoit chaque mot terminé
+    void* contexte;                 // Contexte passé à traiter_mot
+    SuiviLecture* suivi;            // Progression et annulation (NULL : lecture sans suivi)
+    int largeur_bloc;               // Nombre d'octets classés à la fois (32 avec AVX2, 16 avec SSE2, 0 sans SIMD)
+} Tokeniseur;
+
+// Copie de l'état d'un tokeniseur arrêté en fin de lecture (avant terminerTokeniseur), pour reprendre
+// la lecture plus tard sur la suite du même texte
+// Les textes sont copiés à part, bout à bout (voir textesTokeniseur) : le mot inachevé (pos_mot caractères),
+// puis les caractères conservés de la phrase la plus longue, de la plus courte et de la phrase courante
+typedef struct {
+    long long nb_espaces;
+    long long nb_chars_sans_espaces;
+    long long nb_lignes;
+    long long nb_caracteres;
+    long long nb_mots_total;
+    long long nb_phrases;
+    long long nb_paragraphes;
+    double somme_mots_phrases;
+    long long longueur_plus_longue;
+    long long longueur_plus_courte;
+    long long longueur_phrase;
+    uint64_t conserves_plus_longue;
+    uint64_t conserves_plus_courte;
+    uint64_t conserves_phrase;
+    long long mots_dans_phrase;
+    int pos_mot;
+    int en_mot;
+    int en_paragraphe;
+} EtatTokeniseur;
+
+int estCaractereMot(wchar_t c);
+// Opérations permettant de répartir les mots d'un texte entre plusieurs threads
+// (creer_contexte retourne NULL si la mémoire manque : la tranche précédente lit alors la suite du texte)
+typedef struct {
+    void* (*creer_contexte)(void* contexte_principal);                 // Crée le contexte recevant les mots d'une tranche
+    void (*fusionner_contexte)(void* destination, void* contexte);     // Fusionne un contexte dans un autre, puis libère le premier
+    void (*liberer_contexte)(void* contexte);                          // Libère un contexte sans le fusionner
+} OperationsTranches;
+
+// Source coupée en tranches lues indépendamment (voir decouperSource)
+typedef struct DecoupageSource DecoupageSource;
+
+void initialiserTokeniseur(Tokeniseur* tokeniseur, RappelMot traiter_mot, void* contexte);
+void tokeniserCaractere(Tokeniseur* tokeniseur, wint_t c);
+void tokeniserSource(Tokeniseur* tokeniseur, SourceTexte* source);
+void tokeniserSourceParallele(Tokeniseur* tokeniseur, SourceTexte* source, int nb_threads,
+                              const OperationsTranches* operations);
+DecoupageSource* decouperSource(Tokeniseur* tokeniseur, SourceTexte* source, int nb_tranches,
+                                const OperationsTranches* operations);
+int nombreTranches(const DecoupageSource* decoupage);
+void tokeniserTranche(DecoupageSource* decoupage, int numero);
+void assemblerTranches(DecoupageSource* decoupage, int nb_threads);
+void terminerTokeniseur(Tokeniseur* tokeniseur, int inclure_derniere_phrase);
+void libererTokeniseur(Tokeniseur* tokeniseur);
+wchar_t* detacherPhrase(Phrase* phrase);
+void sauvegarderTokeniseur(const Tokeniseur* tokeniseur, EtatTokeniseur* etat);
+int textesTokeniseur(const EtatTokeniseur* etat, size_t* nb_caracteres);
+int restaurerTokeniseur(Tokeniseur* tokeniseur, const EtatTokeniseur* etat, const wchar_t* textes);
+
+#endif